@@ -451,6 +451,7 @@ namespace ashes
 	using VkDescriptorSetArray = std::vector< VkDescriptorSet >;
 	using VkDescriptorSetLayoutArray = std::vector< VkDescriptorSetLayout >;
 	using VkDescriptorSetLayoutBindingArray = std::vector< VkDescriptorSetLayoutBinding >;
+	using VkDescriptorUpdateTemplateEntryArray = std::vector< VkDescriptorUpdateTemplateEntry >;
 	using VkDeviceQueueCreateInfoArray = std::vector< VkDeviceQueueCreateInfo >;
 	using VkDeviceSizeArray = std::vector< VkDeviceSize >;
 	using VkDynamicStateArray = std::vector< VkDynamicState >;
@@ -4,8 +4,9 @@ See LICENSE file in root folder
 #ifndef ___Ashes_common_BuddyAllocator_HPP___
 #define ___Ashes_common_BuddyAllocator_HPP___
 
+#include <cstddef>
 #include <cstdint>
-#include <list>
+#include <unordered_map>
 #include <vector>
 
 namespace ashes
@@ -52,24 +53,78 @@ namespace ashes
 		 *	The memory chunk.
 		 */
 		void deallocate( PointerType pointer );
+		/**
+		 *\param[in] pointer
+		 *	The memory chunk.
+		 *\return
+		 *	The size of the block holding the memory chunk, 0 if it isn't allocated.
+		 */
+		size_t getAllocationSize( PointerType pointer )const;
 
 	private:
 		uint32_t doGetLevel( size_t size )const;
 		size_t doGetLevelSize( uint32_t level )const;
 		Block doAllocate( uint32_t order );
-		void doMergeLevel( Block const & block
-			, uint32_t index
+		void doMergeLevel( size_t index
 			, uint32_t level );
 
 	private:
-		using FreeList = std::list< Block >;
-		using PointerLevel = std::pair< size_t, uint32_t >;
+		/**
+		*\brief
+		*	The free blocks of a level, by index in that level.
+		*\remarks
+		*	The indices are stored in a vector, to pick any of them in O(1),
+		*	and their position in this vector is stored in a map, to remove a given one in O(1).
+		*/
+		struct FreeList
+		{
+			bool empty()const noexcept
+			{
+				return blocks.empty();
+			}
+
+			void push( size_t index )
+			{
+				positions.emplace( index, blocks.size() );
+				blocks.push_back( index );
+			}
+
+			size_t pop()
+			{
+				auto index = blocks.back();
+				blocks.pop_back();
+				positions.erase( index );
+				return index;
+			}
+
+			bool remove( size_t index )
+			{
+				auto it = positions.find( index );
+
+				if ( it == positions.end() )
+				{
+					return false;
+				}
+
+				auto last = blocks.back();
+				blocks[it->second] = last;
+				positions[last] = it->second;
+				blocks.pop_back();
+				positions.erase( index );
+				return true;
+			}
+
+			std::vector< size_t > blocks;
+			std::unordered_map< size_t, size_t > positions;
+		};
 
 	private:
 		uint32_t m_numLevels{};
 		uint32_t m_minBlockSize{};
+		size_t m_allocatedSize{};
 		std::vector< FreeList > m_freeLists;
-		std::vector< PointerLevel > m_allocated;
+		// The level of each allocated block, by offset.
+		std::unordered_map< size_t, uint32_t > m_allocated;
 	};
 }
 
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cassert>
 
 namespace ashes
@@ -11,7 +12,7 @@ namespace ashes
 	{
 		assert( numLevels + minBlockSize < 64u );
 		m_freeLists.resize( m_numLevels + 1 );
-		m_freeLists[0u].push_back( Block{ this->getPointer( 0u ) } );
+		m_freeLists[0u].push( 0u );
 	}
 
 	template< typename TraitsT >
@@ -22,14 +23,7 @@ namespace ashes
 	template< typename TraitsT >
 	inline size_t BuddyAllocatorT< TraitsT >::getAvailable()const noexcept
 	{
-		size_t result{};
-
-		for ( auto const & allocation : m_allocated )
-		{
-			result += doGetLevelSize( allocation.second );
-		}
-
-		return result;
+		return this->getSize() - m_allocatedSize;
 	}
 
 	template< typename TraitsT >
@@ -61,9 +55,15 @@ namespace ashes
 		if ( size <= this->getSize() )
 		{
 			auto level = doGetLevel( size );
-			result = doAllocate( level ).data;
-			m_allocated.emplace_back( this->getOffset( result ), level );
-			TraitsT::registerAllocation( result, size, doGetLevelSize( level ) );
+			auto block = doAllocate( level );
+			result = block.data;
+
+			if ( !this->isNull( result ) )
+			{
+				m_allocated.emplace( this->getOffset( result ), level );
+				m_allocatedSize += doGetLevelSize( level );
+				TraitsT::registerAllocation( result, size, doGetLevelSize( level ) );
+			}
 		}
 
 		return result;
@@ -73,25 +73,29 @@ namespace ashes
 	inline void BuddyAllocatorT< TraitsT >::deallocate( typename BuddyAllocatorT< TraitsT >::PointerType pointer )
 	{
 		auto offset = this->getOffset( pointer );
-		auto it = std::find_if( m_allocated.begin()
-			, m_allocated.end()
-			, [offset]( PointerLevel const & ptrLevel )
-			{
-				return ptrLevel.first == offset;
-			} );
+		auto it = m_allocated.find( offset );
 		assert( it != m_allocated.end() );
 
 		if ( it != m_allocated.end() )
 		{
 			auto level = it->second;
-			auto index = uint32_t( offset / doGetLevelSize( level ) );
-			Block block{ pointer };
+			auto index = size_t( offset / doGetLevelSize( level ) );
 			TraitsT::registerDeallocation( pointer, doGetLevelSize( level ) );
+			m_allocatedSize -= doGetLevelSize( level );
 			m_allocated.erase( it );
-			doMergeLevel( block, index, level );
+			doMergeLevel( index, level );
 		}
 	}
 
+	template< typename TraitsT >
+	inline size_t BuddyAllocatorT< TraitsT >::getAllocationSize( typename BuddyAllocatorT< TraitsT >::PointerType pointer )const
+	{
+		auto it = m_allocated.find( this->getOffset( pointer ) );
+		return it == m_allocated.end()
+			? 0u
+			: doGetLevelSize( it->second );
+	}
+
 	template< typename TraitsT >
 	inline uint32_t BuddyAllocatorT< TraitsT >::doGetLevel( size_t size )const
 	{
@@ -137,63 +141,31 @@ namespace ashes
 				return buddy;
 			}
 
-			freeList.push_back( Block{ PointerType( buddy.data ) } );
-			freeList.push_back( Block{ PointerType( buddy.data + doGetLevelSize( level ) ) } );
+			// Keep the RHS half free, and use the LHS one.
+			auto index = size_t( this->getOffset( buddy.data ) / doGetLevelSize( level ) );
+			freeList.push( index + 1u );
+			return buddy;
 		}
 
-		auto buddy = freeList.front();
-		freeList.erase( freeList.begin() );
-		return buddy;
+		return Block{ this->getPointer( freeList.pop() * doGetLevelSize( level ) ) };
 	}
 
 	template< typename TraitsT >
-	inline void BuddyAllocatorT< TraitsT >::doMergeLevel( typename BuddyAllocatorT< TraitsT >::Block const & block
-		, uint32_t pindex
+	inline void BuddyAllocatorT< TraitsT >::doMergeLevel( size_t index
 		, uint32_t level )
 	{
 		auto & freeList = m_freeLists[level];
-		Block lhs{};
-		Block rhs{};
-		typename FreeList::iterator it;
-
-		if ( pindex % 2u )
-		{
-			// RHS block => find LHS in free blocks of same level.
-			lhs.data = PointerType( block.data - doGetLevelSize( level ) );
-			it = std::find_if( freeList.begin()
-				, freeList.end()
-				, [lhs]( Block const & lookUp )
-			{
-				return lookUp.data == lhs.data;
-			} );
-			rhs = block;
-		}
-		else
-		{
-			// LHS block => find RHS in free blocks of same level.
-			lhs = block;
-			rhs.data = PointerType( block.data + doGetLevelSize( level ) );
-			it = std::find_if( freeList.begin()
-				, freeList.end()
-				, [rhs]( Block const & lookUp )
-			{
-				return lookUp.data == rhs.data;
-			} );
-		}
 
-		if ( it != freeList.end() )
+		// The buddy of a block is the other half of their parent block, at index ^ 1.
+		if ( level > 0u
+			&& freeList.remove( index ^ 1u ) )
 		{
-			// remove the other block from the list.
-			freeList.erase( it );
-			// add lhs to lower level list.
-			auto offset = this->getOffset( lhs.data );
-			auto index = uint32_t( offset / doGetLevelSize( level - 1u ) );
-			// merge lower level.
-			doMergeLevel( lhs, index, level - 1u );
+			// Both halves are free => merge them in the lower level.
+			doMergeLevel( index / 2u, level - 1u );
 		}
 		else
 		{
-			freeList.push_back( block );
+			freeList.push( index );
 		}
 	}
 }
@@ -10,7 +10,10 @@ See LICENSE file in root folder.
 
 #include <vulkan/vulkan.h>
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
+#include <mutex>
 
 #if ANDROID
 #	define AAPCS_VFP_ATTRIBUTE __attribute__( ( pcs( "aapcs-vfp" ) ) )
@@ -183,24 +186,54 @@ namespace ashes
 
 	private:
 		void * allocate( size_t size
-			, size_t /*alignment*/
+			, size_t alignment
 			, VkSystemAllocationScope )override
 		{
-			return reinterpret_cast< void * >( m_allocator.allocate( size ) );
+			// Buddy blocks are aligned on their size, relative to the allocator's memory.
+			std::lock_guard< std::mutex > lock{ m_mutex };
+			return reinterpret_cast< void * >( m_allocator.allocate( std::max( size, alignment ) ) );
 		}
 
 		void * reallocate( void * pOriginal
 			, size_t size
-			, size_t /*alignment*/
+			, size_t alignment
 			, VkSystemAllocationScope )override
 		{
-			m_allocator.deallocate( reinterpret_cast< uint8_t * >( pOriginal ) );
-			return reinterpret_cast< void * >( m_allocator.allocate( size ) );
+			std::lock_guard< std::mutex > lock{ m_mutex };
+
+			if ( !pOriginal )
+			{
+				return reinterpret_cast< void * >( m_allocator.allocate( std::max( size, alignment ) ) );
+			}
+
+			auto original = reinterpret_cast< uint8_t * >( pOriginal );
+
+			if ( !size )
+			{
+				m_allocator.deallocate( original );
+				return nullptr;
+			}
+
+			auto result = reinterpret_cast< void * >( m_allocator.allocate( std::max( size, alignment ) ) );
+
+			if ( result )
+			{
+				std::memcpy( result
+					, pOriginal
+					, std::min( size, m_allocator.getAllocationSize( original ) ) );
+				m_allocator.deallocate( original );
+			}
+
+			return result;
 		}
 
 		void deallocate( void * pMemory )override
 		{
-			m_allocator.deallocate( reinterpret_cast< uint8_t * >( pMemory ) );
+			if ( pMemory )
+			{
+				std::lock_guard< std::mutex > lock{ m_mutex };
+				m_allocator.deallocate( reinterpret_cast< uint8_t * >( pMemory ) );
+			}
 		}
 
 		void onInternalAllocation( size_t
@@ -216,6 +249,7 @@ namespace ashes
 		}
 
 	private:
+		std::mutex m_mutex;
 		BuddyAllocatorT< TraitsT > m_allocator{ LevelCount, MinBlockSize };
 	};
 
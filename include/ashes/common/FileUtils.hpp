@@ -77,6 +77,15 @@ namespace ashes
 	std::string getExecutableDirectory();
 	/**
 	*\brief
+	*	Retrieves the path of the executable or shared library containing the given address.
+	*\param[in] address
+	*	An address in the module, usually one of its functions.
+	*\return
+	*	The module path, empty if not found.
+	*/
+	std::string getModulePath( void const * address );
+	/**
+	*\brief
 	*	Retrieves the given path's parent folder.
 	*\param[in] path
 	*	The path.
@@ -93,6 +102,22 @@ namespace ashes
 	*	The file name.
 	*/
 	std::string getFileName( std::string const & path );
+	/**
+	*\brief
+	*	Retrieves Ashes' folder in the user cache directory, and creates it if needed.
+	*\return
+	*	The folder, empty if there is no user cache directory.
+	*/
+	std::string getCacheDirectory();
+	/**
+	*\brief
+	*	Retrieves a stamp that changes when the given file is modified.
+	*\param[in] path
+	*	The file path.
+	*\return
+	*	The file's last write time and size, empty if the file doesn't exist.
+	*/
+	std::string getFileStamp( std::string const & path );
 }
 /**
 *\brief
@@ -0,0 +1,258 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#ifndef ___Ashes_common_HandleRegistry_HPP___
+#define ___Ashes_common_HandleRegistry_HPP___
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+
+namespace ashes
+{
+	/**
+	*\brief
+	*	A lock free registry of the live handles, with a record per handle.
+	*\remarks
+	*	The handles are spread over shards, each being a chain of open addressing tables of atomic keys.
+	*	A new, bigger, table is chained when the probe window of a handle is full in all the shard's tables.
+	*	An unregistered handle leaves a tombstone, which is reused by later registrations.
+	*	A record is written by the thread registering its handle, and read by the one unregistering it,
+	*	which are already ordered by the handle's ownership.
+	*	The tables are only released with the registry.
+	*/
+	template< typename RecordT >
+	class HandleRegistry
+	{
+	public:
+		static constexpr uint32_t ShardCount = 64u;
+		static constexpr size_t InitialCapacity = 64u;
+		static constexpr size_t MaxProbe = 16u;
+		static_assert( ShardCount == 64u, "The shard is selected from the 6 top bits of a handle's hash" );
+
+	public:
+		HandleRegistry( HandleRegistry const & ) = delete;
+		HandleRegistry( HandleRegistry && ) = delete;
+		HandleRegistry & operator=( HandleRegistry const & ) = delete;
+		HandleRegistry & operator=( HandleRegistry && ) = delete;
+
+		HandleRegistry() = default;
+
+		~HandleRegistry()noexcept
+		{
+			for ( auto & shard : m_shards )
+			{
+				auto table = shard.load( std::memory_order_acquire );
+
+				while ( table )
+				{
+					auto next = table->next;
+					delete table;
+					table = next;
+				}
+			}
+		}
+		/**
+		*\brief
+		*	Registers \p handle, with its \p record.
+		*\return
+		*	\p false if \p handle is already registered.
+		*/
+		bool insert( uint64_t handle
+			, RecordT record )
+		{
+			assert( handle != Empty && handle != Tombstone );
+			auto hash = doHash( handle );
+			auto & shard = m_shards[hash >> 58u];
+			auto head = shard.load( std::memory_order_acquire );
+
+			if ( doFind( head, hash, handle ) )
+			{
+				return false;
+			}
+
+			while ( true )
+			{
+				for ( auto table = head; table; table = table->next )
+				{
+					if ( auto slot = doClaim( *table, hash, handle ) )
+					{
+						slot->record = std::move( record );
+						return true;
+					}
+				}
+
+				auto table = new Table{ head ? head->capacity * 2u : InitialCapacity, head };
+
+				if ( !shard.compare_exchange_strong( head
+					, table
+					, std::memory_order_acq_rel
+					, std::memory_order_acquire ) )
+				{
+					// Another thread chained a table first, head now points to it.
+					table->next = nullptr;
+					delete table;
+				}
+				else
+				{
+					head = table;
+				}
+			}
+		}
+		/**
+		*\brief
+		*	Unregisters \p handle.
+		*\param[out] record
+		*	Receives \p handle's record, if not null.
+		*\return
+		*	\p false if \p handle isn't registered.
+		*/
+		bool erase( uint64_t handle
+			, RecordT * record = nullptr )
+		{
+			auto hash = doHash( handle );
+			auto slot = doFind( m_shards[hash >> 58u].load( std::memory_order_acquire )
+				, hash
+				, handle );
+
+			if ( !slot )
+			{
+				return false;
+			}
+
+			RecordT removed{ std::move( slot->record ) };
+			slot->record = RecordT{};
+			slot->key.store( Tombstone, std::memory_order_release );
+
+			if ( record )
+			{
+				*record = std::move( removed );
+			}
+
+			return true;
+		}
+		/**
+		*\brief
+		*	Calls \p func with each registered handle and its record.
+		*\remarks
+		*	Not to be called while handles are registered or unregistered.
+		*/
+		template< typename FuncT >
+		void forEach( FuncT func )const
+		{
+			for ( auto & shard : m_shards )
+			{
+				for ( auto table = shard.load( std::memory_order_acquire ); table; table = table->next )
+				{
+					for ( size_t i = 0u; i < table->capacity; ++i )
+					{
+						auto & slot = table->slots[i];
+						auto key = slot.key.load( std::memory_order_acquire );
+
+						if ( key != Empty && key != Tombstone )
+						{
+							func( key, slot.record );
+						}
+					}
+				}
+			}
+		}
+
+	private:
+		static constexpr uint64_t Empty = 0u;
+		static constexpr uint64_t Tombstone = ~uint64_t( 0u );
+
+		struct Slot
+		{
+			std::atomic< uint64_t > key{ Empty };
+			RecordT record{};
+		};
+
+		struct Table
+		{
+			Table( size_t pcapacity
+				, Table * pnext )
+				: capacity{ pcapacity }
+				, slots{ std::make_unique< Slot[] >( pcapacity ) }
+				, next{ pnext }
+			{
+			}
+
+			size_t capacity;
+			std::unique_ptr< Slot[] > slots;
+			//! The previous, smaller, table.
+			Table * next;
+		};
+
+		static uint64_t doHash( uint64_t handle )noexcept
+		{
+			// Handles are mostly aligned pointers, mix their bits so that both ends are usable.
+			handle ^= handle >> 33u;
+			handle *= 0xFF51AFD7ED558CCDULL;
+			handle ^= handle >> 33u;
+			handle *= 0xC4CEB9FE1A85EC53ULL;
+			handle ^= handle >> 33u;
+			return handle;
+		}
+
+		static Slot * doFind( Table * table
+			, uint64_t hash
+			, uint64_t handle )noexcept
+		{
+			for ( ; table; table = table->next )
+			{
+				for ( size_t i = 0u; i < MaxProbe; ++i )
+				{
+					auto & slot = table->slots[( hash + i ) & ( table->capacity - 1u )];
+					auto key = slot.key.load( std::memory_order_acquire );
+
+					if ( key == handle )
+					{
+						return &slot;
+					}
+
+					// A handle is claimed in the first free slot of its window, and a slot never gets empty again.
+					if ( key == Empty )
+					{
+						break;
+					}
+				}
+			}
+
+			return nullptr;
+		}
+
+		static Slot * doClaim( Table & table
+			, uint64_t hash
+			, uint64_t handle )noexcept
+		{
+			for ( size_t i = 0u; i < MaxProbe; ++i )
+			{
+				auto & slot = table.slots[( hash + i ) & ( table.capacity - 1u )];
+				auto key = slot.key.load( std::memory_order_relaxed );
+
+				while ( key == Empty || key == Tombstone )
+				{
+					if ( slot.key.compare_exchange_weak( key
+						, handle
+						, std::memory_order_acquire
+						, std::memory_order_relaxed ) )
+					{
+						return &slot;
+					}
+				}
+			}
+
+			return nullptr;
+		}
+
+	private:
+		std::array< std::atomic< Table * >, ShardCount > m_shards{};
+	};
+}
+
+#endif
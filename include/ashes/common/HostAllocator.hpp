@@ -0,0 +1,395 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#ifndef ___Ashes_common_HostAllocator_HPP___
+#define ___Ashes_common_HostAllocator_HPP___
+#pragma once
+
+#include "DeviceAllocator.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ashes
+{
+	/**
+	*\brief
+	*	A thread safe host allocator, to be given as VkAllocationCallbacks.
+	*\remarks
+	*	Small allocations (up to MaxPooledSize bytes, and alignment up to HeaderSize)
+	*	come from size class pools, command scope ones from a linear arena that is
+	*	recycled as a whole once all its allocations are freed.
+	*	The pools and arenas are sharded by thread, to limit lock contention.
+	*	Bigger allocations go through std::malloc.
+	*/
+	class HostAllocator
+		: public DeviceAllocatorBase
+	{
+	public:
+		static constexpr size_t HeaderSize = 16u;
+		static constexpr size_t MaxPooledSize = 1024u;
+		static constexpr size_t ChunkSize = 64u * 1024u;
+		static constexpr size_t ArenaSize = 64u * 1024u;
+		static constexpr uint32_t ShardCount = 16u;
+		static constexpr uint32_t ScopeCount = uint32_t( VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE ) + 1u;
+
+		/**
+		*\brief
+		*	A snapshot of the allocator statistics.
+		*/
+		struct Statistics
+		{
+			//! The live allocations count, per VkSystemAllocationScope.
+			std::array< size_t, ScopeCount > allocationCount{};
+			//! The live allocated bytes, per VkSystemAllocationScope.
+			std::array< size_t, ScopeCount > allocatedSize{};
+			//! The live bytes reported through onInternalAllocation/onInternalFree.
+			size_t internalSize{};
+			//! The count of command arenas recycled.
+			size_t arenaRecycles{};
+		};
+
+	private:
+		enum class Origin : uint8_t
+		{
+			eHeap,
+			ePool,
+			eArena,
+		};
+
+		struct Header
+		{
+			size_t size;
+			uint32_t offset;
+			Origin origin;
+			uint8_t sizeClass;
+			uint8_t shard;
+			uint8_t scope;
+		};
+		static_assert( sizeof( Header ) <= HeaderSize );
+
+		static constexpr size_t SizeClassCount = 7u;
+
+		struct Pool
+		{
+			std::array< void *, SizeClassCount > freeLists{};
+			std::vector< void * > chunks;
+			uint8_t * arena{};
+			size_t arenaOffset{};
+			size_t arenaLive{};
+			std::mutex mutex;
+		};
+
+	public:
+		HostAllocator() = default;
+
+		~HostAllocator()noexcept override
+		{
+			for ( auto & pool : m_pools )
+			{
+				for ( auto chunk : pool.chunks )
+				{
+					std::free( chunk );
+				}
+
+				std::free( pool.arena );
+			}
+		}
+
+		Statistics getStatistics()const noexcept
+		{
+			Statistics result;
+
+			for ( uint32_t i = 0u; i < ScopeCount; ++i )
+			{
+				result.allocationCount[i] = m_allocationCount[i];
+				result.allocatedSize[i] = m_allocatedSize[i];
+			}
+
+			result.internalSize = m_internalSize;
+			result.arenaRecycles = m_arenaRecycles;
+			return result;
+		}
+
+	private:
+		void * allocate( size_t size
+			, size_t alignment
+			, VkSystemAllocationScope allocationScope )override
+		{
+			if ( !size )
+			{
+				return nullptr;
+			}
+
+			alignment = std::max( alignment, size_t( 1u ) );
+			void * result{};
+
+			if ( allocationScope == VK_SYSTEM_ALLOCATION_SCOPE_COMMAND )
+			{
+				result = doAllocateArena( size, alignment );
+			}
+
+			if ( !result
+				&& size <= MaxPooledSize
+				&& alignment <= HeaderSize )
+			{
+				result = doAllocatePool( size );
+			}
+
+			if ( !result )
+			{
+				result = doAllocateHeap( size, alignment );
+			}
+
+			if ( result )
+			{
+				auto & header = getHeader( result );
+				header.size = size;
+				header.scope = uint8_t( allocationScope );
+				++m_allocationCount[allocationScope];
+				m_allocatedSize[allocationScope] += size;
+			}
+
+			return result;
+		}
+
+		void * reallocate( void * pOriginal
+			, size_t size
+			, size_t alignment
+			, VkSystemAllocationScope allocationScope )override
+		{
+			if ( !pOriginal )
+			{
+				return allocate( size, alignment, allocationScope );
+			}
+
+			if ( !size )
+			{
+				deallocate( pOriginal );
+				return nullptr;
+			}
+
+			auto result = allocate( size, alignment, allocationScope );
+
+			if ( result )
+			{
+				std::memcpy( result
+					, pOriginal
+					, std::min( size, getHeader( pOriginal ).size ) );
+				deallocate( pOriginal );
+			}
+
+			return result;
+		}
+
+		void deallocate( void * pMemory )override
+		{
+			if ( !pMemory )
+			{
+				return;
+			}
+
+			auto & header = getHeader( pMemory );
+			--m_allocationCount[header.scope];
+			m_allocatedSize[header.scope] -= header.size;
+
+			switch ( header.origin )
+			{
+			case Origin::ePool:
+				doDeallocatePool( pMemory, header );
+				break;
+			case Origin::eArena:
+				doDeallocateArena( header );
+				break;
+			default:
+				std::free( static_cast< uint8_t * >( pMemory ) - header.offset );
+				break;
+			}
+		}
+
+		void onInternalAllocation( size_t size
+			, VkInternalAllocationType
+			, VkSystemAllocationScope )override
+		{
+			m_internalSize += size;
+		}
+
+		void onInternalFree( size_t size
+			, VkInternalAllocationType
+			, VkSystemAllocationScope )override
+		{
+			m_internalSize -= size;
+		}
+
+	private:
+		static Header & getHeader( void * pMemory )
+		{
+			return *reinterpret_cast< Header * >( static_cast< uint8_t * >( pMemory ) - HeaderSize );
+		}
+
+		static uint8_t * alignUp( uint8_t * pointer
+			, size_t alignment )
+		{
+			auto value = reinterpret_cast< uintptr_t >( pointer );
+			auto aligned = ( value + alignment - 1u ) / alignment * alignment;
+			return pointer + ( aligned - value );
+		}
+
+		static size_t getSizeClass( size_t size )
+		{
+			// 16, 32, 64, ... MaxPooledSize.
+			size_t result = 0u;
+
+			while ( ( size_t( 16u ) << result ) < size )
+			{
+				++result;
+			}
+
+			return result;
+		}
+
+		static uint8_t getShardIndex()
+		{
+			static thread_local uint8_t const result = uint8_t( std::hash< std::thread::id >{}( std::this_thread::get_id() ) % ShardCount );
+			return result;
+		}
+
+		void * doAllocateHeap( size_t size
+			, size_t alignment )
+		{
+			auto raw = static_cast< uint8_t * >( std::malloc( size + alignment + HeaderSize ) );
+
+			if ( !raw )
+			{
+				return nullptr;
+			}
+
+			auto result = alignUp( raw + HeaderSize, alignment );
+			auto & header = getHeader( result );
+			header.offset = uint32_t( result - raw );
+			header.origin = Origin::eHeap;
+			return result;
+		}
+
+		void * doAllocatePool( size_t size )
+		{
+			auto shard = getShardIndex();
+			auto sizeClass = getSizeClass( size );
+			auto & pool = m_pools[shard];
+			std::lock_guard< std::mutex > lock{ pool.mutex };
+			auto & freeList = pool.freeLists[sizeClass];
+
+			if ( !freeList )
+			{
+				// Fills the free list with a new chunk's slots.
+				auto stride = HeaderSize + ( size_t( 16u ) << sizeClass );
+				auto raw = static_cast< uint8_t * >( std::malloc( ChunkSize + HeaderSize ) );
+
+				if ( !raw )
+				{
+					return nullptr;
+				}
+
+				pool.chunks.push_back( raw );
+				auto slot = alignUp( raw, HeaderSize );
+				auto end = raw + ChunkSize + HeaderSize;
+
+				while ( slot + stride <= end )
+				{
+					auto result = slot + HeaderSize;
+					*reinterpret_cast< void ** >( result ) = freeList;
+					freeList = result;
+					slot += stride;
+				}
+			}
+
+			auto result = freeList;
+			freeList = *reinterpret_cast< void ** >( result );
+			auto & header = getHeader( result );
+			header.offset = 0u;
+			header.origin = Origin::ePool;
+			header.sizeClass = uint8_t( sizeClass );
+			header.shard = shard;
+			return result;
+		}
+
+		void doDeallocatePool( void * pMemory
+			, Header const & header )
+		{
+			auto & pool = m_pools[header.shard];
+			std::lock_guard< std::mutex > lock{ pool.mutex };
+			auto & freeList = pool.freeLists[header.sizeClass];
+			*reinterpret_cast< void ** >( pMemory ) = freeList;
+			freeList = pMemory;
+		}
+
+		void * doAllocateArena( size_t size
+			, size_t alignment )
+		{
+			auto shard = getShardIndex();
+			auto & pool = m_pools[shard];
+			std::lock_guard< std::mutex > lock{ pool.mutex };
+
+			if ( !pool.arena )
+			{
+				pool.arena = static_cast< uint8_t * >( std::malloc( ArenaSize ) );
+
+				if ( !pool.arena )
+				{
+					return nullptr;
+				}
+			}
+
+			auto result = alignUp( pool.arena + pool.arenaOffset + HeaderSize
+				, std::max( alignment, HeaderSize ) );
+
+			if ( result + size > pool.arena + ArenaSize )
+			{
+				return nullptr;
+			}
+
+			pool.arenaOffset = size_t( result + size - pool.arena );
+			++pool.arenaLive;
+			auto & header = getHeader( result );
+			header.offset = 0u;
+			header.origin = Origin::eArena;
+			header.shard = shard;
+			return result;
+		}
+
+		void doDeallocateArena( Header const & header )
+		{
+			auto & pool = m_pools[header.shard];
+			std::lock_guard< std::mutex > lock{ pool.mutex };
+
+			if ( --pool.arenaLive == 0u )
+			{
+				// All the command scope allocations are freed, recycle the whole arena.
+				pool.arenaOffset = 0u;
+				++m_arenaRecycles;
+			}
+		}
+
+	private:
+		std::array< Pool, ShardCount > m_pools;
+		std::array< std::atomic< size_t >, ScopeCount > m_allocationCount{};
+		std::array< std::atomic< size_t >, ScopeCount > m_allocatedSize{};
+		std::atomic< size_t > m_internalSize{};
+		std::atomic< size_t > m_arenaRecycles{};
+	};
+
+	inline DeviceAllocatorPtr makeHostAllocator()
+	{
+		return std::make_unique< HostAllocator >();
+	}
+}
+
+#endif
@@ -151,6 +151,7 @@ namespace ashes
 	class DescriptorSet;
 	class DescriptorSetLayout;
 	class DescriptorSetPool;
+	class DescriptorUpdateTemplate;
 	class Device;
 	class DeviceMemory;
 	class Event;
@@ -205,6 +206,7 @@ namespace ashes
 	using DescriptorSetLayoutPtr = std::unique_ptr< DescriptorSetLayout >;
 	using DescriptorSetPoolPtr = std::unique_ptr< DescriptorSetPool >;
 	using DescriptorSetPtr = std::unique_ptr< DescriptorSet >;
+	using DescriptorUpdateTemplatePtr = std::unique_ptr< DescriptorUpdateTemplate >;
 	using EventPtr = std::unique_ptr< Event >;
 	using FencePtr = std::unique_ptr< Fence >;
 	using FrameBufferPtr = std::unique_ptr< FrameBuffer >;
@@ -19,6 +19,8 @@ See LICENSE file in root folder.
 #include "ashespp/Pipeline/RayTracingPipelineCreateInfo.hpp"
 #include "ashespp/RenderPass/RenderPassCreateInfo.hpp"
 
+#include <ashes/common/HandleRegistry.hpp>
+
 #include <mutex>
 #include <string>
 #include <sstream>
@@ -161,6 +163,12 @@ namespace ashes
 		using VkType = VkDescriptorSetLayout;
 	};
 
+	template<>
+	struct AshesTypeTraits< ashes::DescriptorUpdateTemplate >
+	{
+		using VkType = VkDescriptorUpdateTemplate;
+	};
+
 	template<>
 	struct AshesTypeTraits< ashes::Sampler >
 	{
@@ -586,6 +594,23 @@ namespace ashes
 		}
 	};
 
+	template<>
+	struct AshesDebugTypeTraits< ashes::DescriptorUpdateTemplate >
+	{
+#if VK_EXT_debug_utils
+		static VkObjectType constexpr UtilsValue = VK_OBJECT_TYPE_DESCRIPTOR_UPDATE_TEMPLATE;
+#endif
+#if VK_EXT_debug_report || VK_EXT_debug_marker
+		static VkDebugReportObjectTypeEXT constexpr ReportValue = VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_EXT;
+#endif
+		static inline std::string Name{ "VkDescriptorUpdateTemplate" };
+
+		static std::string const & getName()
+		{
+			return Name;
+		}
+	};
+
 	template<>
 	struct AshesDebugTypeTraits< ashes::Sampler >
 	{
@@ -1117,6 +1142,33 @@ namespace ashes
 			, VkDescriptorBindingFlags flags = {} )const;
 		/**
 		*\brief
+		*	Creates a descriptor update template.
+		*\param[in] debugName
+		*	The object debug name.
+		*\param[in] createInfo
+		*	The creation informations.
+		*\return
+		*	The created template.
+		*/
+		DescriptorUpdateTemplatePtr createDescriptorUpdateTemplate( std::string const & debugName
+			, VkDescriptorUpdateTemplateCreateInfo const & createInfo )const;
+		/**
+		*\brief
+		*	Creates a descriptor update template, for the descriptor sets of given layout.
+		*\param[in] debugName
+		*	The object debug name.
+		*\param[in] entries
+		*	The template entries.
+		*\param[in] layout
+		*	The descriptor set layout.
+		*\return
+		*	The created template.
+		*/
+		DescriptorUpdateTemplatePtr createDescriptorUpdateTemplate( std::string const & debugName
+			, VkDescriptorUpdateTemplateEntryArray entries
+			, DescriptorSetLayout const & layout )const;
+		/**
+		*\brief
 		*	Creates a descriptor pool.
 		*\param[in] flags
 		*	Bitmask specifying certain supported operations on a descriptor pool.
@@ -1974,26 +2026,17 @@ namespace ashes
 #if VK_EXT_debug_utils || VK_EXT_debug_marker
 		struct ObjectAllocation
 		{
-			ObjectAllocation( std::string ptype
-				, std::string pname
-				, std::string pcallstack )
-				: type{ std::move( ptype ) }
-				, name{ std::move( pname ) }
-				, callstack{ std::move( pcallstack ) }
-			{
-			}
-
-			std::string type;
+			uint32_t objectType{};
+			//! Points to the type's static name.
+			std::string const * type{};
 			std::string name;
+			//! Only filled when a callstack callback is set.
 			std::string callstack;
 		};
 
 		using CallstackCallback = std::function< std::string() >;
 		CallstackCallback m_callstackCallback;
-		mutable std::mutex m_allocationMutex;
-		mutable std::unordered_map< size_t, ObjectAllocation > m_allocated;
-
-		using lock_type = std::unique_lock< std::mutex >;
+		mutable HandleRegistry< ObjectAllocation > m_allocated;
 
 	public:
 		void setCallstackCallback( CallstackCallback callback )
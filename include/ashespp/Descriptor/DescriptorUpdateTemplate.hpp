@@ -0,0 +1,80 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#ifndef ___AshesPP_DescriptorUpdateTemplate_HPP___
+#define ___AshesPP_DescriptorUpdateTemplate_HPP___
+#pragma once
+
+#include "ashespp/AshesPPPrerequisites.hpp"
+
+namespace ashes
+{
+	/**
+	*\brief
+	*	A descriptor update template, to update descriptor sets from a user defined structure.
+	*/
+	class DescriptorUpdateTemplate
+		: public VkObject
+	{
+	public:
+		/**
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] debugName
+		*	The object debug name.
+		*\param[in] entries
+		*	The template entries, describing where the descriptors lie in the user data.
+		*\param[in] layout
+		*	The layout of the descriptor sets updated through this template.
+		*/
+		DescriptorUpdateTemplate( Device const & device
+			, std::string const & debugName
+			, VkDescriptorUpdateTemplateEntryArray entries
+			, DescriptorSetLayout const & layout );
+		/**
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] debugName
+		*	The object debug name.
+		*\param[in] createInfo
+		*	The creation informations.
+		*/
+		DescriptorUpdateTemplate( Device const & device
+			, std::string const & debugName
+			, VkDescriptorUpdateTemplateCreateInfo const & createInfo );
+		/**
+		*\brief
+		*	Destructor.
+		*/
+		~DescriptorUpdateTemplate()noexcept;
+		/**
+		*\brief
+		*	Updates a descriptor set from user data laid out as described by the template entries.
+		*\param[in] descriptorSet
+		*	The descriptor set to update.
+		*\param[in] data
+		*	The user data.
+		*/
+		void update( VkDescriptorSet descriptorSet
+			, void const * data )const noexcept;
+		/**
+		*\brief
+		*	VkDescriptorUpdateTemplate implicit cast operator.
+		*/
+		operator VkDescriptorUpdateTemplate const & ()const noexcept
+		{
+			return m_internal;
+		}
+
+	private:
+		Device const & m_device;
+		VkDescriptorUpdateTemplate m_internal{};
+	};
+}
+
+#endif
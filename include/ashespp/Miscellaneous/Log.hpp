@@ -4,6 +4,7 @@ See LICENSE file in root folder
 #ifndef ___AshesPP_Log_H___
 #define ___AshesPP_Log_H___
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <string>
@@ -77,6 +78,11 @@ namespace ashes
 		*/
 		static void setTraceCallback( LogCallback callback );
 		/**
+		*\return
+		*	\p true if a trace callback is set, so that trace messages are worth being formatted.
+		*/
+		static bool isTraceEnabled();
+		/**
 		*\brief
 		*	Sets the debug callback.
 		*/
@@ -104,6 +110,7 @@ namespace ashes
 
 	private:
 		LogCallback m_trace;
+		std::atomic< bool > m_traceEnabled{};
 		LogCallback m_debug;
 		LogCallback m_info;
 		LogCallback m_warning;
@@ -3,6 +3,12 @@
 #include "common/FileUtils.hpp"
 
 #include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <map>
+#include <sstream>
 
 #pragma GCC diagnostic ignored "-Wmissing-declarations"
 #pragma GCC diagnostic ignored "-Wmissing-prototypes"
@@ -86,27 +92,273 @@ namespace details
 		{
 			return plugin.description.support.priority;
 		}
+
+		std::string toLower( std::string value )
+		{
+			std::transform( value.begin()
+				, value.end()
+				, value.begin()
+				, []( char c )
+				{
+					return char( std::tolower( uint8_t( c ) ) );
+				} );
+			return value;
+		}
+		/**
+		*\return
+		*	\p true if the plugin file is named after the renderer \p name (libashesGlRenderer.so for gl).
+		*/
+		bool isNamed( Plugin const & plugin
+			, std::string const & name )
+		{
+			auto fileName = ashes::getFileName( plugin.path );
+			return fileName.size() > getPrefix().size() + getPostfix().size()
+				&& toLower( fileName.substr( getPrefix().size(), fileName.size() - getPrefix().size() - getPostfix().size() ) ) == toLower( name );
+		}
+
+		static inline std::string const CacheHeader{ "ashes-plugins 1" };
+
+		struct CacheEntry
+		{
+			std::string stamp;
+			AshPluginDescription description;
+		};
+		using PluginsCache = std::map< std::string, CacheEntry >;
+
+		bool isCacheEnabled()
+		{
+			static bool const result = []()
+			{
+				auto value = getenv( "ASHES_PLUGIN_CACHE" );
+				return value == nullptr
+					|| std::string{ value } != "0";
+			}();
+			return result;
+		}
+
+		std::string getCacheFilePath()
+		{
+			auto folder = ashes::getCacheDirectory();
+			return folder.empty()
+				? folder
+				: folder / "plugins.cache";
+		}
+		/**
+		*\return
+		*	A stamp of what selects the drivers the plugins run on: the environment, and the drivers folders.
+		*\remarks
+		*	A driver update that doesn't show there is still caught when the selected plugin is probed.
+		*/
+		std::string const & getDriverIdentity()
+		{
+			static std::string const result = []()
+			{
+				static char const * const Variables[]
+				{
+					"VK_ICD_FILENAMES",
+					"VK_DRIVER_FILES",
+					"__GLX_VENDOR_LIBRARY_NAME",
+					"__EGL_VENDOR_LIBRARY_FILENAMES",
+					"MESA_LOADER_DRIVER_OVERRIDE",
+					"LIBGL_ALWAYS_SOFTWARE",
+					"GALLIUM_DRIVER",
+					"DRI_PRIME",
+				};
+				std::vector< std::string > paths;
+#if defined( _WIN32 )
+				if ( auto root = getenv( "SystemRoot" ) )
+				{
+					auto system = std::string{ root } / "System32";
+					paths.push_back( system / "DriverStore" / "FileRepository" );
+					paths.push_back( system / "opengl32.dll" );
+					paths.push_back( system / "d3d11.dll" );
+					paths.push_back( system / "vulkan-1.dll" );
+				}
+#elif defined( __APPLE__ )
+				paths.push_back( "/System/Library/Frameworks/OpenGL.framework" );
+				paths.push_back( "/usr/local/lib" );
+#else
+				paths.push_back( "/usr/lib" );
+				paths.push_back( "/usr/lib64" );
+				paths.push_back( "/usr/lib/x86_64-linux-gnu" );
+				paths.push_back( "/usr/lib/aarch64-linux-gnu" );
+				paths.push_back( "/usr/share/vulkan/icd.d" );
+				paths.push_back( "/etc/vulkan/icd.d" );
+#endif
+				std::string identity;
+
+				for ( auto variable : Variables )
+				{
+					auto value = getenv( variable );
+					identity += std::string{ value ? value : "" } + ";";
+				}
+
+				for ( auto & path : paths )
+				{
+					identity += ashes::getFileStamp( path ) + ";";
+				}
+
+				return identity;
+			}();
+			return result;
+		}
+
+		std::string serialize( Plugin const & plugin )
+		{
+			auto & description = plugin.description;
+			auto & features = description.features;
+			std::ostringstream stream;
+			stream << plugin.path
+				<< "\t" << ashes::getFileStamp( plugin.path )
+				<< "\t" << description.name
+				<< "\t" << description.description
+				<< "\t" << description.support.priority
+				<< "\t" << description.support.supported
+				<< "\t" << description.mode
+				<< "\t" << features.hasTexBufferRange
+				<< "\t" << features.hasImageTexture
+				<< "\t" << features.hasBaseInstance
+				<< "\t" << features.hasClearTexImage
+				<< "\t" << features.hasComputeShaders
+				<< "\t" << features.hasStorageBuffers
+				<< "\t" << features.supportsPersistentMapping
+				<< "\t" << features.maxShaderLanguageVersion;
+			return stream.str();
+		}
+
+		bool deserialize( std::string const & line
+			, std::string & path
+			, CacheEntry & entry )
+		{
+			std::vector< std::string > fields;
+			std::istringstream stream{ line };
+			std::string field;
+
+			while ( std::getline( stream, field, '\t' ) )
+			{
+				fields.push_back( field );
+			}
+
+			if ( fields.size() != 15u )
+			{
+				return false;
+			}
+
+			try
+			{
+				auto & description = entry.description;
+				auto & features = description.features;
+				auto index = 0u;
+				path = fields[index++];
+				entry.stamp = fields[index++];
+				strncpy( description.name, fields[index++].c_str(), sizeof( description.name ) - 1u );
+				strncpy( description.description, fields[index++].c_str(), sizeof( description.description ) - 1u );
+				description.support.priority = uint32_t( std::stoul( fields[index++] ) );
+				description.support.supported = VkBool32( std::stoul( fields[index++] ) );
+				description.mode = AshPluginMode( std::stoul( fields[index++] ) );
+				features.hasTexBufferRange = VkBool32( std::stoul( fields[index++] ) );
+				features.hasImageTexture = VkBool32( std::stoul( fields[index++] ) );
+				features.hasBaseInstance = VkBool32( std::stoul( fields[index++] ) );
+				features.hasClearTexImage = VkBool32( std::stoul( fields[index++] ) );
+				features.hasComputeShaders = VkBool32( std::stoul( fields[index++] ) );
+				features.hasStorageBuffers = VkBool32( std::stoul( fields[index++] ) );
+				features.supportsPersistentMapping = VkBool32( std::stoul( fields[index++] ) );
+				features.maxShaderLanguageVersion = uint32_t( std::stoul( fields[index++] ) );
+			}
+			catch ( std::exception & )
+			{
+				return false;
+			}
+
+			return true;
+		}
+
+		std::string readCacheFile( std::string const & filePath )
+		{
+			std::ifstream file{ filePath, std::ios::binary };
+			std::ostringstream stream;
+			stream << file.rdbuf();
+			return stream.str();
+		}
+
+		PluginsCache loadCache()
+		{
+			PluginsCache result;
+			auto filePath = isCacheEnabled()
+				? getCacheFilePath()
+				: std::string{};
+
+			if ( filePath.empty() )
+			{
+				return result;
+			}
+
+			std::istringstream stream{ readCacheFile( filePath ) };
+			std::string line;
+
+			if ( !std::getline( stream, line )
+				|| line != CacheHeader
+				|| !std::getline( stream, line )
+				|| line != getDriverIdentity() )
+			{
+				return result;
+			}
+
+			while ( std::getline( stream, line ) )
+			{
+				std::string path;
+				CacheEntry entry{};
+
+				if ( deserialize( line, path, entry ) )
+				{
+					result.emplace( std::move( path ), std::move( entry ) );
+				}
+			}
+
+			return result;
+		}
 	}
 
 	Plugin * findFirstSupportedPlugin( PluginArray & plugins )
 	{
-		Plugin * result{ nullptr };
-
+		// The plugins missing from the cache have to be probed, to know their priority.
 		for ( auto & lookup : plugins )
 		{
-			if ( ash::isSupported( lookup )
-				&& ( !result || ash::getPriority( lookup ) > ash::getPriority( *result ) ) )
+			if ( lookup.state == Plugin::State::eListed )
 			{
-				result = &lookup;
+				lookup.probe();
 			}
 		}
 
-		return result;
+		while ( true )
+		{
+			Plugin * result{ nullptr };
+
+			for ( auto & lookup : plugins )
+			{
+				if ( ash::isSupported( lookup )
+					&& ( !result || ash::getPriority( lookup ) > ash::getPriority( *result ) ) )
+				{
+					result = &lookup;
+				}
+			}
+
+			// The best cached candidate is probed, which it needs to be used anyway,
+			// and if its description was stale, the selection is done again.
+			if ( !result
+				|| result->state == Plugin::State::eProbed )
+			{
+				return result;
+			}
+
+			result->probe();
+		}
 	}
 
 	PluginArray listPlugins()
 	{
 		PluginArray result;
+		auto cache = ash::loadCache();
 
 		for ( auto & file : ashes::lookForSharedLibrary( []( std::string const &
 			, std::string const & name )
@@ -114,14 +366,15 @@ namespace details
 				return ash::isAshesPlugin( name );
 			} ) )
 		{
-			try
-			{
-				result.emplace_back( std::make_unique< ashes::DynamicLibrary >( file ) );
-			}
-			catch ( ashes::BaseException & exc )
+			auto & plugin = result.emplace_back( file );
+
+			// Unsupported descriptions are kept too, the cache being dropped when the drivers change.
+			if ( auto it = cache.find( file );
+				it != cache.end()
+				&& it->second.stamp == ashes::getFileStamp( file ) )
 			{
-				// Prevent useless noisy message
-				std::clog << exc.what() << std::endl;
+				plugin.description = it->second.description;
+				plugin.state = Plugin::State::eCached;
 			}
 		}
 
@@ -143,25 +396,93 @@ namespace details
 
 			return result;
 		}();
-		Plugin * result{};
 
-		if ( !defaultName.empty() )
+		if ( defaultName.empty() )
 		{
-			auto it = std::find_if( plugins.begin()
-				, plugins.end()
-				, []( Plugin const & lookup )
-				{
-					return lookup.description.name == defaultName
-						&& ash::isSupported( lookup );
-				} );
+			return nullptr;
+		}
 
-			if ( it != plugins.end() )
+		auto matches = []( Plugin & lookup )
+		{
+			return lookup.probe()
+				&& lookup.description.name == defaultName
+				&& ash::isSupported( lookup );
+		};
+
+		// Only load the plugin whose file is named after the renderer.
+		for ( auto & lookup : plugins )
+		{
+			if ( ash::isNamed( lookup, defaultName )
+				&& matches( lookup ) )
 			{
-				result = &( *it );
+				return &lookup;
 			}
 		}
 
-		return result;
+		// Otherwise, load the ones that may have that name.
+		for ( auto & lookup : plugins )
+		{
+			if ( ( lookup.state == Plugin::State::eListed || lookup.description.name == defaultName )
+				&& matches( lookup ) )
+			{
+				return &lookup;
+			}
+		}
+
+		return nullptr;
+	}
+
+	void updatePluginsCache( PluginArray const & plugins )
+	{
+		auto filePath = ash::isCacheEnabled()
+			? ash::getCacheFilePath()
+			: std::string{};
+
+		if ( filePath.empty() )
+		{
+			return;
+		}
+
+		auto content = ash::CacheHeader + "\n" + ash::getDriverIdentity() + "\n";
+
+		for ( auto & plugin : plugins )
+		{
+			// The unsupported plugins are cached as well, so that they aren't loaded by each run,
+			// until the driver identity or the plugin file changes.
+			if ( plugin.state != Plugin::State::eListed )
+			{
+				content += ash::serialize( plugin ) + "\n";
+			}
+		}
+
+		if ( ash::readCacheFile( filePath ) != content )
+		{
+			// Written to a file unique to this process, then moved over the cache in one step,
+			// so that concurrent processes never read a partial file, nor miss it.
+			auto tmpPath = filePath + "."
+				+ std::to_string( std::chrono::high_resolution_clock::now().time_since_epoch().count() )
+				+ ".tmp";
+
+			{
+				std::ofstream file{ tmpPath, std::ios::binary | std::ios::trunc };
+				file << content;
+
+				if ( !file )
+				{
+					file.close();
+					std::remove( tmpPath.c_str() );
+					return;
+				}
+			}
+
+			std::error_code error;
+			std::filesystem::rename( tmpPath, filePath, error );
+
+			if ( error )
+			{
+				std::remove( tmpPath.c_str() );
+			}
+		}
 	}
 }
 
@@ -178,8 +499,10 @@ extern "C"
 
 			if ( pDescriptions )
 			{
-				for ( auto const & plugin : g_library.plugins )
+				for ( auto & plugin : g_library.plugins )
 				{
+					// A cached description has no entry points, so the full one needs the plugin loaded.
+					plugin.probe();
 					*pDescriptions = plugin.description;
 					++pDescriptions;
 				}
@@ -226,682 +549,682 @@ extern "C"
 #ifdef VK_VERSION_1_0
 	Ashes_API PFN_vkVoidFunction VKAPI_CALL vkGetDeviceProcAddr( VkDevice device, const char* pName )
 	{
-		return g_library.getSelectedDesc().functions.GetDeviceProcAddr( device, pName );
+		return g_library.dispatch.GetDeviceProcAddr( device, pName );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkCreateInstance( const VkInstanceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkInstance* pInstance )
 	{
-		return g_library.getSelectedDesc().functions.CreateInstance( pCreateInfo, pAllocator, pInstance );
+		return g_library.getDispatch().CreateInstance( pCreateInfo, pAllocator, pInstance );
 	}
 
 	Ashes_API void VKAPI_CALL vkDestroyInstance( VkInstance instance, const  VkAllocationCallbacks* pAllocator )
 	{
-		return g_library.getSelectedDesc().functions.DestroyInstance( instance, pAllocator );
+		return g_library.dispatch.DestroyInstance( instance, pAllocator );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkEnumeratePhysicalDevices( VkInstance instance, uint32_t* pPhysicalDeviceCount, VkPhysicalDevice*  pPhysicalDevices )
 	{
-		return g_library.getSelectedDesc().functions.EnumeratePhysicalDevices( instance, pPhysicalDeviceCount, pPhysicalDevices );
+		return g_library.dispatch.EnumeratePhysicalDevices( instance, pPhysicalDeviceCount, pPhysicalDevices );
 	}
 
 	Ashes_API void VKAPI_CALL vkGetPhysicalDeviceFeatures( VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures* pFeatures )
 	{
-		return g_library.getSelectedDesc().functions.GetPhysicalDeviceFeatures( physicalDevice, pFeatures );
+		return g_library.dispatch.GetPhysicalDeviceFeatures( physicalDevice, pFeatures );
 	}
 
 	Ashes_API void VKAPI_CALL vkGetPhysicalDeviceFormatProperties( VkPhysicalDevice physicalDevice, VkFormat format, VkFormatProperties*  pFormatProperties )
 	{
-		return g_library.getSelectedDesc().functions.GetPhysicalDeviceFormatProperties( physicalDevice, format, pFormatProperties );
+		return g_library.dispatch.GetPhysicalDeviceFormatProperties( physicalDevice, format, pFormatProperties );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkGetPhysicalDeviceImageFormatProperties( VkPhysicalDevice physicalDevice, VkFormat format, VkImageType type, VkImageTiling tiling, VkImageUsageFlags usage, VkImageCreateFlags flags, VkImageFormatProperties* pImageFormatProperties )
 	{
-		return g_library.getSelectedDesc().functions.GetPhysicalDeviceImageFormatProperties( physicalDevice, format, type, tiling, usage, flags, pImageFormatProperties );
+		return g_library.dispatch.GetPhysicalDeviceImageFormatProperties( physicalDevice, format, type, tiling, usage, flags, pImageFormatProperties );
 	}
 
 	Ashes_API void VKAPI_CALL vkGetPhysicalDeviceProperties( VkPhysicalDevice physicalDevice, VkPhysicalDeviceProperties* pProperties )
 	{
-		return g_library.getSelectedDesc().functions.GetPhysicalDeviceProperties( physicalDevice, pProperties );
+		return g_library.dispatch.GetPhysicalDeviceProperties( physicalDevice, pProperties );
 	}
 
 	Ashes_API void VKAPI_CALL vkGetPhysicalDeviceQueueFamilyProperties( VkPhysicalDevice physicalDevice, uint32_t* pQueueFamilyPropertyCount, VkQueueFamilyProperties*  pQueueFamilyProperties )
 	{
-		return g_library.getSelectedDesc().functions.GetPhysicalDeviceQueueFamilyProperties( physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties );
+		return g_library.dispatch.GetPhysicalDeviceQueueFamilyProperties( physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties );
 	}
 
 	Ashes_API void VKAPI_CALL vkGetPhysicalDeviceMemoryProperties( VkPhysicalDevice physicalDevice, VkPhysicalDeviceMemoryProperties* pMemoryProperties )
 	{
-		return g_library.getSelectedDesc().functions.GetPhysicalDeviceMemoryProperties( physicalDevice, pMemoryProperties );
+		return g_library.dispatch.GetPhysicalDeviceMemoryProperties( physicalDevice, pMemoryProperties );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkCreateDevice( VkPhysicalDevice physicalDevice, const  VkDeviceCreateInfo* pCreateInfo, const  VkAllocationCallbacks* pAllocator, VkDevice* pDevice )
 	{
-		return g_library.getSelectedDesc().functions.CreateDevice( physicalDevice, pCreateInfo, pAllocator, pDevice );
+		return g_library.dispatch.CreateDevice( physicalDevice, pCreateInfo, pAllocator, pDevice );
 	}
 
 	Ashes_API void VKAPI_CALL vkDestroyDevice( VkDevice device, const  VkAllocationCallbacks* pAllocator )
 	{
-		return g_library.getSelectedDesc().functions.DestroyDevice( device, pAllocator );
+		return g_library.dispatch.DestroyDevice( device, pAllocator );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkEnumerateInstanceExtensionProperties( const char* pLayerName, uint32_t* pPropertyCount, VkExtensionProperties* pProperties )
 	{
-		return g_library.getSelectedDesc().functions.EnumerateInstanceExtensionProperties( pLayerName, pPropertyCount, pProperties );
+		return g_library.getDispatch().EnumerateInstanceExtensionProperties( pLayerName, pPropertyCount, pProperties );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkEnumerateDeviceExtensionProperties( VkPhysicalDevice physicalDevice, const  char* pLayerName, uint32_t* pPropertyCount, VkExtensionProperties* pProperties )
 	{
-		return g_library.getSelectedDesc().functions.EnumerateDeviceExtensionProperties( physicalDevice, pLayerName, pPropertyCount, pProperties );
+		return g_library.dispatch.EnumerateDeviceExtensionProperties( physicalDevice, pLayerName, pPropertyCount, pProperties );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkEnumerateInstanceLayerProperties( uint32_t* pPropertyCount, VkLayerProperties* pProperties )
 	{
-		return g_library.getSelectedDesc().functions.EnumerateInstanceLayerProperties( pPropertyCount, pProperties );
+		return g_library.getDispatch().EnumerateInstanceLayerProperties( pPropertyCount, pProperties );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkEnumerateDeviceLayerProperties( VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkLayerProperties*  pProperties )
 	{
-		return g_library.getSelectedDesc().functions.EnumerateDeviceLayerProperties( physicalDevice, pPropertyCount, pProperties );
+		return g_library.dispatch.EnumerateDeviceLayerProperties( physicalDevice, pPropertyCount, pProperties );
 	}
 
 	Ashes_API void VKAPI_CALL vkGetDeviceQueue( VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue* pQueue )
 	{
-		return g_library.getSelectedDesc().functions.GetDeviceQueue( device, queueFamilyIndex, queueIndex, pQueue );
+		return g_library.dispatch.GetDeviceQueue( device, queueFamilyIndex, queueIndex, pQueue );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkQueueSubmit( VkQueue queue, uint32_t submitCount, const  VkSubmitInfo* pSubmits, VkFence fence )
 	{
-		return g_library.getSelectedDesc().functions.QueueSubmit( queue, submitCount, pSubmits, fence );
+		return g_library.dispatch.QueueSubmit( queue, submitCount, pSubmits, fence );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkQueueWaitIdle( VkQueue queue )
 	{
-		return g_library.getSelectedDesc().functions.QueueWaitIdle( queue );
+		return g_library.dispatch.QueueWaitIdle( queue );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkDeviceWaitIdle( VkDevice device )
 	{
-		return g_library.getSelectedDesc().functions.DeviceWaitIdle( device );
+		return g_library.dispatch.DeviceWaitIdle( device );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkAllocateMemory( VkDevice device, const  VkMemoryAllocateInfo* pAllocateInfo, const  VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory )
 	{
-		return g_library.getSelectedDesc().functions.AllocateMemory( device, pAllocateInfo, pAllocator, pMemory );
+		return g_library.dispatch.AllocateMemory( device, pAllocateInfo, pAllocator, pMemory );
 	}
 
 	Ashes_API void VKAPI_CALL vkFreeMemory( VkDevice device, VkDeviceMemory memory, const  VkAllocationCallbacks* pAllocator )
 	{
-		return g_library.getSelectedDesc().functions.FreeMemory( device, memory, pAllocator );
+		return g_library.dispatch.FreeMemory( device, memory, pAllocator );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkMapMemory( VkDevice device, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size, VkMemoryMapFlags flags, void** ppData )
 	{
-		return g_library.getSelectedDesc().functions.MapMemory( device, memory, offset, size, flags, ppData );
+		return g_library.dispatch.MapMemory( device, memory, offset, size, flags, ppData );
 	}
 
 	Ashes_API void VKAPI_CALL vkUnmapMemory( VkDevice device, VkDeviceMemory memory )
 	{
-		return g_library.getSelectedDesc().functions.UnmapMemory( device, memory );
+		return g_library.dispatch.UnmapMemory( device, memory );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkFlushMappedMemoryRanges( VkDevice device, uint32_t memoryRangeCount, const  VkMappedMemoryRange* pMemoryRanges )
 	{
-		return g_library.getSelectedDesc().functions.FlushMappedMemoryRanges( device, memoryRangeCount, pMemoryRanges );
+		return g_library.dispatch.FlushMappedMemoryRanges( device, memoryRangeCount, pMemoryRanges );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkInvalidateMappedMemoryRanges( VkDevice device, uint32_t memoryRangeCount, const  VkMappedMemoryRange* pMemoryRanges )
 	{
-		return g_library.getSelectedDesc().functions.InvalidateMappedMemoryRanges( device, memoryRangeCount, pMemoryRanges );
+		return g_library.dispatch.InvalidateMappedMemoryRanges( device, memoryRangeCount, pMemoryRanges );
 	}
 
 	Ashes_API void VKAPI_CALL vkGetDeviceMemoryCommitment( VkDevice device, VkDeviceMemory memory, VkDeviceSize*  pCommittedMemoryInBytes )
 	{
-		return g_library.getSelectedDesc().functions.GetDeviceMemoryCommitment( device, memory, pCommittedMemoryInBytes );
+		return g_library.dispatch.GetDeviceMemoryCommitment( device, memory, pCommittedMemoryInBytes );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkBindBufferMemory( VkDevice device, VkBuffer buffer, VkDeviceMemory memory, VkDeviceSize memoryOffset )
 	{
-		return g_library.getSelectedDesc().functions.BindBufferMemory( device, buffer, memory, memoryOffset );
+		return g_library.dispatch.BindBufferMemory( device, buffer, memory, memoryOffset );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkBindImageMemory( VkDevice device, VkImage image, VkDeviceMemory memory, VkDeviceSize memoryOffset )
 	{
-		return g_library.getSelectedDesc().functions.BindImageMemory( device, image, memory, memoryOffset );
+		return g_library.dispatch.BindImageMemory( device, image, memory, memoryOffset );
 	}
 
 	Ashes_API void VKAPI_CALL vkGetBufferMemoryRequirements( VkDevice device, VkBuffer buffer, VkMemoryRequirements*  pMemoryRequirements )
 	{
-		return g_library.getSelectedDesc().functions.GetBufferMemoryRequirements( device, buffer, pMemoryRequirements );
+		return g_library.dispatch.GetBufferMemoryRequirements( device, buffer, pMemoryRequirements );
 	}
 
 	Ashes_API void VKAPI_CALL vkGetImageMemoryRequirements( VkDevice device, VkImage image, VkMemoryRequirements*  pMemoryRequirements )
 	{
-		return g_library.getSelectedDesc().functions.GetImageMemoryRequirements( device, image, pMemoryRequirements );
+		return g_library.dispatch.GetImageMemoryRequirements( device, image, pMemoryRequirements );
 	}
 
 	Ashes_API void VKAPI_CALL vkGetImageSparseMemoryRequirements( VkDevice device, VkImage image, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements* pSparseMemoryRequirements )
 	{
-		return g_library.getSelectedDesc().functions.GetImageSparseMemoryRequirements( device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements );
+		return g_library.dispatch.GetImageSparseMemoryRequirements( device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements );
 	}
 
 	Ashes_API void VKAPI_CALL vkGetPhysicalDeviceSparseImageFormatProperties( VkPhysicalDevice physicalDevice, VkFormat format, VkImageType type, VkSampleCountFlagBits samples, VkImageUsageFlags usage, VkImageTiling tiling, uint32_t* pPropertyCount, VkSparseImageFormatProperties* pProperties )
 	{
-		return g_library.getSelectedDesc().functions.GetPhysicalDeviceSparseImageFormatProperties( physicalDevice, format, type, samples, usage, tiling, pPropertyCount, pProperties );
+		return g_library.dispatch.GetPhysicalDeviceSparseImageFormatProperties( physicalDevice, format, type, samples, usage, tiling, pPropertyCount, pProperties );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkQueueBindSparse( VkQueue queue, uint32_t bindInfoCount, const  VkBindSparseInfo* pBindInfo, VkFence fence )
 	{
-		return g_library.getSelectedDesc().functions.QueueBindSparse( queue, bindInfoCount, pBindInfo, fence );
+		return g_library.dispatch.QueueBindSparse( queue, bindInfoCount, pBindInfo, fence );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkCreateFence( VkDevice device, const  VkFenceCreateInfo* pCreateInfo, const  VkAllocationCallbacks* pAllocator, VkFence* pFence )
 	{
-		return g_library.getSelectedDesc().functions.CreateFence( device, pCreateInfo, pAllocator, pFence );
+		return g_library.dispatch.CreateFence( device, pCreateInfo, pAllocator, pFence );
 	}
 
 	Ashes_API void VKAPI_CALL vkDestroyFence( VkDevice device, VkFence fence, const  VkAllocationCallbacks* pAllocator )
 	{
-		return g_library.getSelectedDesc().functions.DestroyFence( device, fence, pAllocator );
+		return g_library.dispatch.DestroyFence( device, fence, pAllocator );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkResetFences( VkDevice device, uint32_t fenceCount, const  VkFence* pFences )
 	{
-		return g_library.getSelectedDesc().functions.ResetFences( device, fenceCount, pFences );
+		return g_library.dispatch.ResetFences( device, fenceCount, pFences );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkGetFenceStatus( VkDevice device, VkFence fence )
 	{
-		return g_library.getSelectedDesc().functions.GetFenceStatus( device, fence );
+		return g_library.dispatch.GetFenceStatus( device, fence );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkWaitForFences( VkDevice device, uint32_t fenceCount, const  VkFence* pFences, VkBool32 waitAll, uint64_t timeout )
 	{
-		return g_library.getSelectedDesc().functions.WaitForFences( device, fenceCount, pFences, waitAll, timeout );
+		return g_library.dispatch.WaitForFences( device, fenceCount, pFences, waitAll, timeout );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkCreateSemaphore( VkDevice device, const  VkSemaphoreCreateInfo* pCreateInfo, const  VkAllocationCallbacks* pAllocator, VkSemaphore* pSemaphore )
 	{
-		return g_library.getSelectedDesc().functions.CreateSemaphore( device, pCreateInfo, pAllocator, pSemaphore );
+		return g_library.dispatch.CreateSemaphore( device, pCreateInfo, pAllocator, pSemaphore );
 	}
 
 	Ashes_API void VKAPI_CALL vkDestroySemaphore( VkDevice device, VkSemaphore semaphore, const  VkAllocationCallbacks* pAllocator )
 	{
-		return g_library.getSelectedDesc().functions.DestroySemaphore( device, semaphore, pAllocator );
+		return g_library.dispatch.DestroySemaphore( device, semaphore, pAllocator );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkCreateEvent( VkDevice device, const  VkEventCreateInfo* pCreateInfo, const  VkAllocationCallbacks* pAllocator, VkEvent* pEvent )
 	{
-		return g_library.getSelectedDesc().functions.CreateEvent( device, pCreateInfo, pAllocator, pEvent );
+		return g_library.dispatch.CreateEvent( device, pCreateInfo, pAllocator, pEvent );
 	}
 
 	Ashes_API void VKAPI_CALL vkDestroyEvent( VkDevice device, VkEvent event, const  VkAllocationCallbacks* pAllocator )
 	{
-		return g_library.getSelectedDesc().functions.DestroyEvent( device, event, pAllocator );
+		return g_library.dispatch.DestroyEvent( device, event, pAllocator );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkGetEventStatus( VkDevice device, VkEvent event )
 	{
-		return g_library.getSelectedDesc().functions.GetEventStatus( device, event );
+		return g_library.dispatch.GetEventStatus( device, event );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkSetEvent( VkDevice device, VkEvent event )
 	{
-		return g_library.getSelectedDesc().functions.SetEvent( device, event );
+		return g_library.dispatch.SetEvent( device, event );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkResetEvent( VkDevice device, VkEvent event )
 	{
-		return g_library.getSelectedDesc().functions.ResetEvent( device, event );
+		return g_library.dispatch.ResetEvent( device, event );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkCreateQueryPool( VkDevice device, const  VkQueryPoolCreateInfo* pCreateInfo, const  VkAllocationCallbacks* pAllocator, VkQueryPool* pQueryPool )
 	{
-		return g_library.getSelectedDesc().functions.CreateQueryPool( device, pCreateInfo, pAllocator, pQueryPool );
+		return g_library.dispatch.CreateQueryPool( device, pCreateInfo, pAllocator, pQueryPool );
 	}
 
 	Ashes_API void VKAPI_CALL vkDestroyQueryPool( VkDevice device, VkQueryPool queryPool, const  VkAllocationCallbacks* pAllocator )
 	{
-		return g_library.getSelectedDesc().functions.DestroyQueryPool( device, queryPool, pAllocator );
+		return g_library.dispatch.DestroyQueryPool( device, queryPool, pAllocator );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkGetQueryPoolResults( VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, size_t dataSize, void* pData, VkDeviceSize stride, VkQueryResultFlags flags )
 	{
-		return g_library.getSelectedDesc().functions.GetQueryPoolResults( device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags );
+		return g_library.dispatch.GetQueryPoolResults( device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkCreateBuffer( VkDevice device, const  VkBufferCreateInfo* pCreateInfo, const  VkAllocationCallbacks* pAllocator, VkBuffer* pBuffer )
 	{
-		return g_library.getSelectedDesc().functions.CreateBuffer( device, pCreateInfo, pAllocator, pBuffer );
+		return g_library.dispatch.CreateBuffer( device, pCreateInfo, pAllocator, pBuffer );
 	}
 
 	Ashes_API void VKAPI_CALL vkDestroyBuffer( VkDevice device, VkBuffer buffer, const  VkAllocationCallbacks* pAllocator )
 	{
-		return g_library.getSelectedDesc().functions.DestroyBuffer( device, buffer, pAllocator );
+		return g_library.dispatch.DestroyBuffer( device, buffer, pAllocator );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkCreateBufferView( VkDevice device, const  VkBufferViewCreateInfo* pCreateInfo, const  VkAllocationCallbacks* pAllocator, VkBufferView* pView )
 	{
-		return g_library.getSelectedDesc().functions.CreateBufferView( device, pCreateInfo, pAllocator, pView );
+		return g_library.dispatch.CreateBufferView( device, pCreateInfo, pAllocator, pView );
 	}
 
 	Ashes_API void VKAPI_CALL vkDestroyBufferView( VkDevice device, VkBufferView bufferView, const  VkAllocationCallbacks* pAllocator )
 	{
-		return g_library.getSelectedDesc().functions.DestroyBufferView( device, bufferView, pAllocator );
+		return g_library.dispatch.DestroyBufferView( device, bufferView, pAllocator );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkCreateImage( VkDevice device, const  VkImageCreateInfo* pCreateInfo, const  VkAllocationCallbacks* pAllocator, VkImage* pImage )
 	{
-		return g_library.getSelectedDesc().functions.CreateImage( device, pCreateInfo, pAllocator, pImage );
+		return g_library.dispatch.CreateImage( device, pCreateInfo, pAllocator, pImage );
 	}
 
 	Ashes_API void VKAPI_CALL vkDestroyImage( VkDevice device, VkImage image, const  VkAllocationCallbacks* pAllocator )
 	{
-		return g_library.getSelectedDesc().functions.DestroyImage( device, image, pAllocator );
+		return g_library.dispatch.DestroyImage( device, image, pAllocator );
 	}
 
 	Ashes_API void VKAPI_CALL vkGetImageSubresourceLayout( VkDevice device, VkImage image, const  VkImageSubresource* pSubresource, VkSubresourceLayout* pLayout )
 	{
-		return g_library.getSelectedDesc().functions.GetImageSubresourceLayout( device, image, pSubresource, pLayout );
+		return g_library.dispatch.GetImageSubresourceLayout( device, image, pSubresource, pLayout );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkCreateImageView( VkDevice device, const  VkImageViewCreateInfo* pCreateInfo, const  VkAllocationCallbacks* pAllocator, VkImageView* pView )
 	{
-		return g_library.getSelectedDesc().functions.CreateImageView( device, pCreateInfo, pAllocator, pView );
+		return g_library.dispatch.CreateImageView( device, pCreateInfo, pAllocator, pView );
 	}
 
 	Ashes_API void VKAPI_CALL vkDestroyImageView( VkDevice device, VkImageView imageView, const  VkAllocationCallbacks* pAllocator )
 	{
-		return g_library.getSelectedDesc().functions.DestroyImageView( device, imageView, pAllocator );
+		return g_library.dispatch.DestroyImageView( device, imageView, pAllocator );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkCreateShaderModule( VkDevice device, const  VkShaderModuleCreateInfo* pCreateInfo, const  VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule )
 	{
-		return g_library.getSelectedDesc().functions.CreateShaderModule( device, pCreateInfo, pAllocator, pShaderModule );
+		return g_library.dispatch.CreateShaderModule( device, pCreateInfo, pAllocator, pShaderModule );
 	}
 
 	Ashes_API void VKAPI_CALL vkDestroyShaderModule( VkDevice device, VkShaderModule shaderModule, const  VkAllocationCallbacks* pAllocator )
 	{
-		return g_library.getSelectedDesc().functions.DestroyShaderModule( device, shaderModule, pAllocator );
+		return g_library.dispatch.DestroyShaderModule( device, shaderModule, pAllocator );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkCreatePipelineCache( VkDevice device, const  VkPipelineCacheCreateInfo* pCreateInfo, const  VkAllocationCallbacks* pAllocator, VkPipelineCache* pPipelineCache )
 	{
-		return g_library.getSelectedDesc().functions.CreatePipelineCache( device, pCreateInfo, pAllocator, pPipelineCache );
+		return g_library.dispatch.CreatePipelineCache( device, pCreateInfo, pAllocator, pPipelineCache );
 	}
 
 	Ashes_API void VKAPI_CALL vkDestroyPipelineCache( VkDevice device, VkPipelineCache pipelineCache, const  VkAllocationCallbacks* pAllocator )
 	{
-		return g_library.getSelectedDesc().functions.DestroyPipelineCache( device, pipelineCache, pAllocator );
+		return g_library.dispatch.DestroyPipelineCache( device, pipelineCache, pAllocator );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkGetPipelineCacheData( VkDevice device, VkPipelineCache pipelineCache, size_t* pDataSize, void* pData )
 	{
-		return g_library.getSelectedDesc().functions.GetPipelineCacheData( device, pipelineCache, pDataSize, pData );
+		return g_library.dispatch.GetPipelineCacheData( device, pipelineCache, pDataSize, pData );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkMergePipelineCaches( VkDevice device, VkPipelineCache dstCache, uint32_t srcCacheCount, const  VkPipelineCache* pSrcCaches )
 	{
-		return g_library.getSelectedDesc().functions.MergePipelineCaches( device, dstCache, srcCacheCount, pSrcCaches );
+		return g_library.dispatch.MergePipelineCaches( device, dstCache, srcCacheCount, pSrcCaches );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkCreateGraphicsPipelines( VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const  VkGraphicsPipelineCreateInfo* pCreateInfos, const  VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines )
 	{
-		return g_library.getSelectedDesc().functions.CreateGraphicsPipelines( device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines );
+		return g_library.dispatch.CreateGraphicsPipelines( device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkCreateComputePipelines( VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const  VkComputePipelineCreateInfo* pCreateInfos, const  VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines )
 	{
-		return g_library.getSelectedDesc().functions.CreateComputePipelines( device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines );
+		return g_library.dispatch.CreateComputePipelines( device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines );
 	}
 
 	Ashes_API void VKAPI_CALL vkDestroyPipeline( VkDevice device, VkPipeline pipeline, const  VkAllocationCallbacks* pAllocator )
 	{
-		return g_library.getSelectedDesc().functions.DestroyPipeline( device, pipeline, pAllocator );
+		return g_library.dispatch.DestroyPipeline( device, pipeline, pAllocator );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkCreatePipelineLayout( VkDevice device, const  VkPipelineLayoutCreateInfo* pCreateInfo, const  VkAllocationCallbacks* pAllocator, VkPipelineLayout* pPipelineLayout )
 	{
-		return g_library.getSelectedDesc().functions.CreatePipelineLayout( device, pCreateInfo, pAllocator, pPipelineLayout );
+		return g_library.dispatch.CreatePipelineLayout( device, pCreateInfo, pAllocator, pPipelineLayout );
 	}
 
 	Ashes_API void VKAPI_CALL vkDestroyPipelineLayout( VkDevice device, VkPipelineLayout pipelineLayout, const  VkAllocationCallbacks* pAllocator )
 	{
-		return g_library.getSelectedDesc().functions.DestroyPipelineLayout( device, pipelineLayout, pAllocator );
+		return g_library.dispatch.DestroyPipelineLayout( device, pipelineLayout, pAllocator );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkCreateSampler( VkDevice device, const  VkSamplerCreateInfo* pCreateInfo, const  VkAllocationCallbacks* pAllocator, VkSampler* pSampler )
 	{
-		return g_library.getSelectedDesc().functions.CreateSampler( device, pCreateInfo, pAllocator, pSampler );
+		return g_library.dispatch.CreateSampler( device, pCreateInfo, pAllocator, pSampler );
 	}
 
 	Ashes_API void VKAPI_CALL vkDestroySampler( VkDevice device, VkSampler sampler, const  VkAllocationCallbacks* pAllocator )
 	{
-		return g_library.getSelectedDesc().functions.DestroySampler( device, sampler, pAllocator );
+		return g_library.dispatch.DestroySampler( device, sampler, pAllocator );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkCreateDescriptorSetLayout( VkDevice device, const  VkDescriptorSetLayoutCreateInfo* pCreateInfo, const  VkAllocationCallbacks* pAllocator, VkDescriptorSetLayout* pSetLayout )
 	{
-		return g_library.getSelectedDesc().functions.CreateDescriptorSetLayout( device, pCreateInfo, pAllocator, pSetLayout );
+		return g_library.dispatch.CreateDescriptorSetLayout( device, pCreateInfo, pAllocator, pSetLayout );
 	}
 
 	Ashes_API void VKAPI_CALL vkDestroyDescriptorSetLayout( VkDevice device, VkDescriptorSetLayout descriptorSetLayout, const  VkAllocationCallbacks* pAllocator )
 	{
-		return g_library.getSelectedDesc().functions.DestroyDescriptorSetLayout( device, descriptorSetLayout, pAllocator );
+		return g_library.dispatch.DestroyDescriptorSetLayout( device, descriptorSetLayout, pAllocator );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkCreateDescriptorPool( VkDevice device, const  VkDescriptorPoolCreateInfo* pCreateInfo, const  VkAllocationCallbacks* pAllocator, VkDescriptorPool* pDescriptorPool )
 	{
-		return g_library.getSelectedDesc().functions.CreateDescriptorPool( device, pCreateInfo, pAllocator, pDescriptorPool );
+		return g_library.dispatch.CreateDescriptorPool( device, pCreateInfo, pAllocator, pDescriptorPool );
 	}
 
 	Ashes_API void VKAPI_CALL vkDestroyDescriptorPool( VkDevice device, VkDescriptorPool descriptorPool, const  VkAllocationCallbacks* pAllocator )
 	{
-		return g_library.getSelectedDesc().functions.DestroyDescriptorPool( device, descriptorPool, pAllocator );
+		return g_library.dispatch.DestroyDescriptorPool( device, descriptorPool, pAllocator );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkResetDescriptorPool( VkDevice device, VkDescriptorPool descriptorPool, VkDescriptorPoolResetFlags  flags )
 	{
-		return g_library.getSelectedDesc().functions.ResetDescriptorPool( device, descriptorPool, flags );
+		return g_library.dispatch.ResetDescriptorPool( device, descriptorPool, flags );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkAllocateDescriptorSets( VkDevice device, const  VkDescriptorSetAllocateInfo* pAllocateInfo, VkDescriptorSet* pDescriptorSets )
 	{
-		return g_library.getSelectedDesc().functions.AllocateDescriptorSets( device, pAllocateInfo, pDescriptorSets );
+		return g_library.dispatch.AllocateDescriptorSets( device, pAllocateInfo, pDescriptorSets );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkFreeDescriptorSets( VkDevice device, VkDescriptorPool descriptorPool, uint32_t descriptorSetCount, const  VkDescriptorSet* pDescriptorSets )
 	{
-		return g_library.getSelectedDesc().functions.FreeDescriptorSets( device, descriptorPool, descriptorSetCount, pDescriptorSets );
+		return g_library.dispatch.FreeDescriptorSets( device, descriptorPool, descriptorSetCount, pDescriptorSets );
 	}
 
 	Ashes_API void VKAPI_CALL vkUpdateDescriptorSets( VkDevice device, uint32_t descriptorWriteCount, const  VkWriteDescriptorSet* pDescriptorWrites, uint32_t descriptorCopyCount, const  VkCopyDescriptorSet* pDescriptorCopies )
 	{
-		return g_library.getSelectedDesc().functions.UpdateDescriptorSets( device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies );
+		return g_library.dispatch.UpdateDescriptorSets( device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkCreateFramebuffer( VkDevice device, const  VkFramebufferCreateInfo* pCreateInfo, const  VkAllocationCallbacks* pAllocator, VkFramebuffer* pFramebuffer )
 	{
-		return g_library.getSelectedDesc().functions.CreateFramebuffer( device, pCreateInfo, pAllocator, pFramebuffer );
+		return g_library.dispatch.CreateFramebuffer( device, pCreateInfo, pAllocator, pFramebuffer );
 	}
 
 	Ashes_API void VKAPI_CALL vkDestroyFramebuffer( VkDevice device, VkFramebuffer framebuffer, const  VkAllocationCallbacks* pAllocator )
 	{
-		return g_library.getSelectedDesc().functions.DestroyFramebuffer( device, framebuffer, pAllocator );
+		return g_library.dispatch.DestroyFramebuffer( device, framebuffer, pAllocator );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkCreateRenderPass( VkDevice device, const  VkRenderPassCreateInfo* pCreateInfo, const  VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass )
 	{
-		return g_library.getSelectedDesc().functions.CreateRenderPass( device, pCreateInfo, pAllocator, pRenderPass );
+		return g_library.dispatch.CreateRenderPass( device, pCreateInfo, pAllocator, pRenderPass );
 	}
 
 	Ashes_API void VKAPI_CALL vkDestroyRenderPass( VkDevice device, VkRenderPass renderPass, const  VkAllocationCallbacks* pAllocator )
 	{
-		return g_library.getSelectedDesc().functions.DestroyRenderPass( device, renderPass, pAllocator );
+		return g_library.dispatch.DestroyRenderPass( device, renderPass, pAllocator );
 	}
 
 	Ashes_API void VKAPI_CALL vkGetRenderAreaGranularity( VkDevice device, VkRenderPass renderPass, VkExtent2D*  pGranularity )
 	{
-		return g_library.getSelectedDesc().functions.GetRenderAreaGranularity( device, renderPass, pGranularity );
+		return g_library.dispatch.GetRenderAreaGranularity( device, renderPass, pGranularity );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkCreateCommandPool( VkDevice device, const  VkCommandPoolCreateInfo* pCreateInfo, const  VkAllocationCallbacks* pAllocator, VkCommandPool* pCommandPool )
 	{
-		return g_library.getSelectedDesc().functions.CreateCommandPool( device, pCreateInfo, pAllocator, pCommandPool );
+		return g_library.dispatch.CreateCommandPool( device, pCreateInfo, pAllocator, pCommandPool );
 	}
 
 	Ashes_API void VKAPI_CALL vkDestroyCommandPool( VkDevice device, VkCommandPool commandPool, const  VkAllocationCallbacks* pAllocator )
 	{
-		return g_library.getSelectedDesc().functions.DestroyCommandPool( device, commandPool, pAllocator );
+		return g_library.dispatch.DestroyCommandPool( device, commandPool, pAllocator );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkResetCommandPool( VkDevice device, VkCommandPool commandPool, VkCommandPoolResetFlags  flags )
 	{
-		return g_library.getSelectedDesc().functions.ResetCommandPool( device, commandPool, flags );
+		return g_library.dispatch.ResetCommandPool( device, commandPool, flags );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkAllocateCommandBuffers( VkDevice device, const  VkCommandBufferAllocateInfo* pAllocateInfo, VkCommandBuffer* pCommandBuffers )
 	{
-		return g_library.getSelectedDesc().functions.AllocateCommandBuffers( device, pAllocateInfo, pCommandBuffers );
+		return g_library.dispatch.AllocateCommandBuffers( device, pAllocateInfo, pCommandBuffers );
 	}
 
 	Ashes_API void VKAPI_CALL vkFreeCommandBuffers( VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount, const  VkCommandBuffer* pCommandBuffers )
 	{
-		return g_library.getSelectedDesc().functions.FreeCommandBuffers( device, commandPool, commandBufferCount, pCommandBuffers );
+		return g_library.dispatch.FreeCommandBuffers( device, commandPool, commandBufferCount, pCommandBuffers );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkBeginCommandBuffer( VkCommandBuffer commandBuffer, const  VkCommandBufferBeginInfo* pBeginInfo )
 	{
-		return g_library.getSelectedDesc().functions.BeginCommandBuffer( commandBuffer, pBeginInfo );
+		return g_library.dispatch.BeginCommandBuffer( commandBuffer, pBeginInfo );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkEndCommandBuffer( VkCommandBuffer commandBuffer )
 	{
-		return g_library.getSelectedDesc().functions.EndCommandBuffer( commandBuffer );
+		return g_library.dispatch.EndCommandBuffer( commandBuffer );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkResetCommandBuffer( VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags )
 	{
-		return g_library.getSelectedDesc().functions.ResetCommandBuffer( commandBuffer, flags );
+		return g_library.dispatch.ResetCommandBuffer( commandBuffer, flags );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdBindPipeline( VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline  pipeline )
 	{
-		return g_library.getSelectedDesc().functions.CmdBindPipeline( commandBuffer, pipelineBindPoint, pipeline );
+		return g_library.dispatch.CmdBindPipeline( commandBuffer, pipelineBindPoint, pipeline );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdSetViewport( VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const  VkViewport* pViewports )
 	{
-		return g_library.getSelectedDesc().functions.CmdSetViewport( commandBuffer, firstViewport, viewportCount, pViewports );
+		return g_library.dispatch.CmdSetViewport( commandBuffer, firstViewport, viewportCount, pViewports );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdSetScissor( VkCommandBuffer commandBuffer, uint32_t firstScissor, uint32_t scissorCount, const  VkRect2D* pScissors )
 	{
-		return g_library.getSelectedDesc().functions.CmdSetScissor( commandBuffer, firstScissor, scissorCount, pScissors );
+		return g_library.dispatch.CmdSetScissor( commandBuffer, firstScissor, scissorCount, pScissors );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdSetLineWidth( VkCommandBuffer commandBuffer, float lineWidth )
 	{
-		return g_library.getSelectedDesc().functions.CmdSetLineWidth( commandBuffer, lineWidth );
+		return g_library.dispatch.CmdSetLineWidth( commandBuffer, lineWidth );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdSetDepthBias( VkCommandBuffer commandBuffer, float depthBiasConstantFactor, float depthBiasClamp, float depthBiasSlopeFactor )
 	{
-		return g_library.getSelectedDesc().functions.CmdSetDepthBias( commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor );
+		return g_library.dispatch.CmdSetDepthBias( commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdSetBlendConstants( VkCommandBuffer commandBuffer, const  float blendConstants[4] )
 	{
-		return g_library.getSelectedDesc().functions.CmdSetBlendConstants( commandBuffer, blendConstants );
+		return g_library.dispatch.CmdSetBlendConstants( commandBuffer, blendConstants );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdSetDepthBounds( VkCommandBuffer commandBuffer, float minDepthBounds, float  maxDepthBounds )
 	{
-		return g_library.getSelectedDesc().functions.CmdSetDepthBounds( commandBuffer, minDepthBounds, maxDepthBounds );
+		return g_library.dispatch.CmdSetDepthBounds( commandBuffer, minDepthBounds, maxDepthBounds );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdSetStencilCompareMask( VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t  compareMask )
 	{
-		return g_library.getSelectedDesc().functions.CmdSetStencilCompareMask( commandBuffer, faceMask, compareMask );
+		return g_library.dispatch.CmdSetStencilCompareMask( commandBuffer, faceMask, compareMask );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdSetStencilWriteMask( VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t  writeMask )
 	{
-		return g_library.getSelectedDesc().functions.CmdSetStencilWriteMask( commandBuffer, faceMask, writeMask );
+		return g_library.dispatch.CmdSetStencilWriteMask( commandBuffer, faceMask, writeMask );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdSetStencilReference( VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t  reference )
 	{
-		return g_library.getSelectedDesc().functions.CmdSetStencilReference( commandBuffer, faceMask, reference );
+		return g_library.dispatch.CmdSetStencilReference( commandBuffer, faceMask, reference );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdBindDescriptorSets( VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t firstSet, uint32_t descriptorSetCount, const  VkDescriptorSet* pDescriptorSets, uint32_t dynamicOffsetCount, const  uint32_t* pDynamicOffsets )
 	{
-		return g_library.getSelectedDesc().functions.CmdBindDescriptorSets( commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets );
+		return g_library.dispatch.CmdBindDescriptorSets( commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdBindIndexBuffer( VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType )
 	{
-		return g_library.getSelectedDesc().functions.CmdBindIndexBuffer( commandBuffer, buffer, offset, indexType );
+		return g_library.dispatch.CmdBindIndexBuffer( commandBuffer, buffer, offset, indexType );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdBindVertexBuffers( VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const  VkBuffer* pBuffers, const  VkDeviceSize* pOffsets )
 	{
-		return g_library.getSelectedDesc().functions.CmdBindVertexBuffers( commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets );
+		return g_library.dispatch.CmdBindVertexBuffers( commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdDraw( VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance )
 	{
-		return g_library.getSelectedDesc().functions.CmdDraw( commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance );
+		return g_library.dispatch.CmdDraw( commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdDrawIndexed( VkCommandBuffer commandBuffer, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance )
 	{
-		return g_library.getSelectedDesc().functions.CmdDrawIndexed( commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance );
+		return g_library.dispatch.CmdDrawIndexed( commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdDrawIndirect( VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride )
 	{
-		return g_library.getSelectedDesc().functions.CmdDrawIndirect( commandBuffer, buffer, offset, drawCount, stride );
+		return g_library.dispatch.CmdDrawIndirect( commandBuffer, buffer, offset, drawCount, stride );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdDrawIndexedIndirect( VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride )
 	{
-		return g_library.getSelectedDesc().functions.CmdDrawIndexedIndirect( commandBuffer, buffer, offset, drawCount, stride );
+		return g_library.dispatch.CmdDrawIndexedIndirect( commandBuffer, buffer, offset, drawCount, stride );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdDispatch( VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ )
 	{
-		return g_library.getSelectedDesc().functions.CmdDispatch( commandBuffer, groupCountX, groupCountY, groupCountZ );
+		return g_library.dispatch.CmdDispatch( commandBuffer, groupCountX, groupCountY, groupCountZ );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdDispatchIndirect( VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize  offset )
 	{
-		return g_library.getSelectedDesc().functions.CmdDispatchIndirect( commandBuffer, buffer, offset );
+		return g_library.dispatch.CmdDispatchIndirect( commandBuffer, buffer, offset );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdCopyBuffer( VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, uint32_t regionCount, const  VkBufferCopy* pRegions )
 	{
-		return g_library.getSelectedDesc().functions.CmdCopyBuffer( commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions );
+		return g_library.dispatch.CmdCopyBuffer( commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdCopyImage( VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const  VkImageCopy* pRegions )
 	{
-		return g_library.getSelectedDesc().functions.CmdCopyImage( commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions );
+		return g_library.dispatch.CmdCopyImage( commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdBlitImage( VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const  VkImageBlit* pRegions, VkFilter filter )
 	{
-		return g_library.getSelectedDesc().functions.CmdBlitImage( commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter );
+		return g_library.dispatch.CmdBlitImage( commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdCopyBufferToImage( VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const  VkBufferImageCopy* pRegions )
 	{
-		return g_library.getSelectedDesc().functions.CmdCopyBufferToImage( commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions );
+		return g_library.dispatch.CmdCopyBufferToImage( commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdCopyImageToBuffer( VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkBuffer dstBuffer, uint32_t regionCount, const  VkBufferImageCopy* pRegions )
 	{
-		return g_library.getSelectedDesc().functions.CmdCopyImageToBuffer( commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions );
+		return g_library.dispatch.CmdCopyImageToBuffer( commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdUpdateBuffer( VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize dataSize, const  void* pData )
 	{
-		return g_library.getSelectedDesc().functions.CmdUpdateBuffer( commandBuffer, dstBuffer, dstOffset, dataSize, pData );
+		return g_library.dispatch.CmdUpdateBuffer( commandBuffer, dstBuffer, dstOffset, dataSize, pData );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdFillBuffer( VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize size, uint32_t data )
 	{
-		return g_library.getSelectedDesc().functions.CmdFillBuffer( commandBuffer, dstBuffer, dstOffset, size, data );
+		return g_library.dispatch.CmdFillBuffer( commandBuffer, dstBuffer, dstOffset, size, data );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdClearColorImage( VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const  VkClearColorValue* pColor, uint32_t rangeCount, const  VkImageSubresourceRange* pRanges )
 	{
-		return g_library.getSelectedDesc().functions.CmdClearColorImage( commandBuffer, image, imageLayout, pColor, rangeCount, pRanges );
+		return g_library.dispatch.CmdClearColorImage( commandBuffer, image, imageLayout, pColor, rangeCount, pRanges );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdClearDepthStencilImage( VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const  VkClearDepthStencilValue* pDepthStencil, uint32_t rangeCount, const  VkImageSubresourceRange* pRanges )
 	{
-		return g_library.getSelectedDesc().functions.CmdClearDepthStencilImage( commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges );
+		return g_library.dispatch.CmdClearDepthStencilImage( commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdClearAttachments( VkCommandBuffer commandBuffer, uint32_t attachmentCount, const  VkClearAttachment* pAttachments, uint32_t rectCount, const  VkClearRect* pRects )
 	{
-		return g_library.getSelectedDesc().functions.CmdClearAttachments( commandBuffer, attachmentCount, pAttachments, rectCount, pRects );
+		return g_library.dispatch.CmdClearAttachments( commandBuffer, attachmentCount, pAttachments, rectCount, pRects );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdResolveImage( VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const  VkImageResolve* pRegions )
 	{
-		return g_library.getSelectedDesc().functions.CmdResolveImage( commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions );
+		return g_library.dispatch.CmdResolveImage( commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdSetEvent( VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags  stageMask )
 	{
-		return g_library.getSelectedDesc().functions.CmdSetEvent( commandBuffer, event, stageMask );
+		return g_library.dispatch.CmdSetEvent( commandBuffer, event, stageMask );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdResetEvent( VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags  stageMask )
 	{
-		return g_library.getSelectedDesc().functions.CmdResetEvent( commandBuffer, event, stageMask );
+		return g_library.dispatch.CmdResetEvent( commandBuffer, event, stageMask );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdWaitEvents( VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers )
 	{
-		return g_library.getSelectedDesc().functions.CmdWaitEvents( commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers );
+		return g_library.dispatch.CmdWaitEvents( commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdPipelineBarrier( VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags, uint32_t memoryBarrierCount, const  VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount, const  VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, const  VkImageMemoryBarrier* pImageMemoryBarriers )
 	{
-		return g_library.getSelectedDesc().functions.CmdPipelineBarrier( commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers );
+		return g_library.dispatch.CmdPipelineBarrier( commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdBeginQuery( VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query, VkQueryControlFlags flags )
 	{
-		return g_library.getSelectedDesc().functions.CmdBeginQuery( commandBuffer, queryPool, query, flags );
+		return g_library.dispatch.CmdBeginQuery( commandBuffer, queryPool, query, flags );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdEndQuery( VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t  query )
 	{
-		return g_library.getSelectedDesc().functions.CmdEndQuery( commandBuffer, queryPool, query );
+		return g_library.dispatch.CmdEndQuery( commandBuffer, queryPool, query );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdResetQueryPool( VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount )
 	{
-		return g_library.getSelectedDesc().functions.CmdResetQueryPool( commandBuffer, queryPool, firstQuery, queryCount );
+		return g_library.dispatch.CmdResetQueryPool( commandBuffer, queryPool, firstQuery, queryCount );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdWriteTimestamp( VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage, VkQueryPool queryPool, uint32_t query )
 	{
-		return g_library.getSelectedDesc().functions.CmdWriteTimestamp( commandBuffer, pipelineStage, queryPool, query );
+		return g_library.dispatch.CmdWriteTimestamp( commandBuffer, pipelineStage, queryPool, query );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdCopyQueryPoolResults( VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize stride, VkQueryResultFlags flags )
 	{
-		return g_library.getSelectedDesc().functions.CmdCopyQueryPoolResults( commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags );
+		return g_library.dispatch.CmdCopyQueryPoolResults( commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdPushConstants( VkCommandBuffer commandBuffer, VkPipelineLayout layout, VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size, const  void* pValues )
 	{
-		return g_library.getSelectedDesc().functions.CmdPushConstants( commandBuffer, layout, stageFlags, offset, size, pValues );
+		return g_library.dispatch.CmdPushConstants( commandBuffer, layout, stageFlags, offset, size, pValues );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdBeginRenderPass( VkCommandBuffer commandBuffer, const  VkRenderPassBeginInfo* pRenderPassBegin, VkSubpassContents contents )
 	{
-		return g_library.getSelectedDesc().functions.CmdBeginRenderPass( commandBuffer, pRenderPassBegin, contents );
+		return g_library.dispatch.CmdBeginRenderPass( commandBuffer, pRenderPassBegin, contents );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdNextSubpass( VkCommandBuffer commandBuffer, VkSubpassContents contents )
 	{
-		return g_library.getSelectedDesc().functions.CmdNextSubpass( commandBuffer, contents );
+		return g_library.dispatch.CmdNextSubpass( commandBuffer, contents );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdEndRenderPass( VkCommandBuffer commandBuffer )
 	{
-		return g_library.getSelectedDesc().functions.CmdEndRenderPass( commandBuffer );
+		return g_library.dispatch.CmdEndRenderPass( commandBuffer );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdExecuteCommands( VkCommandBuffer commandBuffer, uint32_t commandBufferCount, const  VkCommandBuffer* pCommandBuffers )
 	{
-		return g_library.getSelectedDesc().functions.CmdExecuteCommands( commandBuffer, commandBufferCount, pCommandBuffers );
+		return g_library.dispatch.CmdExecuteCommands( commandBuffer, commandBufferCount, pCommandBuffers );
 	}
 
 #endif
@@ -911,142 +1234,142 @@ extern "C"
 
 	Ashes_API VkResult VKAPI_PTR vkEnumerateInstanceVersion( uint32_t * version )
 	{
-		return g_library.getSelectedDesc().functions.EnumerateInstanceVersion( version );
+		return g_library.getDispatch().EnumerateInstanceVersion( version );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkBindBufferMemory2( VkDevice device, uint32_t bindInfoCount, const  VkBindBufferMemoryInfo* pBindInfos )
 	{
-		return g_library.getSelectedDesc().functions.BindBufferMemory2( device, bindInfoCount, pBindInfos );
+		return g_library.dispatch.BindBufferMemory2( device, bindInfoCount, pBindInfos );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkBindImageMemory2( VkDevice device, uint32_t bindInfoCount, const  VkBindImageMemoryInfo* pBindInfos )
 	{
-		return g_library.getSelectedDesc().functions.BindImageMemory2( device, bindInfoCount, pBindInfos );
+		return g_library.dispatch.BindImageMemory2( device, bindInfoCount, pBindInfos );
 	}
 
 	Ashes_API void VKAPI_CALL vkGetDeviceGroupPeerMemoryFeatures( VkDevice device, uint32_t heapIndex, uint32_t localDeviceIndex, uint32_t remoteDeviceIndex, VkPeerMemoryFeatureFlags* pPeerMemoryFeatures )
 	{
-		return g_library.getSelectedDesc().functions.GetDeviceGroupPeerMemoryFeatures( device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures );
+		return g_library.dispatch.GetDeviceGroupPeerMemoryFeatures( device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdSetDeviceMask( VkCommandBuffer commandBuffer, uint32_t deviceMask )
 	{
-		return g_library.getSelectedDesc().functions.CmdSetDeviceMask( commandBuffer, deviceMask );
+		return g_library.dispatch.CmdSetDeviceMask( commandBuffer, deviceMask );
 	}
 
 	Ashes_API void VKAPI_CALL vkCmdDispatchBase( VkCommandBuffer commandBuffer, uint32_t baseGroupX, uint32_t baseGroupY, uint32_t baseGroupZ, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ )
 	{
-		return g_library.getSelectedDesc().functions.CmdDispatchBase( commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ );
+		return g_library.dispatch.CmdDispatchBase( commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkEnumeratePhysicalDeviceGroups( VkInstance instance, uint32_t* pPhysicalDeviceGroupCount, VkPhysicalDeviceGroupProperties*  pPhysicalDeviceGroupProperties )
 	{
-		return g_library.getSelectedDesc().functions.EnumeratePhysicalDeviceGroups( instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties );
+		return g_library.dispatch.EnumeratePhysicalDeviceGroups( instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties );
 	}
 
 	Ashes_API void VKAPI_CALL vkGetImageMemoryRequirements2( VkDevice device, const  VkImageMemoryRequirementsInfo2* pInfo, VkMemoryRequirements2* pMemoryRequirements )
 	{
-		return g_library.getSelectedDesc().functions.GetImageMemoryRequirements2( device, pInfo, pMemoryRequirements );
+		return g_library.dispatch.GetImageMemoryRequirements2( device, pInfo, pMemoryRequirements );
 	}
 
 	Ashes_API void VKAPI_CALL vkGetBufferMemoryRequirements2( VkDevice device, const  VkBufferMemoryRequirementsInfo2* pInfo, VkMemoryRequirements2* pMemoryRequirements )
 	{
-		return g_library.getSelectedDesc().functions.GetBufferMemoryRequirements2( device, pInfo, pMemoryRequirements );
+		return g_library.dispatch.GetBufferMemoryRequirements2( device, pInfo, pMemoryRequirements );
 	}
 
 	Ashes_API void VKAPI_CALL vkGetImageSparseMemoryRequirements2( VkDevice device, const  VkImageSparseMemoryRequirementsInfo2* pInfo, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements2* pSparseMemoryRequirements )
 	{
-		return g_library.getSelectedDesc().functions.GetImageSparseMemoryRequirements2( device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements );
+		return g_library.dispatch.GetImageSparseMemoryRequirements2( device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements );
 	}
 
 	Ashes_API void VKAPI_CALL vkGetPhysicalDeviceFeatures2( VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures2* pFeatures )
 	{
-		return g_library.getSelectedDesc().functions.GetPhysicalDeviceFeatures2( physicalDevice, pFeatures );
+		return g_library.dispatch.GetPhysicalDeviceFeatures2( physicalDevice, pFeatures );
 	}
 
 	Ashes_API void VKAPI_CALL vkGetPhysicalDeviceProperties2( VkPhysicalDevice physicalDevice, VkPhysicalDeviceProperties2* pProperties )
 	{
-		return g_library.getSelectedDesc().functions.GetPhysicalDeviceProperties2( physicalDevice, pProperties );
+		return g_library.dispatch.GetPhysicalDeviceProperties2( physicalDevice, pProperties );
 	}
 
 	Ashes_API void VKAPI_CALL vkGetPhysicalDeviceFormatProperties2( VkPhysicalDevice physicalDevice, VkFormat format, VkFormatProperties2*  pFormatProperties )
 	{
-		return g_library.getSelectedDesc().functions.GetPhysicalDeviceFormatProperties2( physicalDevice, format, pFormatProperties );
+		return g_library.dispatch.GetPhysicalDeviceFormatProperties2( physicalDevice, format, pFormatProperties );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkGetPhysicalDeviceImageFormatProperties2( VkPhysicalDevice physicalDevice, const  VkPhysicalDeviceImageFormatInfo2* pImageFormatInfo, VkImageFormatProperties2* pImageFormatProperties )
 	{
-		return g_library.getSelectedDesc().functions.GetPhysicalDeviceImageFormatProperties2( physicalDevice, pImageFormatInfo, pImageFormatProperties );
+		return g_library.dispatch.GetPhysicalDeviceImageFormatProperties2( physicalDevice, pImageFormatInfo, pImageFormatProperties );
 	}
 
 	Ashes_API void VKAPI_CALL vkGetPhysicalDeviceQueueFamilyProperties2( VkPhysicalDevice physicalDevice, uint32_t* pQueueFamilyPropertyCount, VkQueueFamilyProperties2*  pQueueFamilyProperties )
 	{
-		return g_library.getSelectedDesc().functions.GetPhysicalDeviceQueueFamilyProperties2( physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties );
+		return g_library.dispatch.GetPhysicalDeviceQueueFamilyProperties2( physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties );
 	}
 
 	Ashes_API void VKAPI_CALL vkGetPhysicalDeviceMemoryProperties2( VkPhysicalDevice physicalDevice, VkPhysicalDeviceMemoryProperties2* pMemoryProperties )
 	{
-		return g_library.getSelectedDesc().functions.GetPhysicalDeviceMemoryProperties2( physicalDevice, pMemoryProperties );
+		return g_library.dispatch.GetPhysicalDeviceMemoryProperties2( physicalDevice, pMemoryProperties );
 	}
 
 	Ashes_API void VKAPI_CALL vkGetPhysicalDeviceSparseImageFormatProperties2( VkPhysicalDevice physicalDevice, const  VkPhysicalDeviceSparseImageFormatInfo2* pFormatInfo, uint32_t* pPropertyCount, VkSparseImageFormatProperties2* pProperties )
 	{
-		return g_library.getSelectedDesc().functions.GetPhysicalDeviceSparseImageFormatProperties2( physicalDevice, pFormatInfo, pPropertyCount, pProperties );
+		return g_library.dispatch.GetPhysicalDeviceSparseImageFormatProperties2( physicalDevice, pFormatInfo, pPropertyCount, pProperties );
 	}
 
 	Ashes_API void VKAPI_CALL vkTrimCommandPool( VkDevice device, VkCommandPool commandPool, VkCommandPoolTrimFlags  flags )
 	{
-		return g_library.getSelectedDesc().functions.TrimCommandPool( device, commandPool, flags );
+		return g_library.dispatch.TrimCommandPool( device, commandPool, flags );
 	}
 
 	Ashes_API void VKAPI_CALL vkGetDeviceQueue2( VkDevice device, const  VkDeviceQueueInfo2* pQueueInfo, VkQueue* pQueue )
 	{
-		return g_library.getSelectedDesc().functions.GetDeviceQueue2( device, pQueueInfo, pQueue );
+		return g_library.dispatch.GetDeviceQueue2( device, pQueueInfo, pQueue );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkCreateSamplerYcbcrConversion( VkDevice device, const  VkSamplerYcbcrConversionCreateInfo* pCreateInfo, const  VkAllocationCallbacks* pAllocator, VkSamplerYcbcrConversion* pYcbcrConversion )
 	{
-		return g_library.getSelectedDesc().functions.CreateSamplerYcbcrConversion( device, pCreateInfo, pAllocator, pYcbcrConversion );
+		return g_library.dispatch.CreateSamplerYcbcrConversion( device, pCreateInfo, pAllocator, pYcbcrConversion );
 	}
 
 	Ashes_API void VKAPI_CALL vkDestroySamplerYcbcrConversion( VkDevice device, VkSamplerYcbcrConversion ycbcrConversion, const  VkAllocationCallbacks* pAllocator )
 	{
-		return g_library.getSelectedDesc().functions.DestroySamplerYcbcrConversion( device, ycbcrConversion, pAllocator );
+		return g_library.dispatch.DestroySamplerYcbcrConversion( device, ycbcrConversion, pAllocator );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkCreateDescriptorUpdateTemplate( VkDevice device, const  VkDescriptorUpdateTemplateCreateInfo* pCreateInfo, const  VkAllocationCallbacks* pAllocator, VkDescriptorUpdateTemplate* pDescriptorUpdateTemplate )
 	{
-		return g_library.getSelectedDesc().functions.CreateDescriptorUpdateTemplate( device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate );
+		return g_library.dispatch.CreateDescriptorUpdateTemplate( device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate );
 	}
 
 	Ashes_API void VKAPI_CALL vkDestroyDescriptorUpdateTemplate( VkDevice device, VkDescriptorUpdateTemplate descriptorUpdateTemplate, const  VkAllocationCallbacks* pAllocator )
 	{
-		return g_library.getSelectedDesc().functions.DestroyDescriptorUpdateTemplate( device, descriptorUpdateTemplate, pAllocator );
+		return g_library.dispatch.DestroyDescriptorUpdateTemplate( device, descriptorUpdateTemplate, pAllocator );
 	}
 
 	Ashes_API void VKAPI_CALL vkUpdateDescriptorSetWithTemplate( VkDevice device, VkDescriptorSet descriptorSet, VkDescriptorUpdateTemplate descriptorUpdateTemplate, const  void* pData )
 	{
-		return g_library.getSelectedDesc().functions.UpdateDescriptorSetWithTemplate( device, descriptorSet, descriptorUpdateTemplate, pData );
+		return g_library.dispatch.UpdateDescriptorSetWithTemplate( device, descriptorSet, descriptorUpdateTemplate, pData );
 	}
 
 	Ashes_API void VKAPI_CALL vkGetPhysicalDeviceExternalBufferProperties( VkPhysicalDevice physicalDevice, const  VkPhysicalDeviceExternalBufferInfo* pExternalBufferInfo, VkExternalBufferProperties* pExternalBufferProperties )
 	{
-		return g_library.getSelectedDesc().functions.GetPhysicalDeviceExternalBufferProperties( physicalDevice, pExternalBufferInfo, pExternalBufferProperties );
+		return g_library.dispatch.GetPhysicalDeviceExternalBufferProperties( physicalDevice, pExternalBufferInfo, pExternalBufferProperties );
 	}
 
 	Ashes_API void VKAPI_CALL vkGetPhysicalDeviceExternalFenceProperties( VkPhysicalDevice physicalDevice, const  VkPhysicalDeviceExternalFenceInfo* pExternalFenceInfo, VkExternalFenceProperties* pExternalFenceProperties )
 	{
-		return g_library.getSelectedDesc().functions.GetPhysicalDeviceExternalFenceProperties( physicalDevice, pExternalFenceInfo, pExternalFenceProperties );
+		return g_library.dispatch.GetPhysicalDeviceExternalFenceProperties( physicalDevice, pExternalFenceInfo, pExternalFenceProperties );
 	}
 
 	Ashes_API void VKAPI_CALL vkGetPhysicalDeviceExternalSemaphoreProperties( VkPhysicalDevice physicalDevice, const  VkPhysicalDeviceExternalSemaphoreInfo* pExternalSemaphoreInfo, VkExternalSemaphoreProperties* pExternalSemaphoreProperties )
 	{
-		return g_library.getSelectedDesc().functions.GetPhysicalDeviceExternalSemaphoreProperties( physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties );
+		return g_library.dispatch.GetPhysicalDeviceExternalSemaphoreProperties( physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties );
 	}
 
 	Ashes_API void VKAPI_CALL vkGetDescriptorSetLayoutSupport( VkDevice device, const  VkDescriptorSetLayoutCreateInfo* pCreateInfo, VkDescriptorSetLayoutSupport* pSupport )
 	{
-		return g_library.getSelectedDesc().functions.GetDescriptorSetLayoutSupport( device, pCreateInfo, pSupport );
+		return g_library.dispatch.GetDescriptorSetLayoutSupport( device, pCreateInfo, pSupport );
 	}
 
 #endif
@@ -1056,27 +1379,27 @@ extern "C"
 
 	Ashes_API void VKAPI_CALL vkDestroySurfaceKHR( VkInstance instance, VkSurfaceKHR surface, const  VkAllocationCallbacks* pAllocator )
 	{
-		return g_library.getSelectedDesc().functions.DestroySurfaceKHR( instance, surface, pAllocator );
+		return g_library.dispatch.DestroySurfaceKHR( instance, surface, pAllocator );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkGetPhysicalDeviceSurfaceSupportKHR( VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, VkSurfaceKHR surface, VkBool32* pSupported )
 	{
-		return g_library.getSelectedDesc().functions.GetPhysicalDeviceSurfaceSupportKHR( physicalDevice, queueFamilyIndex, surface, pSupported );
+		return g_library.dispatch.GetPhysicalDeviceSurfaceSupportKHR( physicalDevice, queueFamilyIndex, surface, pSupported );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkGetPhysicalDeviceSurfaceCapabilitiesKHR( VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, VkSurfaceCapabilitiesKHR*  pSurfaceCapabilities )
 	{
-		return g_library.getSelectedDesc().functions.GetPhysicalDeviceSurfaceCapabilitiesKHR( physicalDevice, surface, pSurfaceCapabilities );
+		return g_library.dispatch.GetPhysicalDeviceSurfaceCapabilitiesKHR( physicalDevice, surface, pSurfaceCapabilities );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkGetPhysicalDeviceSurfaceFormatsKHR( VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pSurfaceFormatCount, VkSurfaceFormatKHR* pSurfaceFormats )
 	{
-		return g_library.getSelectedDesc().functions.GetPhysicalDeviceSurfaceFormatsKHR( physicalDevice, surface, pSurfaceFormatCount, pSurfaceFormats );
+		return g_library.dispatch.GetPhysicalDeviceSurfaceFormatsKHR( physicalDevice, surface, pSurfaceFormatCount, pSurfaceFormats );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkGetPhysicalDeviceSurfacePresentModesKHR( VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pPresentModeCount, VkPresentModeKHR* pPresentModes )
 	{
-		return g_library.getSelectedDesc().functions.GetPhysicalDeviceSurfacePresentModesKHR( physicalDevice, surface, pPresentModeCount, pPresentModes );
+		return g_library.dispatch.GetPhysicalDeviceSurfacePresentModesKHR( physicalDevice, surface, pPresentModeCount, pPresentModes );
 	}
 
 #endif
@@ -1085,12 +1408,12 @@ extern "C"
 #ifdef VK_KHR_swapchain
 	Ashes_API VkResult VKAPI_CALL vkCreateSwapchainKHR( VkDevice device, const  VkSwapchainCreateInfoKHR* pCreateInfo, const  VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchain )
 	{
-		return g_library.getSelectedDesc().functions.CreateSwapchainKHR( device, pCreateInfo, pAllocator, pSwapchain );
+		return g_library.dispatch.CreateSwapchainKHR( device, pCreateInfo, pAllocator, pSwapchain );
 	}
 
 	Ashes_API void VKAPI_CALL vkDestroySwapchainKHR( VkDevice device, VkSwapchainKHR swapchain, const  VkAllocationCallbacks* pAllocator )
 	{
-		return g_library.getSelectedDesc().functions.DestroySwapchainKHR( device, swapchain, pAllocator );
+		return g_library.dispatch.DestroySwapchainKHR( device, swapchain, pAllocator );
 	}
 
 #endif
@@ -1101,22 +1424,22 @@ extern "C"
 
 	Ashes_API VkResult VKAPI_CALL vkGetDeviceGroupPresentCapabilitiesKHR( VkDevice device, VkDeviceGroupPresentCapabilitiesKHR* pDeviceGroupPresentCapabilities )
 	{
-		return g_library.getSelectedDesc().functions.GetDeviceGroupPresentCapabilitiesKHR( device, pDeviceGroupPresentCapabilities );
+		return g_library.dispatch.GetDeviceGroupPresentCapabilitiesKHR( device, pDeviceGroupPresentCapabilities );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkGetDeviceGroupSurfacePresentModesKHR( VkDevice device, VkSurfaceKHR surface, VkDeviceGroupPresentModeFlagsKHR*  pModes )
 	{
-		return g_library.getSelectedDesc().functions.GetDeviceGroupSurfacePresentModesKHR( device, surface, pModes );
+		return g_library.dispatch.GetDeviceGroupSurfacePresentModesKHR( device, surface, pModes );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkGetPhysicalDevicePresentRectanglesKHR( VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pRectCount, VkRect2D* pRects )
 	{
-		return g_library.getSelectedDesc().functions.GetPhysicalDevicePresentRectanglesKHR( physicalDevice, surface, pRectCount, pRects );
+		return g_library.dispatch.GetPhysicalDevicePresentRectanglesKHR( physicalDevice, surface, pRectCount, pRects );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkAcquireNextImage2KHR( VkDevice device, const  VkAcquireNextImageInfoKHR* pAcquireInfo, uint32_t* pImageIndex )
 	{
-		return g_library.getSelectedDesc().functions.AcquireNextImage2KHR( device, pAcquireInfo, pImageIndex );
+		return g_library.dispatch.AcquireNextImage2KHR( device, pAcquireInfo, pImageIndex );
 	}
 
 #	endif
@@ -1130,7 +1453,7 @@ extern "C"
 		uint32_t * pPropertyCount,
 		VkDisplayPropertiesKHR * pProperties )
 	{
-		return g_library.getSelectedDesc().functions.GetPhysicalDeviceDisplayPropertiesKHR( physicalDevice, pPropertyCount, pProperties );
+		return g_library.dispatch.GetPhysicalDeviceDisplayPropertiesKHR( physicalDevice, pPropertyCount, pProperties );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkGetPhysicalDeviceDisplayPlanePropertiesKHR(
@@ -1138,7 +1461,7 @@ extern "C"
 		uint32_t * pPropertyCount,
 		VkDisplayPlanePropertiesKHR * pProperties )
 	{
-		return g_library.getSelectedDesc().functions.GetPhysicalDeviceDisplayPlanePropertiesKHR( physicalDevice, pPropertyCount, pProperties );
+		return g_library.dispatch.GetPhysicalDeviceDisplayPlanePropertiesKHR( physicalDevice, pPropertyCount, pProperties );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkGetDisplayPlaneSupportedDisplaysKHR(
@@ -1147,7 +1470,7 @@ extern "C"
 		uint32_t * pDisplayCount,
 		VkDisplayKHR * pDisplays )
 	{
-		return g_library.getSelectedDesc().functions.GetDisplayPlaneSupportedDisplaysKHR( physicalDevice, planeIndex, pDisplayCount, pDisplays );
+		return g_library.dispatch.GetDisplayPlaneSupportedDisplaysKHR( physicalDevice, planeIndex, pDisplayCount, pDisplays );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkGetDisplayModePropertiesKHR(
@@ -1156,7 +1479,7 @@ extern "C"
 		uint32_t * pPropertyCount,
 		VkDisplayModePropertiesKHR * pProperties )
 	{
-		return g_library.getSelectedDesc().functions.GetDisplayModePropertiesKHR( physicalDevice, display, pPropertyCount, pProperties );
+		return g_library.dispatch.GetDisplayModePropertiesKHR( physicalDevice, display, pPropertyCount, pProperties );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkCreateDisplayModeKHR(
@@ -1166,7 +1489,7 @@ extern "C"
 		const VkAllocationCallbacks * pAllocator,
 		VkDisplayModeKHR * pMode )
 	{
-		return g_library.getSelectedDesc().functions.CreateDisplayModeKHR( physicalDevice, display, pCreateInfo, pAllocator, pMode );
+		return g_library.dispatch.CreateDisplayModeKHR( physicalDevice, display, pCreateInfo, pAllocator, pMode );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkGetDisplayPlaneCapabilitiesKHR(
@@ -1175,7 +1498,7 @@ extern "C"
 		uint32_t planeIndex,
 		VkDisplayPlaneCapabilitiesKHR * pCapabilities )
 	{
-		return g_library.getSelectedDesc().functions.GetDisplayPlaneCapabilitiesKHR( physicalDevice, mode, planeIndex, pCapabilities );
+		return g_library.dispatch.GetDisplayPlaneCapabilitiesKHR( physicalDevice, mode, planeIndex, pCapabilities );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkCreateDisplayPlaneSurfaceKHR(
@@ -1184,7 +1507,7 @@ extern "C"
 		const VkAllocationCallbacks * pAllocator,
 		VkSurfaceKHR * pSurface )
 	{
-		return g_library.getSelectedDesc().functions.CreateDisplayPlaneSurfaceKHR( instance, pCreateInfo, pAllocator, pSurface );
+		return g_library.dispatch.CreateDisplayPlaneSurfaceKHR( instance, pCreateInfo, pAllocator, pSurface );
 	}
 
 #endif
@@ -1195,7 +1518,7 @@ extern "C"
 
 	Ashes_API VkResult VKAPI_CALL vkCreateAndroidSurfaceKHR( VkInstance instance, const  VkAndroidSurfaceCreateInfoKHR* pCreateInfo, const  VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface )
 	{
-		return g_library.getSelectedDesc().functions.CreateAndroidSurfaceKHR( instance, pCreateInfo, pAllocator, pSurface );
+		return g_library.dispatch.CreateAndroidSurfaceKHR( instance, pCreateInfo, pAllocator, pSurface );
 	}
 
 #	endif
@@ -1207,7 +1530,7 @@ extern "C"
 
 	Ashes_API VkResult VKAPI_CALL vkCreateImagePipeSurfaceFUCHSIA( VkInstance instance, const  VkImagePipeSurfaceCreateInfoFUCHSIA* pCreateInfo, const  VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface )
 	{
-		return g_library.getSelectedDesc().functions.CreateImagePipeSurfaceFUCHSIA( instance, pCreateInfo, pAllocator, pSurface );
+		return g_library.dispatch.CreateImagePipeSurfaceFUCHSIA( instance, pCreateInfo, pAllocator, pSurface );
 	}
 
 #	endif
@@ -1219,7 +1542,7 @@ extern "C"
 
 	Ashes_API VkResult VKAPI_CALL vkCreateIOSSurfaceMVK( VkInstance instance, const  VkIOSSurfaceCreateInfoMVK* pCreateInfo, const  VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface )
 	{
-		return g_library.getSelectedDesc().functions.CreateIOSSurfaceMVK( instance, pCreateInfo, pAllocator, pSurface );
+		return g_library.dispatch.CreateIOSSurfaceMVK( instance, pCreateInfo, pAllocator, pSurface );
 	}
 
 #	endif
@@ -1230,7 +1553,7 @@ extern "C"
 
 	Ashes_API VkResult VKAPI_CALL vkCreateMacOSSurfaceMVK( VkInstance instance, const  VkMacOSSurfaceCreateInfoMVK* pCreateInfo, const  VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface )
 	{
-		return g_library.getSelectedDesc().functions.CreateMacOSSurfaceMVK( instance, pCreateInfo, pAllocator, pSurface );
+		return g_library.dispatch.CreateMacOSSurfaceMVK( instance, pCreateInfo, pAllocator, pSurface );
 	}
 
 #	endif
@@ -1241,7 +1564,7 @@ extern "C"
 
 	Ashes_API VkResult VKAPI_CALL vkCreateViSurfaceNN( VkInstance instance, const  VkViSurfaceCreateInfoNN* pCreateInfo, const  VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface )
 	{
-		return g_library.getSelectedDesc().functions.CreateViSurfaceNN( instance, pCreateInfo, pAllocator, pSurface );
+		return g_library.dispatch.CreateViSurfaceNN( instance, pCreateInfo, pAllocator, pSurface );
 	}
 
 #	endif
@@ -1252,12 +1575,12 @@ extern "C"
 
 	Ashes_API VkResult VKAPI_CALL vkCreateXcbSurfaceKHR( VkInstance instance, const  VkXcbSurfaceCreateInfoKHR* pCreateInfo, const  VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface )
 	{
-		return g_library.getSelectedDesc().functions.CreateXcbSurfaceKHR( instance, pCreateInfo, pAllocator, pSurface );
+		return g_library.dispatch.CreateXcbSurfaceKHR( instance, pCreateInfo, pAllocator, pSurface );
 	}
 
 	Ashes_API VkBool32 VKAPI_CALL vkGetPhysicalDeviceXcbPresentationSupportKHR( VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, xcb_connection_t* connection, xcb_visualid_t visual_id )
 	{
-		return g_library.getSelectedDesc().functions.GetPhysicalDeviceXcbPresentationSupportKHR( physicalDevice, queueFamilyIndex, connection, visual_id );
+		return g_library.dispatch.GetPhysicalDeviceXcbPresentationSupportKHR( physicalDevice, queueFamilyIndex, connection, visual_id );
 	}
 
 #	endif
@@ -1267,12 +1590,12 @@ extern "C"
 
 	Ashes_API VkResult VKAPI_CALL vkCreateXlibSurfaceKHR( VkInstance instance, const  VkXlibSurfaceCreateInfoKHR* pCreateInfo, const  VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface )
 	{
-		return g_library.getSelectedDesc().functions.CreateXlibSurfaceKHR( instance, pCreateInfo, pAllocator, pSurface );
+		return g_library.dispatch.CreateXlibSurfaceKHR( instance, pCreateInfo, pAllocator, pSurface );
 	}
 
 	Ashes_API VkBool32 VKAPI_CALL vkGetPhysicalDeviceXlibPresentationSupportKHR( VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, Display* dpy, VisualID visualID )
 	{
-		return g_library.getSelectedDesc().functions.GetPhysicalDeviceXlibPresentationSupportKHR( physicalDevice, queueFamilyIndex, dpy, visualID );
+		return g_library.dispatch.GetPhysicalDeviceXlibPresentationSupportKHR( physicalDevice, queueFamilyIndex, dpy, visualID );
 	}
 
 #	endif
@@ -1282,12 +1605,12 @@ extern "C"
 
 	Ashes_API VkResult VKAPI_CALL vkCreateWaylandSurfaceKHR( VkInstance instance, const  VkWaylandSurfaceCreateInfoKHR* pCreateInfo, const  VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface )
 	{
-		return g_library.getSelectedDesc().functions.CreateWaylandSurfaceKHR( instance, pCreateInfo, pAllocator, pSurface );
+		return g_library.dispatch.CreateWaylandSurfaceKHR( instance, pCreateInfo, pAllocator, pSurface );
 	}
 
 	Ashes_API VkBool32 VKAPI_CALL vkGetPhysicalDeviceWaylandPresentationSupportKHR( VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, struct wl_display* display )
 	{
-		return g_library.getSelectedDesc().functions.GetPhysicalDeviceWaylandPresentationSupportKHR( physicalDevice, queueFamilyIndex, display );
+		return g_library.dispatch.GetPhysicalDeviceWaylandPresentationSupportKHR( physicalDevice, queueFamilyIndex, display );
 	}
 
 #	endif
@@ -1298,12 +1621,12 @@ extern "C"
 
 	Ashes_API VkResult VKAPI_CALL vkCreateWin32SurfaceKHR( VkInstance instance, const  VkWin32SurfaceCreateInfoKHR* pCreateInfo, const  VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface )
 	{
-		return g_library.getSelectedDesc().functions.CreateWin32SurfaceKHR( instance, pCreateInfo, pAllocator, pSurface );
+		return g_library.dispatch.CreateWin32SurfaceKHR( instance, pCreateInfo, pAllocator, pSurface );
 	}
 
 	Ashes_API VkBool32 VKAPI_CALL vkGetPhysicalDeviceWin32PresentationSupportKHR( VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex )
 	{
-		return g_library.getSelectedDesc().functions.GetPhysicalDeviceWin32PresentationSupportKHR( physicalDevice, queueFamilyIndex );
+		return g_library.dispatch.GetPhysicalDeviceWin32PresentationSupportKHR( physicalDevice, queueFamilyIndex );
 	}
 
 #	endif
@@ -1315,12 +1638,12 @@ extern "C"
 
 	Ashes_API VkResult VKAPI_CALL vkAcquireXlibDisplayEXT( VkPhysicalDevice physicalDevice, Display* dpy, VkDisplayKHR  display )
 	{
-		return g_library.getSelectedDesc().functions.AcquireXlibDisplayEXT( physicalDevice, dpy, display );
+		return g_library.dispatch.AcquireXlibDisplayEXT( physicalDevice, dpy, display );
 	}
 
 	Ashes_API VkResult VKAPI_CALL vkGetRandROutputDisplayEXT( VkPhysicalDevice physicalDevice, Display* dpy, RROutput rrOutput, VkDisplayKHR* pDisplay )
 	{
-		return g_library.getSelectedDesc().functions.GetRandROutputDisplayEXT( physicalDevice, dpy, rrOutput, pDisplay );
+		return g_library.dispatch.GetRandROutputDisplayEXT( physicalDevice, dpy, rrOutput, pDisplay );
 	}
 
 #	endif
@@ -12,33 +12,78 @@
 #include <algorithm>
 #include <cassert>
 #include <cstring>
-#include <functional>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <regex>
 #include <set>
 #include <stdexcept>
 #include <vector>
 #pragma warning( pop )
 
+/**
+*\brief
+*	A renderer plugin file, which is loaded only once it's needed.
+*\remarks
+*	Until it's probed, its description may come from the plugins cache.
+*/
 struct Plugin
 {
 	using PFN_ashUpdatePluginSupport = VkResult( VKAPI_PTR * )();
 
+	enum class State
+	{
+		//! Only the file is known.
+		eListed,
+		//! The description comes from the cache.
+		eCached,
+		//! The plugin is loaded, and the description comes from it.
+		eProbed,
+	};
+
+	std::string path;
 	std::unique_ptr< ashes::DynamicLibrary > library;
-	PFN_ashGetPluginDescription fnGetPluginDescription;
-	AshPluginDescription description;
+	PFN_ashGetPluginDescription fnGetPluginDescription{};
+	AshPluginDescription description{};
+	State state{ State::eListed };
 
-	Plugin( std::unique_ptr< ashes::DynamicLibrary > lib )
-		: library{ std::move( lib ) }
+	explicit Plugin( std::string filePath )
+		: path{ std::move( filePath ) }
 	{
-
-		if ( !library->getFunction( "ashGetPluginDescription", fnGetPluginDescription ) )
+	}
+	/**
+	*\brief
+	*	Loads the plugin, and retrieves its description, if not already done.
+	*\return
+	*	\p false if the file couldn't be loaded, or isn't a renderer plugin.
+	*/
+	bool probe()
+	{
+		if ( state != State::eProbed )
 		{
-			throw ashes::BaseException{ "[" + ashes::getFileName( library->getPath() ) + "] is not a renderer plugin" };
+			state = State::eProbed;
+
+			try
+			{
+				library = std::make_unique< ashes::DynamicLibrary >( path );
+
+				if ( !library->getFunction( "ashGetPluginDescription", fnGetPluginDescription ) )
+				{
+					throw ashes::BaseException{ "[" + ashes::getFileName( library->getPath() ) + "] is not a renderer plugin" };
+				}
+
+				fnGetPluginDescription( &description );
+			}
+			catch ( ashes::BaseException & exc )
+			{
+				// Prevent useless noisy message
+				std::clog << exc.what() << std::endl;
+				library.reset();
+				description.support.supported = VK_FALSE;
+			}
 		}
 
-		fnGetPluginDescription( &description );
+		return library != nullptr;
 	}
 };
 
@@ -67,62 +112,24 @@ namespace details
 	Plugin * findFirstSupportedPlugin( PluginArray & plugins );
 	Plugin * findDefaultPlugin( PluginArray & plugins );
 	PluginArray listPlugins();
+	void updatePluginsCache( PluginArray const & plugins );
 }
 
 struct PluginLibrary
 {
-	inline PluginLibrary()
-	{
-		getSelectedDesc = [this]() -> AshPluginDescription &
-		{
-			( void )init();
-			return getSelectedDesc();
-		};
-	}
-
+	/**
+	*\brief
+	*	Lists the plugins and selects the default one, once, whichever thread comes first.
+	*/
 	inline VkResult init()
 	{
-		VkResult result = VK_SUCCESS;
-
-		if ( !selectedPlugin )
-		{
-			plugins = details::listPlugins();
-
-			if ( plugins.empty() )
-			{
-				result = VK_ERROR_INITIALIZATION_FAILED;
-			}
-			else
-			{
-				selectedPlugin = details::findDefaultPlugin( plugins );
-
-				if ( !selectedPlugin )
-				{
-					selectedPlugin = details::findFirstSupportedPlugin( plugins );
-				}
-
-				if ( selectedPlugin )
-				{
-					result = VK_SUCCESS;
-				}
-				else
-				{
-					std::cerr << "Couldn't find a suitable plugin" << std::endl;
-					result = VK_ERROR_INITIALIZATION_FAILED;
-				}
-			}
-
-			if ( result == VK_SUCCESS )
+		std::call_once( initFlag
+			, [this]()
 			{
-				getSelectedDesc = [this]()noexcept -> AshPluginDescription &
-				{
-					return selectedPlugin->description;
-				};
-			}
-		}
-
-		assert( result == VK_SUCCESS );
-		return result;
+				initResult = doInit();
+			} );
+		assert( initResult == VK_SUCCESS );
+		return initResult;
 	}
 
 	inline VkResult selectDesc( AshPluginDescription const & description )
@@ -140,13 +147,78 @@ struct PluginLibrary
 			return VK_ERROR_INITIALIZATION_FAILED;
 		}
 
-		selectedPlugin = &( *it );
-		return VK_SUCCESS;
+		return doSelect( *it )
+			? VK_SUCCESS
+			: VK_ERROR_INITIALIZATION_FAILED;
 	}
 
-	using SelectedDescGetter = std::function< AshPluginDescription & () >;
+	inline AshPluginDescription & getSelectedDesc()
+	{
+		( void )init();
+		return selectedPlugin->description;
+	}
+	/**
+	*\return
+	*	The dispatch table, after making sure a plugin is selected.
+	*\remarks
+	*	Only needed by the functions that can be called first, the other ones use \p dispatch directly.
+	*/
+	inline AshPluginStaticFunction const & getDispatch()
+	{
+		( void )init();
+		return dispatch;
+	}
+
+	//! The selected plugin's functions, copied when it's selected, so that each entry point is a single indirect call.
+	alignas( 64 ) AshPluginStaticFunction dispatch{};
 	PluginArray plugins;
 	bool isUsingICD{ false };
 	Plugin * selectedPlugin{ nullptr };
-	SelectedDescGetter getSelectedDesc;
+
+private:
+	inline VkResult doInit()
+	{
+		VkResult result = VK_SUCCESS;
+		plugins = details::listPlugins();
+
+		if ( plugins.empty() )
+		{
+			result = VK_ERROR_INITIALIZATION_FAILED;
+		}
+		else
+		{
+			auto plugin = details::findDefaultPlugin( plugins );
+
+			if ( !plugin )
+			{
+				plugin = details::findFirstSupportedPlugin( plugins );
+			}
+
+			if ( !plugin
+				|| !doSelect( *plugin ) )
+			{
+				std::cerr << "Couldn't find a suitable plugin" << std::endl;
+				result = VK_ERROR_INITIALIZATION_FAILED;
+			}
+
+			details::updatePluginsCache( plugins );
+		}
+
+		return result;
+	}
+
+	inline bool doSelect( Plugin & plugin )
+	{
+		if ( !plugin.probe() )
+		{
+			return false;
+		}
+
+		selectedPlugin = &plugin;
+		dispatch = plugin.description.functions;
+		return true;
+	}
+
+	std::once_flag initFlag;
+	VkResult initResult{ VK_ERROR_INITIALIZATION_FAILED };
 };
@@ -3,10 +3,13 @@
 #if defined( __APPLE__ )
 
 #include <cassert>
+#include <cerrno>
+#include <cstdlib>
 #include <iostream>
 
 #include <sys/stat.h>
 
+#include <dlfcn.h>
 #include <unistd.h>
 #include <dirent.h>
 #include <pwd.h>
@@ -117,6 +120,67 @@ namespace ashes
 		result = getPath( result );
 		return result;
 	}
+
+	std::string getModulePath( void const * address )
+	{
+		Dl_info info{};
+
+		if ( dladdr( address, &info ) == 0
+			|| info.dli_fname == nullptr )
+		{
+			return std::string{};
+		}
+
+		return info.dli_fname;
+	}
+
+	std::string getCacheDirectory()
+	{
+		std::string result;
+
+		if ( auto cache = getenv( "XDG_CACHE_HOME" );
+			cache && *cache )
+		{
+			result = cache;
+		}
+		else if ( auto home = getenv( "HOME" );
+			home && *home )
+		{
+			result = std::string{ home } / "Library" / "Caches";
+		}
+		else if ( auto pw = getpwuid( getuid() ) )
+		{
+			result = std::string{ pw->pw_dir } / "Library" / "Caches";
+		}
+
+		if ( !result.empty() )
+		{
+			mkdir( result.c_str(), 0755 );
+			result = result / "ashes";
+
+			if ( mkdir( result.c_str(), 0755 ) != 0
+				&& errno != EEXIST )
+			{
+				result.clear();
+			}
+		}
+
+		return result;
+	}
+
+	std::string getFileStamp( std::string const & path )
+	{
+		struct stat status{};
+
+		if ( stat( path.c_str(), &status ) != 0 )
+		{
+			return std::string{};
+		}
+
+		return std::to_string( status.st_mtimespec.tv_sec )
+			+ "." + std::to_string( status.st_mtimespec.tv_nsec )
+			+ ":" + std::to_string( status.st_size );
+	}
 }
 
 std::string operator/( std::string const & lhs, std::string const & rhs )
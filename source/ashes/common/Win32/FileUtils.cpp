@@ -13,6 +13,7 @@
 #include <sstream>
 
 #include <cstdio>
+#include <cstdlib>
 #include <cstring>
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -103,6 +104,70 @@ namespace ashes
 		result = getPath( result );
 		return result;
 	}
+
+	std::string getModulePath( void const * address )
+	{
+		HMODULE module{};
+
+		if ( !::GetModuleHandleExA( GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT
+			, static_cast< LPCSTR >( address )
+			, &module ) )
+		{
+			return std::string{};
+		}
+
+		std::array< char, FILENAME_MAX > path{};
+
+		if ( DWORD ret = ::GetModuleFileNameA( module, path.data(), DWORD( sizeof( char ) * path.size() ) );
+			ret == 0 )
+		{
+			return std::string{};
+		}
+
+		return path.data();
+	}
+
+	std::string getCacheDirectory()
+	{
+		std::error_code error;
+		std::filesystem::path result;
+
+		if ( auto cache = getenv( "LOCALAPPDATA" );
+			cache && *cache )
+		{
+			result = cache;
+		}
+		else
+		{
+			result = std::filesystem::temp_directory_path( error );
+		}
+
+		if ( error || result.empty() )
+		{
+			return std::string{};
+		}
+
+		result /= "ashes";
+		std::filesystem::create_directories( result, error );
+		return error
+			? std::string{}
+			: result.string();
+	}
+
+	std::string getFileStamp( std::string const & path )
+	{
+		std::error_code error;
+		auto time = std::filesystem::last_write_time( path, error );
+
+		if ( error )
+		{
+			return std::string{};
+		}
+
+		auto size = std::filesystem::file_size( path, error );
+		return std::to_string( time.time_since_epoch().count() )
+			+ ":" + std::to_string( error ? 0u : size );
+	}
 }
 
 std::string operator/( std::string const & lhs, std::string const & rhs )
@@ -8,6 +8,8 @@
 
 #include "ashesd3d11_api.hpp"
 
+#include <renderer/RendererCommon/ProcAddrTable.hpp>
+
 #include <ashes/common/Exception.hpp>
 
 #include <cstring>
@@ -4555,125 +4557,118 @@ namespace ashes::D3D11_NAMESPACE
 			&& get( device )->hasExtension( extension );
 	}
 
-	using InstanceFunctions = std::map< std::string, PFN_vkVoidFunction, std::less<> >;
-	using PhysicalDeviceFunctions = std::map< std::string, PFN_vkVoidFunction, std::less<> >;
-	using DeviceFunctions = std::map< std::string, PFN_vkVoidFunction, std::less<> >;
-
 #pragma warning( push )
 #pragma warning( disable: 4191 )
 
-	InstanceFunctions const & getFunctions( VkInstance instance )
+	namespace
 	{
-		static std::map< VkInstance, InstanceFunctions > functions;
-		auto [it, res] = functions.try_emplace( instance );
-
-		if ( res )
+		ProcAddrTable constexpr procAddrTable
 		{
-			if ( instance != nullptr )
+			std::array
 			{
-				it->second =
-				{
-#define VK_LIB_GLOBAL_FUNCTION( v, x )\
-					{ "vk"#x, checkVersion( instance, v ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
-#define VK_LIB_GLOBAL_FUNCTION_EXT( v, n, x )\
-					{ "vk"#x, checkVersionExt( instance, v, n ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
-#define VK_LIB_INSTANCE_FUNCTION( v, x )\
-					{ "vk"#x, checkVersion( instance, v ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
-#define VK_LIB_INSTANCE_FUNCTION_EXT( v, n, x )\
-					{ "vk"#x, checkVersionExt( instance, v, n ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
-#define VK_LIB_PHYSDEVICE_FUNCTION( v, x )\
-					{ "vk"#x, checkVersion( instance, v ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
-#define VK_LIB_PHYSDEVICE_FUNCTION_EXT( v, n, x )\
-					{ "vk"#x, checkVersionExt( instance, v, n ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
-#define VK_LIB_DEVICE_FUNCTION( v, x )\
-					{ "vk"#x, checkVersion( instance, v ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
-#define VK_LIB_DEVICE_FUNCTION_EXT( v, n, x )\
-					{ "vk"#x, checkVersionExt( instance, v, n ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
-#include <ashes/ashes_functions_list.hpp>
-				};
+#include <renderer/RendererCommon/ProcAddrEntries.inl>
 			}
-			else
-			{
-				it->second =
+		};
+		using ProcAddrMask = ProcMask< procAddrTable.size() >;
+
+		std::array< PFN_vkVoidFunction, procAddrTable.size() > const procAddrFunctions
+		{
+#include <renderer/RendererCommon/ProcAddrFunctions.inl>
+		};
+
+		ProcAddrMask const & getInstanceMask( VkInstance instance )
+		{
+			static ProcMaskRegistry< VkInstance, procAddrTable.size() > masks;
+			return masks.get( instance
+				, [instance]( ProcAddrMask & mask )
 				{
-#define VK_LIB_GLOBAL_FUNCTION( v, x )\
-					{ "vk"#x, PFN_vkVoidFunction( vk##x ) },
-#define VK_LIB_INSTANCE_FUNCTION( v, x )
-#define VK_LIB_PHYSDEVICE_FUNCTION( v, x )
-#define VK_LIB_DEVICE_FUNCTION( v, x )
-#define VK_LIB_GLOBAL_FUNCTION_EXT( v, n, x )
-#define VK_LIB_INSTANCE_FUNCTION_EXT( v, n, x )
-#define VK_LIB_PHYSDEVICE_FUNCTION_EXT( v, n, x )
-#define VK_LIB_DEVICE_FUNCTION_EXT( v, n, x )
-#include <ashes/ashes_functions_list.hpp>
-				};
-			}
+					fillProcMask( procAddrTable
+						, mask
+						, [instance]( ProcEntry const & entry )
+						{
+							if ( instance == nullptr )
+							{
+								return entry.scope == ProcScope::eGlobal
+									&& entry.extension.empty();
+							}
+
+							return ( entry.extension.empty() || entry.isStatic )
+								? checkVersion( instance, entry.version )
+								: checkVersionExt( instance, entry.version, entry.extension );
+						} );
+				} );
+		}
+
+		ProcAddrMask const & getPhysicalDeviceMask( VkInstance instance )
+		{
+			static ProcMaskRegistry< VkInstance, procAddrTable.size() > masks;
+			return masks.get( instance
+				, [instance]( ProcAddrMask & mask )
+				{
+					fillProcMask( procAddrTable
+						, mask
+						, [instance]( ProcEntry const & entry )
+						{
+							return entry.scope == ProcScope::ePhysicalDevice
+								&& ( entry.extension.empty()
+									? checkVersion( instance, entry.version )
+									: checkVersionExt( instance, entry.version, entry.extension ) );
+						} );
+				} );
 		}
 
-		return it->second;
+		ProcAddrMask const & getDeviceMask( VkDevice device )
+		{
+			static ProcMaskRegistry< VkDevice, procAddrTable.size() > masks;
+			return masks.get( device
+				, [device]( ProcAddrMask & mask )
+				{
+					fillProcMask( procAddrTable
+						, mask
+						, [device]( ProcEntry const & entry )
+						{
+							if ( entry.name == "vkGetDeviceProcAddr" )
+							{
+								return true;
+							}
+
+							return entry.scope == ProcScope::eDevice
+								&& ( ( entry.extension.empty() || entry.isStatic )
+									? checkVersion( device, entry.version )
+									: checkVersionExt( device, entry.version, entry.extension ) );
+						} );
+				} );
+		}
 	}
 
 	PFN_vkVoidFunction VKAPI_CALL vkGetInstanceProcAddr(
 		VkInstance instance,
 		const char* pName )
 	{
-		PFN_vkVoidFunction result{ nullptr };
-		auto & functions = getFunctions( instance );
-
-		if ( auto it = functions.find( pName );
-			it != functions.end() )
-		{
-			result = it->second;
-		}
-
-		return result;
+		return findProcAddr( procAddrTable
+			, procAddrFunctions
+			, getInstanceMask( instance )
+			, pName );
 	}
 
 	PFN_vkVoidFunction VKAPI_CALL vkGetPhysicalDeviceProcAddr(
 		VkInstance instance,
 		const char* pName )
 	{
-		PFN_vkVoidFunction result{ nullptr };
-		static PhysicalDeviceFunctions functions
-		{
-#define VK_LIB_PHYSDEVICE_FUNCTION( v, x )\
-			{ "vk"#x, checkVersion( instance, v ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
-#define VK_LIB_PHYSDEVICE_FUNCTION_EXT( v, n, x )\
-			{ "vk"#x, checkVersionExt( instance, v, n ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
-#include <ashes/ashes_functions_list.hpp>
-		};
-
-		if ( auto it = functions.find( pName );
-			it != functions.end() )
-		{
-			result = it->second;
-		}
-
-		return result;
+		return findProcAddr( procAddrTable
+			, procAddrFunctions
+			, getPhysicalDeviceMask( instance )
+			, pName );
 	}
 
 	PFN_vkVoidFunction VKAPI_CALL vkGetDeviceProcAddr(
 		VkDevice device,
 		const char* pName )
 	{
-		PFN_vkVoidFunction result{ nullptr };
-		static DeviceFunctions functions
-		{
-			{ "vkGetDeviceProcAddr", PFN_vkVoidFunction( vkGetDeviceProcAddr ) },
-#define VK_LIB_DEVICE_FUNCTION( v, x )\
-			{ "vk"#x, checkVersion( device, v ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
-#define VK_LIB_DEVICE_FUNCTION_EXT( v, n, x )\
-			{ "vk"#x, checkVersionExt( device, v, n ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
-#include <ashes/ashes_functions_list.hpp>
-		};
-
-		if ( auto it = functions.find( pName );
-			it != functions.end() )
-		{
-			result = it->second;
-		}
-
-		return result;
+		return findProcAddr( procAddrTable
+			, procAddrFunctions
+			, getDeviceMask( device )
+			, pName );
 	}
 
 #pragma warning( pop )
@@ -12,6 +12,7 @@ namespace ashes::gl
 		, VkDevice device
 		, VkBufferViewCreateInfo createInfo )
 		: m_device{ device }
+		, m_buffer{ createInfo.buffer }
 		, m_format{ createInfo.format }
 		, m_offset{ createInfo.offset }
 		, m_range{ createInfo.range }
@@ -36,8 +36,14 @@ namespace ashes::gl
 			return m_format;
 		}
 
+		VkBuffer getBuffer()const noexcept
+		{
+			return m_buffer;
+		}
+
 	private:
 		VkDevice m_device;
+		VkBuffer m_buffer;
 		VkFormat m_format;
 		VkDeviceSize m_offset;
 		VkDeviceSize m_range;
@@ -11,6 +11,8 @@ See LICENSE file in root folder.
 
 #include <algorithm>
 
+using ashes::operator==;
+
 namespace ashes::gl
 {
 	namespace geombuf
@@ -349,4 +351,214 @@ namespace ashes::gl
 
 		return result;
 	}
+
+	//*********************************************************************************************
+
+	VertexLayout::VertexLayout( VkPipelineVertexInputStateCreateInfo const & vertexInputState )
+		: m_bindings{ makeVector( vertexInputState.pVertexBindingDescriptions
+			, vertexInputState.vertexBindingDescriptionCount ) }
+		, m_attributes{ makeVector( vertexInputState.pVertexAttributeDescriptions
+			, vertexInputState.vertexAttributeDescriptionCount ) }
+	{
+	}
+
+	VkVertexInputBindingDescription const * VertexLayout::findBinding( uint32_t binding )const noexcept
+	{
+		auto it = std::find_if( m_bindings.begin()
+			, m_bindings.end()
+			, [binding]( VkVertexInputBindingDescription const & lookup )
+			{
+				return lookup.binding == binding;
+			} );
+		return it == m_bindings.end()
+			? nullptr
+			: &( *it );
+	}
+
+	bool VertexLayout::matches( VkPipelineVertexInputStateCreateInfo const & vertexInputState )const noexcept
+	{
+		return std::equal( m_bindings.begin()
+				, m_bindings.end()
+				, vertexInputState.pVertexBindingDescriptions
+				, vertexInputState.pVertexBindingDescriptions + vertexInputState.vertexBindingDescriptionCount )
+			&& std::equal( m_attributes.begin()
+				, m_attributes.end()
+				, vertexInputState.pVertexAttributeDescriptions
+				, vertexInputState.pVertexAttributeDescriptions + vertexInputState.vertexAttributeDescriptionCount );
+	}
+
+	//*********************************************************************************************
+
+	VertexArrayCache::VertexArrayCache( VkDevice device )
+		: m_device{ device }
+	{
+	}
+
+	VertexArrayCache::~VertexArrayCache()noexcept
+	{
+		cleanup();
+	}
+
+	VertexLayout const & VertexArrayCache::getLayout( size_t hash
+		, VkPipelineVertexInputStateCreateInfo const & vertexInputState )const
+	{
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		auto [begin, end] = m_layouts.equal_range( hash );
+		auto it = std::find_if( begin
+			, end
+			, [&vertexInputState]( auto const & lookup )
+			{
+				return lookup.second->matches( vertexInputState );
+			} );
+
+		if ( it == end )
+		{
+			it = m_layouts.emplace( hash
+				, std::make_unique< VertexLayout >( vertexInputState ) );
+		}
+
+		return *it->second;
+	}
+
+	void VertexArrayCache::bind( ContextLock const & context
+		, VertexLayout const & layout )const
+	{
+		std::lock_guard< std::mutex > lock{ m_mutex };
+
+		if ( layout.m_vao != GL_INVALID_INDEX )
+		{
+			m_lru.splice( m_lru.begin(), m_lru, layout.m_lru );
+			glLogCall( context
+				, glBindVertexArray
+				, layout.m_vao );
+			return;
+		}
+
+		doCreateVao( context, layout );
+
+		if ( layout.m_vao != GL_INVALID_INDEX )
+		{
+			m_lru.push_front( &layout );
+			layout.m_lru = m_lru.begin();
+		}
+
+		// The evicted VAOs are never the bound one, which is at the front.
+		while ( m_lru.size() > MaxVaos )
+		{
+			auto evicted = m_lru.back();
+			m_lru.pop_back();
+			doDeleteVao( context, *evicted );
+			++get( m_device )->getVertexArrayCounters().evicted;
+		}
+	}
+
+	void VertexArrayCache::cleanup()const noexcept
+	{
+		std::lock_guard< std::mutex > lock{ m_mutex };
+
+		if ( m_lru.empty() )
+		{
+			return;
+		}
+
+		auto context = get( m_device )->getContext();
+
+		for ( auto layout : m_lru )
+		{
+			doDeleteVao( context, *layout );
+		}
+
+		m_lru.clear();
+	}
+
+	void VertexArrayCache::doCreateVao( ContextLock const & context
+		, VertexLayout const & layout )const
+	{
+		glLogCreateCall( context
+			, glGenVertexArrays
+			, 1
+			, &layout.m_vao );
+
+		if ( layout.m_vao == GL_INVALID_INDEX )
+		{
+			get( m_device )->reportMessage( VK_DEBUG_REPORT_ERROR_BIT_EXT
+				, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_EXT
+				, uint64_t( get( m_device ) )
+				, 0u
+				, VK_ERROR_INCOMPATIBLE_DRIVER
+				, "OpenGL"
+				, "Couldn't create VAO" );
+			return;
+		}
+
+		glLogCall( context
+			, glBindVertexArray
+			, layout.m_vao );
+
+		for ( auto const & attribute : layout.m_attributes )
+		{
+			if ( !isSupportedInternal( attribute.format ) )
+			{
+				reportError( m_device
+					, VK_ERROR_FORMAT_NOT_SUPPORTED
+					, "OpenGL"
+					, "Unsupported internal format: " + ashes::getName( attribute.format ) );
+				continue;
+			}
+
+			glLogCall( context
+				, glEnableVertexAttribArray
+				, attribute.location );
+
+			if ( geombuf::isInteger( attribute.format ) )
+			{
+				glLogCall( context
+					, glVertexAttribIFormat
+					, attribute.location
+					, GLint( ashes::getCount( attribute.format ) )
+					, getType( attribute.format )
+					, attribute.offset );
+			}
+			else
+			{
+				glLogCall( context
+					, glVertexAttribFormat
+					, attribute.location
+					, GLint( ashes::getCount( attribute.format ) )
+					, getType( attribute.format )
+					, geombuf::isNormalized( attribute.format ) ? GL_TRUE : GL_FALSE
+					, attribute.offset );
+			}
+
+			glLogCall( context
+				, glVertexAttribBinding
+				, attribute.location
+				, attribute.binding );
+		}
+
+		for ( auto const & binding : layout.m_bindings )
+		{
+			if ( binding.inputRate == VK_VERTEX_INPUT_RATE_INSTANCE )
+			{
+				glLogCall( context
+					, glVertexBindingDivisor
+					, binding.binding
+					, 1u );
+			}
+		}
+
+		auto & counters = get( m_device )->getVertexArrayCounters();
+		++counters.created;
+		++counters.createdInFrame;
+	}
+
+	void VertexArrayCache::doDeleteVao( ContextLock const & context
+		, VertexLayout const & layout )const noexcept
+	{
+		glLogCall( context
+			, glDeleteVertexArrays
+			, 1
+			, &layout.m_vao );
+		layout.m_vao = GL_INVALID_INDEX;
+	}
 }
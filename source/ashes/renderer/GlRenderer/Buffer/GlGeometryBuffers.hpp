@@ -10,6 +10,10 @@ See LICENSE file in root folder.
 
 #include "renderer/GlRenderer/Shader/GlShaderDesc.hpp"
 
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
 namespace ashes::gl
 {
 	class GeometryBuffers
@@ -101,6 +105,92 @@ namespace ashes::gl
 		std::unique_ptr< IBO > m_ibo;
 		GLuint m_vao{ GL_INVALID_INDEX };
 	};
+	/**
+	*\brief
+	*	A vertex input state, turned into a VAO that only holds the attributes formats (ARB_vertex_attrib_binding).
+	*\remarks
+	*	The vertex buffers are bound at draw time, so the VAO is shared by all the pipelines
+	*	with the same vertex input state, whatever the buffers and offsets.
+	*/
+	class VertexLayout
+	{
+		friend class VertexArrayCache;
+
+	public:
+		explicit VertexLayout( VkPipelineVertexInputStateCreateInfo const & vertexInputState );
+
+		VkVertexInputBindingDescription const * findBinding( uint32_t binding )const noexcept;
+		/**
+		*\return
+		*	\p true if the layout has the bindings and attributes of \p vertexInputState.
+		*/
+		bool matches( VkPipelineVertexInputStateCreateInfo const & vertexInputState )const noexcept;
+
+		VkVertexInputBindingDescriptionArray const & getBindings()const noexcept
+		{
+			return m_bindings;
+		}
+
+		VkVertexInputAttributeDescriptionArray const & getAttributes()const noexcept
+		{
+			return m_attributes;
+		}
+
+	private:
+		VkVertexInputBindingDescriptionArray m_bindings;
+		VkVertexInputAttributeDescriptionArray m_attributes;
+		// The VAO, and its place in the cache LRU list, only valid when the VAO exists.
+		mutable GLuint m_vao{ GL_INVALID_INDEX };
+		mutable std::list< VertexLayout const * >::iterator m_lru;
+	};
+	using VertexLayoutPtr = std::unique_ptr< VertexLayout >;
+	/**
+	*\brief
+	*	Holds the vertex layouts, indexed by the pipelines vertex input state hash,
+	*	the layouts sharing a hash being told apart by their content.
+	*\remarks
+	*	The layouts are kept until the device destruction, since recorded commands point to them,
+	*	but their VAOs are bound in count: the least recently used ones are destroyed,
+	*	and created again if used afterwards.
+	*/
+	class VertexArrayCache
+	{
+	public:
+		static size_t constexpr MaxVaos = 256u;
+
+		explicit VertexArrayCache( VkDevice device );
+		~VertexArrayCache()noexcept;
+		/**
+		*\brief
+		*	Retrieves the layout for given vertex input state, creates it if needed.
+		*/
+		VertexLayout const & getLayout( size_t hash
+			, VkPipelineVertexInputStateCreateInfo const & vertexInputState )const;
+		/**
+		*\brief
+		*	Binds the layout's VAO, creating it if needed.
+		*/
+		void bind( ContextLock const & context
+			, VertexLayout const & layout )const;
+		/**
+		*\brief
+		*	Destroys all the VAOs, when the context is about to change.
+		*/
+		void cleanup()const noexcept;
+
+	private:
+		void doCreateVao( ContextLock const & context
+			, VertexLayout const & layout )const;
+		void doDeleteVao( ContextLock const & context
+			, VertexLayout const & layout )const noexcept;
+
+	private:
+		VkDevice m_device;
+		mutable std::mutex m_mutex;
+		mutable std::unordered_multimap< size_t, VertexLayoutPtr > m_layouts;
+		// The layouts that own a VAO, the most recently used first.
+		mutable std::list< VertexLayout const * > m_lru;
+	};
 }
 
 #endif
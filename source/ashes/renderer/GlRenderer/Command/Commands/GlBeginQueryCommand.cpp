@@ -20,15 +20,15 @@ namespace ashes::gl
 		{
 			for ( auto type : get( pool )->getTypes() )
 			{
-				list.push_back( makeCmd< OpType::eBeginQuery >( type
-					, *( get( pool )->begin() + query ) ) );
+				list.emplace< OpType::eBeginQuery >( type
+					, *( get( pool )->begin() + query ) );
 				++query;
 			}
 		}
 		else
 		{
-			list.push_back( makeCmd< OpType::eBeginQuery >( convert( get( pool )->getType() )
-				, *( get( pool )->begin() + query ) ) );
+			list.emplace< OpType::eBeginQuery >( convert( get( pool )->getType() )
+				, *( get( pool )->begin() + query ) );
 		}
 	}
 }
@@ -30,22 +30,22 @@ namespace ashes::gl
 			{
 				if ( getAspectMask( attachDesc.format ) == VK_IMAGE_ASPECT_COLOR_BIT )
 				{
-					list.push_back( makeCmd< OpType::eClearColour >( rtClearValues[clearIndex].color, 0u ) );
+					list.emplace< OpType::eClearColour >( rtClearValues[clearIndex].color, 0u );
 					++clearIndex;
 				}
 				else
 				{
 					if ( isDepthStencilFormat( attachDesc.format ) )
 					{
-						list.push_back( makeCmd< OpType::eClearDepthStencil >( dsClearValue.depthStencil ) );
+						list.emplace< OpType::eClearDepthStencil >( dsClearValue.depthStencil );
 					}
 					else if ( isDepthFormat( attachDesc.format ) )
 					{
-						list.push_back( makeCmd< OpType::eClearDepth >( dsClearValue.depthStencil.depth ) );
+						list.emplace< OpType::eClearDepth >( dsClearValue.depthStencil.depth );
 					}
 					else if ( isStencilFormat( attachDesc.format ) )
 					{
-						list.push_back( makeCmd< OpType::eClearStencil >( int32_t( dsClearValue.depthStencil.stencil ) ) );
+						list.emplace< OpType::eClearStencil >( int32_t( dsClearValue.depthStencil.stencil ) );
 					}
 				}
 			}
@@ -99,8 +99,8 @@ namespace ashes::gl
 			|| stack.getCurrentFramebuffer() != frameBuffer )
 			&& get( frameBuffer )->getInternal() != GL_INVALID_INDEX )
 		{
-			list.push_back( makeCmd< OpType::eBindFramebuffer >( GL_FRAMEBUFFER
-				, frameBuffer ) );
+			list.emplace< OpType::eBindFramebuffer >( GL_FRAMEBUFFER
+				, frameBuffer );
 			stack.setCurrentFramebuffer( frameBuffer );
 		}
 
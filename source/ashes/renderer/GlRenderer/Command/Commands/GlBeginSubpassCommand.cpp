@@ -40,7 +40,7 @@ namespace ashes::gl
 				}
 			}
 
-			list.push_back( makeCmd< OpType::eDrawBuffers >( get( frameBuffer )->getDrawBuffers( references ) ) );
+			list.emplace< OpType::eDrawBuffers >( get( frameBuffer )->getDrawBuffers( references ) );
 		}
 
 		stack.applySRGBStatus( list, get( frameBuffer )->isSRGB() );
@@ -19,7 +19,7 @@ namespace ashes::gl
 
 		if ( stack.getCurrentProgram() != get( pipeline )->getCompProgram() )
 		{
-			list.push_back( makeCmd< OpType::eUseProgram >( get( pipeline )->getCompProgram() ) );
+			list.emplace< OpType::eUseProgram >( get( pipeline )->getCompProgram() );
 			stack.setCurrentProgram( get( pipeline )->getCompProgram() );
 		}
 	}
@@ -28,6 +28,6 @@ namespace ashes::gl
 		, CmdList & list )
 	{
 		stack.setCurrentProgram( 0u );
-		list.push_back( makeCmd< OpType::eUseProgram >( 0u ) );
+		list.emplace< OpType::eUseProgram >( 0u );
 	}
 }
@@ -15,6 +15,8 @@ See LICENSE file in root folder.
 
 #include "ashesgl_api.hpp"
 
+#include <algorithm>
+
 namespace ashes::gl
 {
 	namespace common
@@ -47,7 +49,7 @@ namespace ashes::gl
 			, uint32_t bindingIndex
 			, CmdList & list )
 		{
-			list.push_back( makeCmd< OpType::eBindSampler >( bindingIndex, get( sampler )->getInternal() ) );
+			list.emplace< OpType::eBindSampler >( bindingIndex, get( sampler )->getInternal() );
 		}
 
 		static void bindUniformBuffer( VkWriteDescriptorSet const & write
@@ -63,13 +65,13 @@ namespace ashes::gl
 
 				for ( auto i = 0u; i < write.descriptorCount; ++i )
 				{
-					uint32_t bindingIndex = dstBinding + i;
+					uint32_t bindingIndex = dstBinding + write.dstArrayElement + i;
 					auto buffer = getBuffer( write, i );
-					list.push_back( makeCmd< OpType::eBindBufferRange >( bindingIndex
+					list.emplace< OpType::eBindBufferRange >( bindingIndex
 						, GL_BUFFER_TARGET_UNIFORM
 						, get( buffer )->getInternal()
 						, int64_t( get( buffer )->getOffset() + write.pBufferInfo[i].offset )
-						, int64_t( std::min( write.pBufferInfo[i].range, get( buffer )->getMemoryRequirements().size ) ) ) );
+						, int64_t( std::min( write.pBufferInfo[i].range, get( buffer )->getMemoryRequirements().size ) ) );
 				}
 			}
 			else
@@ -94,13 +96,13 @@ namespace ashes::gl
 
 				for ( auto i = 0u; i < write.descriptorCount; ++i )
 				{
-					uint32_t bindingIndex = dstBinding + i;
+					uint32_t bindingIndex = dstBinding + write.dstArrayElement + i;
 					auto buffer = getBuffer( write, i );
-					list.push_back( makeCmd< OpType::eBindBufferRange >( bindingIndex
+					list.emplace< OpType::eBindBufferRange >( bindingIndex
 						, GL_BUFFER_TARGET_SHADER_STORAGE
 						, get( buffer )->getInternal()
 						, int64_t( get( buffer )->getOffset() + write.pBufferInfo[i].offset )
-						, int64_t( std::min( write.pBufferInfo[i].range, get( buffer )->getMemoryRequirements().size ) ) ) );
+						, int64_t( std::min( write.pBufferInfo[i].range, get( buffer )->getMemoryRequirements().size ) ) );
 				}
 			}
 			else
@@ -125,12 +127,12 @@ namespace ashes::gl
 
 				for ( auto i = 0u; i < write.descriptorCount; ++i )
 				{
-					uint32_t bindingIndex = dstBinding + i;
+					uint32_t bindingIndex = dstBinding + write.dstArrayElement + i;
 					auto bufferView = getBufferView( write, i );
-					list.push_back( makeCmd< OpType::eActiveTexture >( bindingIndex ) );
+					list.emplace< OpType::eActiveTexture >( bindingIndex );
 
-					list.push_back( makeCmd< OpType::eBindTexture >( GL_TEXTURE_BUFFER
-						, get( bufferView )->getImage() ) );
+					list.emplace< OpType::eBindTexture >( GL_TEXTURE_BUFFER
+						, get( bufferView )->getImage() );
 				}
 			}
 			else
@@ -155,16 +157,16 @@ namespace ashes::gl
 
 				for ( auto i = 0u; i < write.descriptorCount; ++i )
 				{
-					uint32_t bindingIndex = dstBinding + i;
+					uint32_t bindingIndex = dstBinding + write.dstArrayElement + i;
 					auto bufferView = getBufferView( write, i );
-					list.push_back( makeCmd< OpType::eActiveTexture >( bindingIndex ) );
+					list.emplace< OpType::eActiveTexture >( bindingIndex );
 
-					list.push_back( makeCmd< OpType::eBindImage >( bindingIndex
+					list.emplace< OpType::eBindImage >( bindingIndex
 						, get( bufferView )->getInternal()
 						, 0u
 						, 0u
 						, 0u
-						, getInternalFormat( get( bufferView )->getFormat() ) ) );
+						, getInternalFormat( get( bufferView )->getFormat() ) );
 				}
 			}
 			else
@@ -190,13 +192,13 @@ namespace ashes::gl
 
 				for ( auto i = 0u; i < write.descriptorCount; ++i )
 				{
-					uint32_t bindingIndex = dstBinding + i;
+					uint32_t bindingIndex = dstBinding + write.dstArrayElement + i;
 					auto buffer = getBuffer( write, i );
-					list.push_back( makeCmd< OpType::eBindBufferRange >( bindingIndex
+					list.emplace< OpType::eBindBufferRange >( bindingIndex
 						, GL_BUFFER_TARGET_UNIFORM
 						, get( buffer )->getInternal()
 						, int64_t( get( buffer )->getOffset() + write.pBufferInfo[i].offset + offset )
-						, int64_t( std::min( write.pBufferInfo[i].range, get( buffer )->getMemoryRequirements().size ) ) ) );
+						, int64_t( std::min( write.pBufferInfo[i].range, get( buffer )->getMemoryRequirements().size ) ) );
 				}
 			}
 			else
@@ -222,13 +224,13 @@ namespace ashes::gl
 
 				for ( auto i = 0u; i < write.descriptorCount; ++i )
 				{
-					uint32_t bindingIndex = dstBinding + i;
+					uint32_t bindingIndex = dstBinding + write.dstArrayElement + i;
 					auto buffer = getBuffer( write, i );
-					list.push_back( makeCmd< OpType::eBindBufferRange >( bindingIndex
+					list.emplace< OpType::eBindBufferRange >( bindingIndex
 						, GL_BUFFER_TARGET_SHADER_STORAGE
 						, get( buffer )->getInternal()
 						, int64_t( get( buffer )->getOffset() + write.pBufferInfo[i].offset + offset )
-						, int64_t( std::min( write.pBufferInfo[i].range, get( buffer )->getMemoryRequirements().size ) ) ) );
+						, int64_t( std::min( write.pBufferInfo[i].range, get( buffer )->getMemoryRequirements().size ) ) );
 				}
 			}
 			else
@@ -335,9 +337,9 @@ namespace ashes::gl
 			, GlTextureType target
 			, CmdList & list )
 		{
-			list.push_back( makeCmd< OpType::eTexParameterf >( target
+			list.emplace< OpType::eTexParameterf >( target
 				, uint32_t( GL_TEX_PARAMETER_LOD_BIAS )
-				, get( sampler )->getLodBias() ) );
+				, get( sampler )->getLodBias() );
 		}
 
 		static GlTextureType bindTexture( VkImageView view
@@ -348,36 +350,36 @@ namespace ashes::gl
 				, get( get( view )->getImage() )->getType()
 				, get( get( view )->getImage() )->getArrayLayers()
 				, get( get( view )->getImage() )->getSamples() );
-			list.push_back( makeCmd< OpType::eActiveTexture >( bindingIndex ) );
-			list.push_back( makeCmd< OpType::eBindTexture >( target
-				, get( get( view )->getImage() )->getInternal() ) );
+			list.emplace< OpType::eActiveTexture >( bindingIndex );
+			list.emplace< OpType::eBindTexture >( target
+				, get( get( view )->getImage() )->getInternal() );
 
 			if ( get( view )->getComponents().r != VK_COMPONENT_SWIZZLE_IDENTITY )
 			{
-				list.push_back( makeCmd< OpType::eTexParameteri >( target
+				list.emplace< OpType::eTexParameteri >( target
 					, uint32_t( GL_TEX_PARAMETER_SWIZZLE_R )
-					, int32_t( convertComponentSwizzle( get( view )->getComponents().r ) ) ) );
+					, int32_t( convertComponentSwizzle( get( view )->getComponents().r ) ) );
 			}
 
 			if ( get( view )->getComponents().g != VK_COMPONENT_SWIZZLE_IDENTITY )
 			{
-				list.push_back( makeCmd< OpType::eTexParameteri >( target
+				list.emplace< OpType::eTexParameteri >( target
 					, uint32_t( GL_TEX_PARAMETER_SWIZZLE_G )
-					, int32_t( convertComponentSwizzle( get( view )->getComponents().g ) ) ) );
+					, int32_t( convertComponentSwizzle( get( view )->getComponents().g ) ) );
 			}
 
 			if ( get( view )->getComponents().b != VK_COMPONENT_SWIZZLE_IDENTITY )
 			{
-				list.push_back( makeCmd< OpType::eTexParameteri >( target
+				list.emplace< OpType::eTexParameteri >( target
 					, uint32_t( GL_TEX_PARAMETER_SWIZZLE_B )
-					, int32_t( convertComponentSwizzle( get( view )->getComponents().b ) ) ) );
+					, int32_t( convertComponentSwizzle( get( view )->getComponents().b ) ) );
 			}
 
 			if ( get( view )->getComponents().a != VK_COMPONENT_SWIZZLE_IDENTITY )
 			{
-				list.push_back( makeCmd< OpType::eTexParameteri >( target
+				list.emplace< OpType::eTexParameteri >( target
 					, uint32_t( GL_TEX_PARAMETER_SWIZZLE_A )
-					, int32_t( convertComponentSwizzle( get( view )->getComponents().a ) ) ) );
+					, int32_t( convertComponentSwizzle( get( view )->getComponents().a ) ) );
 			}
 
 			return target;
@@ -389,13 +391,13 @@ namespace ashes::gl
 		{
 			auto name = get( get( view )->getImage() )->getInternal();
 			auto & range = get( view )->getSubresourceRange();
-			list.push_back( makeCmd< OpType::eActiveTexture >( bindingIndex ) );
-			list.push_back( makeCmd< OpType::eBindImage >( bindingIndex
+			list.emplace< OpType::eActiveTexture >( bindingIndex );
+			list.emplace< OpType::eBindImage >( bindingIndex
 				, name
 				, range.baseMipLevel
 				, range.layerCount
 				, range.baseArrayLayer
-				, get( view )->getInternalFormat() ) );
+				, get( view )->getInternalFormat() );
 		}
 
 		static void bindTextureAndSampler( VkImageView view
@@ -428,7 +430,7 @@ namespace ashes::gl
 
 				for ( auto i = 0u; i < write.descriptorCount; ++i )
 				{
-					uint32_t bindingIndex = dstBinding + i;
+					uint32_t bindingIndex = dstBinding + write.dstArrayElement + i;
 					auto writeSampler = common::getSampler( write, i );
 
 					if ( write.descriptorType == VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT
@@ -470,7 +472,7 @@ namespace ashes::gl
 
 				for ( auto i = 0u; i < write.descriptorCount; ++i )
 				{
-					uint32_t bindingIndex = dstBinding + i;
+					uint32_t bindingIndex = dstBinding + write.dstArrayElement + i;
 					common::bindSampler( common::getSampler( write, i )
 						, bindingIndex
 						, list );
@@ -498,7 +500,7 @@ namespace ashes::gl
 
 				for ( auto i = 0u; i < write.descriptorCount; ++i )
 				{
-					uint32_t bindingIndex = dstBinding + i;
+					uint32_t bindingIndex = dstBinding + write.dstArrayElement + i;
 					bindTexture( common::getView( write, i )
 						, bindingIndex
 						, list );
@@ -527,7 +529,7 @@ namespace ashes::gl
 
 				for ( auto i = 0u; i < write.descriptorCount; ++i )
 				{
-					uint32_t bindingIndex = dstBinding + i;
+					uint32_t bindingIndex = dstBinding + write.dstArrayElement + i;
 					bindTextureAndSampler( common::getView( write, i )
 						, sampler
 						, bindingIndex
@@ -556,7 +558,7 @@ namespace ashes::gl
 
 				for ( auto i = 0u; i < write.descriptorCount; ++i )
 				{
-					uint32_t bindingIndex = dstBinding + i;
+					uint32_t bindingIndex = dstBinding + write.dstArrayElement + i;
 					bindImage( common::getView( write, i )
 						, bindingIndex
 						, list );
@@ -658,8 +660,8 @@ namespace ashes::gl
 			auto type = getTextureType( get( view )->getType()
 				, get( view )->getSubresourceRange().layerCount
 				, get( get( view )->getImage() )->getSamples() );
-			list.push_back( makeCmd< OpType::eActiveTexture >( bindingIndex ) );
-			list.push_back( makeCmd< OpType::eBindTexture >( type, name ) );
+			list.emplace< OpType::eActiveTexture >( bindingIndex );
+			list.emplace< OpType::eBindTexture >( type, name );
 			return GlTextureType{};
 		}
 
@@ -669,13 +671,13 @@ namespace ashes::gl
 		{
 			auto name = get( view )->getInternal();
 			auto & range = get( view )->getSubresourceRange();
-			list.push_back( makeCmd< OpType::eActiveTexture >( bindingIndex ) );
-			list.push_back( makeCmd< OpType::eBindImage >( bindingIndex
+			list.emplace< OpType::eActiveTexture >( bindingIndex );
+			list.emplace< OpType::eBindImage >( bindingIndex
 				, name
 				, range.baseMipLevel
 				, range.layerCount > 1u ? GL_TRUE : GL_FALSE
 				, range.layerCount > 1u ? 0u : range.baseArrayLayer
-				, get( view )->getInternalFormat() ) );
+				, get( view )->getInternalFormat() );
 		}
 
 		static void bindTextureAndSampler( VkImageView view
@@ -705,7 +707,7 @@ namespace ashes::gl
 
 				for ( auto i = 0u; i < write.descriptorCount; ++i )
 				{
-					uint32_t bindingIndex = dstBinding + i;
+					uint32_t bindingIndex = dstBinding + write.dstArrayElement + i;
 					auto writeSampler = common::getSampler( write, i );
 
 					if ( write.descriptorType == VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT
@@ -748,7 +750,7 @@ namespace ashes::gl
 
 				for ( auto i = 0u; i < write.descriptorCount; ++i )
 				{
-					uint32_t bindingIndex = dstBinding + i;
+					uint32_t bindingIndex = dstBinding + write.dstArrayElement + i;
 					common::bindSampler( common::getSampler( write, i )
 						, bindingIndex
 						, list );
@@ -776,7 +778,7 @@ namespace ashes::gl
 
 				for ( auto i = 0u; i < write.descriptorCount; ++i )
 				{
-					uint32_t bindingIndex = dstBinding + i;
+					uint32_t bindingIndex = dstBinding + write.dstArrayElement + i;
 					bindTexture( common::getView( write, i )
 						, bindingIndex
 						, list );
@@ -805,7 +807,7 @@ namespace ashes::gl
 
 				for ( auto i = 0u; i < write.descriptorCount; ++i )
 				{
-					uint32_t bindingIndex = dstBinding + i;
+					uint32_t bindingIndex = dstBinding + write.dstArrayElement + i;
 					bindTextureAndSampler( common::getView( write, i )
 						, sampler
 						, bindingIndex
@@ -834,7 +836,7 @@ namespace ashes::gl
 
 				for ( auto i = 0u; i < write.descriptorCount; ++i )
 				{
-					uint32_t bindingIndex = dstBinding + i;
+					uint32_t bindingIndex = dstBinding + write.dstArrayElement + i;
 					bindImage( common::getView( write, i )
 						, bindingIndex
 						, list );
@@ -926,6 +928,440 @@ namespace ashes::gl
 		}
 	}
 
+	namespace mbind
+	{
+		template< typename FuncT >
+		static void forEachBinding( VkWriteDescriptorSet const & write
+			, ShaderBindingMap const & bindings
+			, uint32_t setIndex
+			, FuncT function )
+		{
+			auto it = bindings.find( makeShaderBindingKey( setIndex, write.dstBinding ) );
+
+			if ( it != bindings.end() )
+			{
+				auto dstBinding = it->second;
+
+				for ( auto i = 0u; i < write.descriptorCount; ++i )
+				{
+					function( dstBinding + write.dstArrayElement + i, i );
+				}
+			}
+			else
+			{
+				reportWarning( write.dstSet
+					, VK_ERROR_UNKNOWN
+					, "vkCmdBindDescriptorSets"
+					, "Couldn't find binding" );
+			}
+		}
+
+		static void bindImage( VkImageView view
+			, uint32_t bindingIndex
+			, DescriptorBinder & binder )
+		{
+			auto & range = get( view )->getSubresourceRange();
+			auto layered = range.layerCount > 1u;
+			// glBindImageTextures binds the level 0 of the view, layered,
+			// which is also what we need for the non layered texture types.
+			auto multiBind = range.baseMipLevel == 0u
+				&& ( layered
+					|| get( view )->getType() == VK_IMAGE_VIEW_TYPE_1D
+					|| get( view )->getType() == VK_IMAGE_VIEW_TYPE_2D );
+			binder.bindImage( bindingIndex
+				, { get( view )->getInternal()
+					, range.baseMipLevel
+					, uint32_t( layered ? GL_TRUE : GL_FALSE )
+					, layered ? 0u : range.baseArrayLayer
+					, get( view )->getInternalFormat()
+					, multiBind } );
+		}
+
+		static void bindBuffer( VkWriteDescriptorSet const & write
+			, ShaderBindingMap const & bindings
+			, uint32_t setIndex
+			, GlBufferTarget target
+			, uint32_t offset
+			, DescriptorBinder & binder )
+		{
+			forEachBinding( write
+				, bindings
+				, setIndex
+				, [&write, target, offset, &binder]( uint32_t bindingIndex, uint32_t i )
+				{
+					auto buffer = common::getBuffer( write, i );
+					binder.bindBufferRange( target
+						, bindingIndex
+						, { get( buffer )->getInternal()
+							, int64_t( get( buffer )->getOffset() + write.pBufferInfo[i].offset + offset )
+							, int64_t( std::min( write.pBufferInfo[i].range, get( buffer )->getMemoryRequirements().size ) ) } );
+				} );
+		}
+
+		static void bindCombinedSampler( VkWriteDescriptorSet const & write
+			, ShaderBindingMap const & bindings
+			, uint32_t setIndex
+			, VkSampler sampler
+			, DescriptorBinder & binder )
+		{
+			forEachBinding( write
+				, bindings
+				, setIndex
+				, [&write, sampler, &binder]( uint32_t bindingIndex, uint32_t i )
+				{
+					auto writeSampler = common::getSampler( write, i );
+
+					if ( write.descriptorType == VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT
+						|| writeSampler == nullptr )
+					{
+						writeSampler = sampler;
+					}
+
+					binder.bindTexture( bindingIndex, get( common::getView( write, i ) )->getInternal() );
+					binder.bindSampler( bindingIndex, get( writeSampler )->getInternal() );
+				} );
+		}
+
+		static void bindSampler( VkWriteDescriptorSet const & write
+			, ShaderBindingMap const & bindings
+			, uint32_t setIndex
+			, DescriptorBinder & binder )
+		{
+			forEachBinding( write
+				, bindings
+				, setIndex
+				, [&write, &binder]( uint32_t bindingIndex, uint32_t i )
+				{
+					binder.bindSampler( bindingIndex, get( common::getSampler( write, i ) )->getInternal() );
+				} );
+		}
+
+		static void bindSampledTexture( VkWriteDescriptorSet const & write
+			, ShaderBindingMap const & bindings
+			, uint32_t setIndex
+			, DescriptorBinder & binder )
+		{
+			forEachBinding( write
+				, bindings
+				, setIndex
+				, [&write, &binder]( uint32_t bindingIndex, uint32_t i )
+				{
+					binder.bindTexture( bindingIndex, get( common::getView( write, i ) )->getInternal() );
+				} );
+		}
+
+		static void bindStorageTexture( VkWriteDescriptorSet const & write
+			, ShaderBindingMap const & bindings
+			, uint32_t setIndex
+			, DescriptorBinder & binder )
+		{
+			forEachBinding( write
+				, bindings
+				, setIndex
+				, [&write, &binder]( uint32_t bindingIndex, uint32_t i )
+				{
+					bindImage( common::getView( write, i ), bindingIndex, binder );
+				} );
+		}
+
+		static void bindUniformTexelBuffer( VkWriteDescriptorSet const & write
+			, ShaderBindingMap const & bindings
+			, uint32_t setIndex
+			, DescriptorBinder & binder )
+		{
+			forEachBinding( write
+				, bindings
+				, setIndex
+				, [&write, &binder]( uint32_t bindingIndex, uint32_t i )
+				{
+					binder.bindTexture( bindingIndex, get( common::getBufferView( write, i ) )->getImage() );
+				} );
+		}
+
+		static void bindStorageTexelBuffer( VkWriteDescriptorSet const & write
+			, ShaderBindingMap const & bindings
+			, uint32_t setIndex
+			, DescriptorBinder & binder )
+		{
+			forEachBinding( write
+				, bindings
+				, setIndex
+				, [&write, &binder]( uint32_t bindingIndex, uint32_t i )
+				{
+					auto bufferView = common::getBufferView( write, i );
+					binder.bindImage( bindingIndex
+						, { get( bufferView )->getInternal()
+							, 0u
+							, uint32_t( GL_FALSE )
+							, 0u
+							, getInternalFormat( get( bufferView )->getFormat() )
+							, true } );
+				} );
+		}
+
+		template< typename FuncT, typename ... ParamsT >
+		static void forEachWrite( LayoutBindingWritesArray const & writes
+			, FuncT function
+			, ParamsT && ... params )
+		{
+			for ( auto & bindingWrites : writes )
+			{
+				for ( auto & write : bindingWrites->writes )
+				{
+					function( write, params... );
+				}
+			}
+		}
+
+		static void bindDynamicBuffers( LayoutBindingWritesArray const & writes
+			, ShaderBindings const & bindings
+			, uint32_t setIndex
+			, ArrayView< uint32_t const > const & offsets
+			, uint32_t & dynamicOffsetIndex
+			, DescriptorBinder & binder )
+		{
+			for ( auto & write : writes )
+			{
+				if ( write->descriptorCount )
+				{
+					for ( auto & bindingWrite : write->writes )
+					{
+						switch ( write->descriptorType )
+						{
+						case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+							bindBuffer( bindingWrite, bindings.ubo, setIndex, GL_BUFFER_TARGET_UNIFORM, offsets[dynamicOffsetIndex], binder );
+							break;
+
+						case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+							bindBuffer( bindingWrite, bindings.sbo, setIndex, GL_BUFFER_TARGET_SHADER_STORAGE, offsets[dynamicOffsetIndex], binder );
+							break;
+
+						default:
+							assert( false && "Unsupported dynamic descriptor type" );
+							throw ashes::BaseException{ "Unsupported dynamic descriptor type" };
+						}
+					}
+
+					++dynamicOffsetIndex;
+				}
+			}
+		}
+	}
+
+	//*********************************************************************************************
+
+	static bool operator==( DescriptorBinder::ImageBinding const & lhs
+		, DescriptorBinder::ImageBinding const & rhs )
+	{
+		return lhs.name == rhs.name
+			&& lhs.level == rhs.level
+			&& lhs.layered == rhs.layered
+			&& lhs.layer == rhs.layer
+			&& lhs.internal == rhs.internal;
+	}
+
+	static bool operator==( DescriptorBinder::BufferBinding const & lhs
+		, DescriptorBinder::BufferBinding const & rhs )
+	{
+		return lhs.name == rhs.name
+			&& lhs.offset == rhs.offset
+			&& lhs.range == rhs.range;
+	}
+
+	void DescriptorBinder::bindTexture( uint32_t unit
+		, uint32_t name )
+	{
+		m_textures.pending.emplace_back( unit, name );
+	}
+
+	void DescriptorBinder::bindSampler( uint32_t unit
+		, uint32_t name )
+	{
+		m_samplers.pending.emplace_back( unit, name );
+	}
+
+	void DescriptorBinder::bindImage( uint32_t unit
+		, ImageBinding const & binding )
+	{
+		m_images.pending.emplace_back( unit, binding );
+	}
+
+	void DescriptorBinder::bindBufferRange( GlBufferTarget target
+		, uint32_t unit
+		, BufferBinding const & binding )
+	{
+		if ( target == GL_BUFFER_TARGET_UNIFORM )
+		{
+			m_uniformBuffers.pending.emplace_back( unit, binding );
+		}
+		else
+		{
+			m_storageBuffers.pending.emplace_back( unit, binding );
+		}
+	}
+
+	void DescriptorBinder::flush( VkDevice device
+		, CmdList & list )
+	{
+		if ( m_epoch != list.getBindingsEpoch() )
+		{
+			// Another command changed the bindings, what was bound is unknown now.
+			m_textures.bound.clear();
+			m_samplers.bound.clear();
+			m_images.bound.clear();
+			m_uniformBuffers.bound.clear();
+			m_storageBuffers.bound.clear();
+		}
+
+		auto count = list.size();
+		doFlushTextures( list );
+		doFlushSamplers( list );
+		doFlushImages( list );
+		doFlushBuffers( GL_BUFFER_TARGET_UNIFORM, m_uniformBuffers, list );
+		doFlushBuffers( GL_BUFFER_TARGET_SHADER_STORAGE, m_storageBuffers, list );
+		m_epoch = list.getBindingsEpoch();
+
+		if ( m_requested )
+		{
+			auto & counters = get( device )->getDescriptorBindCounters();
+			counters.requested += m_requested;
+			counters.skipped += m_skipped;
+			counters.recorded += list.size() - count;
+			m_requested = 0u;
+			m_skipped = 0u;
+		}
+	}
+
+	template< typename ValueT, typename FuncT >
+	void DescriptorBinder::doFlush( Slots< ValueT > & slots
+		, FuncT function )
+	{
+		auto & pending = slots.pending;
+		// Sorted by unit, the last request for a unit wins.
+		std::stable_sort( pending.begin()
+			, pending.end()
+			, []( auto const & lhs, auto const & rhs )
+			{
+				return lhs.first < rhs.first;
+			} );
+
+		for ( auto it = pending.begin(); it != pending.end(); ++it )
+		{
+			auto next = std::next( it );
+
+			if ( next != pending.end()
+				&& next->first == it->first )
+			{
+				continue;
+			}
+
+			auto unit = it->first;
+			++m_requested;
+
+			if ( unit < slots.bound.size()
+				&& slots.bound[unit]
+				&& *slots.bound[unit] == it->second )
+			{
+				++m_skipped;
+				continue;
+			}
+
+			if ( unit >= slots.bound.size() )
+			{
+				slots.bound.resize( unit + 1u );
+			}
+
+			slots.bound[unit] = it->second;
+			function( unit, it->second );
+		}
+
+		pending.clear();
+	}
+
+	void DescriptorBinder::doFlushTextures( CmdList & list )
+	{
+		CmdBindTextures * cmd{};
+		doFlush( m_textures
+			, [&list, &cmd]( uint32_t unit, uint32_t name )
+			{
+				if ( !cmd
+					|| cmd->first + cmd->count != unit
+					|| cmd->count == CmdBindTextures::MaxElems )
+				{
+					cmd = &list.emplace< OpType::eBindTextures >( unit );
+				}
+
+				cmd->push( name );
+			} );
+	}
+
+	void DescriptorBinder::doFlushSamplers( CmdList & list )
+	{
+		CmdBindSamplers * cmd{};
+		doFlush( m_samplers
+			, [&list, &cmd]( uint32_t unit, uint32_t name )
+			{
+				if ( !cmd
+					|| cmd->first + cmd->count != unit
+					|| cmd->count == CmdBindSamplers::MaxElems )
+				{
+					cmd = &list.emplace< OpType::eBindSamplers >( unit );
+				}
+
+				cmd->push( name );
+			} );
+	}
+
+	void DescriptorBinder::doFlushImages( CmdList & list )
+	{
+		CmdBindImageTextures * cmd{};
+		doFlush( m_images
+			, [&list, &cmd]( uint32_t unit, ImageBinding const & binding )
+			{
+				if ( !binding.multiBind )
+				{
+					list.emplace< OpType::eBindImage >( unit
+						, binding.name
+						, binding.level
+						, binding.layered
+						, binding.layer
+						, binding.internal );
+					cmd = nullptr;
+					return;
+				}
+
+				if ( !cmd
+					|| cmd->first + cmd->count != unit
+					|| cmd->count == CmdBindImageTextures::MaxElems )
+				{
+					cmd = &list.emplace< OpType::eBindImageTextures >( unit );
+				}
+
+				cmd->push( binding.name );
+			} );
+	}
+
+	void DescriptorBinder::doFlushBuffers( GlBufferTarget target
+		, Slots< BufferBinding > & slots
+		, CmdList & list )
+	{
+		CmdBindBuffersRange * cmd{};
+		doFlush( slots
+			, [&list, &cmd, target]( uint32_t unit, BufferBinding const & binding )
+			{
+				if ( !cmd
+					|| cmd->first + cmd->count != unit
+					|| cmd->count == CmdBindBuffersRange::MaxElems )
+				{
+					cmd = &list.emplace< OpType::eBindBuffersRange >( target, unit );
+				}
+
+				cmd->push( binding.name, binding.offset, binding.range );
+			} );
+	}
+
+	//*********************************************************************************************
+
 	void buildBindDescriptorSetCommand( VkDevice device
 		, VkDescriptorSet descriptorSet
 		, uint32_t setIndex
@@ -933,6 +1369,7 @@ namespace ashes::gl
 		, ArrayView< uint32_t const > const & dynamicOffsets
 		, uint32_t & dynamicOffsetIndex
 		, [[maybe_unused]] VkPipelineBindPoint bindingPoint
+		, DescriptorBinder & binder
 		, CmdList & list )
 	{
 		assert( get( descriptorSet )->getDynamicBuffers().size() + dynamicOffsetIndex <= dynamicOffsets.size()
@@ -943,7 +1380,77 @@ namespace ashes::gl
 
 		if ( setIndex != GL_INVALID_INDEX )
 		{
-			if ( hasTextureViews( device ) )
+			if ( hasTextureViews( device )
+				&& hasMultiBind( device ) )
+			{
+				// Only gathered here, recorded by DescriptorBinder::flush.
+				auto sampler = get( device )->getSampler();
+				mbind::forEachWrite( get( descriptorSet )->getInputAttachments()
+					, mbind::bindCombinedSampler
+					, bindings.tex
+					, setIndex
+					, sampler
+					, binder );
+				mbind::forEachWrite( get( descriptorSet )->getCombinedTextureSamplers()
+					, mbind::bindCombinedSampler
+					, bindings.tex
+					, setIndex
+					, sampler
+					, binder );
+				mbind::forEachWrite( get( descriptorSet )->getSamplers()
+					, mbind::bindSampler
+					, bindings.tex
+					, setIndex
+					, binder );
+				mbind::forEachWrite( get( descriptorSet )->getSampledTextures()
+					, mbind::bindSampledTexture
+					, bindings.tex
+					, setIndex
+					, binder );
+				mbind::forEachWrite( get( descriptorSet )->getStorageTextures()
+					, mbind::bindStorageTexture
+					, bindings.img
+					, setIndex
+					, binder );
+				mbind::forEachWrite( get( descriptorSet )->getTexelImageBuffers()
+					, mbind::bindStorageTexelBuffer
+					, bindings.ibo
+					, setIndex
+					, binder );
+				mbind::forEachWrite( get( descriptorSet )->getUniformBuffers()
+					, mbind::bindBuffer
+					, bindings.ubo
+					, setIndex
+					, GL_BUFFER_TARGET_UNIFORM
+					, 0u
+					, binder );
+				mbind::forEachWrite( get( descriptorSet )->getInlineUniforms()
+					, mbind::bindBuffer
+					, bindings.ubo
+					, setIndex
+					, GL_BUFFER_TARGET_UNIFORM
+					, 0u
+					, binder );
+				mbind::forEachWrite( get( descriptorSet )->getStorageBuffers()
+					, mbind::bindBuffer
+					, bindings.sbo
+					, setIndex
+					, GL_BUFFER_TARGET_SHADER_STORAGE
+					, 0u
+					, binder );
+				mbind::forEachWrite( get( descriptorSet )->getTexelSamplerBuffers()
+					, mbind::bindUniformTexelBuffer
+					, bindings.tbo
+					, setIndex
+					, binder );
+				mbind::bindDynamicBuffers( get( descriptorSet )->getDynamicBuffers()
+					, bindings
+					, setIndex
+					, dynamicOffsets
+					, dynamicOffsetIndex
+					, binder );
+			}
+			else if ( hasTextureViews( device ) )
 			{
 				for ( auto & write : get( descriptorSet )->getInputAttachments() )
 				{
@@ -8,6 +8,83 @@ See LICENSE file in root folder
 
 namespace ashes::gl
 {
+	/**
+	*\brief
+	*	Gathers the descriptor bindings of a vkCmdBindDescriptorSets call, and records them
+	*	as ARB_multi_bind commands, one per run of contiguous units.
+	*\remarks
+	*	It also remembers what was recorded so far in the command list, to skip the binds
+	*	that wouldn't change anything.
+	*	That knowledge is dropped as soon as another command changes the bindings.
+	*/
+	class DescriptorBinder
+	{
+	public:
+		struct ImageBinding
+		{
+			uint32_t name;
+			uint32_t level;
+			uint32_t layered;
+			uint32_t layer;
+			GlInternal internal;
+			//! Tells if glBindImageTextures would give the same binding.
+			bool multiBind;
+		};
+
+		struct BufferBinding
+		{
+			uint32_t name;
+			int64_t offset;
+			int64_t range;
+		};
+
+	private:
+		template< typename ValueT >
+		struct Slots
+		{
+			std::vector< std::pair< uint32_t, ValueT > > pending;
+			std::vector< Optional< ValueT > > bound;
+		};
+
+	public:
+		void bindTexture( uint32_t unit
+			, uint32_t name );
+		void bindSampler( uint32_t unit
+			, uint32_t name );
+		void bindImage( uint32_t unit
+			, ImageBinding const & binding );
+		void bindBufferRange( GlBufferTarget target
+			, uint32_t unit
+			, BufferBinding const & binding );
+		/**
+		*\brief
+		*	Records the pending bindings into the given list.
+		*/
+		void flush( VkDevice device
+			, CmdList & list );
+
+	private:
+		void doFlushTextures( CmdList & list );
+		void doFlushSamplers( CmdList & list );
+		void doFlushImages( CmdList & list );
+		void doFlushBuffers( GlBufferTarget target
+			, Slots< BufferBinding > & slots
+			, CmdList & list );
+		template< typename ValueT, typename FuncT >
+		void doFlush( Slots< ValueT > & slots
+			, FuncT function );
+
+	private:
+		Slots< uint32_t > m_textures;
+		Slots< uint32_t > m_samplers;
+		Slots< ImageBinding > m_images;
+		Slots< BufferBinding > m_uniformBuffers;
+		Slots< BufferBinding > m_storageBuffers;
+		size_t m_epoch{ ~size_t( 0u ) };
+		uint64_t m_requested{};
+		uint64_t m_skipped{};
+	};
+
 	void buildBindDescriptorSetCommand( VkDevice device
 		, VkDescriptorSet descriptorSet
 		, uint32_t descriptorSetIndex
@@ -15,5 +92,6 @@ namespace ashes::gl
 		, ArrayView< uint32_t const > const & dynamicOffsets
 		, uint32_t & dynamicOffsetIndex
 		, VkPipelineBindPoint bindingPoint
+		, DescriptorBinder & binder
 		, CmdList & list );
 }
@@ -14,6 +14,6 @@ namespace ashes::gl
 		, CmdList & list )
 	{
 		glLogCommand( list, "BindGeometryBuffersCommand" );
-		list.push_back( makeCmd< OpType::eBindVextexArray >( &vao ) );
+		list.emplace< OpType::eBindVextexArray >( &vao );
 	}
 }
@@ -4,6 +4,8 @@ See LICENSE file in root folder.
 */
 #include "Command/Commands/GlBindPipelineCommand.hpp"
 
+#include "Command/GlQueue.hpp"
+
 #include "Core/GlDevice.hpp"
 #include "Pipeline/GlPipeline.hpp"
 #include "Pipeline/GlPipelineLayout.hpp"
@@ -43,21 +45,30 @@ namespace ashes::gl
 			stack.apply( list, glpipeline->getRtotContextState() );
 			program = glpipeline->getRtotProgram();
 		}
-		else
+		else if ( glpipeline->isBackProgramReady() )
 		{
 			stack.apply( list, glpipeline->getBackContextState() );
 			program = glpipeline->getBackProgram();
 		}
+		else
+		{
+			// The back buffer program is built at replay, not to stall the recording thread,
+			// hence its name isn't known here.
+			stack.apply( list, glpipeline->getBackContextState() );
+			list.emplace< OpType::eUseBackProgram >( pipeline );
+			program = ~0u;
+			stack.setCurrentProgram( program );
+		}
 
 		if ( stack.getCurrentProgram() != program )
 		{
 			if ( hasProgramPipelines( device ) )
 			{
-				list.push_back( makeCmd< OpType::eUseProgramPipeline >( program ) );
+				list.emplace< OpType::eUseProgramPipeline >( program );
 			}
 			else
 			{
-				list.push_back( makeCmd< OpType::eUseProgram >( program ) );
+				list.emplace< OpType::eUseProgram >( program );
 			}
 
 			stack.setCurrentProgram( program );
@@ -74,6 +85,26 @@ namespace ashes::gl
 		}
 	}
 
+	void apply( ContextLock const & context
+		, CmdUseBackProgram const & cmd )
+	{
+		auto glpipeline = get( cmd.pipeline );
+		auto program = glpipeline->getBackProgram( context );
+		// Through the replay, so that the shadowed state knows about the bound program.
+		CmdList list;
+
+		if ( hasProgramPipelines( glpipeline->getDevice() ) )
+		{
+			list.emplace< OpType::eUseProgramPipeline >( program );
+		}
+		else
+		{
+			list.emplace< OpType::eUseProgram >( program );
+		}
+
+		applyBuffer( context, list );
+	}
+
 	void buildUnbindPipelineCommand( ContextStateStack & stack
 		, VkDevice device
 		, CmdList & list )
@@ -82,11 +113,11 @@ namespace ashes::gl
 
 		if ( hasProgramPipelines( device ) )
 		{
-			list.push_back( makeCmd< OpType::eUseProgramPipeline >( 0u ) );
+			list.emplace< OpType::eUseProgramPipeline >( 0u );
 		}
 		else
 		{
-			list.push_back( makeCmd< OpType::eUseProgram >( 0u ) );
+			list.emplace< OpType::eUseProgram >( 0u );
 		}
 	}
 }
@@ -90,19 +90,19 @@ namespace ashes::gl
 				, srcImage
 				, dstImage };
 
-			list.push_back( makeCmd< OpType::eBindSrcFramebuffer >( GL_READ_FRAMEBUFFER ) );
+			list.emplace< OpType::eBindSrcFramebuffer >( GL_READ_FRAMEBUFFER );
 			layerCopy.bindSrc( stack
 				, srcBaseArrayLayer + layer
 				, uint32_t( float( srcBaseSlice + layer ) * sliceRatio )
 				, GL_READ_FRAMEBUFFER
 				, list );
-			list.push_back( makeCmd< OpType::eBindDstFramebuffer >( GL_DRAW_FRAMEBUFFER ) );
+			list.emplace< OpType::eBindDstFramebuffer >( GL_DRAW_FRAMEBUFFER );
 			layerCopy.bindDst( stack
 				, dstBaseArrayLayer + layer
 				, dstBaseSlice + layer
 				, GL_DRAW_FRAMEBUFFER
 				, list );
-			list.push_back( makeCmd< OpType::eBlitFramebuffer >( layerCopy.getRegion().srcOffsets[0].x
+			list.emplace< OpType::eBlitFramebuffer >( layerCopy.getRegion().srcOffsets[0].x
 				, layerCopy.getRegion().srcOffsets[0].y
 				, layerCopy.getRegion().srcOffsets[1].x
 				, layerCopy.getRegion().srcOffsets[1].y
@@ -111,11 +111,11 @@ namespace ashes::gl
 				, layerCopy.getRegion().dstOffsets[1].x
 				, layerCopy.getRegion().dstOffsets[1].y
 				, blitimg::getMask( get( srcImage )->getFormatVk() )
-				, convert( filter ) ) );
-			list.push_back( makeCmd< OpType::eBindFramebuffer >( GL_READ_FRAMEBUFFER
-				, nullptr ) );
-			list.push_back( makeCmd< OpType::eBindFramebuffer >( GL_DRAW_FRAMEBUFFER
-				, nullptr ) );
+				, convert( filter ) );
+			list.emplace< OpType::eBindFramebuffer >( GL_READ_FRAMEBUFFER
+				, nullptr );
+			list.emplace< OpType::eBindFramebuffer >( GL_DRAW_FRAMEBUFFER
+				, nullptr );
 
 			if ( stack.hasCurrentFramebuffer() )
 			{
@@ -36,8 +36,8 @@ namespace ashes::gl
 				if ( ashes::checkFlag( clearAttach.aspectMask, VK_IMAGE_ASPECT_COLOR_BIT ) )
 				{
 					auto & colour = clearAttach.clearValue.color;
-					list.push_back( makeCmd< OpType::eClearColour >( colour
-						, clearAttach.colorAttachment ) );
+					list.emplace< OpType::eClearColour >( colour
+						, clearAttach.colorAttachment );
 				}
 				else
 				{
@@ -46,15 +46,15 @@ namespace ashes::gl
 
 					if ( ashes::checkFlag( clearAttach.aspectMask, VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT ) )
 					{
-						list.push_back( makeCmd< OpType::eClearDepthStencil >( depthStencil ) );
+						list.emplace< OpType::eClearDepthStencil >( depthStencil );
 					}
 					else if ( ashes::checkFlag( clearAttach.aspectMask, VK_IMAGE_ASPECT_DEPTH_BIT ) )
 					{
-						list.push_back( makeCmd< OpType::eClearDepth >( depthStencil.depth ) );
+						list.emplace< OpType::eClearDepth >( depthStencil.depth );
 					}
 					else if ( ashes::checkFlag( clearAttach.aspectMask, VK_IMAGE_ASPECT_STENCIL_BIT ) )
 					{
-						list.push_back( makeCmd< OpType::eClearStencil >( stencil ) );
+						list.emplace< OpType::eClearStencil >( stencil );
 					}
 				}
 			}
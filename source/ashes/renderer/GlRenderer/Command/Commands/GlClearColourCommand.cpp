@@ -43,24 +43,24 @@ namespace ashes::gl
 				{
 					if ( isUIntFormat( get( image )->getFormatVk() ) )
 					{
-						list.push_back( makeCmd< OpType::eClearTexColorUI >( get( image )->getInternal()
+						list.emplace< OpType::eClearTexColorUI >( get( image )->getInternal()
 							, level
 							, get( image )->getUnpackFormat()
-							, value.uint32 ) );
+							, value.uint32 );
 					}
 					else if ( isSIntFormat( get( image )->getFormatVk() ) )
 					{
-						list.push_back( makeCmd< OpType::eClearTexColorSI >( get( image )->getInternal()
+						list.emplace< OpType::eClearTexColorSI >( get( image )->getInternal()
 							, level
 							, get( image )->getUnpackFormat()
-							, value.int32 ) );
+							, value.int32 );
 					}
 					else
 					{
-						list.push_back( makeCmd< OpType::eClearTexColorF >( get( image )->getInternal()
+						list.emplace< OpType::eClearTexColorF >( get( image )->getInternal()
 							, level
 							, get( image )->getUnpackFormat()
-							, value.float32 ) );
+							, value.float32 );
 					}
 				}
 			}
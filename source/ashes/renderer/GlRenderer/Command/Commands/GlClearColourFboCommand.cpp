@@ -33,7 +33,7 @@ namespace ashes::gl
 		}
 
 		bool hadFbo = stack.hasCurrentFramebuffer();
-		list.push_back( makeCmd< OpType::eBindDstFramebuffer >( GL_FRAMEBUFFER ) );
+		list.emplace< OpType::eBindDstFramebuffer >( GL_FRAMEBUFFER );
 		auto point = getAttachmentPoint( glimage.getFormatVk() );
 
 		for ( auto range : ranges )
@@ -54,39 +54,39 @@ namespace ashes::gl
 				{
 					for ( auto layer = range.baseArrayLayer; layer < range.baseArrayLayer + range.layerCount; ++layer )
 					{
-						list.push_back( makeCmd< OpType::eFramebufferTextureLayer >( GL_FRAMEBUFFER
+						list.emplace< OpType::eFramebufferTextureLayer >( GL_FRAMEBUFFER
 							, point
 							, get( image )->getInternal()
 							, level
-							, layer ) );
-						list.push_back( makeCmd< OpType::eDrawBuffers >( point ) );
-						list.push_back( makeCmd< OpType::eClearColour >( value
-							, 0u ) );
+							, layer );
+						list.emplace< OpType::eDrawBuffers >( point );
+						list.emplace< OpType::eClearColour >( value
+							, 0u );
 					}
 				}
 				else
 				{
-					list.push_back( makeCmd< OpType::eFramebufferTexture2D >( GL_FRAMEBUFFER
+					list.emplace< OpType::eFramebufferTexture2D >( GL_FRAMEBUFFER
 						, point
 						, target
 						, get( image )->getInternal()
-						, level ) );
-					list.push_back( makeCmd< OpType::eDrawBuffers >( point ) );
-					list.push_back( makeCmd< OpType::eClearColour >( value
-						, 0u ) );
+						, level );
+					list.emplace< OpType::eDrawBuffers >( point );
+					list.emplace< OpType::eClearColour >( value
+						, 0u );
 				}
 			}
 		}
 
 		if ( hadFbo )
 		{
-			list.push_back( makeCmd< OpType::eBindFramebuffer >( GL_FRAMEBUFFER
-				, stack.getCurrentFramebuffer() ) );
+			list.emplace< OpType::eBindFramebuffer >( GL_FRAMEBUFFER
+				, stack.getCurrentFramebuffer() );
 		}
 		else
 		{
-			list.push_back( makeCmd< OpType::eBindFramebuffer >( GL_FRAMEBUFFER
-				, nullptr ) );
+			list.emplace< OpType::eBindFramebuffer >( GL_FRAMEBUFFER
+				, nullptr );
 		}
 	}
 }
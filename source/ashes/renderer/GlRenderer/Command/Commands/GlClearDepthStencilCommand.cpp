@@ -36,11 +36,11 @@ namespace ashes::gl
 				level < range.baseMipLevel + range.levelCount;
 				++level )
 			{
-				list.push_back( makeCmd< OpType::eClearTexDepthStencil >( get( image )->getInternal()
+				list.emplace< OpType::eClearTexDepthStencil >( get( image )->getInternal()
 					, level
 					, format
 					, type
-					, value ) );
+					, value );
 			}
 		}
 	}
@@ -69,11 +69,11 @@ namespace ashes::gl
 				level < range.baseMipLevel + range.levelCount;
 				++level )
 			{
-				list.push_back( makeCmd< OpType::eClearTexStencil >( get( image )->getInternal()
+				list.emplace< OpType::eClearTexStencil >( get( image )->getInternal()
 					, level
 					, format
 					, type
-					, int32_t( value.stencil ) ) );
+					, int32_t( value.stencil ) );
 			}
 		}
 	}
@@ -102,11 +102,11 @@ namespace ashes::gl
 				level < range.baseMipLevel + range.levelCount;
 				++level )
 			{
-				list.push_back( makeCmd< OpType::eClearTexDepth >( get( image )->getInternal()
+				list.emplace< OpType::eClearTexDepth >( get( image )->getInternal()
 					, level
 					, format
 					, type
-					, value.depth ) );
+					, value.depth );
 			}
 		}
 	}
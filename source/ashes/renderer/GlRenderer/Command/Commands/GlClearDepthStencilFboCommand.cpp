@@ -23,24 +23,24 @@ namespace ashes::gl
 	{
 		for ( auto layer = range.baseArrayLayer; layer < range.baseArrayLayer + range.layerCount; ++layer )
 		{
-			list.push_back( makeCmd< OpType::eFramebufferTextureLayer >( GL_FRAMEBUFFER
+			list.emplace< OpType::eFramebufferTextureLayer >( GL_FRAMEBUFFER
 				, point
 				, get( image )->getInternal()
 				, level
-				, layer ) );
+				, layer );
 			auto format = get( image )->getFormatVk();
 
 			if ( isDepthStencilFormat( format ) )
 			{
-				list.push_back( makeCmd< OpType::eClearDepthStencil >( value ) );
+				list.emplace< OpType::eClearDepthStencil >( value );
 			}
 			else if ( isDepthFormat( format ) )
 			{
-				list.push_back( makeCmd< OpType::eClearDepth >( value.depth ) );
+				list.emplace< OpType::eClearDepth >( value.depth );
 			}
 			else if ( isStencilFormat( format ) )
 			{
-				list.push_back( makeCmd< OpType::eClearStencil >( int32_t( value.stencil ) ) );
+				list.emplace< OpType::eClearStencil >( int32_t( value.stencil ) );
 			}
 		}
 	}
@@ -51,24 +51,24 @@ namespace ashes::gl
 		, VkClearDepthStencilValue value
 		, CmdList & list )
 	{
-		list.push_back( makeCmd< OpType::eFramebufferTexture2D >( GL_FRAMEBUFFER
+		list.emplace< OpType::eFramebufferTexture2D >( GL_FRAMEBUFFER
 			, point
 			, target
 			, get( image )->getInternal()
-			, level ) );
+			, level );
 		auto format = get( image )->getFormatVk();
 
 		if ( isDepthStencilFormat( format ) )
 		{
-			list.push_back( makeCmd< OpType::eClearDepthStencil >( value ) );
+			list.emplace< OpType::eClearDepthStencil >( value );
 		}
 		else if ( isDepthFormat( format ) )
 		{
-			list.push_back( makeCmd< OpType::eClearDepth >( value.depth ) );
+			list.emplace< OpType::eClearDepth >( value.depth );
 		}
 		else if ( isStencilFormat( format ) )
 		{
-			list.push_back( makeCmd< OpType::eClearStencil >( int32_t( value.stencil ) ) );
+			list.emplace< OpType::eClearStencil >( int32_t( value.stencil ) );
 		}
 	}
 
@@ -91,7 +91,7 @@ namespace ashes::gl
 		}
 
 		bool hadFbo = stack.hasCurrentFramebuffer();
-		list.push_back( makeCmd< OpType::eBindDstFramebuffer >( GL_FRAMEBUFFER ) );
+		list.emplace< OpType::eBindDstFramebuffer >( GL_FRAMEBUFFER );
 		auto point = getAttachmentPoint( glimage.getFormatVk() );
 
 		for ( auto range : ranges )
@@ -121,13 +121,13 @@ namespace ashes::gl
 
 		if ( hadFbo )
 		{
-			list.push_back( makeCmd< OpType::eBindFramebuffer >( GL_FRAMEBUFFER
-				, stack.getCurrentFramebuffer() ) );
+			list.emplace< OpType::eBindFramebuffer >( GL_FRAMEBUFFER
+				, stack.getCurrentFramebuffer() );
 		}
 		else
 		{
-			list.push_back( makeCmd< OpType::eBindFramebuffer >( GL_FRAMEBUFFER
-				, nullptr ) );
+			list.emplace< OpType::eBindFramebuffer >( GL_FRAMEBUFFER
+				, nullptr );
 		}
 	}
 }
@@ -4,6 +4,7 @@ See LICENSE file in root folder.
 */
 #include "Command/Commands/GlCommandBase.hpp"
 
+#include "Buffer/GlGeometryBuffers.hpp"
 #include "Core/GlContextLock.hpp"
 #include "Miscellaneous/GlDeviceMemory.hpp"
 #include "RenderPass/GlFrameBuffer.hpp"
@@ -112,6 +113,19 @@ namespace ashes::gl
 			, GLsizeiptr( cmd.range ) );
 	}
 
+	void apply( ContextLock const & context
+		, CmdBindBuffersRange const & cmd )
+	{
+		glLogCall( context
+			, glBindBuffersRange
+			, cmd.target
+			, cmd.first
+			, GLsizei( cmd.count )
+			, cmd.names.data()
+			, cmd.offsets.data()
+			, cmd.ranges.data() );
+	}
+
 	void apply( ContextLock const & context
 		, CmdBindContextState const & cmd )
 	{
@@ -185,6 +199,16 @@ namespace ashes::gl
 			, cmd.internal );
 	}
 
+	void apply( ContextLock const & context
+		, CmdBindImageTextures const & cmd )
+	{
+		glLogCall( context
+			, glBindImageTextures
+			, cmd.first
+			, GLsizei( cmd.count )
+			, cmd.names.data() );
+	}
+
 	void apply( ContextLock const & context
 		, CmdBindSampler const & cmd )
 	{
@@ -194,6 +218,16 @@ namespace ashes::gl
 			, cmd.name );
 	}
 
+	void apply( ContextLock const & context
+		, CmdBindSamplers const & cmd )
+	{
+		glLogCall( context
+			, glBindSamplers
+			, cmd.first
+			, GLsizei( cmd.count )
+			, cmd.names.data() );
+	}
+
 	void apply( ContextLock const & context
 		, CmdBindTexture const & cmd )
 	{
@@ -203,6 +237,45 @@ namespace ashes::gl
 			, cmd.name );
 	}
 
+	void apply( ContextLock const & context
+		, CmdBindTextures const & cmd )
+	{
+		glLogCall( context
+			, glBindTextures
+			, cmd.first
+			, GLsizei( cmd.count )
+			, cmd.names.data() );
+	}
+
+	void apply( ContextLock const & context
+		, CmdBindVertexBuffer const & cmd )
+	{
+		glLogCall( context
+			, glBindVertexBuffer
+			, cmd.binding
+			, cmd.name
+			, cmd.offset
+			, cmd.stride );
+	}
+
+	void apply( ContextLock const & context
+		, CmdBindVertexBuffers const & cmd )
+	{
+		glLogCall( context
+			, glBindVertexBuffers
+			, cmd.first
+			, GLsizei( cmd.count )
+			, cmd.names.data()
+			, cmd.offsets.data()
+			, cmd.strides.data() );
+	}
+
+	void apply( ContextLock const & context
+		, CmdBindVertexLayout const & cmd )
+	{
+		cmd.cache->bind( context, *cmd.layout );
+	}
+
 	void apply( ContextLock const & context
 		, CmdBindVextexArray const & cmd )
 	{
@@ -842,12 +915,12 @@ namespace ashes::gl
 	void apply( ContextLock const & context
 		, CmdGetQueryResults const & cmd )
 	{
-		get( cmd.queryPool )->getResults( context
+		get( cmd.queryPool )->resolveResults( context
 			, cmd.firstQuery
 			, cmd.queryCount
 			, cmd.stride
 			, cmd.flags
-			, getBufferOffset( intptr_t( cmd.bufferOffset ) ) );
+			, cmd.bufferOffset );
 	}
 
 	void apply( ContextLock const & context
@@ -862,6 +935,12 @@ namespace ashes::gl
 			, getBufferOffset( cmd.offset ) );
 	}
 
+	void apply( [[maybe_unused]] ContextLock const & context
+		, CmdInvalidateMemoryPages const & cmd )
+	{
+		get( cmd.memory )->invalidatePages( BindingRange{ cmd.offset, cmd.size } );
+	}
+
 	void apply( ContextLock const & context
 		, CmdLineWidth const & cmd )
 	{
@@ -1157,16 +1236,16 @@ namespace ashes::gl
 			, nullptr );
 	}
 
-	void apply( ContextLock const &
+	void apply( ContextLock const & context
 		, CmdResetEvent const & cmd )
 	{
-		get( cmd.event )->reset();
+		get( cmd.event )->reset( context );
 	}
 
-	void apply( ContextLock const &
+	void apply( ContextLock const & context
 		, CmdSetEvent const & cmd )
 	{
-		get( cmd.event )->set();
+		get( cmd.event )->set( context );
 	}
 
 	void apply( ContextLock const & context
@@ -1472,23 +1551,13 @@ namespace ashes::gl
 			, cmd.program );
 	}
 
-	void apply( ContextLock const &
+	void apply( ContextLock const & context
 		, CmdWaitEvents const & cmd )
 	{
-		auto count = 0u;
-
-		do
+		for ( auto event : cmd.events )
 		{
-			count = uint32_t( std::count_if( cmd.events.begin()
-				, cmd.events.end()
-				, []( VkEvent event )
-				{
-					return get( event )->getStatus() == VK_EVENT_SET
-						|| get( event )->getStatus() == VK_EVENT_RESET;
-				} ) );
-			std::this_thread::sleep_for( std::chrono::nanoseconds{ 10 } );
+			get( event )->wait( context );
 		}
-		while ( count != cmd.events.size() );
 	}
 
 	void apply( ContextLock const & context
@@ -5,6 +5,7 @@ See LICENSE file in root folder
 #pragma once
 
 #include "renderer/GlRenderer/GlRendererPrerequisites.hpp"
+#include "renderer/GlRenderer/Command/GlCommandList.hpp"
 
 #include <ashes/common/ArrayView.hpp>
 
@@ -33,13 +34,20 @@ namespace ashes::gl
 		eBeginQuery,
 		eBindBuffer,
 		eBindBufferRange,
+		eBindBuffersRange,
 		eBindContextState,
 		eBindFramebuffer,
 		eBindSrcFramebuffer,
 		eBindDstFramebuffer,
 		eBindImage,
+		eBindImageTextures,
 		eBindSampler,
+		eBindSamplers,
 		eBindTexture,
+		eBindTextures,
+		eBindVertexBuffer,
+		eBindVertexBuffers,
+		eBindVertexLayout,
 		eBindVextexArray,
 		eBindVextexArrayObject,
 		eBlendConstants,
@@ -98,6 +106,7 @@ namespace ashes::gl
 		eGetCompressedTexImage,
 		eGetQueryResults,
 		eGetTexImage,
+		eInvalidateMemoryPages,
 		eLineWidth,
 		eLogCommand,
 		eLogicOp,
@@ -124,6 +133,7 @@ namespace ashes::gl
 		eProgramUniformMatrix2fv,
 		eProgramUniformMatrix3fv,
 		eProgramUniformMatrix4fv,
+		ePushBackConstants,
 		ePushDebugGroup,
 		eReadBuffer,
 		eReadPixels,
@@ -155,6 +165,7 @@ namespace ashes::gl
 		eUniformMatrix4fv,
 		eUpdateBuffer,
 		eUploadMemory,
+		eUseBackProgram,
 		eUseProgram,
 		eUseProgramPipeline,
 		eWaitEvents,
@@ -187,6 +198,14 @@ namespace ashes::gl
 	template< OpType OpT >
 	struct CmdT;
 
+	template<> struct ChangesBindings< OpType::eBindBufferRange > : std::true_type {};
+	template<> struct ChangesBindings< OpType::eBindImage > : std::true_type {};
+	template<> struct ChangesBindings< OpType::eBindSampler > : std::true_type {};
+	template<> struct ChangesBindings< OpType::eBindTexture > : std::true_type {};
+	// Memory transfers bind the images textures, on the active unit.
+	template<> struct ChangesBindings< OpType::eDownloadMemory > : std::true_type {};
+	template<> struct ChangesBindings< OpType::eUploadMemory > : std::true_type {};
+
 	//*************************************************************************
 
 	template< typename TypeT, typename IterT >
@@ -583,6 +602,44 @@ namespace ashes::gl
 
 	//*************************************************************************
 
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eBindBuffersRange >
+	{
+		static uint32_t constexpr MaxElems = 16u;
+
+		explicit CmdT( GlBufferTarget target
+			, uint32_t first )
+			: target{ target }
+			, first{ first }
+		{
+		}
+
+		void push( uint32_t name
+			, int64_t offset
+			, int64_t range )
+		{
+			assert( count < MaxElems );
+			names[count] = name;
+			offsets[count] = GLintptr( offset );
+			ranges[count] = GLsizeiptr( range );
+			++count;
+		}
+
+		Command cmd{ makeCommand< CmdT >( OpType::eBindBuffersRange ) };
+		GlBufferTarget target;
+		uint32_t first;
+		uint32_t count{};
+		std::array< GLuint, MaxElems > names{};
+		std::array< GLintptr, MaxElems > offsets{};
+		std::array< GLsizeiptr, MaxElems > ranges{};
+	};
+	using CmdBindBuffersRange = CmdT< OpType::eBindBuffersRange >;
+
+	void apply( ContextLock const & context
+		, CmdBindBuffersRange const & cmd );
+
+	//*************************************************************************
+
 	template<>
 	struct alignas( uint64_t ) CmdT< OpType::eBindContextState >
 	{
@@ -637,6 +694,35 @@ namespace ashes::gl
 
 	//*************************************************************************
 
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eBindImageTextures >
+	{
+		static uint32_t constexpr MaxElems = 32u;
+
+		explicit CmdT( uint32_t first )
+			: first{ first }
+		{
+		}
+
+		void push( uint32_t name )
+		{
+			assert( count < MaxElems );
+			names[count] = name;
+			++count;
+		}
+
+		Command cmd{ makeCommand< CmdT >( OpType::eBindImageTextures ) };
+		uint32_t first;
+		uint32_t count{};
+		std::array< GLuint, MaxElems > names{};
+	};
+	using CmdBindImageTextures = CmdT< OpType::eBindImageTextures >;
+
+	void apply( ContextLock const & context
+		, CmdBindImageTextures const & cmd );
+
+	//*************************************************************************
+
 	template<>
 	struct alignas( uint64_t ) CmdT< OpType::eBindSampler >
 	{
@@ -658,6 +744,35 @@ namespace ashes::gl
 
 	//*************************************************************************
 
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eBindSamplers >
+	{
+		static uint32_t constexpr MaxElems = 32u;
+
+		explicit CmdT( uint32_t first )
+			: first{ first }
+		{
+		}
+
+		void push( uint32_t name )
+		{
+			assert( count < MaxElems );
+			names[count] = name;
+			++count;
+		}
+
+		Command cmd{ makeCommand< CmdT >( OpType::eBindSamplers ) };
+		uint32_t first;
+		uint32_t count{};
+		std::array< GLuint, MaxElems > names{};
+	};
+	using CmdBindSamplers = CmdT< OpType::eBindSamplers >;
+
+	void apply( ContextLock const & context
+		, CmdBindSamplers const & cmd );
+
+	//*************************************************************************
+
 	template<>
 	struct alignas( uint64_t ) CmdT< OpType::eBindTexture >
 	{
@@ -679,6 +794,118 @@ namespace ashes::gl
 
 	//*************************************************************************
 
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eBindTextures >
+	{
+		static uint32_t constexpr MaxElems = 32u;
+
+		explicit CmdT( uint32_t first )
+			: first{ first }
+		{
+		}
+
+		void push( uint32_t name )
+		{
+			assert( count < MaxElems );
+			names[count] = name;
+			++count;
+		}
+
+		Command cmd{ makeCommand< CmdT >( OpType::eBindTextures ) };
+		uint32_t first;
+		uint32_t count{};
+		std::array< GLuint, MaxElems > names{};
+	};
+	using CmdBindTextures = CmdT< OpType::eBindTextures >;
+
+	void apply( ContextLock const & context
+		, CmdBindTextures const & cmd );
+
+	//*************************************************************************
+
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eBindVertexBuffer >
+	{
+		explicit CmdT( uint32_t binding
+			, uint32_t name
+			, GLintptr offset
+			, GLsizei stride )
+			: binding{ binding }
+			, name{ name }
+			, offset{ offset }
+			, stride{ stride }
+		{
+		}
+
+		Command cmd{ makeCommand< CmdT >( OpType::eBindVertexBuffer ) };
+		uint32_t binding;
+		uint32_t name;
+		GLintptr offset;
+		GLsizei stride;
+	};
+	using CmdBindVertexBuffer = CmdT< OpType::eBindVertexBuffer >;
+
+	void apply( ContextLock const & context
+		, CmdBindVertexBuffer const & cmd );
+
+	//*************************************************************************
+
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eBindVertexBuffers >
+	{
+		static uint32_t constexpr MaxElems = 16u;
+
+		explicit CmdT( uint32_t first )
+			: first{ first }
+		{
+		}
+
+		void push( uint32_t name
+			, GLintptr offset
+			, GLsizei stride )
+		{
+			assert( count < MaxElems );
+			names[count] = name;
+			offsets[count] = offset;
+			strides[count] = stride;
+			++count;
+		}
+
+		Command cmd{ makeCommand< CmdT >( OpType::eBindVertexBuffers ) };
+		uint32_t first;
+		uint32_t count{};
+		std::array< GLintptr, MaxElems > offsets{};
+		std::array< GLuint, MaxElems > names{};
+		std::array< GLsizei, MaxElems > strides{};
+	};
+	using CmdBindVertexBuffers = CmdT< OpType::eBindVertexBuffers >;
+
+	void apply( ContextLock const & context
+		, CmdBindVertexBuffers const & cmd );
+
+	//*************************************************************************
+
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eBindVertexLayout >
+	{
+		explicit CmdT( VertexArrayCache const * cache
+			, VertexLayout const * layout )
+			: cache{ cache }
+			, layout{ layout }
+		{
+		}
+
+		Command cmd{ makeCommand< CmdT >( OpType::eBindVertexLayout ) };
+		VertexArrayCache const * cache;
+		VertexLayout const * layout;
+	};
+	using CmdBindVertexLayout = CmdT< OpType::eBindVertexLayout >;
+
+	void apply( ContextLock const & context
+		, CmdBindVertexLayout const & cmd );
+
+	//*************************************************************************
+
 	template<>
 	struct alignas( uint64_t ) CmdT< OpType::eBindVextexArray >
 	{
@@ -2234,6 +2461,34 @@ namespace ashes::gl
 
 	//*************************************************************************
 
+	/**
+	*\brief
+	*	Tells a device memory that the GPU may have written a range of its GL buffer.
+	*/
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eInvalidateMemoryPages >
+	{
+		explicit CmdT( VkDeviceMemory memory
+			, VkDeviceSize offset
+			, VkDeviceSize size )
+			: memory{ memory }
+			, offset{ offset }
+			, size{ size }
+		{
+		}
+
+		Command cmd{ makeCommand< CmdT >( OpType::eInvalidateMemoryPages ) };
+		VkDeviceMemory memory;
+		VkDeviceSize offset;
+		VkDeviceSize size;
+	};
+	using CmdInvalidateMemoryPages = CmdT< OpType::eInvalidateMemoryPages >;
+
+	void apply( ContextLock const & context
+		, CmdInvalidateMemoryPages const & cmd );
+
+	//*************************************************************************
+
 	template<>
 	struct alignas( uint64_t ) CmdT< OpType::eLineWidth >
 	{
@@ -2824,6 +3079,34 @@ namespace ashes::gl
 
 	//*************************************************************************
 
+	/**
+	*\brief
+	*	Push constants for the back buffer program variant of a pipeline, which is only known at replay.
+	*/
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::ePushBackConstants >
+	{
+		explicit CmdT( VkPipeline pipeline
+			, VkShaderStageFlags stageFlags
+			, ByteArray const * data )
+			: pipeline{ pipeline }
+			, stageFlags{ stageFlags }
+			, data{ data }
+		{
+		}
+
+		Command cmd{ makeCommand< CmdT >( OpType::ePushBackConstants ) };
+		VkPipeline pipeline;
+		VkShaderStageFlags stageFlags;
+		ByteArray const * data;
+	};
+	using CmdPushBackConstants = CmdT< OpType::ePushBackConstants >;
+
+	void apply( ContextLock const & context
+		, CmdPushBackConstants const & cmd );
+
+	//*************************************************************************
+
 	template<>
 	struct alignas( uint64_t ) CmdT< OpType::ePushDebugGroup >
 	{
@@ -3599,6 +3882,28 @@ namespace ashes::gl
 
 	//*************************************************************************
 
+	/**
+	*\brief
+	*	Binds the back buffer program variant of a pipeline, which is only known at replay.
+	*/
+	template<>
+	struct alignas( uint64_t ) CmdT< OpType::eUseBackProgram >
+	{
+		explicit CmdT( VkPipeline pipeline )
+			: pipeline{ pipeline }
+		{
+		}
+
+		Command cmd{ makeCommand< CmdT >( OpType::eUseBackProgram ) };
+		VkPipeline pipeline;
+	};
+	using CmdUseBackProgram = CmdT< OpType::eUseBackProgram >;
+
+	void apply( ContextLock const & context
+		, CmdUseBackProgram const & cmd );
+
+	//*************************************************************************
+
 	template<>
 	struct alignas( uint64_t ) CmdT< OpType::eUseProgram >
 	{
@@ -3671,17 +3976,6 @@ namespace ashes::gl
 
 	//*************************************************************************
 
-	template< OpType OpT, typename ... ParamsT >
-	CmdBuffer makeCmd( ParamsT && ... params )
-	{
-		CmdT< OpT > cmd{ std::forward< ParamsT >( params )... };
-		CmdBuffer result;
-		result.resize( cmd.cmd.op.size );
-		auto it = result.begin();
-		push( it, result.end(), cmd );
-		return result;
-	}
-
 	template< typename IterT >
 	bool map( IterT & cur, IterT end, Command const *& cmd )
 	{
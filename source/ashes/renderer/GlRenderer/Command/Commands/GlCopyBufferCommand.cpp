@@ -34,16 +34,16 @@ namespace ashes::gl
 				, get( dst )->getMemoryBinding().getSize() );
 		}
 
-		list.push_back( makeCmd< OpType::eBindBuffer >( GL_BUFFER_TARGET_COPY_READ
-			, get( src )->getInternal() ) );
-		list.push_back( makeCmd< OpType::eBindBuffer >( GL_BUFFER_TARGET_COPY_WRITE
-			, get( dst )->getInternal() ) );
-		list.push_back( makeCmd< OpType::eCopyBufferSubData >( GL_BUFFER_TARGET_COPY_READ
+		list.emplace< OpType::eBindBuffer >( GL_BUFFER_TARGET_COPY_READ
+			, get( src )->getInternal() );
+		list.emplace< OpType::eBindBuffer >( GL_BUFFER_TARGET_COPY_WRITE
+			, get( dst )->getInternal() );
+		list.emplace< OpType::eCopyBufferSubData >( GL_BUFFER_TARGET_COPY_READ
 			, GL_BUFFER_TARGET_COPY_WRITE
-			, std::move( copyInfo ) ) );
-		list.push_back( makeCmd< OpType::eBindBuffer >( GL_BUFFER_TARGET_COPY_WRITE
-			, 0u ) );
-		list.push_back( makeCmd< OpType::eBindBuffer >( GL_BUFFER_TARGET_COPY_READ
-			, 0u ) );
+			, std::move( copyInfo ) );
+		list.emplace< OpType::eBindBuffer >( GL_BUFFER_TARGET_COPY_WRITE
+			, 0u );
+		list.emplace< OpType::eBindBuffer >( GL_BUFFER_TARGET_COPY_READ
+			, 0u );
 	}
 }
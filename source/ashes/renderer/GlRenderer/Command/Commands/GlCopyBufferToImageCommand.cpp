@@ -28,28 +28,28 @@ namespace ashes::gl
 			, get( dst )->getType()
 			, get( dst )->getArrayLayers()
 			, get( dst )->getCreateFlags() );
-		list.push_back( makeCmd< OpType::eBindBuffer >( GL_BUFFER_TARGET_PIXEL_UNPACK
-			, src.getInternal() ) );
+		list.emplace< OpType::eBindBuffer >( GL_BUFFER_TARGET_PIXEL_UNPACK
+			, src.getInternal() );
 		stack.applyUnpackAlign( list, 1 );
-		list.push_back( makeCmd< OpType::eBindTexture >( copyTarget
-			, get( dst )->getInternal() ) );
+		list.emplace< OpType::eBindTexture >( copyTarget
+			, get( dst )->getInternal() );
 
 		if ( isCompressedFormat( get( dst )->getFormatVk() ) )
 		{
 			switch ( copyTarget )
 			{
 			case GL_TEXTURE_1D:
-				list.push_back( makeCmd< OpType::eCompressedTexSubImage1D >( copyTarget
+				list.emplace< OpType::eCompressedTexSubImage1D >( copyTarget
 					, copyInfo.imageSubresource.mipLevel
 					, copyInfo.imageOffset.x
 					, copyInfo.imageExtent.width
 					, get( dst )->getInternalFormat()
 					, int32_t( getSize( copyInfo.imageExtent, get( dst )->getFormatVk() ) )
-					, int32_t( copyInfo.bufferOffset ) ) );
+					, int32_t( copyInfo.bufferOffset ) );
 				break;
 
 			case GL_TEXTURE_2D:
-				list.push_back( makeCmd< OpType::eCompressedTexSubImage2D >( copyTarget
+				list.emplace< OpType::eCompressedTexSubImage2D >( copyTarget
 					, copyInfo.imageSubresource.mipLevel
 					, copyInfo.imageOffset.x
 					, copyInfo.imageOffset.y
@@ -57,11 +57,11 @@ namespace ashes::gl
 					, copyInfo.imageExtent.height
 					, get( dst )->getInternalFormat()
 					, int32_t( getSize( copyInfo.imageExtent, get( dst )->getFormatVk() ) )
-					, int32_t( copyInfo.bufferOffset ) ) );
+					, int32_t( copyInfo.bufferOffset ) );
 				break;
 
 			case GL_TEXTURE_3D:
-				list.push_back( makeCmd< OpType::eCompressedTexSubImage3D >( copyTarget
+				list.emplace< OpType::eCompressedTexSubImage3D >( copyTarget
 					, copyInfo.imageSubresource.mipLevel
 					, copyInfo.imageOffset.x
 					, copyInfo.imageOffset.y
@@ -71,11 +71,11 @@ namespace ashes::gl
 					, copyInfo.imageExtent.depth
 					, get( dst )->getInternalFormat()
 					, int32_t( getSize( copyInfo.imageExtent, get( dst )->getFormatVk() ) )
-					, int32_t( copyInfo.bufferOffset ) ) );
+					, int32_t( copyInfo.bufferOffset ) );
 				break;
 
 			case GL_TEXTURE_1D_ARRAY:
-				list.push_back( makeCmd< OpType::eCompressedTexSubImage2D >( copyTarget
+				list.emplace< OpType::eCompressedTexSubImage2D >( copyTarget
 					, copyInfo.imageSubresource.mipLevel
 					, copyInfo.imageOffset.x
 					, int32_t( copyInfo.imageSubresource.baseArrayLayer )
@@ -83,11 +83,11 @@ namespace ashes::gl
 					, copyInfo.imageSubresource.layerCount
 					, get( dst )->getInternalFormat()
 					, int32_t( getSize( copyInfo.imageExtent, get( dst )->getFormatVk() ) )
-					, int32_t( copyInfo.bufferOffset ) ) );
+					, int32_t( copyInfo.bufferOffset ) );
 				break;
 
 			case GL_TEXTURE_2D_ARRAY:
-				list.push_back( makeCmd< OpType::eCompressedTexSubImage3D >( copyTarget
+				list.emplace< OpType::eCompressedTexSubImage3D >( copyTarget
 					, copyInfo.imageSubresource.mipLevel
 					, copyInfo.imageOffset.x
 					, copyInfo.imageOffset.y
@@ -97,11 +97,11 @@ namespace ashes::gl
 					, copyInfo.imageSubresource.layerCount
 					, get( dst )->getInternalFormat()
 					, int32_t( getSize( copyInfo.imageExtent, get( dst )->getFormatVk() ) )
-					, int32_t( copyInfo.bufferOffset ) ) );
+					, int32_t( copyInfo.bufferOffset ) );
 				break;
 
 			case GL_TEXTURE_CUBE:
-				list.push_back( makeCmd< OpType::eCompressedTexSubImage2D >( GlTextureType( GL_TEXTURE_CUBE_POSITIVE_X + copyInfo.imageSubresource.baseArrayLayer )
+				list.emplace< OpType::eCompressedTexSubImage2D >( GlTextureType( GL_TEXTURE_CUBE_POSITIVE_X + copyInfo.imageSubresource.baseArrayLayer )
 					, copyInfo.imageSubresource.mipLevel
 					, copyInfo.imageOffset.x
 					, copyInfo.imageOffset.y
@@ -109,11 +109,11 @@ namespace ashes::gl
 					, copyInfo.imageExtent.height
 					, get( dst )->getInternalFormat()
 					, int32_t( getSize( copyInfo.imageExtent, get( dst )->getFormatVk() ) )
-					, int32_t( copyInfo.bufferOffset ) ) );
+					, int32_t( copyInfo.bufferOffset ) );
 				break;
 
 			case GL_TEXTURE_CUBE_ARRAY:
-				list.push_back( makeCmd< OpType::eCompressedTexSubImage3D >( GlTextureType( GL_TEXTURE_CUBE_POSITIVE_X + ( copyInfo.imageSubresource.baseArrayLayer % 6u ) )
+				list.emplace< OpType::eCompressedTexSubImage3D >( GlTextureType( GL_TEXTURE_CUBE_POSITIVE_X + ( copyInfo.imageSubresource.baseArrayLayer % 6u ) )
 					, copyInfo.imageSubresource.mipLevel
 					, copyInfo.imageOffset.x
 					, copyInfo.imageOffset.y
@@ -123,7 +123,7 @@ namespace ashes::gl
 					, copyInfo.imageSubresource.layerCount / 6u
 					, get( dst )->getInternalFormat()
 					, int32_t( getSize( copyInfo.imageExtent, get( dst )->getFormatVk() ) )
-					, int32_t( copyInfo.bufferOffset ) ) );
+					, int32_t( copyInfo.bufferOffset ) );
 				break;
 
 			default:
@@ -136,17 +136,17 @@ namespace ashes::gl
 			switch ( copyTarget )
 			{
 			case GL_TEXTURE_1D:
-				list.push_back( makeCmd< OpType::eTexSubImage1D >( copyTarget
+				list.emplace< OpType::eTexSubImage1D >( copyTarget
 					, copyInfo.imageSubresource.mipLevel
 					, copyInfo.imageOffset.x
 					, copyInfo.imageExtent.width
 					, unpackFormat
 					, unpackType
-					, int32_t( copyInfo.bufferOffset ) ) );
+					, int32_t( copyInfo.bufferOffset ) );
 				break;
 
 			case GL_TEXTURE_2D:
-				list.push_back( makeCmd< OpType::eTexSubImage2D >( copyTarget
+				list.emplace< OpType::eTexSubImage2D >( copyTarget
 					, copyInfo.imageSubresource.mipLevel
 					, copyInfo.imageOffset.x
 					, copyInfo.imageOffset.y
@@ -154,11 +154,11 @@ namespace ashes::gl
 					, copyInfo.imageExtent.height
 					, unpackFormat
 					, unpackType
-					, int32_t( copyInfo.bufferOffset ) ) );
+					, int32_t( copyInfo.bufferOffset ) );
 				break;
 
 			case GL_TEXTURE_3D:
-				list.push_back( makeCmd< OpType::eTexSubImage3D >( copyTarget
+				list.emplace< OpType::eTexSubImage3D >( copyTarget
 					, copyInfo.imageSubresource.mipLevel
 					, copyInfo.imageOffset.x
 					, copyInfo.imageOffset.y
@@ -168,11 +168,11 @@ namespace ashes::gl
 					, copyInfo.imageExtent.depth
 					, unpackFormat
 					, unpackType
-					, int32_t( copyInfo.bufferOffset ) ) );
+					, int32_t( copyInfo.bufferOffset ) );
 				break;
 
 			case GL_TEXTURE_1D_ARRAY:
-				list.push_back( makeCmd< OpType::eTexSubImage2D >( copyTarget
+				list.emplace< OpType::eTexSubImage2D >( copyTarget
 					, copyInfo.imageSubresource.mipLevel
 					, copyInfo.imageOffset.x
 					, int32_t( copyInfo.imageSubresource.baseArrayLayer )
@@ -180,11 +180,11 @@ namespace ashes::gl
 					, copyInfo.imageSubresource.layerCount
 					, unpackFormat
 					, unpackType
-					, int32_t( copyInfo.bufferOffset ) ) );
+					, int32_t( copyInfo.bufferOffset ) );
 				break;
 
 			case GL_TEXTURE_2D_ARRAY:
-				list.push_back( makeCmd< OpType::eTexSubImage3D >( copyTarget
+				list.emplace< OpType::eTexSubImage3D >( copyTarget
 					, copyInfo.imageSubresource.mipLevel
 					, copyInfo.imageOffset.x
 					, copyInfo.imageOffset.y
@@ -194,11 +194,11 @@ namespace ashes::gl
 					, copyInfo.imageSubresource.layerCount
 					, unpackFormat
 					, unpackType
-					, int32_t( copyInfo.bufferOffset ) ) );
+					, int32_t( copyInfo.bufferOffset ) );
 				break;
 
 			case GL_TEXTURE_CUBE:
-				list.push_back( makeCmd< OpType::eTexSubImage2D >( GlTextureType( GL_TEXTURE_CUBE_POSITIVE_X + copyInfo.imageSubresource.baseArrayLayer )
+				list.emplace< OpType::eTexSubImage2D >( GlTextureType( GL_TEXTURE_CUBE_POSITIVE_X + copyInfo.imageSubresource.baseArrayLayer )
 					, copyInfo.imageSubresource.mipLevel
 					, copyInfo.imageOffset.x
 					, copyInfo.imageOffset.y
@@ -206,11 +206,11 @@ namespace ashes::gl
 					, copyInfo.imageExtent.height
 					, unpackFormat
 					, unpackType
-					, int32_t( copyInfo.bufferOffset ) ) );
+					, int32_t( copyInfo.bufferOffset ) );
 				break;
 
 			case GL_TEXTURE_CUBE_ARRAY:
-				list.push_back( makeCmd< OpType::eTexSubImage3D >( GlTextureType( GL_TEXTURE_CUBE_POSITIVE_X + ( copyInfo.imageSubresource.baseArrayLayer % 6u ) )
+				list.emplace< OpType::eTexSubImage3D >( GlTextureType( GL_TEXTURE_CUBE_POSITIVE_X + ( copyInfo.imageSubresource.baseArrayLayer % 6u ) )
 					, copyInfo.imageSubresource.mipLevel
 					, copyInfo.imageOffset.x
 					, copyInfo.imageOffset.y
@@ -220,7 +220,7 @@ namespace ashes::gl
 					, copyInfo.imageSubresource.layerCount / 6u
 					, unpackFormat
 					, unpackType
-					, int32_t( copyInfo.bufferOffset ) ) );
+					, int32_t( copyInfo.bufferOffset ) );
 				break;
 
 			default:
@@ -229,10 +229,10 @@ namespace ashes::gl
 			}
 		}
 
-		list.push_back( makeCmd< OpType::eBindBuffer >( GL_BUFFER_TARGET_PIXEL_UNPACK
-			, 0u ) );
-		list.push_back( makeCmd< OpType::eBindTexture >( copyTarget
-			, 0u ) );
+		list.emplace< OpType::eBindBuffer >( GL_BUFFER_TARGET_PIXEL_UNPACK
+			, 0u );
+		list.emplace< OpType::eBindTexture >( copyTarget
+			, 0u );
 	}
 
 	void buildCopyBufferToImageCommand( ContextStateStack & stack
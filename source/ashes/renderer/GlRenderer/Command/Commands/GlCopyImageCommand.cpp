@@ -74,11 +74,11 @@ namespace ashes::gl
 				, get( dstImage )->getType()
 				, get( dstImage )->getArrayLayers()
 				, get( srcImage )->getCreateFlags() );
-			list.push_back( makeCmd< OpType::eCopyImageSubData >( get( srcImage )->getInternal()
+			list.emplace< OpType::eCopyImageSubData >( get( srcImage )->getInternal()
 				, srcTarget
 				, get( dstImage )->getInternal()
 				, dstTarget
-				, copyInfo ) );
+				, copyInfo );
 		}
 		else
 		{
@@ -97,17 +97,17 @@ namespace ashes::gl
 					, srcImage
 					, dstImage };
 
-				list.push_back( makeCmd< OpType::eBindSrcFramebuffer >( GL_READ_FRAMEBUFFER ) );
+				list.emplace< OpType::eBindSrcFramebuffer >( GL_READ_FRAMEBUFFER );
 				layerCopy.bindSrc( stack
 					, srcBaseArrayLayer + layer
 					, GL_READ_FRAMEBUFFER
 					, list );
-				list.push_back( makeCmd< OpType::eBindDstFramebuffer >( GL_DRAW_FRAMEBUFFER ) );
+				list.emplace< OpType::eBindDstFramebuffer >( GL_DRAW_FRAMEBUFFER );
 				layerCopy.bindDst( stack
 					, dstBaseArrayLayer + layer
 					, GL_DRAW_FRAMEBUFFER
 					, list );
-				list.push_back( makeCmd< OpType::eBlitFramebuffer >( layerCopy.getRegion().srcOffsets[0].x
+				list.emplace< OpType::eBlitFramebuffer >( layerCopy.getRegion().srcOffsets[0].x
 					, layerCopy.getRegion().srcOffsets[0].y
 					, layerCopy.getRegion().srcOffsets[1].x
 					, layerCopy.getRegion().srcOffsets[1].y
@@ -116,11 +116,11 @@ namespace ashes::gl
 					, layerCopy.getRegion().dstOffsets[1].x
 					, layerCopy.getRegion().dstOffsets[1].y
 					, copyimg::getMask( get( srcImage )->getFormatVk() )
-					, GL_FILTER_NEAREST ) );
-				list.push_back( makeCmd< OpType::eBindFramebuffer >( GL_READ_FRAMEBUFFER
-					, nullptr ) );
-				list.push_back( makeCmd< OpType::eBindFramebuffer >( GL_DRAW_FRAMEBUFFER
-					, nullptr ) );
+					, GL_FILTER_NEAREST );
+				list.emplace< OpType::eBindFramebuffer >( GL_READ_FRAMEBUFFER
+					, nullptr );
+				list.emplace< OpType::eBindFramebuffer >( GL_DRAW_FRAMEBUFFER
+					, nullptr );
 
 				if ( stack.hasCurrentFramebuffer() )
 				{
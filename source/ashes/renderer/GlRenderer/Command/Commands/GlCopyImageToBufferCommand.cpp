@@ -30,24 +30,24 @@ namespace ashes::gl
 			FboAttachment srcAttach{ device
 				, copyInfo.imageSubresource
 				, src };
-			list.push_back( makeCmd< OpType::eBindBuffer >( GL_BUFFER_TARGET_PIXEL_PACK
-				, dst ) );
+			list.emplace< OpType::eBindBuffer >( GL_BUFFER_TARGET_PIXEL_PACK
+				, dst );
 			stack.applyPackAlign( list, 1 );
-			list.push_back( makeCmd< OpType::eBindSrcFramebuffer >( GL_READ_FRAMEBUFFER ) );
+			list.emplace< OpType::eBindSrcFramebuffer >( GL_READ_FRAMEBUFFER );
 			srcAttach.bindRead( stack
 				, copyInfo.imageSubresource.mipLevel
 				, baseArrayLayer
 				, GL_READ_FRAMEBUFFER, list );
-			list.push_back( makeCmd< OpType::eReadPixels >( copyInfo.imageOffset.x
+			list.emplace< OpType::eReadPixels >( copyInfo.imageOffset.x
 				, copyInfo.imageOffset.y
 				, copyInfo.imageExtent.width
 				, copyInfo.imageExtent.height
 				, get( src )->getPackFormat()
-				, get( src )->getPackType() ) );
-			list.push_back( makeCmd< OpType::eBindFramebuffer >( GL_READ_FRAMEBUFFER
-				, nullptr ) );
-			list.push_back( makeCmd< OpType::eBindBuffer >( GL_BUFFER_TARGET_PIXEL_PACK
-				, 0u ) );
+				, get( src )->getPackType() );
+			list.emplace< OpType::eBindFramebuffer >( GL_READ_FRAMEBUFFER
+				, nullptr );
+			list.emplace< OpType::eBindBuffer >( GL_BUFFER_TARGET_PIXEL_PACK
+				, 0u );
 
 			if ( stack.hasCurrentFramebuffer() )
 			{
@@ -62,27 +62,27 @@ namespace ashes::gl
 		{
 			auto & srcBinding = static_cast< ImageMemoryBinding const & >( get( src )->getMemoryBinding() );
 			auto srcBufferOffset = srcBinding.getMipLevelOffset( copyInfo.imageSubresource.mipLevel );
-			list.push_back( makeCmd< OpType::eBindBuffer >( GL_BUFFER_TARGET_PIXEL_PACK, get( srcBinding.getParent() )->getInternal() ) );
+			list.emplace< OpType::eBindBuffer >( GL_BUFFER_TARGET_PIXEL_PACK, get( srcBinding.getParent() )->getInternal() );
 			stack.applyPackAlign( list, 1 );
-			list.push_back( makeCmd< OpType::eBindTexture >( get( src )->getTarget(), get( src )->getInternal() ) );
+			list.emplace< OpType::eBindTexture >( get( src )->getTarget(), get( src )->getInternal() );
 
 			if ( isCompressedFormat( get( src )->getFormatVk() ) )
 			{
-				list.push_back( makeCmd< OpType::eGetCompressedTexImage >( get( src )->getTarget()
+				list.emplace< OpType::eGetCompressedTexImage >( get( src )->getTarget()
 					, GLint( copyInfo.imageSubresource.mipLevel )
-					, intptr_t( srcBufferOffset ) ) );
+					, intptr_t( srcBufferOffset ) );
 			}
 			else
 			{
-				list.push_back( makeCmd< OpType::eGetTexImage >( get( src )->getTarget()
+				list.emplace< OpType::eGetTexImage >( get( src )->getTarget()
 					, get( src )->getPackFormat()
 					, get( src )->getPackType()
 					, GLint( copyInfo.imageSubresource.mipLevel )
-					, intptr_t( srcBufferOffset ) ) );
+					, intptr_t( srcBufferOffset ) );
 			}
 
-			list.push_back( makeCmd< OpType::eBindTexture >( get( src )->getTarget(), 0u ) );
-			list.push_back( makeCmd< OpType::eBindBuffer >( GL_BUFFER_TARGET_PIXEL_PACK, 0u ) );
+			list.emplace< OpType::eBindTexture >( get( src )->getTarget(), 0u );
+			list.emplace< OpType::eBindBuffer >( GL_BUFFER_TARGET_PIXEL_PACK, 0u );
 			return srcBufferOffset;
 		}
 
@@ -128,37 +128,37 @@ namespace ashes::gl
 			auto layerSize = srcBinding.getArrayLayerSize();
 			auto layerCount = std::max( copyInfo.imageSubresource.layerCount
 				, copyInfo.imageExtent.depth );
-			list.push_back( makeCmd< OpType::eBindBuffer >( GL_BUFFER_TARGET_PIXEL_PACK, get( srcBinding.getParent() )->getInternal() ) );
+			list.emplace< OpType::eBindBuffer >( GL_BUFFER_TARGET_PIXEL_PACK, get( srcBinding.getParent() )->getInternal() );
 			stack.applyPackAlign( list, 1 );
 
 			for ( uint32_t layer = 0u; layer < layerCount; ++layer )
 			{
 				VkImageView layerView = get( src )->createView( getViewCreateInfo( src, copyInfo ) );
-				list.push_back( makeCmd< OpType::eBindTexture >( get( layerView )->getTextureType(), get( src )->getInternal() ) );
+				list.emplace< OpType::eBindTexture >( get( layerView )->getTextureType(), get( src )->getInternal() );
 
 				if ( isCompressedFormat( get( src )->getFormatVk() ) )
 				{
-					list.push_back( makeCmd< OpType::eGetCompressedTexImage >( get( layerView )->getTextureType()
+					list.emplace< OpType::eGetCompressedTexImage >( get( layerView )->getTextureType()
 						, GLint( copyInfo.imageSubresource.mipLevel )
-						, intptr_t( bufferOffset ) ) );
+						, intptr_t( bufferOffset ) );
 				}
 				else
 				{
-					list.push_back( makeCmd< OpType::eGetTexImage >( get( layerView )->getTextureType()
+					list.emplace< OpType::eGetTexImage >( get( layerView )->getTextureType()
 						, get( src )->getPackFormat()
 						, get( src )->getPackType()
 						, GLint( copyInfo.imageSubresource.mipLevel )
-						, intptr_t( bufferOffset ) ) );
+						, intptr_t( bufferOffset ) );
 				}
 
-				list.push_back( makeCmd< OpType::eBindTexture >( get( layerView )->getTextureType(), 0u ) );
+				list.emplace< OpType::eBindTexture >( get( layerView )->getTextureType(), 0u );
 				bufferOffset += layerSize;
 			}
 
-			list.push_back( makeCmd< OpType::eBindBuffer >( GL_BUFFER_TARGET_PIXEL_PACK, 0u ) );
-			list.push_back( makeCmd< OpType::eDownloadMemory >( srcBinding.getParent()
+			list.emplace< OpType::eBindBuffer >( GL_BUFFER_TARGET_PIXEL_PACK, 0u );
+			list.emplace< OpType::eDownloadMemory >( srcBinding.getParent()
 				, srcBinding.getOffset()
-				, srcBinding.getSize() ) );
+				, srcBinding.getSize() );
 		}
 
 		static void copyImageFullDataToBuffer( VkBufferImageCopy const & copyInfo
@@ -169,26 +169,26 @@ namespace ashes::gl
 			, CmdList & list )
 		{
 			auto dstBufferOffset = copyInfo.bufferOffset;
-			list.push_back( makeCmd< OpType::eBindBuffer >( GL_BUFFER_TARGET_COPY_READ
-				, get( get( src )->getMemoryBinding().getParent() )->getInternal() ) );
-			list.push_back( makeCmd< OpType::eBindBuffer >( GL_BUFFER_TARGET_COPY_WRITE
-				, dst ) );
+			list.emplace< OpType::eBindBuffer >( GL_BUFFER_TARGET_COPY_READ
+				, get( get( src )->getMemoryBinding().getParent() )->getInternal() );
+			list.emplace< OpType::eBindBuffer >( GL_BUFFER_TARGET_COPY_WRITE
+				, dst );
 			auto layerCount = std::max( copyInfo.imageSubresource.layerCount
 				, copyInfo.imageExtent.depth );
 
 			for ( uint32_t layer = 0u; layer < layerCount; ++layer )
 			{
-				list.push_back( makeCmd< OpType::eCopyBufferSubData >( GL_BUFFER_TARGET_COPY_READ
+				list.emplace< OpType::eCopyBufferSubData >( GL_BUFFER_TARGET_COPY_READ
 					, GL_BUFFER_TARGET_COPY_WRITE
-					, VkBufferCopy{ srcBufferOffset, dstBufferOffset, srcMipLayerSize } ) );
+					, VkBufferCopy{ srcBufferOffset, dstBufferOffset, srcMipLayerSize } );
 				srcBufferOffset += srcMipLayerSize;
 				dstBufferOffset += srcMipLayerSize;
 			}
 
-			list.push_back( makeCmd< OpType::eBindBuffer >( GL_BUFFER_TARGET_COPY_WRITE
-				, 0u ) );
-			list.push_back( makeCmd< OpType::eBindBuffer >( GL_BUFFER_TARGET_COPY_READ
-				, 0u ) );
+			list.emplace< OpType::eBindBuffer >( GL_BUFFER_TARGET_COPY_WRITE
+				, 0u );
+			list.emplace< OpType::eBindBuffer >( GL_BUFFER_TARGET_COPY_READ
+				, 0u );
 		}
 
 		static void copyImagePartialDataToBuffer( VkBufferImageCopy const & copyInfo
@@ -217,10 +217,10 @@ namespace ashes::gl
 			auto layerCount = std::max( copyInfo.imageSubresource.layerCount
 				, copyInfo.imageExtent.depth );
 
-			list.push_back( makeCmd< OpType::eBindBuffer >( GL_BUFFER_TARGET_COPY_READ
-				, get( get( src )->getMemoryBinding().getParent() )->getInternal() ) );
-			list.push_back( makeCmd< OpType::eBindBuffer >( GL_BUFFER_TARGET_COPY_WRITE
-				, dst ) );
+			list.emplace< OpType::eBindBuffer >( GL_BUFFER_TARGET_COPY_READ
+				, get( get( src )->getMemoryBinding().getParent() )->getInternal() );
+			list.emplace< OpType::eBindBuffer >( GL_BUFFER_TARGET_COPY_WRITE
+				, dst );
 
 			for ( uint32_t layer = 0u; layer < layerCount; ++layer )
 			{
@@ -229,9 +229,9 @@ namespace ashes::gl
 
 				for ( uint32_t row = 0u; row < rowCount; ++row )
 				{
-					list.push_back( makeCmd< OpType::eCopyBufferSubData >( GL_BUFFER_TARGET_COPY_READ
+					list.emplace< OpType::eCopyBufferSubData >( GL_BUFFER_TARGET_COPY_READ
 						, GL_BUFFER_TARGET_COPY_WRITE
-						, VkBufferCopy{ srcRowOffset, dstRowOffset, srcSubRowSize } ) );
+						, VkBufferCopy{ srcRowOffset, dstRowOffset, srcSubRowSize } );
 
 					srcRowOffset += srcRowSize;
 					dstRowOffset += dstRowSize;
@@ -241,10 +241,10 @@ namespace ashes::gl
 				dstBufferOffset += dstMipLayerSize;
 			}
 
-			list.push_back( makeCmd< OpType::eBindBuffer >( GL_BUFFER_TARGET_COPY_WRITE
-				, 0u ) );
-			list.push_back( makeCmd< OpType::eBindBuffer >( GL_BUFFER_TARGET_COPY_READ
-				, 0u ) );
+			list.emplace< OpType::eBindBuffer >( GL_BUFFER_TARGET_COPY_WRITE
+				, 0u );
+			list.emplace< OpType::eBindBuffer >( GL_BUFFER_TARGET_COPY_READ
+				, 0u );
 		}
 	}
 
@@ -14,8 +14,8 @@ namespace ashes::gl
 		, CmdList & list )
 	{
 		glLogCommand( list, "DispatchCommand" );
-		list.push_back( makeCmd< OpType::eDispatch >( groupCountX
+		list.emplace< OpType::eDispatch >( groupCountX
 			, groupCountY
-			, groupCountZ ) );
+			, groupCountZ );
 	}
 }
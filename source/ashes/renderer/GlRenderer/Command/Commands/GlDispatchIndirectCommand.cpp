@@ -15,10 +15,10 @@ namespace ashes::gl
 		, CmdList & list )
 	{
 		glLogCommand( list, "DispatchIndirectCommand" );
-		list.push_back( makeCmd< OpType::eBindBuffer >( GL_BUFFER_TARGET_DISPATCH_INDIRECT
-			, get( buffer )->getInternal() ) );
-		list.push_back( makeCmd< OpType::eDispatchIndirect >( get( buffer )->getOffset() + offset ) );
-		list.push_back( makeCmd< OpType::eBindBuffer >( GL_BUFFER_TARGET_DISPATCH_INDIRECT
-			, 0u ) );
+		list.emplace< OpType::eBindBuffer >( GL_BUFFER_TARGET_DISPATCH_INDIRECT
+			, get( buffer )->getInternal() );
+		list.emplace< OpType::eDispatchIndirect >( get( buffer )->getOffset() + offset );
+		list.emplace< OpType::eBindBuffer >( GL_BUFFER_TARGET_DISPATCH_INDIRECT
+			, 0u );
 	}
 }
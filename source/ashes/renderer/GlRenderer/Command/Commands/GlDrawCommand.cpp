@@ -24,18 +24,18 @@ namespace ashes::gl
 
 		if ( firstInstance > 0 )
 		{
-			list.push_back( makeCmd< OpType::eDrawBaseInstance >( vtxCount
+			list.emplace< OpType::eDrawBaseInstance >( vtxCount
 				, instCount
 				, firstVertex
 				, firstInstance
-				, convert( mode ) ) );
+				, convert( mode ) );
 		}
 		else
 		{
-			list.push_back( makeCmd< OpType::eDraw >( vtxCount
+			list.emplace< OpType::eDraw >( vtxCount
 				, instCount
 				, firstVertex
-				, convert( mode ) ) );
+				, convert( mode ) );
 		}
 	}
 }
@@ -38,22 +38,22 @@ namespace ashes::gl
 
 		if ( firstInstance > 0 )
 		{
-			list.push_back( makeCmd< OpType::eDrawIndexedBaseInstance >( indexCount
+			list.emplace< OpType::eDrawIndexedBaseInstance >( indexCount
 				, instCount
 				, firstIndex * drawidx::getSize( type )
 				, vertexOffset
 				, firstInstance
 				, convert( mode )
-				, convert( type ) ) );
+				, convert( type ) );
 		}
 		else
 		{
-			list.push_back( makeCmd< OpType::eDrawIndexed >( indexCount
+			list.emplace< OpType::eDrawIndexed >( indexCount
 				, instCount
 				, firstIndex * drawidx::getSize( type )
 				, vertexOffset
 				, convert( mode )
-				, convert( type ) ) );
+				, convert( type ) );
 		}
 	}
 }
@@ -19,14 +19,14 @@ namespace ashes::gl
 		, CmdList & list )
 	{
 		glLogCommand( list, "DrawIndexedIndirectCommand" );
-		list.push_back( makeCmd< OpType::eBindBuffer >( GL_BUFFER_TARGET_DRAW_INDIRECT
-			, get( buffer )->getInternal() ) );
-		list.push_back( makeCmd< OpType::eDrawIndexedIndirect >( uint32_t( get( buffer )->getOffset() + offset )
+		list.emplace< OpType::eBindBuffer >( GL_BUFFER_TARGET_DRAW_INDIRECT
+			, get( buffer )->getInternal() );
+		list.emplace< OpType::eDrawIndexedIndirect >( uint32_t( get( buffer )->getOffset() + offset )
 			, drawCount
 			, stride
 			, convert( mode )
-			, convert( type ) ) );
-		list.push_back( makeCmd< OpType::eBindBuffer >( GL_BUFFER_TARGET_DRAW_INDIRECT
-			, 0u ) );
+			, convert( type ) );
+		list.emplace< OpType::eBindBuffer >( GL_BUFFER_TARGET_DRAW_INDIRECT
+			, 0u );
 	}
 }
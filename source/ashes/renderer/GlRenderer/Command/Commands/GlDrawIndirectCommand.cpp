@@ -18,13 +18,13 @@ namespace ashes::gl
 		, CmdList & list )
 	{
 		glLogCommand( list, "DrawIndirectCommand" );
-		list.push_back( makeCmd< OpType::eBindBuffer >( GL_BUFFER_TARGET_DRAW_INDIRECT
-			, get( buffer )->getInternal() ) );
-		list.push_back( makeCmd< OpType::eDrawIndirect >( uint32_t( get( buffer )->getOffset() + offset )
+		list.emplace< OpType::eBindBuffer >( GL_BUFFER_TARGET_DRAW_INDIRECT
+			, get( buffer )->getInternal() );
+		list.emplace< OpType::eDrawIndirect >( uint32_t( get( buffer )->getOffset() + offset )
 			, drawCount
 			, stride
-			, convert( mode ) ) );
-		list.push_back( makeCmd< OpType::eBindBuffer >( GL_BUFFER_TARGET_DRAW_INDIRECT
-			, 0u ) );
+			, convert( mode ) );
+		list.emplace< OpType::eBindBuffer >( GL_BUFFER_TARGET_DRAW_INDIRECT
+			, 0u );
 	}
 }
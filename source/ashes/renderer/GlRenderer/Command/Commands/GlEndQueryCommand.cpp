@@ -19,12 +19,12 @@ namespace ashes::gl
 		{
 			for ( auto type : get( pool )->getTypes() )
 			{
-				list.push_back( makeCmd< OpType::eEndQuery >( type ) );
+				list.emplace< OpType::eEndQuery >( type );
 			}
 		}
 		else
 		{
-			list.push_back( makeCmd< OpType::eEndQuery >( convert( get( pool )->getType() ) ) );
+			list.emplace< OpType::eEndQuery >( convert( get( pool )->getType() ) );
 		}
 	}
 }
@@ -15,8 +15,8 @@ namespace ashes::gl
 	{
 		if ( stack.hasCurrentFramebuffer() )
 		{
-			list.push_back( makeCmd< OpType::eBindFramebuffer >( GL_FRAMEBUFFER
-				, nullptr ) );
+			list.emplace< OpType::eBindFramebuffer >( GL_FRAMEBUFFER
+				, nullptr );
 			stack.setCurrentFramebuffer( nullptr );
 		}
 	}
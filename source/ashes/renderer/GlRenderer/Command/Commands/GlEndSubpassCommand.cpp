@@ -59,18 +59,18 @@ namespace ashes::gl
 						|| srcAttach.originalMipLevel != dstAttach.originalMipLevel )
 					{
 						// Perform blit
-						list.push_back( makeCmd< OpType::eBindSrcFramebuffer >( GL_READ_FRAMEBUFFER ) );
+						list.emplace< OpType::eBindSrcFramebuffer >( GL_READ_FRAMEBUFFER );
 						srcAttach.bindRead( stack, srcAttach.mipLevel, GL_READ_FRAMEBUFFER, list );
-						list.push_back( makeCmd< OpType::eBindDstFramebuffer >( GL_DRAW_FRAMEBUFFER ) );
+						list.emplace< OpType::eBindDstFramebuffer >( GL_DRAW_FRAMEBUFFER );
 						dstAttach.bindDraw( stack, dstAttach.mipLevel, GL_DRAW_FRAMEBUFFER, list );
-						list.push_back( makeCmd< OpType::eBlitFramebuffer >(
+						list.emplace< OpType::eBlitFramebuffer >(
 							0, 0, int32_t( get( frameBuffer )->getWidth() ), int32_t( get( frameBuffer )->getHeight() ),
 							0, 0, int32_t( get( frameBuffer )->getWidth() ), int32_t( get( frameBuffer )->getHeight() ),
-							GL_COLOR_BUFFER_BIT, GL_FILTER_NEAREST ) );
-						list.push_back( makeCmd< OpType::eBindFramebuffer >( GL_READ_FRAMEBUFFER
-							, nullptr ) );
-						list.push_back( makeCmd< OpType::eBindFramebuffer >( GL_DRAW_FRAMEBUFFER
-							, nullptr ) );
+							GL_COLOR_BUFFER_BIT, GL_FILTER_NEAREST );
+						list.emplace< OpType::eBindFramebuffer >( GL_READ_FRAMEBUFFER
+							, nullptr );
+						list.emplace< OpType::eBindFramebuffer >( GL_DRAW_FRAMEBUFFER
+							, nullptr );
 					}
 				}
 			}
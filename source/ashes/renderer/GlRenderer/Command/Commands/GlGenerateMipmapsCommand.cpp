@@ -18,10 +18,10 @@ namespace ashes::gl
 			, get( texture )->getType()
 			, get( texture )->getArrayLayers()
 			, get( texture )->getCreateFlags() );
-		list.push_back( makeCmd< OpType::eBindTexture >( target
-				, get( texture )->getInternal() ) );
-		list.push_back( makeCmd< OpType::eGenerateMipmaps >( target ) );
-		list.push_back( makeCmd< OpType::eBindTexture >( target
-			, 0u ) );
+		list.emplace< OpType::eBindTexture >( target
+				, get( texture )->getInternal() );
+		list.emplace< OpType::eGenerateMipmaps >( target );
+		list.emplace< OpType::eBindTexture >( target
+			, 0u );
 	}
 }
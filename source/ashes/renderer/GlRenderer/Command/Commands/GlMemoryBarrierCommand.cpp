@@ -28,16 +28,16 @@ namespace ashes::gl
 						|| checkFlag( srcAccessMask, VK_ACCESS_HOST_WRITE_BIT ) ) )
 				{
 					uploads.insert( binding.getParent() );
-					list.push_back( makeCmd< OpType::eUploadMemory >( binding.getParent()
+					list.emplace< OpType::eUploadMemory >( binding.getParent()
 						, binding.getOffset()
-						, binding.getSize() ) );
+						, binding.getSize() );
 				}
 				else if ( checkFlag( srcAccessMask, VK_ACCESS_TRANSFER_WRITE_BIT ) )
 				{
 					downloads.insert( binding.getParent() );
-					list.push_back( makeCmd< OpType::eDownloadMemory >( binding.getParent()
+					list.emplace< OpType::eDownloadMemory >( binding.getParent()
 						, binding.getOffset()
-						, binding.getSize() ) );
+						, binding.getSize() );
 				}
 			}
 
@@ -60,16 +60,16 @@ namespace ashes::gl
 						|| checkFlag( dstAccessMask, VK_ACCESS_MEMORY_READ_BIT ) ) )
 				{
 					downloads.insert( binding.getParent() );
-					list.push_back( makeCmd< OpType::eDownloadMemory >( binding.getParent()
+					list.emplace< OpType::eDownloadMemory >( binding.getParent()
 						, binding.getOffset()
-						, binding.getSize() ) );
+						, binding.getSize() );
 				}
 				else if ( checkFlag( dstAccessMask, VK_ACCESS_TRANSFER_READ_BIT ) )
 				{
 					uploads.insert( binding.getParent() );
-					list.push_back( makeCmd< OpType::eUploadMemory >( binding.getParent()
+					list.emplace< OpType::eUploadMemory >( binding.getParent()
 						, binding.getOffset()
-						, binding.getSize() ) );
+						, binding.getSize() );
 				}
 			}
 
@@ -110,10 +110,10 @@ namespace ashes::gl
 				, list ) || hasMapped;
 		}
 
-		list.push_back( makeCmd< OpType::eMemoryBarrier >( getMemoryBarrierFlags( before )
+		list.emplace< OpType::eMemoryBarrier >( getMemoryBarrierFlags( before )
 			| ( hasMapped
 				? GL_MEMORY_BARRIER_CLIENT_MAPPED_BUFFER
-				: 0u ) ) );
+				: 0u ) );
 
 		for ( auto & barrier : bufferMemoryBarriers )
 		{
@@ -4,6 +4,9 @@ See LICENSE file in root folder.
 */
 #include "Command/Commands/GlPushConstantsCommand.hpp"
 
+#include "Command/GlQueue.hpp"
+#include "Pipeline/GlPipeline.hpp"
+
 #include "ashesgl_api.hpp"
 
 namespace ashes::gl
@@ -19,10 +22,10 @@ namespace ashes::gl
 
 			for ( auto layer = 0u; layer < arraySize; ++layer )
 			{
-				list.push_back( makeCmd< OpT >( constant.program
+				list.emplace< OpT >( constant.program
 					, constant.location + layer
 					, GL_FALSE
-					, reinterpret_cast< T const * >( buffer ) ) );
+					, reinterpret_cast< T const * >( buffer ) );
 				buffer += constant.size;
 			}
 		}
@@ -36,9 +39,9 @@ namespace ashes::gl
 
 			for ( auto layer = 0u; layer < arraySize; ++layer )
 			{
-				list.push_back( makeCmd< OpT >( constant.program
+				list.emplace< OpT >( constant.program
 					, constant.location + layer
-					, reinterpret_cast< T const * >( buffer ) ) );
+					, reinterpret_cast< T const * >( buffer ) );
 				buffer += constant.size;
 			}
 		}
@@ -52,9 +55,9 @@ namespace ashes::gl
 
 			for ( auto layer = 0u; layer < arraySize; ++layer )
 			{
-				list.push_back( makeCmd< OpTypeT >( constant.location + layer
+				list.emplace< OpTypeT >( constant.location + layer
 					, GL_FALSE
-					, reinterpret_cast< DataT const * >( buffer ) ) );
+					, reinterpret_cast< DataT const * >( buffer ) );
 				buffer += constant.size;
 			}
 		}
@@ -68,8 +71,8 @@ namespace ashes::gl
 
 			for ( auto layer = 0u; layer < arraySize; ++layer )
 			{
-				list.push_back( makeCmd< OpTypeT >( constant.location + layer
-					, reinterpret_cast< DataT const * >( buffer ) ) );
+				list.emplace< OpTypeT >( constant.location + layer
+					, reinterpret_cast< DataT const * >( buffer ) );
 				buffer += constant.size;
 			}
 		}
@@ -269,4 +272,29 @@ namespace ashes::gl
 			pushconst::buildPushUniformsCommands( stageFlags, constants, data, list );
 		}
 	}
+
+	void buildPushBackConstantsCommand( VkShaderStageFlags stageFlags
+		, VkPipeline pipeline
+		, ByteArray const & data
+		, CmdList & list )
+	{
+		glLogCommand( list, "PushBackConstantsCommand" );
+		list.emplace< OpType::ePushBackConstants >( pipeline
+			, stageFlags
+			, &data );
+	}
+
+	void apply( ContextLock const & context
+		, CmdPushBackConstants const & cmd )
+	{
+		auto glpipeline = get( cmd.pipeline );
+		CmdList list;
+		buildPushConstantsCommand( glpipeline->getDevice()
+			, cmd.stageFlags
+			, glpipeline->getLayout()
+			, glpipeline->getBackPushConstantsDesc( context )
+			, *cmd.data
+			, list );
+		applyBuffer( context, list );
+	}
 }
@@ -16,4 +16,14 @@ namespace ashes::gl
 		, ConstantsLayout const & constants
 		, ByteArray const & data
 		, CmdList & list );
+	/**
+	*\brief
+	*	Push constants for the back buffer program variant of \p pipeline, when it is built at replay.
+	*\param[in] data
+	*	Must outlive the command list.
+	*/
+	void buildPushBackConstantsCommand( VkShaderStageFlags stageFlags
+		, VkPipeline pipeline
+		, ByteArray const & data
+		, CmdList & list );
 }
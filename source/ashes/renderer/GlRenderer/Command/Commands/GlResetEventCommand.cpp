@@ -15,6 +15,6 @@ namespace ashes::gl
 		, CmdList & list )
 	{
 		glLogCommand( list, "ResetEventCommand" );
-		list.push_back( makeCmd< OpType::eResetEvent >( event ) );
+		list.emplace< OpType::eResetEvent >( event );
 	}
 }
@@ -14,8 +14,8 @@ namespace ashes::gl
 		, CmdList & list )
 	{
 		glLogCommand( list, "SetDepthBiasCommand" );
-		list.push_back( makeCmd< OpType::ePolygonOffset >( constantFactor
+		list.emplace< OpType::ePolygonOffset >( constantFactor
 			, clamp
-			, slopeFactor ) );
+			, slopeFactor );
 	}
 }
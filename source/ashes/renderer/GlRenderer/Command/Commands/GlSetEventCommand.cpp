@@ -15,6 +15,6 @@ namespace ashes::gl
 		, CmdList & list )
 	{
 		glLogCommand( list, "SetEventCommand" );
-		list.push_back( makeCmd< OpType::eSetEvent >( event ) );
+		list.emplace< OpType::eSetEvent >( event );
 	}
 }
@@ -12,6 +12,6 @@ namespace ashes::gl
 		, CmdList & list )
 	{
 		glLogCommand( list, "SetLineWidthCommand" );
-		list.push_back( makeCmd< OpType::eSetLineWidth >( width ) );
+		list.emplace< OpType::eSetLineWidth >( width );
 	}
 }
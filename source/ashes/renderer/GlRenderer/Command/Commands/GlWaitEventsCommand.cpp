@@ -23,6 +23,6 @@ namespace ashes::gl
 		, CmdList & list )
 	{
 		glLogCommand( list, "WaitEventsCommand" );
-		list.push_back( makeCmd< OpType::eWaitEvents >( std::move( events ) ) );
+		list.emplace< OpType::eWaitEvents >( std::move( events ) );
 	}
 }
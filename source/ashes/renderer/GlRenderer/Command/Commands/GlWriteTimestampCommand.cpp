@@ -16,6 +16,6 @@ namespace ashes::gl
 		, CmdList & list )
 	{
 		glLogCommand( list, "WriteTimestampCommand" );
-		list.push_back( makeCmd< OpType::eWriteTimestamp >( *( get( pool )->begin() + query ) ) );
+		list.emplace< OpType::eWriteTimestamp >( *( get( pool )->begin() + query ) );
 	}
 }
@@ -5,6 +5,7 @@ See LICENSE file in root folder.
 #include "Command/GlCommandBuffer.hpp"
 
 #include "Buffer/GlBuffer.hpp"
+#include "Buffer/GlBufferView.hpp"
 #include "Buffer/GlGeometryBuffers.hpp"
 #include "Command/GlCommandPool.hpp"
 #include "Core/GlDevice.hpp"
@@ -61,7 +62,6 @@ See LICENSE file in root folder.
 #include <renderer/RendererCommon/Helper/VertexInputState.hpp>
 
 #include <algorithm>
-#include <numeric>
 
 using ashes::operator==;
 using ashes::operator!=;
@@ -78,32 +78,6 @@ namespace ashes::gl
 {
 	namespace cmdbuf
 	{
-		static void mergeList( CmdList const & list
-			, CmdBuffer & cmds )
-		{
-			size_t totalSize = std::accumulate( list.begin()
-				, list.end()
-				, size_t( 0u )
-				, []( size_t value, CmdBuffer const & lookup )
-				{
-					return value + lookup.size();
-				} );
-
-			if ( totalSize )
-			{
-				cmds.resize( totalSize );
-				auto it = cmds.begin();
-
-				for ( auto & cmd : list )
-				{
-					std::copy( cmd.begin()
-						, cmd.end()
-						, it );
-					it += ptrdiff_t( cmd.size() );
-				}
-			}
-		}
-
 		static bool areCompatible( VkPushConstantRangeArray const & lhs
 			, VkPushConstantRangeArray const & rhs )
 		{
@@ -176,9 +150,12 @@ namespace ashes::gl
 
 	CommandBuffer::CommandBuffer( [[maybe_unused]] VkAllocationCallbacks const * allocInfo
 		, VkDevice device
-		, VkCommandBufferLevel level )
+		, VkCommandBufferLevel level
+		, CmdChunkPool & chunkPool )
 		: m_device{ device }
 		, m_level{ level }
+		, m_cmdList{ &chunkPool }
+		, m_cmdAfterSubmit{ &chunkPool }
 	{
 		registerObject( m_device, *this );
 	}
@@ -246,18 +223,20 @@ namespace ashes::gl
 	{
 		m_state.pushConstantBuffers.clear();
 
-		if ( m_level == VK_COMMAND_BUFFER_LEVEL_PRIMARY )
+		// The shadow copies can't rely on their last synchronisation with those memories anymore.
+		for ( auto const & [memory, range] : m_state.gpuWrites )
 		{
-			cmdbuf::mergeList( m_cmdList, m_cmds );
-			cmdbuf::mergeList( m_cmdAfterSubmit, m_cmdsAfterSubmit );
+			m_cmdList.emplace< OpType::eInvalidateMemoryPages >( memory
+				, range.getOffset()
+				, range.getSize() );
 		}
 
+		m_state.gpuWrites.clear();
 		return VK_SUCCESS;
 	}
 
 	VkResult CommandBuffer::reset()const noexcept
 	{
-		m_preExecuteActions.clear();
 		doReset();
 		return VK_SUCCESS;
 	}
@@ -335,14 +314,17 @@ namespace ashes::gl
 				, glCommandBuffer->m_state.vaos.end() );
 			glCommandBuffer->m_state.vaos.clear();
 			glCommandBuffer->doApplyPreExecuteCommands( *m_state.stack );
-			cmdbuf::mergeList( glCommandBuffer->m_cmdList, glCommandBuffer->m_cmds );
-			cmdbuf::mergeList( glCommandBuffer->m_cmdAfterSubmit, glCommandBuffer->m_cmdsAfterSubmit );
-			m_cmdList.insert( m_cmdList.end()
-				, glCommandBuffer->m_cmdList.begin()
-				, glCommandBuffer->m_cmdList.end() );
-			m_cmdAfterSubmit.insert( m_cmdAfterSubmit.end()
-				, glCommandBuffer->m_cmdAfterSubmit.begin()
-				, glCommandBuffer->m_cmdAfterSubmit.end() );
+			m_cmdList.append( glCommandBuffer->m_cmdList );
+			m_cmdAfterSubmit.append( glCommandBuffer->m_cmdAfterSubmit );
+
+			for ( auto event : glCommandBuffer->m_waitedEvents )
+			{
+				doAddWaitedEvent( event );
+			}
+
+			m_setEvents.insert( m_setEvents.end()
+				, glCommandBuffer->m_setEvents.begin()
+				, glCommandBuffer->m_setEvents.end() );
 		}
 	}
 
@@ -433,6 +415,7 @@ namespace ashes::gl
 			}
 
 			m_state.currentGraphicsPipeline = pipeline;
+			m_state.selectedLayout = nullptr;
 			buildBindPipelineCommand( *m_state.stack
 				, m_device
 				, pipeline
@@ -483,14 +466,20 @@ namespace ashes::gl
 			for ( auto const & [layout, constants] : m_state.pushConstantBuffers )
 			{
 				doPushConstants( constants );
-				buildPushConstantsCommand( get( pipeline )->getDevice()
-					, constants.stageFlags
-					, layout
-					, ( m_state.currentGraphicsPipeline == pipeline
-						? get( pipeline )->getPushConstantsDesc( doIsRtotFbo() )
-						: get( pipeline )->getPushConstantsDesc() )
-					, m_state.currentPushConstantsBuffer
-					, m_cmdList );
+
+				if ( m_state.currentGraphicsPipeline == pipeline )
+				{
+					doBuildGraphicsPushConstants( constants.stageFlags, layout );
+				}
+				else
+				{
+					buildPushConstantsCommand( get( pipeline )->getDevice()
+						, constants.stageFlags
+						, layout
+						, get( pipeline )->getPushConstantsDesc()
+						, m_state.currentPushConstantsBuffer
+						, m_cmdList );
+				}
 			}
 
 			m_state.pushConstantBuffers.clear();
@@ -548,9 +537,12 @@ namespace ashes::gl
 				, dynamicOffsets
 				, dynamicOffsetIndex
 				, bindingPoint
+				, m_state.descriptorBinder
 				, m_cmdList );
 			++currentSet;
 		}
+
+		m_state.descriptorBinder.flush( m_device, m_cmdList );
 	}
 
 	void CommandBuffer::setViewport( uint32_t firstViewport
@@ -595,7 +587,7 @@ namespace ashes::gl
 
 				if ( m_state.stack->isPrimitiveRestartEnabled() )
 				{
-					m_cmdList.emplace_back( makeCmd< OpType::ePrimitiveRestartIndex >( 0xFFFFFFFFu ) );
+					m_cmdList.emplace< OpType::ePrimitiveRestartIndex >( 0xFFFFFFFFu );
 				}
 
 				doProcessMappedBoundVaoBuffersIn();
@@ -612,15 +604,7 @@ namespace ashes::gl
 			}
 			else
 			{
-				if ( !m_state.selectedVao )
-				{
-					doSelectVao();
-				}
-
-				doProcessMappedBoundVaoBuffersIn();
-				assert( m_state.selectedVao );
-				buildBindGeometryBuffersCommand( *m_state.selectedVao
-					, m_cmdList );
+				doBindGeometryBuffers();
 				buildDrawCommand( vtxCount
 					, instCount
 					, firstVertex
@@ -629,7 +613,7 @@ namespace ashes::gl
 					, m_cmdList );
 			}
 
-			m_cmdList.push_back( makeCmd< OpType::eBindVextexArray >( nullptr ) );
+			m_cmdList.emplace< OpType::eBindVextexArray >( nullptr );
 			doProcessMappedBoundDescriptorsBuffersOut();
 		}
 	}
@@ -656,22 +640,15 @@ namespace ashes::gl
 				bindIndexBuffer( get( m_device )->getEmptyIndexedVaoIdx(), 0u, VK_INDEX_TYPE_UINT32 );
 				m_state.selectedVao = &get( m_device )->getEmptyIndexedVao();
 			}
-			else if ( !m_state.selectedVao )
-			{
-				doSelectVao();
-			}
 
 			if ( m_state.stack->isPrimitiveRestartEnabled() )
 			{
-				m_cmdList.emplace_back( makeCmd< OpType::ePrimitiveRestartIndex >( m_state.indexType == VK_INDEX_TYPE_UINT32
+				m_cmdList.emplace< OpType::ePrimitiveRestartIndex >( m_state.indexType == VK_INDEX_TYPE_UINT32
 					? 0xFFFFFFFFu
-					: 0x0000FFFFu ) );
+					: 0x0000FFFFu );
 			}
 
-			doProcessMappedBoundVaoBuffersIn();
-			assert( m_state.selectedVao );
-			buildBindGeometryBuffersCommand( *m_state.selectedVao
-				, m_cmdList );
+			doBindGeometryBuffers();
 			buildDrawIndexedCommand( indexCount
 				, instCount
 				, firstIndex
@@ -680,7 +657,7 @@ namespace ashes::gl
 				, get( m_state.currentGraphicsPipeline )->getInputAssemblyState().topology
 				, m_state.indexType
 				, m_cmdList );
-			m_cmdList.push_back( makeCmd< OpType::eBindVextexArray >( nullptr ) );
+			m_cmdList.emplace< OpType::eBindVextexArray >( nullptr );
 			doProcessMappedBoundDescriptorsBuffersOut();
 			m_state.newlyBoundIbo = IboBinding{};
 		}
@@ -700,22 +677,14 @@ namespace ashes::gl
 		}
 		else
 		{
-			if ( !m_state.selectedVao )
-			{
-				doSelectVao();
-			}
-
-			doProcessMappedBoundVaoBuffersIn();
-			assert( m_state.selectedVao );
-			buildBindGeometryBuffersCommand( *m_state.selectedVao
-				, m_cmdList );
+			doBindGeometryBuffers();
 			buildDrawIndirectCommand( buffer
 				, offset
 				, drawCount
 				, stride
 				, get( m_state.currentGraphicsPipeline )->getInputAssemblyState().topology
 				, m_cmdList );
-			m_cmdList.push_back( makeCmd< OpType::eBindVextexArray >( nullptr ) );
+			m_cmdList.emplace< OpType::eBindVextexArray >( nullptr );
 			doProcessMappedBoundDescriptorsBuffersOut();
 		}
 	}
@@ -740,22 +709,15 @@ namespace ashes::gl
 				bindIndexBuffer( get( m_device )->getEmptyIndexedVaoIdx(), 0u, VK_INDEX_TYPE_UINT32 );
 				m_state.selectedVao = &get( m_device )->getEmptyIndexedVao();
 			}
-			else if ( !m_state.selectedVao )
-			{
-				doSelectVao();
-			}
 
 			if ( m_state.stack->isPrimitiveRestartEnabled() )
 			{
-				m_cmdList.emplace_back( makeCmd< OpType::ePrimitiveRestartIndex >( m_state.indexType == VK_INDEX_TYPE_UINT32
+				m_cmdList.emplace< OpType::ePrimitiveRestartIndex >( m_state.indexType == VK_INDEX_TYPE_UINT32
 					? 0xFFFFFFFFu
-					: 0x0000FFFFu ) );
+					: 0x0000FFFFu );
 			}
 
-			doProcessMappedBoundVaoBuffersIn();
-			assert( m_state.selectedVao );
-			buildBindGeometryBuffersCommand( *m_state.selectedVao
-				, m_cmdList );
+			doBindGeometryBuffers();
 			buildDrawIndexedIndirectCommand( buffer
 				, offset
 				, drawCount
@@ -763,7 +725,7 @@ namespace ashes::gl
 				, get( m_state.currentGraphicsPipeline )->getInputAssemblyState().topology
 				, m_state.indexType
 				, m_cmdList );
-			m_cmdList.push_back( makeCmd< OpType::eBindVextexArray >( nullptr ) );
+			m_cmdList.emplace< OpType::eBindVextexArray >( nullptr );
 			doProcessMappedBoundDescriptorsBuffersOut();
 			m_state.newlyBoundIbo = IboBinding{};
 		}
@@ -790,6 +752,8 @@ namespace ashes::gl
 		, VkBuffer dst
 		, ArrayView< VkBufferImageCopy const > copyInfos )const
 	{
+		doAddGpuWrite( dst );
+
 		for ( auto const & copyInfo : copyInfos )
 		{
 			buildCopyImageToBufferCommand( *m_state.stack
@@ -813,11 +777,12 @@ namespace ashes::gl
 			realSize = get( dstBuffer )->getMemoryRequirements().size - dstOffset;
 		}
 
+		doAddGpuWrite( dstBuffer );
 		m_updatesData.push_back( std::make_unique< ByteArray >( data.begin(), data.begin() + realSize ) );
-		m_cmdList.push_back( makeCmd< OpType::eUpdateBuffer >( get( dstBuffer )->getMemoryBinding().getParent()
+		m_cmdList.emplace< OpType::eUpdateBuffer >( get( dstBuffer )->getMemoryBinding().getParent()
 			, realOffset
 			, realSize
-			, m_updatesData.back()->data() ) );
+			, m_updatesData.back()->data() );
 	}
 
 	void CommandBuffer::fillBuffer( VkBuffer dstBuffer
@@ -835,16 +800,19 @@ namespace ashes::gl
 			realSize = get( dstBuffer )->getMemoryRequirements().size - dstOffset;
 		}
 
-		m_cmdList.push_back( makeCmd< OpType::eFillBuffer >( get( dstBuffer )->getMemoryBinding().getParent()
+		doAddGpuWrite( dstBuffer );
+		m_cmdList.emplace< OpType::eFillBuffer >( get( dstBuffer )->getMemoryBinding().getParent()
 			, realOffset
 			, realSize
-			, data ) );
+			, data );
 	}
 
 	void CommandBuffer::copyBuffer( VkBuffer src
 		, VkBuffer dst
 		, ArrayView< VkBufferCopy const > copyInfos )const
 	{
+		doAddGpuWrite( dst );
+
 		for ( auto const & copyInfo : copyInfos )
 		{
 			buildCopyBufferCommand( copyInfo
@@ -917,6 +885,11 @@ namespace ashes::gl
 		, uint32_t firstQuery
 		, uint32_t queryCount )const
 	{
+		for ( uint32_t i = 0u; i < queryCount; ++i )
+		{
+			m_writtenQueries.emplace_back( pool, firstQuery + i );
+		}
+
 		buildResetQueryPoolCommand( pool
 			, firstQuery
 			, queryCount
@@ -935,6 +908,7 @@ namespace ashes::gl
 	void CommandBuffer::endQuery( VkQueryPool pool
 		, uint32_t query )const
 	{
+		m_writtenQueries.emplace_back( pool, query );
 		buildEndQueryCommand( pool
 			, query
 			, m_cmdList );
@@ -944,6 +918,7 @@ namespace ashes::gl
 		, VkQueryPool pool
 		, uint32_t query )const
 	{
+		m_writtenQueries.emplace_back( pool, query );
 		buildWriteTimestampCommand( pipelineStage
 			, pool
 			, query
@@ -967,16 +942,17 @@ namespace ashes::gl
 		}
 		else
 		{
-			m_cmdList.push_back( makeCmd< OpType::eBindBuffer >( GL_BUFFER_TARGET_QUERY
-				, get( dstBuffer )->getInternal() ) );
-			m_cmdList.push_back( makeCmd< OpType::eGetQueryResults >( queryPool
+			doAddGpuWrite( dstBuffer );
+			m_cmdList.emplace< OpType::eBindBuffer >( GL_BUFFER_TARGET_QUERY
+				, get( dstBuffer )->getInternal() );
+			m_cmdList.emplace< OpType::eGetQueryResults >( queryPool
 				, firstQuery
 				, queryCount
 				, stride
 				, flags
-				, dstOffset + get( dstBuffer )->getOffset() ) );
-			m_cmdList.push_back( makeCmd< OpType::eBindBuffer >( GL_BUFFER_TARGET_QUERY
-				, 0u ) );
+				, dstOffset + get( dstBuffer )->getOffset() );
+			m_cmdList.emplace< OpType::eBindBuffer >( GL_BUFFER_TARGET_QUERY
+				, 0u );
 		}
 	}
 
@@ -1000,12 +976,7 @@ namespace ashes::gl
 		{
 			doCheckPipelineLayoutCompatibility( layout, m_state.currentGraphicsPipelineLayout );
 			doPushConstants( desc );
-			buildPushConstantsCommand( get( layout )->getDevice()
-				, stageFlags
-				, layout
-				, get( m_state.currentGraphicsPipeline )->getPushConstantsDesc( doIsRtotFbo() )
-				, m_state.currentPushConstantsBuffer
-				, m_cmdList );
+			doBuildGraphicsPushConstants( stageFlags, layout );
 		}
 
 		if ( m_state.currentComputePipeline
@@ -1088,16 +1059,16 @@ namespace ashes::gl
 
 	void CommandBuffer::setBlendConstants( float const blendConstants[4] )const
 	{
-		m_cmdList.push_back( makeCmd< OpType::eBlendConstants >( blendConstants[0]
+		m_cmdList.emplace< OpType::eBlendConstants >( blendConstants[0]
 			, blendConstants[1] 
 			, blendConstants[2] 
-			, blendConstants[3] ) );
+			, blendConstants[3] );
 	}
 
 	void CommandBuffer::setDepthBounds( float minDepthBounds
 		, float maxDepthBounds )const
 	{
-		m_cmdList.push_back( makeCmd< OpType::eDepthRange >( minDepthBounds, maxDepthBounds ) );
+		m_cmdList.emplace< OpType::eDepthRange >( minDepthBounds, maxDepthBounds );
 	}
 
 	void CommandBuffer::setStencilCompareMask( VkStencilFaceFlags faceMask
@@ -1127,6 +1098,7 @@ namespace ashes::gl
 	void CommandBuffer::setEvent( VkEvent event
 		, VkPipelineStageFlags stageMask )const
 	{
+		m_setEvents.push_back( event );
 		buildSetEventCommand( event
 			, stageMask
 			, m_cmdList );
@@ -1147,6 +1119,11 @@ namespace ashes::gl
 		, ArrayView< VkBufferMemoryBarrier const > bufferMemoryBarriers
 		, ArrayView< VkImageMemoryBarrier const > imageMemoryBarriers )const
 	{
+		for ( auto event : events )
+		{
+			doAddWaitedEvent( event );
+		}
+
 		buildWaitEventsCommand( std::move( events )
 			, srcStageMask
 			, dstStageMask
@@ -1192,15 +1169,15 @@ namespace ashes::gl
 			{ labelInfo.color[0], labelInfo.color[1], labelInfo.color[2], labelInfo.color[3] },
 			labelInfo.pLabelName,
 		};
-		m_cmdList.push_back( makeCmd< OpType::ePushDebugGroup >( GL_DEBUG_SOURCE_APPLICATION
+		m_cmdList.emplace< OpType::ePushDebugGroup >( GL_DEBUG_SOURCE_APPLICATION
 			, 1u
 			, GLsizei( m_label.value().labelName.size() )
-			, m_label.value().labelName.c_str() ) );
+			, m_label.value().labelName.c_str() );
 	}
 
 	void CommandBuffer::endDebugUtilsLabel()const
 	{
-		m_cmdList.push_back( makeCmd< OpType::ePopDebugGroup >() );
+		m_cmdList.emplace< OpType::ePopDebugGroup >();
 		m_label = ashes::nullopt;
 	}
 
@@ -1218,15 +1195,15 @@ namespace ashes::gl
 			{ labelInfo.color[0], labelInfo.color[1], labelInfo.color[2], labelInfo.color[3] },
 			labelInfo.pMarkerName,
 		};
-		m_cmdList.push_back( makeCmd< OpType::ePushDebugGroup >( GL_DEBUG_SOURCE_APPLICATION
+		m_cmdList.emplace< OpType::ePushDebugGroup >( GL_DEBUG_SOURCE_APPLICATION
 			, 1u
 			, GLsizei( m_label.value().labelName.size() )
-			, m_label.value().labelName.c_str() ) );
+			, m_label.value().labelName.c_str() );
 	}
 
 	void CommandBuffer::debugMarkerEnd()const
 	{
-		m_cmdList.push_back( makeCmd< OpType::ePopDebugGroup >() );
+		m_cmdList.emplace< OpType::ePopDebugGroup >();
 		m_label = ashes::nullopt;
 	}
 
@@ -1257,12 +1234,24 @@ namespace ashes::gl
 	void CommandBuffer::doReset()const noexcept
 	{
 		m_mappedBuffers.clear();
+		m_preExecuteActions.clear();
 		m_cmdList.clear();
-		m_cmds.clear();
 		m_cmdAfterSubmit.clear();
-		m_cmdsAfterSubmit.clear();
 		m_downloads.clear();
 		m_uploads.clear();
+		m_pushConstantsData.clear();
+		m_writtenQueries.clear();
+		m_waitedEvents.clear();
+		m_setEvents.clear();
+	}
+
+	void CommandBuffer::doAddWaitedEvent( VkEvent event )const
+	{
+		// An event set earlier in the command buffer is waited for on the GPU.
+		if ( m_setEvents.end() == std::find( m_setEvents.begin(), m_setEvents.end(), event ) )
+		{
+			m_waitedEvents.push_back( event );
+		}
 	}
 
 	void CommandBuffer::doSelectVao()const
@@ -1290,6 +1279,90 @@ namespace ashes::gl
 		}
 	}
 
+	void CommandBuffer::doBindGeometryBuffers()const
+	{
+		auto cache = get( m_device )->getVertexArrayCache();
+
+		if ( m_state.selectedVao || !cache )
+		{
+			if ( !m_state.selectedVao )
+			{
+				doSelectVao();
+			}
+
+			doProcessMappedBoundVaoBuffersIn();
+			assert( m_state.selectedVao );
+			buildBindGeometryBuffersCommand( *m_state.selectedVao
+				, m_cmdList );
+			return;
+		}
+
+		// The VAO only holds the vertex formats, the buffers are bound for this draw.
+		auto pipeline = get( m_state.currentGraphicsPipeline );
+
+		if ( !m_state.selectedLayout )
+		{
+			m_state.selectedLayout = &cache->getLayout( pipeline->getVertexInputStateHash()
+				, pipeline->getVertexInputState() );
+		}
+
+		auto & layout = *m_state.selectedLayout;
+
+		for ( auto const & [binding, vbo] : m_state.boundVbos )
+		{
+			if ( layout.findBinding( binding ) )
+			{
+				doProcessMappedBoundBufferIn( vbo.buffer );
+			}
+		}
+
+		if ( m_state.boundIbo )
+		{
+			doProcessMappedBoundBufferIn( m_state.boundIbo.value().buffer );
+		}
+
+		m_cmdList.emplace< OpType::eBindVertexLayout >( cache, &layout );
+		auto multiBind = hasMultiBind( m_device );
+		CmdBindVertexBuffers * cmd{};
+
+		for ( auto const & [binding, vbo] : m_state.boundVbos )
+		{
+			auto desc = layout.findBinding( binding );
+
+			if ( !desc )
+			{
+				continue;
+			}
+
+			auto offset = GLintptr( get( vbo.buffer )->getOffset() + vbo.offset );
+			auto stride = GLsizei( desc->stride );
+
+			if ( !multiBind )
+			{
+				m_cmdList.emplace< OpType::eBindVertexBuffer >( binding
+					, vbo.bo
+					, offset
+					, stride );
+				continue;
+			}
+
+			if ( !cmd
+				|| cmd->first + cmd->count != binding
+				|| cmd->count == CmdBindVertexBuffers::MaxElems )
+			{
+				cmd = &m_cmdList.emplace< OpType::eBindVertexBuffers >( binding );
+			}
+
+			cmd->push( vbo.bo, offset, stride );
+		}
+
+		if ( m_state.boundIbo )
+		{
+			m_cmdList.emplace< OpType::eBindBuffer >( GL_BUFFER_TARGET_ELEMENT_ARRAY
+				, m_state.boundIbo.value().bo );
+		}
+	}
+
 	void CommandBuffer::doProcessMappedBoundDescriptorBuffersIn( VkDescriptorSet descriptor )const
 	{
 		for ( auto const & writes : get( descriptor )->getDynamicBuffers() )
@@ -1329,6 +1402,8 @@ namespace ashes::gl
 					{
 						doProcessMappedBoundBufferOut( write.pBufferInfo->buffer );
 					}
+
+					doAddGpuWrites( *writes );
 				}
 			}
 
@@ -1338,7 +1413,46 @@ namespace ashes::gl
 				{
 					doProcessMappedBoundBufferOut( write.pBufferInfo->buffer );
 				}
+
+				doAddGpuWrites( *writes );
 			}
+
+			for ( auto const & writes : get( descriptor )->getTexelImageBuffers() )
+			{
+				doAddGpuWrites( *writes );
+			}
+		}
+	}
+
+	void CommandBuffer::doAddGpuWrites( LayoutBindingWrites const & writes )const
+	{
+		for ( size_t i = 0u; i < writes.written.size(); ++i )
+		{
+			if ( writes.written[i] )
+			{
+				doAddGpuWrite( ( writes.texelBufferViews.empty()
+					? writes.buffers[i].buffer
+					: get( writes.texelBufferViews[i] )->getBuffer() ) );
+			}
+		}
+	}
+
+	void CommandBuffer::doAddGpuWrite( VkBuffer buffer )const
+	{
+		if ( !buffer )
+		{
+			return;
+		}
+
+		auto & binding = get( buffer )->getMemoryBinding();
+		BindingRange range{ binding.getOffset(), binding.getSize() };
+		auto [it, added] = m_state.gpuWrites.try_emplace( binding.getParent(), range );
+
+		if ( !added )
+		{
+			auto min = std::min( it->second.getMin(), range.getMin() );
+			auto max = std::max( it->second.getMax(), range.getMax() );
+			it->second = BindingRange{ min, max - min };
 		}
 	}
 
@@ -1380,15 +1494,15 @@ namespace ashes::gl
 
 		if ( isInput )
 		{
-			m_cmdList.emplace_back( makeCmd< OpType::eUploadMemory >( buf->getMemoryBinding().getParent()
+			m_cmdList.emplace< OpType::eUploadMemory >( buf->getMemoryBinding().getParent()
 				, buf->getMemoryBinding().getOffset()
-				, buf->getMemoryBinding().getSize() ) );
+				, buf->getMemoryBinding().getSize() );
 		}
 		else
 		{
-			m_cmdList.emplace_back( makeCmd< OpType::eDownloadMemory >( buf->getMemoryBinding().getParent()
+			m_cmdList.emplace< OpType::eDownloadMemory >( buf->getMemoryBinding().getParent()
 				, buf->getMemoryBinding().getOffset()
-				, buf->getMemoryBinding().getSize() ) );
+				, buf->getMemoryBinding().getSize() );
 		}
 
 		auto it = std::find_if( m_mappedBuffers.begin()
@@ -1493,4 +1607,30 @@ namespace ashes::gl
 		assert( ( desc.offset + desc.size ) <= m_state.currentPushConstantsBuffer.size() );
 		std::memcpy( m_state.currentPushConstantsBuffer.data() + desc.offset, desc.data.data(), desc.size );
 	}
+
+	void CommandBuffer::doBuildGraphicsPushConstants( VkShaderStageFlags stageFlags
+		, VkPipelineLayout layout )const
+	{
+		auto pipeline = get( m_state.currentGraphicsPipeline );
+		auto isRtot = doIsRtotFbo();
+
+		if ( isRtot || pipeline->isBackProgramReady() )
+		{
+			buildPushConstantsCommand( m_device
+				, stageFlags
+				, layout
+				, pipeline->getPushConstantsDesc( isRtot )
+				, m_state.currentPushConstantsBuffer
+				, m_cmdList );
+		}
+		else
+		{
+			// The uniforms locations are only known once the program is built, at replay.
+			m_pushConstantsData.push_back( std::make_unique< ByteArray >( m_state.currentPushConstantsBuffer ) );
+			buildPushBackConstantsCommand( stageFlags
+				, m_state.currentGraphicsPipeline
+				, *m_pushConstantsData.back()
+				, m_cmdList );
+		}
+	}
 }
@@ -4,20 +4,25 @@ See LICENSE file in root folder
 */
 #pragma once
 
+#include "renderer/GlRenderer/Command/Commands/GlBindDescriptorSetCommand.hpp"
 #include "renderer/GlRenderer/Command/Commands/GlCommandBase.hpp"
 #include "renderer/GlRenderer/Command/GlCommandPool.hpp"
 #include "renderer/GlRenderer/Core/GlContextStateStack.hpp"
+#include "renderer/GlRenderer/Miscellaneous/GlDeviceMemoryBinding.hpp"
 #include "renderer/GlRenderer/Shader/GlShaderDesc.hpp"
 
 namespace ashes::gl
 {
+	struct LayoutBindingWrites;
+
 	class CommandBuffer
 		: public ashes::IcdObject
 	{
 	public:
 		CommandBuffer( VkAllocationCallbacks const * allocInfo
 			, VkDevice device
-			, VkCommandBufferLevel level );
+			, VkCommandBufferLevel level
+			, CmdChunkPool & chunkPool );
 		~CommandBuffer()noexcept;
 
 		VkResult begin( VkCommandBufferBeginInfo const & info )const;
@@ -188,14 +193,38 @@ namespace ashes::gl
 			return *m_state.stack;
 		}
 
-		inline CmdBuffer const & getCmds()const
+		inline CmdList const & getCmds()const
 		{
-			return m_cmds;
+			return m_cmdList;
 		}
 
-		inline CmdBuffer const & getCmdsAfterSubmit()const
+		inline CmdList const & getCmdsAfterSubmit()const
+		{
+			return m_cmdAfterSubmit;
+		}
+		/**
+		*\return
+		*	The queries the command buffer ends, resets or writes a timestamp to.
+		*/
+		inline std::vector< std::pair< VkQueryPool, uint32_t > > const & getWrittenQueries()const
+		{
+			return m_writtenQueries;
+		}
+		/**
+		*\return
+		*	The events the command buffer waits for, without having set them before.
+		*/
+		inline VkEventArray const & getWaitedEvents()const
+		{
+			return m_waitedEvents;
+		}
+		/**
+		*\return
+		*	The events the command buffer sets.
+		*/
+		inline VkEventArray const & getSetEvents()const
 		{
-			return m_cmdsAfterSubmit;
+			return m_setEvents;
 		}
 
 		inline VkDevice getDevice()const
@@ -223,7 +252,9 @@ namespace ashes::gl
 	private:
 		void doApplyPreExecuteCommands( ContextStateStack const & stack )const;
 		void doReset()const noexcept;
+		void doAddWaitedEvent( VkEvent event )const;
 		void doSelectVao()const;
+		void doBindGeometryBuffers()const;
 		void doProcessMappedBoundDescriptorBuffersIn( VkDescriptorSet descriptor )const;
 		void doProcessMappedBoundDescriptorsBuffersOut()const;
 		void doProcessMappedBoundVaoBuffersIn()const;
@@ -235,14 +266,16 @@ namespace ashes::gl
 		void doCheckPipelineLayoutCompatibility( VkPipelineLayout layout
 			, VkPipelineLayout & currentLayout )const;
 		void doPushConstants( PushConstantsDesc const & desc )const;
+		void doAddGpuWrite( VkBuffer buffer )const;
+		void doAddGpuWrites( LayoutBindingWrites const & writes )const;
+		void doBuildGraphicsPushConstants( VkShaderStageFlags stageFlags
+			, VkPipelineLayout layout )const;
 
 	private:
 		VkDevice m_device;
 		VkCommandBufferLevel m_level;
 		mutable CmdList m_cmdList;
-		mutable CmdBuffer m_cmds;
 		mutable CmdList m_cmdAfterSubmit;
-		mutable CmdBuffer m_cmdsAfterSubmit;
 		mutable std::vector< BufferIndex > m_mappedBuffers;
 		struct State
 		{
@@ -263,13 +296,21 @@ namespace ashes::gl
 			IboBinding newlyBoundIbo;
 			VkIndexType indexType{};
 			GeometryBuffers * selectedVao{ nullptr };
+			VertexLayout const * selectedLayout{ nullptr };
 			GeometryBuffersRefArray vaos;
 			std::map< uint32_t, VkDescriptorSet > boundDescriptors;
 			std::map< uint32_t, std::function< VkDescriptorSet( VkDescriptorSet, uint32_t & ) > > waitingDescriptors;
+			DescriptorBinder descriptorBinder;
+			// The device memory ranges the GPU may write, by memory.
+			std::map< VkDeviceMemory, BindingRange > gpuWrites;
 		};
 		mutable State m_state;
 		mutable Optional< DebugLabel > m_label;
 		std::vector< std::unique_ptr< ByteArray > > m_updatesData;
+		mutable std::vector< std::unique_ptr< ByteArray > > m_pushConstantsData;
+		mutable std::vector< std::pair< VkQueryPool, uint32_t > > m_writtenQueries;
+		mutable VkEventArray m_waitedEvents;
+		mutable VkEventArray m_setEvents;
 		mutable PreExecuteActions m_preExecuteActions;
 		mutable VkDeviceMemorySet m_downloads;
 		mutable VkDeviceMemorySet m_uploads;
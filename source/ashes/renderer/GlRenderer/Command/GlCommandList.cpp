@@ -0,0 +1,115 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#include "Command/GlCommandList.hpp"
+
+#include <algorithm>
+
+namespace ashes::gl
+{
+	//*********************************************************************************************
+
+	UInt32Array CmdChunkPool::acquire( size_t minSize )
+	{
+		if ( minSize <= ChunkSize && !m_chunks.empty() )
+		{
+			auto result = std::move( m_chunks.back() );
+			m_chunks.pop_back();
+			return result;
+		}
+
+		UInt32Array result;
+		result.resize( std::max( ChunkSize, minSize ) );
+		return result;
+	}
+
+	void CmdChunkPool::release( UInt32Array chunk )
+	{
+		// Oversized chunks are not kept, they are one shot allocations.
+		if ( chunk.size() == ChunkSize )
+		{
+			m_chunks.push_back( std::move( chunk ) );
+		}
+	}
+
+	void CmdChunkPool::trim()noexcept
+	{
+		m_chunks.clear();
+		m_chunks.shrink_to_fit();
+	}
+
+	//*********************************************************************************************
+
+	CmdList::CmdList( CmdChunkPool * pool )
+		: m_pool{ pool }
+	{
+	}
+
+	CmdList::~CmdList()noexcept
+	{
+		clear();
+	}
+
+	void CmdList::append( CmdList const & rhs )
+	{
+		for ( auto & src : rhs.m_chunks )
+		{
+			if ( src.used )
+			{
+				auto & dst = doReserve( src.used );
+				std::copy( src.data.begin()
+					, src.data.begin() + ptrdiff_t( src.used )
+					, dst.data.begin() + ptrdiff_t( dst.used ) );
+				dst.used += src.used;
+			}
+		}
+
+		m_count += rhs.m_count;
+		++m_bindingsEpoch;
+	}
+
+	void CmdList::clear()noexcept
+	{
+		if ( m_pool )
+		{
+			try
+			{
+				for ( auto & chunk : m_chunks )
+				{
+					m_pool->release( std::move( chunk.data ) );
+				}
+			}
+			catch ( ... )
+			{
+				// Chunks are simply lost for the pool.
+			}
+		}
+
+		m_chunks.clear();
+		m_count = 0u;
+		++m_bindingsEpoch;
+	}
+
+	CmdList::Chunk & CmdList::doReserve( size_t size )
+	{
+		if ( m_chunks.empty()
+			|| m_chunks.back().data.size() - m_chunks.back().used < size )
+		{
+			if ( m_pool )
+			{
+				m_chunks.push_back( { m_pool->acquire( size ), 0u } );
+			}
+			else
+			{
+				Chunk chunk;
+				chunk.data.resize( std::max( CmdChunkPool::ChunkSize, size ) );
+				m_chunks.push_back( std::move( chunk ) );
+			}
+		}
+
+		return m_chunks.back();
+	}
+
+	//*********************************************************************************************
+}
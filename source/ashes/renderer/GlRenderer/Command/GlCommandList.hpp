@@ -0,0 +1,142 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "renderer/GlRenderer/GlRendererPrerequisites.hpp"
+
+#include <new>
+#include <type_traits>
+
+namespace ashes::gl
+{
+	enum class OpType
+		: uint16_t;
+
+	template< OpType OpT >
+	struct CmdT;
+	/**
+	*\brief
+	*	Tells if a command changes the texture, image, sampler or indexed buffer bindings
+	*	(specialised alongside the commands).
+	*/
+	template< OpType OpT >
+	struct ChangesBindings
+		: std::false_type
+	{
+	};
+
+	/**
+	*\brief
+	*	Keeps the storage chunks released by the command lists of a command pool,
+	*	so that recording after a reset doesn't allocate anymore.
+	*/
+	class CmdChunkPool
+	{
+	public:
+		/**
+		*\brief
+		*	The default size of a chunk, in uint32_t.
+		*/
+		static size_t constexpr ChunkSize = 4096u;
+
+		UInt32Array acquire( size_t minSize );
+		void release( UInt32Array chunk );
+		void trim()noexcept;
+
+	private:
+		std::vector< UInt32Array > m_chunks;
+	};
+
+	/**
+	*\brief
+	*	Linear arena in which the commands are directly constructed.
+	*\remarks
+	*	The commands are stored in chunks of contiguous uint32_t, a command never
+	*	spans across two chunks, hence each chunk can be walked as a plain commands buffer.
+	*	Commands are considered trivially destructible.
+	*/
+	class CmdList
+	{
+	public:
+		struct Chunk
+		{
+			UInt32Array data;
+			size_t used{};
+		};
+
+	public:
+		explicit CmdList( CmdChunkPool * pool = nullptr );
+		~CmdList()noexcept;
+		CmdList( CmdList const & ) = delete;
+		CmdList & operator=( CmdList const & ) = delete;
+		CmdList( CmdList && rhs )noexcept = default;
+		CmdList & operator=( CmdList && rhs )noexcept = default;
+
+		template< OpType OpT, typename ... ParamsT >
+		CmdT< OpT > & emplace( ParamsT && ... params )
+		{
+			static_assert( sizeof( CmdT< OpT > ) % sizeof( uint64_t ) == 0u );
+			auto & chunk = doReserve( sizeof( CmdT< OpT > ) / sizeof( uint32_t ) );
+			auto result = new ( chunk.data.data() + chunk.used ) CmdT< OpT >{ std::forward< ParamsT >( params )... };
+			chunk.used += result->cmd.op.size;
+			++m_count;
+
+			if constexpr ( ChangesBindings< OpT >::value )
+			{
+				++m_bindingsEpoch;
+			}
+
+			return *result;
+		}
+		/**
+		*\brief
+		*	Copies the commands of the given list at the end of this one.
+		*/
+		void append( CmdList const & rhs );
+		/**
+		*\brief
+		*	Removes all commands, the chunks are given back to the pool.
+		*/
+		void clear()noexcept;
+
+		size_t size()const noexcept
+		{
+			return m_count;
+		}
+
+		bool empty()const noexcept
+		{
+			return m_count == 0u;
+		}
+		/**
+		*\brief
+		*	Changes each time a command that may change the bindings is added,
+		*	or when the list is cleared or appended to.
+		*/
+		size_t getBindingsEpoch()const noexcept
+		{
+			return m_bindingsEpoch;
+		}
+
+		auto begin()const noexcept
+		{
+			return m_chunks.begin();
+		}
+
+		auto end()const noexcept
+		{
+			return m_chunks.end();
+		}
+
+	private:
+		Chunk & doReserve( size_t size );
+
+	private:
+		CmdChunkPool * m_pool;
+		std::vector< Chunk > m_chunks;
+		size_t m_count{};
+		size_t m_bindingsEpoch{};
+	};
+}
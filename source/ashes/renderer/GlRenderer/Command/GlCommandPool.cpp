@@ -32,7 +32,8 @@ namespace ashes::gl
 		VkResult result = allocate( commandBuffer
 			, m_allocInfo
 			, getDevice()
-			, info.level );
+			, info.level
+			, m_chunkPool );
 		m_commandBuffers.push_back( commandBuffer );
 		return result;
 	}
@@ -64,4 +65,9 @@ namespace ashes::gl
 
 		return VK_SUCCESS;
 	}
+
+	void CommandPool::trim()noexcept
+	{
+		m_chunkPool.trim();
+	}
 }
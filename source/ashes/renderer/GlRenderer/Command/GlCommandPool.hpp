@@ -5,6 +5,7 @@ See LICENSE file in root folder
 #pragma once
 
 #include "renderer/GlRenderer/GlRendererPrerequisites.hpp"
+#include "renderer/GlRenderer/Command/GlCommandList.hpp"
 
 #include <map>
 
@@ -38,6 +39,7 @@ namespace ashes::gl
 		void destroyCommandBuffer( VkCommandBuffer commandBuffer )noexcept;
 		VkResult reset( VkCommandPoolResetFlags flags )const noexcept;
 		VkResult freeCommands( VkCommandBufferArray const & sets )noexcept;
+		void trim()noexcept;
 
 		VkDevice getDevice()const noexcept
 		{
@@ -48,5 +50,6 @@ namespace ashes::gl
 		VkDevice m_device;
 		VkAllocationCallbacks const * m_allocInfo;
 		VkCommandBufferArray m_commandBuffers;
+		CmdChunkPool m_chunkPool;
 	};
 }
@@ -40,17 +40,156 @@ See LICENSE file in root folder.
 #include "Command/Commands/GlSetLineWidthCommand.hpp"
 #include "Command/Commands/GlWaitEventsCommand.hpp"
 #include "Command/Commands/GlWriteTimestampCommand.hpp"
+#include "Core/GlContextShadow.hpp"
 #include "Core/GlDevice.hpp"
 #include "Sync/GlFence.hpp"
 #include "Sync/GlSemaphore.hpp"
 #include "Core/GlSwapChain.hpp"
+#include "Miscellaneous/GlQueryPool.hpp"
 
 #include "ashesgl_api.hpp"
 
+#include <algorithm>
+#include <cstdlib>
+#include <string_view>
+
 namespace ashes::gl
 {
 	namespace queue
 	{
+		/**
+		*\brief
+		*	Tells if the shadowed GL state must be checked against the real one, after each replayed buffer.
+		*/
+		static bool isShadowStateCheck()
+		{
+			static bool const result = []()
+			{
+				auto value = std::getenv( "ASHES_GL_CHECK_SHADOW_STATE" );
+				return value
+					&& *value
+					&& std::string_view{ value } != "0";
+			}();
+			return result;
+		}
+		/**
+		*\brief
+		*	Tells if the queues process their submissions on a dedicated thread.
+		*	Otherwise, they are processed on the thread calling vkQueueSubmit.
+		*/
+		static bool isSubmitThreadEnabled()
+		{
+			static bool const result = []()
+			{
+				auto value = std::getenv( "ASHES_GL_SUBMIT_THREAD" );
+				return value
+					&& *value
+					&& std::string_view{ value } != "0";
+			}();
+			return result;
+		}
+
+#if VK_KHR_timeline_semaphore
+		static VkTimelineSemaphoreSubmitInfoKHR const * getTimelineInfo( VkSubmitInfo const & value )
+		{
+			auto pNext = reinterpret_cast< VkBaseInStructure const * >( value.pNext );
+
+			while ( pNext )
+			{
+				if ( pNext->sType == VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR )
+				{
+					return reinterpret_cast< VkTimelineSemaphoreSubmitInfoKHR const * >( pNext );
+				}
+
+				pNext = pNext->pNext;
+			}
+
+			return nullptr;
+		}
+#endif
+
+		static void fillBatch( VkSubmitInfo const & value
+			, SubmitBatch & batch )
+		{
+			uint64_t const * waitValues{};
+			uint32_t waitValueCount{};
+			uint64_t const * signalValues{};
+			uint32_t signalValueCount{};
+#if VK_KHR_timeline_semaphore
+
+			if ( auto timelineInfo = getTimelineInfo( value ) )
+			{
+				waitValues = timelineInfo->pWaitSemaphoreValues;
+				waitValueCount = waitValues ? timelineInfo->waitSemaphoreValueCount : 0u;
+				signalValues = timelineInfo->pSignalSemaphoreValues;
+				signalValueCount = signalValues ? timelineInfo->signalSemaphoreValueCount : 0u;
+			}
+
+#endif
+			batch.waits.clear();
+
+			for ( uint32_t i = 0u; i < value.waitSemaphoreCount; ++i )
+			{
+				batch.waits.push_back( { value.pWaitSemaphores[i]
+					, ( i < waitValueCount ? waitValues[i] : 0u ) } );
+			}
+
+			batch.commandBuffers.assign( value.pCommandBuffers
+				, value.pCommandBuffers + value.commandBufferCount );
+			batch.signals.clear();
+
+			for ( uint32_t i = 0u; i < value.signalSemaphoreCount; ++i )
+			{
+				batch.signals.push_back( { value.pSignalSemaphores[i]
+					, ( i < signalValueCount ? signalValues[i] : 0u ) } );
+			}
+		}
+
+		static void fillBatches( VkSubmitInfoArray const & values
+			, std::vector< SubmitBatch > & batches )
+		{
+			batches.resize( values.size() );
+			auto it = batches.begin();
+
+			for ( auto & value : values )
+			{
+				fillBatch( value, *it );
+				++it;
+			}
+		}
+		/**
+		*\brief
+		*	Records the batches' signals, in submit order.
+		*/
+		static void enqueue( std::vector< SubmitBatch > const & batches )
+		{
+			for ( auto & batch : batches )
+			{
+				for ( auto & signal : batch.signals )
+				{
+					get( signal.semaphore )->enqueueSignal( signal.value );
+				}
+			}
+		}
+		/**
+		*\brief
+		*	Tells the queries written by the command buffers that they aren't available before the submission is processed.
+		*/
+		static void setQueriesPending( VkSubmitInfoArray const & values
+			, SubmitThread const & thread
+			, uint64_t serial )
+		{
+			for ( auto & value : values )
+			{
+				for ( auto commandBuffer : makeArrayView( value.pCommandBuffers, value.commandBufferCount ) )
+				{
+					for ( auto & [pool, query] : get( commandBuffer )->getWrittenQueries() )
+					{
+						get( pool )->setPending( query, thread, serial );
+					}
+				}
+			}
+		}
 		static void applyCmd( ContextLock const & lock, Command const & cmd )
 		{
 			switch ( cmd.op.type )
@@ -82,6 +221,9 @@ namespace ashes::gl
 			case OpType::eBindBufferRange:
 				apply( lock, map< OpType::eBindBufferRange >( cmd ) );
 				break;
+			case OpType::eBindBuffersRange:
+				apply( lock, map< OpType::eBindBuffersRange >( cmd ) );
+				break;
 			case OpType::eBindContextState:
 				apply( lock, map< OpType::eBindContextState >( cmd ) );
 				break;
@@ -97,12 +239,30 @@ namespace ashes::gl
 			case OpType::eBindImage:
 				apply( lock, map< OpType::eBindImage >( cmd ) );
 				break;
+			case OpType::eBindImageTextures:
+				apply( lock, map< OpType::eBindImageTextures >( cmd ) );
+				break;
 			case OpType::eBindSampler:
 				apply( lock, map< OpType::eBindSampler >( cmd ) );
 				break;
+			case OpType::eBindSamplers:
+				apply( lock, map< OpType::eBindSamplers >( cmd ) );
+				break;
 			case OpType::eBindTexture:
 				apply( lock, map< OpType::eBindTexture >( cmd ) );
 				break;
+			case OpType::eBindTextures:
+				apply( lock, map< OpType::eBindTextures >( cmd ) );
+				break;
+			case OpType::eBindVertexBuffer:
+				apply( lock, map< OpType::eBindVertexBuffer >( cmd ) );
+				break;
+			case OpType::eBindVertexBuffers:
+				apply( lock, map< OpType::eBindVertexBuffers >( cmd ) );
+				break;
+			case OpType::eBindVertexLayout:
+				apply( lock, map< OpType::eBindVertexLayout >( cmd ) );
+				break;
 			case OpType::eBindVextexArray:
 				apply( lock, map< OpType::eBindVextexArray >( cmd ) );
 				break;
@@ -271,6 +431,9 @@ namespace ashes::gl
 			case OpType::eGetQueryResults:
 				apply( lock, map< OpType::eGetQueryResults >( cmd ) );
 				break;
+			case OpType::eInvalidateMemoryPages:
+				apply( lock, map< OpType::eInvalidateMemoryPages >( cmd ) );
+				break;
 			case OpType::eLineWidth:
 				apply( lock, map< OpType::eLineWidth >( cmd ) );
 				break;
@@ -349,6 +512,9 @@ namespace ashes::gl
 			case OpType::eProgramUniformMatrix4fv:
 				apply( lock, map< OpType::eProgramUniformMatrix4fv >( cmd ) );
 				break;
+			case OpType::ePushBackConstants:
+				apply( lock, map< OpType::ePushBackConstants >( cmd ) );
+				break;
 			case OpType::ePushDebugGroup:
 				apply( lock, map< OpType::ePushDebugGroup >( cmd ) );
 				break;
@@ -442,6 +608,9 @@ namespace ashes::gl
 			case OpType::eUploadMemory:
 				apply( lock, map< OpType::eUploadMemory >( cmd ) );
 				break;
+			case OpType::eUseBackProgram:
+				apply( lock, map< OpType::eUseBackProgram >( cmd ) );
+				break;
 			case OpType::eUseProgram:
 				apply( lock, map< OpType::eUseProgram >( cmd ) );
 				break;
@@ -461,35 +630,43 @@ namespace ashes::gl
 		}
 	}
 
-	void applyList( ContextLock const & lock
+	void applyBuffer( ContextLock const & lock
 		, CmdList const & cmds )
 	{
+		auto & shadow = lock->getShadow();
 		Command const * pCmd = nullptr;
+		uint64_t replayed{};
+		uint64_t skipped{};
 
-		for ( CmdBuffer const & cmdBuf : cmds )
+		for ( auto & chunk : cmds )
 		{
-			auto it = cmdBuf.begin();
+			auto it = chunk.data.begin();
+			auto end = it + ptrdiff_t( chunk.used );
 
-			if ( map( it, cmdBuf.end(), pCmd ) )
+			while ( map( it, end, pCmd ) )
 			{
 				auto & cmd = *pCmd;
-				queue::applyCmd( lock, cmd );
+				it += cmd.op.size;
+
+				if ( shadow.filter( cmd ) )
+				{
+					++skipped;
+				}
+				else
+				{
+					queue::applyCmd( lock, cmd );
+					++replayed;
+				}
 			}
 		}
-	}
 
-	void applyBuffer( ContextLock const & lock
-		, CmdBuffer const & cmds )
-	{
-		auto it = cmds.begin();
-		auto end = cmds.end();
-		Command const * pCmd = nullptr;
+		auto & counters = shadow.getCounters();
+		counters.replayed += replayed;
+		counters.skipped += skipped;
 
-		while ( map( it, end, pCmd ) )
+		if ( queue::isShadowStateCheck() )
 		{
-			auto & cmd = *pCmd;
-			it += cmd.op.size;
-			queue::applyCmd( lock, cmd );
+			shadow.check( lock );
 		}
 	}
 
@@ -500,10 +677,21 @@ namespace ashes::gl
 		, m_createInfo{ std::move( createInfo ) }
 	{
 		registerObject( m_device, *this );
+
+		if ( queue::isSubmitThreadEnabled() )
+		{
+			m_submitThread = std::make_unique< SubmitThread >( m_device
+				, [this]( ContextLock const & context
+					, Submission const & submission )
+				{
+					doProcess( context, submission );
+				} );
+		}
 	}
 
 	Queue::~Queue()noexcept
 	{
+		m_submitThread.reset();
 		unregisterObject( m_device, *this );
 	}
 
@@ -512,24 +700,70 @@ namespace ashes::gl
 	{
 		try
 		{
+			if ( m_submitThread )
+			{
+				auto result = m_submitThread->getResult();
+
+				if ( result != VK_SUCCESS )
+				{
+					return result;
+				}
+
+				auto serial = m_submitThread->push( [&values, fence]( Submission & submission )
+					{
+						queue::fillBatches( values, submission.batches );
+						// Before publishing, so that the thread sees the signals the submission will set.
+						queue::enqueue( submission.batches );
+						submission.fence = fence;
+						submission.swapchains.clear();
+					} );
+
+				if ( fence )
+				{
+					get( fence )->setPending( *m_submitThread, serial );
+				}
+
+				queue::setQueriesPending( values, *m_submitThread, serial );
+
+				return VK_SUCCESS;
+			}
+
+			queue::fillBatches( values, m_batches );
+			queue::enqueue( m_batches );
 			auto context = get( m_device )->getContext();
+			std::lock_guard< std::mutex > lock{ m_heldMutex };
 
-			for ( auto & value : values )
+			if ( m_held.empty()
+				&& isSubmissionReady( m_batches ) )
 			{
-				for ( auto commandBuffer : makeArrayView( value.pCommandBuffers, value.commandBufferCount ) )
+				// The bindings may have been changed outside of the queue since the last submit.
+				context->getShadow().invalidateBindings();
+
+				for ( auto & batch : m_batches )
 				{
-					auto const & glCommandBuffer = *get( commandBuffer );
-					glCommandBuffer.initialiseGeometryBuffers( context );
-					applyBuffer( context, glCommandBuffer.getCmds() );
-					applyBuffer( context, glCommandBuffer.getCmdsAfterSubmit() );
+					doSubmit( context, batch );
 				}
+
+				if ( fence )
+				{
+					get( fence )->insert( context );
+				}
+
+				return VK_SUCCESS;
 			}
 
+			// A wait submitted before its signal, or for an unset event, held back until the host signals or sets it.
+			auto & held = m_held.emplace_back();
+			held.batches = std::move( m_batches );
+			held.fence = fence;
+			m_batches.clear();
+
 			if ( fence )
 			{
-				get( fence )->insert( context );
+				get( fence )->setHeld();
 			}
 
+			doReplayHeld( context );
 			return VK_SUCCESS;
 		}
 		catch ( Exception & exc )
@@ -546,28 +780,78 @@ namespace ashes::gl
 	{
 		try
 		{
-			if ( presentInfo.pResults )
+			auto swapchains = makeArrayView( presentInfo.pSwapchains, presentInfo.swapchainCount );
+			auto waits = makeArrayView( presentInfo.pWaitSemaphores, presentInfo.waitSemaphoreCount );
+
+			if ( m_submitThread
+				&& !presentInfo.pResults )
 			{
-				auto itResult = presentInfo.pResults;
+				auto result = m_submitThread->getResult();
 
-				for ( auto itSwapchain = presentInfo.pSwapchains;
-					itSwapchain != presentInfo.pSwapchains + presentInfo.swapchainCount;
-					++itResult, ++itSwapchain )
+				if ( result != VK_SUCCESS )
 				{
-					*itResult = get( *itSwapchain )->present();
+					return result;
 				}
+
+				m_submitThread->push( [&swapchains, &waits]( Submission & submission )
+					{
+						submission.batches.resize( 1u );
+						auto & batch = submission.batches.front();
+						batch.waits.clear();
+
+						for ( auto semaphore : waits )
+						{
+							batch.waits.push_back( { semaphore, 0u } );
+						}
+
+						batch.commandBuffers.clear();
+						batch.signals.clear();
+						submission.fence = nullptr;
+						submission.swapchains.assign( swapchains.begin(), swapchains.end() );
+					} );
+				return VK_SUCCESS;
 			}
-			else
+
+			if ( !m_submitThread )
 			{
-				for ( auto itSwapchain = presentInfo.pSwapchains;
-					itSwapchain != presentInfo.pSwapchains + presentInfo.swapchainCount;
-					++itSwapchain )
+				std::lock_guard< std::mutex > lock{ m_heldMutex };
+
+				if ( !m_held.empty() )
 				{
-					get( *itSwapchain )->present();
+					// Presented after the held submissions, the results can't be known yet.
+					auto & held = m_held.emplace_back();
+					held.batches.resize( 1u );
+
+					for ( auto semaphore : waits )
+					{
+						held.batches.front().waits.push_back( { semaphore, 0u } );
+					}
+
+					held.swapchains.assign( swapchains.begin(), swapchains.end() );
+
+					if ( presentInfo.pResults )
+					{
+						std::fill_n( presentInfo.pResults, swapchains.size(), VK_SUCCESS );
+					}
+
+					return VK_SUCCESS;
 				}
 			}
 
-			return VK_SUCCESS;
+			// The per swapchain results are needed, so the present happens on the calling thread.
+			drain();
+
+			if ( !waits.empty() )
+			{
+				auto context = get( m_device )->getContext();
+
+				for ( auto semaphore : waits )
+				{
+					get( semaphore )->wait( context, 0u );
+				}
+			}
+
+			return doPresent( swapchains, presentInfo.pResults );
 		}
 		catch ( Exception & exc )
 		{
@@ -589,11 +873,14 @@ namespace ashes::gl
 	{
 		try
 		{
+			drain();
 			auto context = get( m_device )->getContext();
 			logDebug( "*** vkQueueWaitIdle ***" );
 			glLogEmptyCall( context
 				, glFinish );
-			return VK_SUCCESS;
+			return m_submitThread
+				? m_submitThread->getResult()
+				: VK_SUCCESS;
 		}
 		catch ( Exception & exc )
 		{
@@ -605,6 +892,119 @@ namespace ashes::gl
 		}
 	}
 
+	void Queue::drain()const
+	{
+		if ( m_submitThread )
+		{
+			m_submitThread->drain();
+		}
+	}
+
+	void Queue::replayHeld()const
+	{
+		if ( m_submitThread )
+		{
+			m_submitThread->notify();
+			return;
+		}
+
+		{
+			std::lock_guard< std::mutex > lock{ m_heldMutex };
+
+			if ( m_held.empty() )
+			{
+				return;
+			}
+		}
+
+		auto context = get( m_device )->getContext();
+		std::lock_guard< std::mutex > lock{ m_heldMutex };
+		doReplayHeld( context );
+	}
+
+	void Queue::doProcess( ContextLock const & context
+		, Submission const & submission )const
+	{
+		// The bindings may have been changed outside of the queue since the last submit.
+		context->getShadow().invalidateBindings();
+
+		for ( auto & batch : submission.batches )
+		{
+			doSubmit( context, batch );
+		}
+
+		if ( submission.fence )
+		{
+			get( submission.fence )->insert( context );
+		}
+
+		if ( !submission.swapchains.empty() )
+		{
+			doPresent( makeArrayView( submission.swapchains.data()
+					, submission.swapchains.data() + submission.swapchains.size() )
+				, nullptr );
+		}
+	}
+
+	void Queue::doReplayHeld( ContextLock const & context )const
+	{
+		// In submission order, so a held submission holds back the ones after it.
+		while ( !m_held.empty()
+			&& isSubmissionReady( m_held.front().batches ) )
+		{
+			doProcess( context, m_held.front() );
+			m_held.pop_front();
+		}
+	}
+
+	void Queue::doApply( ContextLock const & context
+		, ArrayView< VkCommandBuffer const > commandBuffers )const
+	{
+		for ( auto commandBuffer : commandBuffers )
+		{
+			auto const & glCommandBuffer = *get( commandBuffer );
+			glCommandBuffer.initialiseGeometryBuffers( context );
+			applyBuffer( context, glCommandBuffer.getCmds() );
+			applyBuffer( context, glCommandBuffer.getCmdsAfterSubmit() );
+		}
+	}
+
+	void Queue::doSubmit( ContextLock const & context
+		, SubmitBatch const & batch )const
+	{
+		for ( auto & wait : batch.waits )
+		{
+			get( wait.semaphore )->wait( context, wait.value );
+		}
+
+		doApply( context, makeArrayView( batch.commandBuffers.data()
+			, batch.commandBuffers.data() + batch.commandBuffers.size() ) );
+
+		for ( auto & signal : batch.signals )
+		{
+			get( signal.semaphore )->signal( context, signal.value );
+		}
+	}
+
+	VkResult Queue::doPresent( ArrayView< VkSwapchainKHR const > swapchains
+		, VkResult * results )const
+	{
+		for ( auto swapchain : swapchains )
+		{
+			auto result = get( swapchain )->present();
+
+			if ( results )
+			{
+				*results = result;
+				++results;
+			}
+		}
+
+		auto & counters = get( m_device )->getVertexArrayCounters();
+		counters.createdLastFrame = counters.createdInFrame.exchange( 0u );
+		return VK_SUCCESS;
+	}
+
 #if VK_EXT_debug_utils
 
 	void Queue::beginDebugUtilsLabel( VkDebugUtilsLabelEXT const & labelInfo )const
@@ -5,13 +5,15 @@ See LICENSE file in root folder.
 #pragma once
 
 #include "renderer/GlRenderer/GlRendererPrerequisites.hpp"
+#include "renderer/GlRenderer/Command/GlSubmitThread.hpp"
 #include "renderer/GlRenderer/Command/Commands/GlCommandBase.hpp"
 
+#include <deque>
+#include <mutex>
+
 namespace ashes::gl
 {
 	void applyBuffer( ContextLock const & lock
-		, CmdBuffer const & cmds );
-	void applyList( ContextLock const & lock
 		, CmdList const & cmds );
 
 	class Queue
@@ -29,6 +31,20 @@ namespace ashes::gl
 			, VkFence fence )const;
 		VkResult present( VkPresentInfoKHR const & presentInfo )const;
 		VkResult waitIdle()const;
+		/**
+		*\brief
+		*	Waits until the submission thread, if any, has processed all submissions.
+		*\remarks
+		*	Must not be called while holding the device context.
+		*/
+		void drain()const;
+		/**
+		*\brief
+		*	Replays the submissions held back by waits for host signals or event sets, which are now covered.
+		*\remarks
+		*	Must not be called while holding the device context.
+		*/
+		void replayHeld()const;
 #if VK_EXT_debug_utils
 		void beginDebugUtilsLabel( VkDebugUtilsLabelEXT const & labelInfo )const;
 		void endDebugUtilsLabel()const;
@@ -44,10 +60,39 @@ namespace ashes::gl
 		{
 			return m_createInfo;
 		}
+		/**
+		*\return
+		*	The submission thread, \p nullptr if the submissions are processed on the calling thread.
+		*/
+		SubmitThread * getSubmitThread()const noexcept
+		{
+			return m_submitThread.get();
+		}
+
+	private:
+		void doApply( ContextLock const & context
+			, ArrayView< VkCommandBuffer const > commandBuffers )const;
+		void doSubmit( ContextLock const & context
+			, SubmitBatch const & batch )const;
+		void doProcess( ContextLock const & context
+			, Submission const & submission )const;
+		void doReplayHeld( ContextLock const & context )const;
+		VkResult doPresent( ArrayView< VkSwapchainKHR const > swapchains
+			, VkResult * results )const;
 
 	private:
 		VkDevice m_device;
 		VkDeviceQueueCreateInfo m_createInfo;
 		mutable Optional< DebugLabel > m_label;
+		std::unique_ptr< SubmitThread > m_submitThread;
+		//! The batches of the submissions processed on the calling thread, kept to reuse their storage.
+		mutable std::vector< SubmitBatch > m_batches;
+		/**
+		*\brief
+		*	The submissions processed on the calling thread that wait for a host signal or event set, with the ones after them.
+		*	They are replayed when the host signals the semaphores or sets the events, vkQueueSubmit never blocks for them.
+		*/
+		mutable std::deque< Submission > m_held;
+		mutable std::mutex m_heldMutex;
 	};
 }
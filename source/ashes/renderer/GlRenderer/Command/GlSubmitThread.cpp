@@ -0,0 +1,332 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#include "Command/GlSubmitThread.hpp"
+
+#include "Command/GlCommandBuffer.hpp"
+#include "Core/GlContextLock.hpp"
+#include "Core/GlDevice.hpp"
+#include "Miscellaneous/GlDebug.hpp"
+#include "Sync/GlEvent.hpp"
+#include "Sync/GlSemaphore.hpp"
+
+#include "ashesgl_api.hpp"
+
+#include <algorithm>
+
+namespace ashes::gl
+{
+	bool isSubmissionReady( std::vector< SubmitBatch > const & batches )
+	{
+		VkEventArray setEvents;
+
+		for ( auto & batch : batches )
+		{
+			for ( auto & wait : batch.waits )
+			{
+				if ( !get( wait.semaphore )->isCovered( wait.value ) )
+				{
+					return false;
+				}
+			}
+
+			for ( auto commandBuffer : batch.commandBuffers )
+			{
+				auto & glCommandBuffer = *get( commandBuffer );
+
+				for ( auto event : glCommandBuffer.getWaitedEvents() )
+				{
+					if ( setEvents.end() == std::find( setEvents.begin(), setEvents.end(), event )
+						&& !get( event )->isSet() )
+					{
+						return false;
+					}
+				}
+
+				setEvents.insert( setEvents.end()
+					, glCommandBuffer.getSetEvents().begin()
+					, glCommandBuffer.getSetEvents().end() );
+			}
+		}
+
+		return true;
+	}
+
+	SubmitThread::SubmitThread( VkDevice device
+		, ProcessFunc process )
+		: m_device{ device }
+		, m_process{ std::move( process ) }
+	{
+		for ( uint64_t i = 0u; i < RingSize; ++i )
+		{
+			m_slots[i].sequence.store( i, std::memory_order_relaxed );
+		}
+
+		m_thread = std::thread{ [this]()
+			{
+				doRun();
+			} };
+	}
+
+	SubmitThread::~SubmitThread()noexcept
+	{
+		{
+			std::lock_guard< std::mutex > lock{ m_mutex };
+			m_stopped = true;
+		}
+
+		m_wakeUp.notify_one();
+		m_thread.join();
+	}
+
+	void SubmitThread::wait( uint64_t serial )const
+	{
+		if ( isDone( serial ) )
+		{
+			return;
+		}
+
+		std::unique_lock< std::mutex > lock{ m_mutex };
+		m_taskDone.wait( lock
+			, [this, serial]()
+			{
+				return isDone( serial );
+			} );
+	}
+
+	bool SubmitThread::wait( uint64_t serial
+		, std::chrono::steady_clock::time_point deadline )const
+	{
+		if ( isDone( serial ) )
+		{
+			return true;
+		}
+
+		std::unique_lock< std::mutex > lock{ m_mutex };
+		return m_taskDone.wait_until( lock
+			, deadline
+			, [this, serial]()
+			{
+				return isDone( serial );
+			} );
+	}
+
+	void SubmitThread::notify()
+	{
+		{
+			std::lock_guard< std::mutex > lock{ m_mutex };
+		}
+
+		m_wakeUp.notify_one();
+	}
+
+	void SubmitThread::drain()const
+	{
+		wait( m_head.load( std::memory_order_acquire ) );
+	}
+
+	SubmitThread::Slot & SubmitThread::doAcquire()
+	{
+		auto position = m_head.load( std::memory_order_relaxed );
+		bool stalled = false;
+
+		while ( true )
+		{
+			auto & slot = m_slots[position % RingSize];
+			auto sequence = slot.sequence.load( std::memory_order_acquire );
+
+			if ( sequence == position )
+			{
+				if ( m_head.compare_exchange_weak( position
+					, position + 1u
+					, std::memory_order_relaxed ) )
+				{
+					slot.position = position;
+					return slot;
+				}
+			}
+			else if ( sequence < position )
+			{
+				// The ring is full, wait for the thread to free a slot.
+				if ( !stalled )
+				{
+					stalled = true;
+					++m_counters.stalls;
+				}
+
+				{
+					std::unique_lock< std::mutex > lock{ m_mutex };
+					m_taskDone.wait( lock
+						, [&slot, position]()
+						{
+							return slot.sequence.load( std::memory_order_acquire ) >= position;
+						} );
+				}
+
+				position = m_head.load( std::memory_order_relaxed );
+			}
+			else
+			{
+				// Another producer took this position.
+				position = m_head.load( std::memory_order_relaxed );
+			}
+		}
+	}
+
+	uint64_t SubmitThread::doPublish( Slot & slot )
+	{
+		auto serial = slot.position + 1u;
+		// Sequentially consistent, along with m_idle, so that the thread can't miss it before going to sleep.
+		slot.sequence.store( serial );
+		++m_counters.pushed;
+
+		if ( m_idle.load() )
+		{
+			{
+				std::lock_guard< std::mutex > lock{ m_mutex };
+			}
+
+			m_wakeUp.notify_one();
+		}
+
+		return serial;
+	}
+
+	bool SubmitThread::doHasWork()const noexcept
+	{
+		return m_slots[m_tail % RingSize].sequence.load() == m_tail + 1u;
+	}
+
+	bool SubmitThread::doIsReady()const
+	{
+		return isSubmissionReady( m_slots[m_tail % RingSize].submission.batches );
+	}
+
+	bool SubmitThread::doIsReleaseRequested()const noexcept
+	{
+		return m_context
+			&& m_context->isReleaseRequested()
+			&& m_context->isCurrent();
+	}
+
+	void SubmitThread::doRun()noexcept
+	{
+		while ( true )
+		{
+			bool stopped{};
+
+			{
+				std::unique_lock< std::mutex > lock{ m_mutex };
+				auto predicate = [this]()
+				{
+					return m_stopped
+						|| ( doHasWork() && doIsReady() )
+						|| doIsReleaseRequested();
+				};
+				m_idle.store( true );
+
+				if ( doHasWork() )
+				{
+					// Held back by a wait for the host, in case a signal doesn't notify this thread.
+					m_wakeUp.wait_for( lock, std::chrono::milliseconds{ 1 }, predicate );
+				}
+				else
+				{
+					m_wakeUp.wait( lock, predicate );
+				}
+
+				m_idle.store( false );
+				stopped = m_stopped;
+
+				if ( stopped
+					&& !doHasWork() )
+				{
+					break;
+				}
+			}
+
+			if ( doIsReleaseRequested() )
+			{
+				// Another thread needs the context, even if work is ready.
+				m_context->releaseSticky();
+				m_context->waitLockWaiters();
+			}
+
+			if ( !doHasWork()
+				|| !( stopped || doIsReady() ) )
+			{
+				continue;
+			}
+
+			++m_counters.wakeUps;
+			bool yielded = false;
+
+			{
+				auto context = get( m_device )->getContext();
+				m_context = context.operator->();
+				context->setStickyOwner( [this]()
+					{
+						{
+							std::lock_guard< std::mutex > lock{ m_mutex };
+						}
+
+						m_wakeUp.notify_one();
+					} );
+
+				while ( !yielded
+					&& doHasWork()
+					&& ( stopped || doIsReady() ) )
+				{
+					auto & slot = m_slots[m_tail % RingSize];
+
+					if ( m_result.load() == VK_SUCCESS )
+					{
+						try
+						{
+							m_process( context, slot.submission );
+						}
+						catch ( Exception & exc )
+						{
+							logError( exc.what() );
+							m_result = exc.getResult();
+						}
+						catch ( std::exception & exc )
+						{
+							logError( exc.what() );
+							m_result = VK_ERROR_DEVICE_LOST;
+						}
+						catch ( ... )
+						{
+							m_result = VK_ERROR_DEVICE_LOST;
+						}
+					}
+
+					++m_tail;
+					slot.sequence.store( m_tail - 1u + RingSize, std::memory_order_release );
+					m_done.store( m_tail, std::memory_order_release );
+
+					{
+						std::lock_guard< std::mutex > lock{ m_mutex };
+					}
+
+					m_taskDone.notify_all();
+
+					// Between two submissions, the threads waiting for the context take it.
+					yielded = context->hasLockWaiters();
+				}
+			}
+
+			if ( yielded )
+			{
+				m_context->releaseSticky();
+				m_context->waitLockWaiters();
+			}
+		}
+
+		if ( m_context )
+		{
+			m_context->releaseSticky();
+		}
+	}
+}
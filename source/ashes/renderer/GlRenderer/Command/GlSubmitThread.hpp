@@ -0,0 +1,186 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#pragma once
+
+#include "renderer/GlRenderer/GlRendererPrerequisites.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace ashes::gl
+{
+	/**
+	*\brief
+	*	A semaphore wait or signal, the value is ignored for binary semaphores.
+	*/
+	struct SemaphoreOp
+	{
+		VkSemaphore semaphore;
+		uint64_t value;
+	};
+	/**
+	*\brief
+	*	The content of a VkSubmitInfo: semaphores to wait for, command buffers to replay,
+	*	then semaphores to signal.
+	*/
+	struct SubmitBatch
+	{
+		std::vector< SemaphoreOp > waits;
+		std::vector< VkCommandBuffer > commandBuffers;
+		std::vector< SemaphoreOp > signals;
+	};
+	/**
+	*\brief
+	*	A work item for the submission thread: batches to replay,
+	*	then an optional fence to insert, then optional swapchains to present.
+	*/
+	struct Submission
+	{
+		std::vector< SubmitBatch > batches;
+		VkFence fence{};
+		std::vector< VkSwapchainKHR > swapchains;
+	};
+	/**
+	*\return
+	*	\p false if a wait of the batches isn't covered yet: a semaphore wait by a submitted or host signal,
+	*	an event wait by a host set, or by a set earlier in the batches.
+	*/
+	bool isSubmissionReady( std::vector< SubmitBatch > const & batches );
+	/**
+	*\brief
+	*	A thread replaying the submissions of a queue, fed through a bounded lock free MPSC ring.
+	*\remarks
+	*	The thread is the sticky owner of the device context: it keeps it current between its submissions,
+	*	and releases it when another thread needs it, between two submissions, so that the other threads can still create resources.
+	*	A producer finding the ring full sleeps until the thread frees a slot.
+	*	Each submission gets a serial, in push order, that can be waited for.
+	*	A submission waiting for a timeline value that no submitted signal will set, or for an unset event,
+	*	is held back, with the ones after it, until the host signals the value or sets the event.
+	*/
+	class SubmitThread
+	{
+	public:
+		static uint32_t constexpr RingSize = 64u;
+		using ProcessFunc = std::function< void( ContextLock const &, Submission const & ) >;
+
+		struct Counters
+		{
+			//! The submissions pushed to the ring.
+			std::atomic< uint64_t > pushed{};
+			//! The times a producer had to wait for a free slot in the ring.
+			std::atomic< uint64_t > stalls{};
+			//! The times the thread woke up to find work, after having been idle.
+			std::atomic< uint64_t > wakeUps{};
+		};
+
+	public:
+		SubmitThread( SubmitThread const & ) = delete;
+		SubmitThread( SubmitThread && ) = delete;
+		SubmitThread & operator=( SubmitThread const & ) = delete;
+		SubmitThread & operator=( SubmitThread && ) = delete;
+
+		SubmitThread( VkDevice device
+			, ProcessFunc process );
+		~SubmitThread()noexcept;
+		/**
+		*\brief
+		*	Moves \p fill's result in a free slot of the ring, and wakes the thread up.
+		*\param[in] fill
+		*	Fills the slot's submission, which may hold data from a previous use, to reuse its storage.
+		*\return
+		*	The submission serial.
+		*/
+		template< typename FillFuncT >
+		uint64_t push( FillFuncT fill )
+		{
+			auto & slot = doAcquire();
+			fill( slot.submission );
+			return doPublish( slot );
+		}
+		/**
+		*\brief
+		*	Waits until the submission with given serial has been processed.
+		*/
+		void wait( uint64_t serial )const;
+		/**
+		*\brief
+		*	Waits until the submission with given serial has been processed, or until \p deadline.
+		*\return
+		*	\p true if the submission has been processed.
+		*/
+		bool wait( uint64_t serial
+			, std::chrono::steady_clock::time_point deadline )const;
+		/**
+		*\brief
+		*	Waits until all pushed submissions have been processed.
+		*/
+		void drain()const;
+		/**
+		*\return
+		*	\p true if the submission with given serial has been processed.
+		*/
+		bool isDone( uint64_t serial )const noexcept
+		{
+			return m_done.load( std::memory_order_acquire ) >= serial;
+		}
+		/**
+		*\return
+		*	The first error met while processing a submission, VK_SUCCESS if none.
+		*/
+		VkResult getResult()const noexcept
+		{
+			return m_result.load();
+		}
+		/**
+		*\brief
+		*	Wakes the thread up, to check again a submission held back by a wait for the host.
+		*/
+		void notify();
+
+		Counters & getCounters()noexcept
+		{
+			return m_counters;
+		}
+
+	private:
+		struct Slot
+		{
+			//! The ring position this slot can be written at, or this position + 1 when it's ready to be read.
+			std::atomic< uint64_t > sequence{};
+			uint64_t position{};
+			Submission submission;
+		};
+
+		Slot & doAcquire();
+		uint64_t doPublish( Slot & slot );
+		bool doHasWork()const noexcept;
+		bool doIsReady()const;
+		bool doIsReleaseRequested()const noexcept;
+		void doRun()noexcept;
+
+	private:
+		VkDevice m_device;
+		ProcessFunc m_process;
+		//! The context used by the last submissions, which may still be current on the thread.
+		Context * m_context{};
+		std::array< Slot, RingSize > m_slots;
+		std::atomic< uint64_t > m_head{};
+		uint64_t m_tail{};
+		std::atomic< uint64_t > m_done{};
+		std::atomic< bool > m_idle{};
+		std::atomic< VkResult > m_result{ VK_SUCCESS };
+		mutable std::mutex m_mutex;
+		std::condition_variable m_wakeUp;
+		mutable std::condition_variable m_taskDone;
+		bool m_stopped{};
+		Counters m_counters;
+		std::thread m_thread;
+	};
+}
@@ -1,6 +1,7 @@
 #include "Core/GlContext.hpp"
 
 #include "Core/GlContextLock.hpp"
+#include "Core/GlContextShadow.hpp"
 #include "Core/GlSurface.hpp"
 
 #include "ashesgl_api.hpp"
@@ -9,6 +10,7 @@
 #	include <gl/GL.h>
 #endif
 
+#include <chrono>
 #include <iostream>
 #include <locale>
 
@@ -74,6 +76,45 @@ namespace ashes::gl
 				, 0u );
 			return result;
 		}
+
+		static GLuint allocateStorage( ContextLock const & context
+			, GLuint result
+			, GlBufferTarget target
+			, GLsizeiptr size
+			, gl4::GlMemoryPropertyFlags flags )
+		{
+			glLogCall( context
+				, glBindBuffer
+				, target
+				, result );
+			glLogCall( context
+				, glBufferStorage
+				, target
+				, size
+				, nullptr
+				, flags );
+			glLogCall( context
+				, glBindBuffer
+				, target
+				, 0u );
+			return result;
+		}
+
+		//! The context left current on this thread, after its unlock.
+		static thread_local Context * tlsStickyContext = nullptr;
+
+		static void releaseThreadSticky( Context const * next )noexcept
+		{
+			auto sticky = tlsStickyContext;
+
+			if ( sticky
+				&& sticky != next
+				&& !sticky->isEnabled() )
+			{
+				// Making another context current on this thread would silently release it.
+				sticky->releaseSticky();
+			}
+		}
 	}
 
 	//*************************************************************************
@@ -88,7 +129,9 @@ namespace ashes::gl
 	Context::Context( gl::ContextImplPtr impl )
 		: m_impl{ std::move( impl ) }
 		, m_instance{ m_impl->instance }
+		, m_shadow{ std::make_unique< ContextShadow >() }
 	{
+		ctxt::releaseThreadSticky( nullptr );
 		m_impl->preInitialise( MinMajor, MinMinor );
 		m_impl->enable();
 		loadBaseFunctions();
@@ -96,6 +139,17 @@ namespace ashes::gl
 		m_impl->postInitialise();
 	}
 
+	Context::~Context()noexcept
+	{
+		if ( m_currentThread.load() != std::thread::id{} )
+		{
+			// Takes the context back from the thread it's still current on.
+			lock();
+			m_releaseRequested = true;
+			unlock();
+		}
+	}
+
 #if _WIN32
 
 	ContextPtr Context::create( VkInstance instance
@@ -223,10 +277,51 @@ namespace ashes::gl
 
 	void Context::lock()
 	{
-		m_mutex.lock();
+		auto id = std::this_thread::get_id();
+		ctxt::releaseThreadSticky( this );
+		++m_lockWaiters;
+		std::unique_lock< std::mutex > lock{ m_mutex };
+		bool requested = false;
+
+		while ( m_currentThread.load() != std::thread::id{}
+			&& m_currentThread.load() != id )
+		{
+			// Still current on another thread, only that thread can release it.
+			if ( !requested )
+			{
+				requested = true;
+				++m_lockCounters.handoffs;
+			}
+
+			m_releaseRequested = true;
+
+			if ( m_releaseNotify )
+			{
+				m_releaseNotify();
+			}
+
+			// Bounded, the request is notified again in case the owner missed it.
+			m_handoff.wait_for( lock, std::chrono::milliseconds{ 1 } );
+		}
+
+		lock.release();
+
+		if ( --m_lockWaiters == 0u )
+		{
+			m_handoff.notify_all();
+		}
+
 		m_enabled = true;
-		m_activeThread = std::this_thread::get_id();
-		m_impl->enable();
+		m_activeThread = id;
+		++m_lockCounters.locks;
+
+		if ( m_currentThread.load() != id )
+		{
+			m_impl->enable();
+			m_currentThread = id;
+			++m_lockCounters.makeCurrents;
+		}
+
 		logContextLock();
 	}
 
@@ -234,15 +329,98 @@ namespace ashes::gl
 	{
 		logContextUnlock();
 		assert( isEnabled() );
-		m_impl->disable();
+		auto id = std::this_thread::get_id();
 		m_activeThread.exchange( {} );
 		m_enabled = false;
+
+		if ( m_releaseRequested
+			|| id != m_stickyThread
+			|| !m_releaseNotify )
+		{
+			doRelease();
+		}
+		else
+		{
+			ctxt::tlsStickyContext = this;
+		}
+
 		m_mutex.unlock();
 	}
 
+	void Context::setStickyOwner( std::function< void() > releaseNotify )
+	{
+		assert( isEnabled() );
+		assert( releaseNotify && "A sticky owner must be able to release the context" );
+		m_stickyThread = std::this_thread::get_id();
+		m_releaseNotify = std::move( releaseNotify );
+	}
+
+	void Context::releaseSticky()noexcept
+	{
+		auto id = std::this_thread::get_id();
+
+		if ( m_currentThread.load() != id
+			|| isEnabled() )
+		{
+			return;
+		}
+
+		std::lock_guard< std::mutex > lock{ m_mutex };
+
+		if ( m_currentThread.load() == id )
+		{
+			doRelease();
+		}
+	}
+
+	void Context::waitLockWaiters()noexcept
+	{
+		std::unique_lock< std::mutex > lock{ m_mutex };
+		m_handoff.wait_for( lock
+			, std::chrono::milliseconds{ 1 }
+			, [this]()
+			{
+				return m_lockWaiters.load() == 0u;
+			} );
+	}
+
+	void Context::doRelease()noexcept
+	{
+		m_impl->disable();
+		m_currentThread = std::thread::id{};
+		m_stickyThread = std::thread::id{};
+		m_releaseNotify = nullptr;
+		++m_lockCounters.releases;
+
+		if ( ctxt::tlsStickyContext == this )
+		{
+			ctxt::tlsStickyContext = nullptr;
+		}
+
+		if ( m_releaseRequested.exchange( false ) )
+		{
+			m_handoff.notify_all();
+		}
+	}
+
 	GLuint Context::createBuffer( GlBufferTarget target
 		, GLsizeiptr size
 		, GlBufferDataUsageFlags flags )
+	{
+		return doCreateBuffer( target, size, flags, {} );
+	}
+
+	GLuint Context::createStorageBuffer( GlBufferTarget target
+		, GLsizeiptr size
+		, gl4::GlMemoryPropertyFlags flags )
+	{
+		return doCreateBuffer( target, size, {}, flags );
+	}
+
+	GLuint Context::doCreateBuffer( GlBufferTarget target
+		, GLsizeiptr size
+		, GlBufferDataUsageFlags flags
+		, gl4::GlMemoryPropertyFlags storageFlags )
 	{
 		GLuint result;
 		ContextLock context{ *this };
@@ -258,7 +436,16 @@ namespace ashes::gl
 			std::stringstream err;
 			err << "Buffer " << result << " is being reused";
 			reportWarning( m_instance, VK_SUCCESS, "Buffer memory", err.str() );
-			ctxt::allocateBuffer( context, it->name, it->target, it->size, it->flags );
+
+			if ( it->storageFlags )
+			{
+				ctxt::allocateStorage( context, it->name, it->target, it->size, it->storageFlags );
+			}
+			else
+			{
+				ctxt::allocateBuffer( context, it->name, it->target, it->size, it->flags );
+			}
+
 			glLogCreateCall( context
 				, glGenBuffers
 				, 1u
@@ -267,11 +454,20 @@ namespace ashes::gl
 		}
 
 		assert( isEnabled() );
-		ctxt::allocateBuffer( context, result, target, size, flags );
+
+		if ( storageFlags )
+		{
+			ctxt::allocateStorage( context, result, target, size, storageFlags );
+		}
+		else
+		{
+			ctxt::allocateBuffer( context, result, target, size, flags );
+		}
+
 		GLint realSize = getBufferSize( context, target, result );
 		assert( isEnabled() );
 		assert( realSize >= size );
-		m_buffers.push_back( { result, target, GLsizeiptr( realSize ), flags } );
+		m_buffers.push_back( { result, target, GLsizeiptr( realSize ), flags, storageFlags } );
 		return result;
 	}
 
@@ -369,6 +565,15 @@ namespace ashes::gl
 		glLogCall( lock
 			, glEnable
 			, GL_TEXTURE_CUBE_MAP_SEAMLESS );
+
+		if ( hasMaxShaderCompilerThreads() )
+		{
+			// Let the driver choose the compiler threads count,
+			// so that batched pipeline creation compiles and links concurrently.
+			glLogCall( lock
+				, glMaxShaderCompilerThreads
+				, 0xFFFFFFFFu );
+		}
 	}
 
 	GLint Context::getBufferSize( ContextLock const & context
@@ -10,6 +10,8 @@ See LICENSE file in root folder
 #pragma warning( push )
 #pragma warning( disable: 5262 )
 #include <atomic>
+#include <condition_variable>
+#include <functional>
 #include <mutex>
 #include <thread>
 #pragma warning( pop )
@@ -17,6 +19,7 @@ See LICENSE file in root folder
 namespace ashes::gl
 {
 	class ContextLock;
+	class ContextShadow;
 
 	class Context
 	{
@@ -27,15 +30,25 @@ namespace ashes::gl
 			GlBufferTarget target;
 			GLsizeiptr size;
 			GlBufferDataUsageFlags flags;
+			// Non zero for immutable storage buffers.
+			gl4::GlMemoryPropertyFlags storageFlags;
 		};
 		using BufferAllocCont = std::vector< BufferAlloc >;
 
 		explicit Context( gl::ContextImplPtr impl );
 
 	public:
-		~Context()noexcept = default;
+		~Context()noexcept;
 
 		gl::ContextState & getState();
+		/**
+		*\brief
+		*	The shadow of the GL state, used to filter the commands replayed at submit time.
+		*/
+		gl::ContextShadow & getShadow()noexcept
+		{
+			return *m_shadow;
+		}
 
 #if VK_EXT_debug_utils
 		void submitDebugUtilsMessenger( VkDebugUtilsMessageSeverityFlagBitsEXT messageSeverity
@@ -52,12 +65,89 @@ namespace ashes::gl
 			, const char * pMessage );
 #endif
 
+		struct LockCounters
+		{
+			//! The context locks taken, nested ones excluded.
+			std::atomic< uint64_t > locks{};
+			//! The times the context was made current on a thread.
+			std::atomic< uint64_t > makeCurrents{};
+			//! The times the context was released from its thread.
+			std::atomic< uint64_t > releases{};
+			//! The times a thread had to ask for the context to be released from another thread.
+			std::atomic< uint64_t > handoffs{};
+		};
+
+	public:
+		/**
+		*\brief
+		*	Locks the context, and makes it current on the calling thread if it isn't already.
+		*\remarks
+		*	If the context is still current on another thread, it asks that thread to release it,
+		*	and waits for it.
+		*/
 		void lock();
+		/**
+		*\brief
+		*	Unlocks the context.
+		*\remarks
+		*	The context stays current on the calling thread if that thread is its sticky owner,
+		*	unless another thread asked for it.
+		*/
 		void unlock()noexcept;
+		/**
+		*\brief
+		*	Makes the calling thread, which holds the lock, the sticky owner of the context:
+		*	the context stays current on it after unlock, until another thread needs it.
+		*\param[in] releaseNotify
+		*	Called, from the requesting thread, when another thread needs the context.
+		*	The owner must then call releaseSticky() in a timely manner.
+		*/
+		void setStickyOwner( std::function< void() > releaseNotify );
+		/**
+		*\brief
+		*	Releases the context from the calling thread, if it's still current there and not locked.
+		*/
+		void releaseSticky()noexcept;
+		/**
+		*\brief
+		*	Gives the threads waiting in lock() the time to take the context, for at most a millisecond,
+		*	so that a thread that just released it doesn't lock it again before them.
+		*/
+		void waitLockWaiters()noexcept;
+
+		bool isReleaseRequested()const noexcept
+		{
+			return m_releaseRequested;
+		}
+		/**
+		*\return
+		*	\p true if threads are waiting in lock().
+		*/
+		bool hasLockWaiters()const noexcept
+		{
+			return m_lockWaiters.load() != 0u;
+		}
+
+		bool isCurrent()const noexcept
+		{
+			return m_currentThread == std::this_thread::get_id();
+		}
+
+		LockCounters & getLockCounters()noexcept
+		{
+			return m_lockCounters;
+		}
 
 		GLuint createBuffer( GlBufferTarget target
 			, GLsizeiptr size
 			, GlBufferDataUsageFlags flags );
+		/**
+		*\brief
+		*	Creates a buffer with immutable storage (ARB_buffer_storage).
+		*/
+		GLuint createStorageBuffer( GlBufferTarget target
+			, GLsizeiptr size
+			, gl4::GlMemoryPropertyFlags flags );
 		void deleteBuffer( GLuint buffer )noexcept;
 
 		void setOutOfMemory()
@@ -159,10 +249,15 @@ namespace ashes::gl
 			, GLuint buffer )noexcept;
 		GLint getBufferSize( ContextLock const & context
 			, GLuint buffer )noexcept;
+		GLuint doCreateBuffer( GlBufferTarget target
+			, GLsizeiptr size
+			, GlBufferDataUsageFlags flags
+			, gl4::GlMemoryPropertyFlags storageFlags );
 		BufferAllocCont::iterator findBuffer( GLuint buffer )noexcept;
 		BufferAllocCont::iterator findBuffer( GLuint buffer
 			, GLsizeiptr size )noexcept;
 		void checkOutOfMemory()const noexcept;
+		void doRelease()noexcept;
 
 	private:
 		gl::ContextImplPtr m_impl;
@@ -173,6 +268,15 @@ namespace ashes::gl
 		std::atomic< bool > m_enabled{ false };
 		std::atomic< std::thread::id > m_activeThread;
 		std::map< std::thread::id, std::unique_ptr< gl::ContextState > > m_state;
+		std::unique_ptr< gl::ContextShadow > m_shadow;
+		//! The thread the context is current on, even when it isn't locked.
+		std::atomic< std::thread::id > m_currentThread;
+		std::atomic< bool > m_releaseRequested{ false };
+		std::atomic< uint32_t > m_lockWaiters{};
+		std::condition_variable m_handoff;
+		std::thread::id m_stickyThread;
+		std::function< void() > m_releaseNotify;
+		LockCounters m_lockCounters;
 		BufferAllocCont m_buffers;
 		std::atomic< bool > m_outOfMemory{ false };
 	};
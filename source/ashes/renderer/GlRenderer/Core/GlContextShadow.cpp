@@ -0,0 +1,448 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#include "Core/GlContextShadow.hpp"
+
+#include "Core/GlContextLock.hpp"
+#include "Miscellaneous/GlDebug.hpp"
+#include "RenderPass/GlFrameBuffer.hpp"
+
+#include "ashesgl_api.hpp"
+
+#include <algorithm>
+#include <sstream>
+
+namespace ashes::gl
+{
+	namespace shadow
+	{
+		template< typename ValueT >
+		static bool update( Optional< ValueT > & current
+			, ValueT const & value )
+		{
+			if ( current && *current == value )
+			{
+				return true;
+			}
+
+			current = value;
+			return false;
+		}
+
+		template< typename ValueT >
+		static Optional< ValueT > & getIndexed( std::vector< Optional< ValueT > > & values
+			, uint32_t index )
+		{
+			if ( index >= values.size() )
+			{
+				values.resize( index + 1u );
+			}
+
+			return values[index];
+		}
+
+		template< typename ExpectedT, typename ActualT >
+		static uint64_t compare( char const * name
+			, Optional< ExpectedT > const & expected
+			, ActualT const & actual )
+		{
+			if ( !expected
+				|| *expected == ExpectedT( actual ) )
+			{
+				return 0u;
+			}
+
+			std::stringstream stream;
+			stream << "Shadowed GL state mismatch for " << name
+				<< ": expected " << *expected
+				<< ", got " << actual;
+			logError( stream.str().c_str() );
+			return 1u;
+		}
+	}
+
+	bool ContextShadow::filter( Command const & cmd )
+	{
+		switch ( cmd.op.type )
+		{
+		case OpType::eActiveTexture:
+			return shadow::update( m_activeTexture, map< OpType::eActiveTexture >( cmd ).binding );
+		case OpType::eApplyDepthRanges:
+		case OpType::eApplyViewport:
+			// Those also set the depth range of the first viewport.
+			m_depthRange = {};
+			return false;
+		case OpType::eBindFramebuffer:
+			{
+				auto & bind = map< OpType::eBindFramebuffer >( cmd );
+				return doFilterFramebuffer( bind.target
+					, ( bind.fbo
+						? GLuint( get( bind.fbo )->getInternal() )
+						: 0u ) );
+			}
+		case OpType::eBindSrcFramebuffer:
+		case OpType::eBindDstFramebuffer:
+		case OpType::eCleanupFramebuffer:
+			// The blit FBOs are created lazily, and deleting a bound FBO unbinds it.
+			m_drawFramebuffer = {};
+			m_readFramebuffer = {};
+			return false;
+		case OpType::eBindSampler:
+			{
+				auto & bind = map< OpType::eBindSampler >( cmd );
+				return doFilterSampler( bind.binding, bind.name );
+			}
+		case OpType::eBindSamplers:
+			{
+				auto & bind = map< OpType::eBindSamplers >( cmd );
+
+				for ( uint32_t i = 0u; i < bind.count; ++i )
+				{
+					shadow::getIndexed( m_samplers, bind.first + i ) = bind.names[i];
+				}
+
+				return false;
+			}
+		case OpType::eBindTexture:
+			{
+				auto & bind = map< OpType::eBindTexture >( cmd );
+				return doFilterTexture( bind.type, bind.name );
+			}
+		case OpType::eBindTextures:
+			{
+				// glBindTextures uses the textures own targets, which are unknown here.
+				auto & bind = map< OpType::eBindTextures >( cmd );
+				auto end = std::min( size_t( bind.first + bind.count ), m_textures.size() );
+
+				for ( size_t unit = bind.first; unit < end; ++unit )
+				{
+					m_textures[unit].clear();
+				}
+
+				return false;
+			}
+		case OpType::eBlendConstants:
+			{
+				auto & blend = map< OpType::eBlendConstants >( cmd );
+				return shadow::update( m_blendConstants
+					, { blend.blendConstant0, blend.blendConstant1, blend.blendConstant2, blend.blendConstant3 } );
+			}
+		case OpType::eBlendEquation:
+			{
+				auto & blend = map< OpType::eBlendEquation >( cmd );
+				return shadow::update( shadow::getIndexed( m_blendEquations, blend.index )
+					, { blend.color, blend.alpha } );
+			}
+		case OpType::eBlendFunc:
+			{
+				auto & blend = map< OpType::eBlendFunc >( cmd );
+				return shadow::update( shadow::getIndexed( m_blendFuncs, blend.index )
+					, { blend.colorSrc, blend.colorDst, blend.alphaSrc, blend.alphaDst } );
+			}
+		case OpType::eColorMask:
+			{
+				auto & mask = map< OpType::eColorMask >( cmd );
+				return shadow::update( shadow::getIndexed( m_colorMasks, mask.index )
+					, { mask.r, mask.g, mask.b, mask.a } );
+			}
+		case OpType::eClearDepth:
+		case OpType::eClearDepthStencil:
+		case OpType::eClearStencil:
+			// Those clears enable the depth writes.
+			m_depthMask = uint32_t( GL_TRUE );
+			return false;
+		case OpType::eCullFace:
+			return shadow::update( m_cullFace, map< OpType::eCullFace >( cmd ).value );
+		case OpType::eDepthFunc:
+			return shadow::update( m_depthFunc, map< OpType::eDepthFunc >( cmd ).value );
+		case OpType::eDepthMask:
+			return shadow::update( m_depthMask, map< OpType::eDepthMask >( cmd ).value );
+		case OpType::eDepthRange:
+			{
+				auto & range = map< OpType::eDepthRange >( cmd );
+				return shadow::update( m_depthRange, { range.min, range.max } );
+			}
+		case OpType::eDisable:
+			return doFilterCap( map< OpType::eDisable >( cmd ).value, false );
+		case OpType::eEnable:
+			return doFilterCap( map< OpType::eEnable >( cmd ).value, true );
+		case OpType::eFrontFace:
+			return shadow::update( m_frontFace, map< OpType::eFrontFace >( cmd ).value );
+		case OpType::eLineWidth:
+			return shadow::update( m_lineWidth, map< OpType::eLineWidth >( cmd ).value );
+		case OpType::eSetLineWidth:
+			return shadow::update( m_lineWidth, map< OpType::eSetLineWidth >( cmd ).width );
+		case OpType::eLogicOp:
+			return shadow::update( m_logicOp, map< OpType::eLogicOp >( cmd ).value );
+		case OpType::eMinSampleShading:
+			return shadow::update( m_minSampleShading, map< OpType::eMinSampleShading >( cmd ).value );
+		case OpType::ePatchParameter:
+			{
+				auto & patch = map< OpType::ePatchParameter >( cmd );
+				return patch.param == GL_PATCH_VERTICES
+					&& shadow::update( m_patchVertices, patch.value );
+			}
+		case OpType::ePixelStore:
+			{
+				auto & store = map< OpType::ePixelStore >( cmd );
+				return shadow::update( ( store.name == GL_PACK_ALIGNMENT
+						? m_packAlign
+						: m_unpackAlign )
+					, store.param );
+			}
+		case OpType::ePolygonMode:
+			return shadow::update( m_polygonMode, map< OpType::ePolygonMode >( cmd ).value );
+		case OpType::ePolygonOffset:
+			{
+				auto & offset = map< OpType::ePolygonOffset >( cmd );
+				return shadow::update( m_polygonOffset
+					, { offset.constantFactor, offset.clamp, offset.slopeFactor } );
+			}
+		case OpType::ePrimitiveRestartIndex:
+			return shadow::update( m_primitiveRestartIndex, map< OpType::ePrimitiveRestartIndex >( cmd ).index );
+		case OpType::eStencilFunc:
+			{
+				auto & func = map< OpType::eStencilFunc >( cmd );
+				return doFilterFaces( func.face
+					, m_stencilFuncs
+					, std::array< uint32_t, 3u >{ uint32_t( func.op ), func.ref, func.compMask } );
+			}
+		case OpType::eStencilMask:
+			{
+				auto & mask = map< OpType::eStencilMask >( cmd );
+				return doFilterFaces( mask.face
+					, m_stencilMasks
+					, mask.mask );
+			}
+		case OpType::eStencilOp:
+			{
+				auto & op = map< OpType::eStencilOp >( cmd );
+				return doFilterFaces( op.face
+					, m_stencilOps
+					, std::array< GlStencilOp, 3u >{ op.fail, op.depthFail, op.pass } );
+			}
+		case OpType::eUseProgram:
+			return shadow::update( m_program, GLuint( map< OpType::eUseProgram >( cmd ).program ) );
+		case OpType::eUseProgramPipeline:
+			return shadow::update( m_programPipeline, GLuint( map< OpType::eUseProgramPipeline >( cmd ).program ) );
+		case OpType::eDownloadMemory:
+		case OpType::eUploadMemory:
+			// Memory transfers bind the images textures, and set the pixel store.
+			m_textures.clear();
+			m_packAlign = {};
+			m_unpackAlign = {};
+			return false;
+		default:
+			return false;
+		}
+	}
+
+	void ContextShadow::invalidateBindings()noexcept
+	{
+		m_activeTexture = {};
+		m_textures.clear();
+		m_samplers.clear();
+		m_program = {};
+		m_programPipeline = {};
+		m_drawFramebuffer = {};
+		m_readFramebuffer = {};
+		m_packAlign = {};
+		m_unpackAlign = {};
+	}
+
+	void ContextShadow::invalidate()noexcept
+	{
+		invalidateBindings();
+		m_caps.clear();
+		m_blendConstants = {};
+		m_blendEquations.clear();
+		m_blendFuncs.clear();
+		m_colorMasks.clear();
+		m_depthMask = {};
+		m_depthFunc = {};
+		m_depthRange = {};
+		m_stencilFuncs = {};
+		m_stencilOps = {};
+		m_stencilMasks = {};
+		m_cullFace = {};
+		m_frontFace = {};
+		m_polygonMode = {};
+		m_polygonOffset = {};
+		m_lineWidth = {};
+		m_logicOp = {};
+		m_minSampleShading = {};
+		m_patchVertices = {};
+		m_primitiveRestartIndex = {};
+	}
+
+	void ContextShadow::check( ContextLock const & context )
+	{
+		uint64_t mismatches{};
+
+		for ( auto const & [cap, enabled] : m_caps )
+		{
+			mismatches += shadow::compare( getName( cap ).c_str()
+				, Optional< bool >{ enabled }
+				, context->glIsEnabled( cap ) != GL_FALSE );
+		}
+
+		GLint value{};
+		float fvalue{};
+		mismatches += shadow::compare( "GL_DEPTH_WRITEMASK"
+			, m_depthMask
+			, context.getValue( GL_VALUE_NAME_DEPTH_WRITEMASK, value ) );
+		mismatches += shadow::compare( "GL_DEPTH_FUNC"
+			, m_depthFunc
+			, context.getValue( GL_VALUE_NAME_DEPTH_FUNC, value ) );
+		mismatches += shadow::compare( "GL_CULL_FACE_MODE"
+			, m_cullFace
+			, context.getValue( GL_VALUE_NAME_CULL_FACE_MODE, value ) );
+		mismatches += shadow::compare( "GL_FRONT_FACE"
+			, m_frontFace
+			, context.getValue( GL_VALUE_NAME_FRONT_FACE, value ) );
+		mismatches += shadow::compare( "GL_LINE_WIDTH"
+			, m_lineWidth
+			, context.getValue( GL_VALUE_NAME_LINE_WIDTH, fvalue ) );
+		mismatches += shadow::compare( "GL_ACTIVE_TEXTURE"
+			, m_activeTexture
+			, context.getValue( GL_VALUE_NAME_ACTIVE_TEXTURE, value ) - GLint( GL_TEXTURE0 ) );
+		mismatches += shadow::compare( "GL_CURRENT_PROGRAM"
+			, m_program
+			, context.getValue( GL_VALUE_NAME_CURRENT_PROGRAM, value ) );
+
+		if ( m_programPipeline )
+		{
+			mismatches += shadow::compare( "GL_PROGRAM_PIPELINE_BINDING"
+				, m_programPipeline
+				, context.getValue( GL_VALUE_NAME_PROGRAM_PIPELINE_BINDING, value ) );
+		}
+
+		mismatches += shadow::compare( "GL_DRAW_FRAMEBUFFER_BINDING"
+			, m_drawFramebuffer
+			, context.getValue( GL_VALUE_NAME_DRAW_FRAMEBUFFER_BINDING, value ) );
+		mismatches += shadow::compare( "GL_READ_FRAMEBUFFER_BINDING"
+			, m_readFramebuffer
+			, context.getValue( GL_VALUE_NAME_READ_FRAMEBUFFER_BINDING, value ) );
+		mismatches += shadow::compare( "GL_PACK_ALIGNMENT"
+			, m_packAlign
+			, context.getValue( GL_VALUE_NAME_PACK_ALIGNMENT, value ) );
+		mismatches += shadow::compare( "GL_UNPACK_ALIGNMENT"
+			, m_unpackAlign
+			, context.getValue( GL_VALUE_NAME_UNPACK_ALIGNMENT, value ) );
+
+		if ( mismatches )
+		{
+			m_counters.mismatches += mismatches;
+			invalidate();
+		}
+	}
+
+	bool ContextShadow::doFilterCap( GlTweak cap
+		, bool enabled )
+	{
+		auto it = std::find_if( m_caps.begin()
+			, m_caps.end()
+			, [cap]( std::pair< GlTweak, bool > const & lookup )
+			{
+				return lookup.first == cap;
+			} );
+
+		if ( it == m_caps.end() )
+		{
+			m_caps.emplace_back( cap, enabled );
+			return false;
+		}
+
+		if ( it->second == enabled )
+		{
+			return true;
+		}
+
+		it->second = enabled;
+		return false;
+	}
+
+	bool ContextShadow::doFilterTexture( GlTextureType type
+		, GLuint name )
+	{
+		if ( !m_activeTexture )
+		{
+			// The binding would go to an unknown unit.
+			return false;
+		}
+
+		auto unit = *m_activeTexture;
+
+		if ( unit >= m_textures.size() )
+		{
+			m_textures.resize( unit + 1u );
+		}
+
+		auto & bindings = m_textures[unit];
+		auto it = std::find_if( bindings.begin()
+			, bindings.end()
+			, [type]( std::pair< GlTextureType, GLuint > const & lookup )
+			{
+				return lookup.first == type;
+			} );
+
+		if ( it == bindings.end() )
+		{
+			bindings.emplace_back( type, name );
+			return false;
+		}
+
+		if ( it->second == name )
+		{
+			return true;
+		}
+
+		it->second = name;
+		return false;
+	}
+
+	bool ContextShadow::doFilterSampler( uint32_t unit
+		, GLuint name )
+	{
+		return shadow::update( shadow::getIndexed( m_samplers, unit ), name );
+	}
+
+	bool ContextShadow::doFilterFramebuffer( GlFrameBufferTarget target
+		, GLuint name )
+	{
+		switch ( target )
+		{
+		case GL_READ_FRAMEBUFFER:
+			return shadow::update( m_readFramebuffer, name );
+		case GL_DRAW_FRAMEBUFFER:
+			return shadow::update( m_drawFramebuffer, name );
+		default:
+			{
+				auto draw = shadow::update( m_drawFramebuffer, name );
+				auto read = shadow::update( m_readFramebuffer, name );
+				return draw && read;
+			}
+		}
+	}
+
+	template< typename ValueT >
+	bool ContextShadow::doFilterFaces( GlCullMode face
+		, std::array< Optional< ValueT >, 2u > & values
+		, ValueT const & value )
+	{
+		bool result = true;
+
+		if ( face != GL_CULL_MODE_BACK )
+		{
+			result = shadow::update( values[0], value ) && result;
+		}
+
+		if ( face != GL_CULL_MODE_FRONT )
+		{
+			result = shadow::update( values[1], value ) && result;
+		}
+
+		return result;
+	}
+}
@@ -0,0 +1,117 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "renderer/GlRenderer/Command/Commands/GlCommandBase.hpp"
+
+#include <atomic>
+
+namespace ashes::gl
+{
+	/**
+	*\brief
+	*	A shadow of the live OpenGL state of a context, used at submit time to skip
+	*	the commands that wouldn't change it.
+	*\remarks
+	*	The render state (enables, blend, depth, stencil, rasterisation) is only changed
+	*	through the queue, so it is kept from one submit to the next.
+	*	The bindings (textures, samplers, programs, framebuffers) and the pixel store
+	*	are also changed by resources creation and uploads, so they are only trusted
+	*	inside a submit.
+	*	An unknown value never filters anything.
+	*/
+	class ContextShadow
+	{
+	public:
+		struct Counters
+		{
+			//! The commands replayed at submit time.
+			std::atomic< uint64_t > replayed{};
+			//! The commands skipped, since they matched the shadowed state.
+			std::atomic< uint64_t > skipped{};
+			//! The differences found between the shadow and the GL state, in check mode.
+			std::atomic< uint64_t > mismatches{};
+		};
+
+	public:
+		/**
+		*\brief
+		*	Tells if the given command would leave the state unchanged.
+		*	If not, the shadow is updated with its effect, since the command is about to be applied.
+		*/
+		bool filter( Command const & cmd );
+		/**
+		*\brief
+		*	Forgets the bindings and the pixel store.
+		*/
+		void invalidateBindings()noexcept;
+		/**
+		*\brief
+		*	Forgets everything.
+		*/
+		void invalidate()noexcept;
+		/**
+		*\brief
+		*	Compares the known values to the ones retrieved through glGet*.
+		*	The mismatches are logged, and the shadow is then dropped.
+		*/
+		void check( ContextLock const & context );
+
+		Counters & getCounters()noexcept
+		{
+			return m_counters;
+		}
+
+	private:
+		using TextureBindings = std::vector< std::pair< GlTextureType, GLuint > >;
+
+		bool doFilterCap( GlTweak cap
+			, bool enabled );
+		bool doFilterTexture( GlTextureType type
+			, GLuint name );
+		bool doFilterSampler( uint32_t unit
+			, GLuint name );
+		bool doFilterFramebuffer( GlFrameBufferTarget target
+			, GLuint name );
+		template< typename ValueT >
+		bool doFilterFaces( GlCullMode face
+			, std::array< Optional< ValueT >, 2u > & values
+			, ValueT const & value );
+
+	private:
+		// Render state.
+		std::vector< std::pair< GlTweak, bool > > m_caps;
+		Optional< std::array< float, 4u > > m_blendConstants;
+		std::vector< Optional< std::array< GlBlendOp, 2u > > > m_blendEquations;
+		std::vector< Optional< std::array< GlBlendFactor, 4u > > > m_blendFuncs;
+		std::vector< Optional< std::array< GLboolean, 4u > > > m_colorMasks;
+		Optional< uint32_t > m_depthMask;
+		Optional< GlCompareOp > m_depthFunc;
+		Optional< std::array< float, 2u > > m_depthRange;
+		std::array< Optional< std::array< uint32_t, 3u > >, 2u > m_stencilFuncs;
+		std::array< Optional< std::array< GlStencilOp, 3u > >, 2u > m_stencilOps;
+		std::array< Optional< uint32_t >, 2u > m_stencilMasks;
+		Optional< GlCullMode > m_cullFace;
+		Optional< GlFrontFace > m_frontFace;
+		Optional< GlPolygonMode > m_polygonMode;
+		Optional< std::array< float, 3u > > m_polygonOffset;
+		Optional< float > m_lineWidth;
+		Optional< GlLogicOp > m_logicOp;
+		Optional< float > m_minSampleShading;
+		Optional< int > m_patchVertices;
+		Optional< uint32_t > m_primitiveRestartIndex;
+		// Bindings.
+		Optional< uint32_t > m_activeTexture;
+		std::vector< TextureBindings > m_textures;
+		std::vector< Optional< GLuint > > m_samplers;
+		Optional< GLuint > m_program;
+		Optional< GLuint > m_programPipeline;
+		Optional< GLuint > m_drawFramebuffer;
+		Optional< GLuint > m_readFramebuffer;
+		Optional< int32_t > m_packAlign;
+		Optional< int32_t > m_unpackAlign;
+		Counters m_counters;
+	};
+}
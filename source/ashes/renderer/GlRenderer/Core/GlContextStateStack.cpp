@@ -29,11 +29,11 @@ namespace ashes::gl
 		{
 			if ( enable )
 			{
-				list.emplace_back( makeCmd< OpType::eEnable >( GlTweak( value ) ) );
+				list.emplace< OpType::eEnable >( GlTweak( value ) );
 			}
 			else
 			{
-				list.emplace_back( makeCmd< OpType::eDisable >( GlTweak( value ) ) );
+				list.emplace< OpType::eDisable >( GlTweak( value ) );
 			}
 
 			return enable;
@@ -60,11 +60,11 @@ namespace ashes::gl
 		{
 			if ( state.logicOpEnable )
 			{
-				list.emplace_back( makeCmd< OpType::eLogicOp >( convert( state.logicOp ) ) );
+				list.emplace< OpType::eLogicOp >( convert( state.logicOp ) );
 			}
 			else
 			{
-				list.emplace_back( makeCmd< OpType::eLogicOp >( GL_LOGIC_OP_COPY ) );
+				list.emplace< OpType::eLogicOp >( GL_LOGIC_OP_COPY );
 			}
 		}
 
@@ -72,10 +72,10 @@ namespace ashes::gl
 			, VkPipelineColorBlendStateCreateInfo const & state )
 		{
 			auto & blendConstants = state.blendConstants;
-			list.emplace_back( makeCmd< OpType::eBlendConstants >( blendConstants[0]
+			list.emplace< OpType::eBlendConstants >( blendConstants[0]
 				, blendConstants[1]
 				, blendConstants[2]
-				, blendConstants[3] ) );
+				, blendConstants[3] );
 		}
 
 		static bool doApplyBlendAttach( CmdList & list
@@ -85,19 +85,19 @@ namespace ashes::gl
 		{
 			if ( state.blendEnable || force )
 			{
-				list.emplace_back( makeCmd< OpType::eBlendEquation >( index
+				list.emplace< OpType::eBlendEquation >( index
 					, convert( state.colorBlendOp )
-					, convert( state.alphaBlendOp ) ) );
-				list.emplace_back( makeCmd< OpType::eBlendFunc >( index
+					, convert( state.alphaBlendOp ) );
+				list.emplace< OpType::eBlendFunc >( index
 					, convert( state.srcColorBlendFactor )
 					, convert( state.dstColorBlendFactor )
 					, convert( state.srcAlphaBlendFactor )
-					, convert( state.dstAlphaBlendFactor ) ) );
-				list.emplace_back( makeCmd< OpType::eColorMask >( index
+					, convert( state.dstAlphaBlendFactor ) );
+				list.emplace< OpType::eColorMask >( index
 					, checkFlag( state.colorWriteMask, VK_COLOR_COMPONENT_R_BIT )
 					, checkFlag( state.colorWriteMask, VK_COLOR_COMPONENT_G_BIT )
 					, checkFlag( state.colorWriteMask, VK_COLOR_COMPONENT_B_BIT )
-					, checkFlag( state.colorWriteMask, VK_COLOR_COMPONENT_A_BIT ) ) );
+					, checkFlag( state.colorWriteMask, VK_COLOR_COMPONENT_A_BIT ) );
 			}
 
 			return state.blendEnable != 0;
@@ -131,7 +131,7 @@ namespace ashes::gl
 		static void doApplyPolygonMode( CmdList & list
 			, VkPipelineRasterizationStateCreateInfo const & state )
 		{
-			list.emplace_back( makeCmd< OpType::ePolygonMode >( convert( state.polygonMode ) ) );
+			list.emplace< OpType::ePolygonMode >( convert( state.polygonMode ) );
 		}
 
 		static void doApplyLineWidth( CmdList & list
@@ -143,7 +143,7 @@ namespace ashes::gl
 					, dynamicState.pDynamicStates + dynamicState.dynamicStateCount
 					, VK_DYNAMIC_STATE_LINE_WIDTH ) )
 			{
-				list.emplace_back( makeCmd< OpType::eLineWidth >( rasterState.lineWidth ) );
+				list.emplace< OpType::eLineWidth >( rasterState.lineWidth );
 			}
 		}
 
@@ -182,9 +182,9 @@ namespace ashes::gl
 				, dynamicState.pDynamicStates + dynamicState.dynamicStateCount
 				, VK_DYNAMIC_STATE_DEPTH_BIAS ) )
 			{
-				list.emplace_back( makeCmd< OpType::ePolygonOffset >( rasterState.depthBiasConstantFactor
+				list.emplace< OpType::ePolygonOffset >( rasterState.depthBiasConstantFactor
 					, rasterState.depthBiasClamp
-					, rasterState.depthBiasSlopeFactor ) );
+					, rasterState.depthBiasSlopeFactor );
 			}
 		}
 
@@ -227,7 +227,7 @@ namespace ashes::gl
 				, GL_SAMPLE_SHADING
 				, state.sampleShadingEnable != 0 ) )
 			{
-				list.emplace_back( makeCmd< OpType::eMinSampleShading >( state.minSampleShading ) );
+				list.emplace< OpType::eMinSampleShading >( state.minSampleShading );
 			}
 		}
 
@@ -242,7 +242,7 @@ namespace ashes::gl
 		static void doApplyDepthWrite( CmdList & list
 			, VkPipelineDepthStencilStateCreateInfo const & state )
 		{
-			list.emplace_back( makeCmd< OpType::eDepthMask >( uint32_t( state.depthWriteEnable ? GL_TRUE : GL_FALSE ) ) );
+			list.emplace< OpType::eDepthMask >( uint32_t( state.depthWriteEnable ? GL_TRUE : GL_FALSE ) );
 		}
 
 		static void doApplyDepthTest( CmdList & list
@@ -252,7 +252,7 @@ namespace ashes::gl
 				, GL_DEPTH_TEST
 				, state.depthTestEnable != 0 ) )
 			{
-				list.emplace_back( makeCmd< OpType::eDepthFunc >( convert( state.depthCompareOp ) ) );
+				list.emplace< OpType::eDepthFunc >( convert( state.depthCompareOp ) );
 			}
 		}
 
@@ -261,8 +261,8 @@ namespace ashes::gl
 			, uint32_t & save
 			, GlCullMode face )
 		{
-			list.emplace_back( makeCmd< OpType::eStencilMask >( face
-				, state ) );
+			list.emplace< OpType::eStencilMask >( face
+				, state );
 			save = state;
 		}
 
@@ -302,9 +302,9 @@ namespace ashes::gl
 				assert( false && "Unsupported polygon mode." );
 				break;
 			}
-			list.emplace_back( makeCmd< OpType::ePolygonOffset >( newConstantFactor
+			list.emplace< OpType::ePolygonOffset >( newConstantFactor
 				, newClamp
-				, newSlopeFactor ) );
+				, newSlopeFactor );
 			saveEnable = newEnable;
 			saveConstantFactor = newConstantFactor;
 			saveClamp = newClamp;
@@ -320,10 +320,10 @@ namespace ashes::gl
 			, uint32_t & saveCompareMask
 			, GlCullMode face )
 		{
-			list.emplace_back( makeCmd< OpType::eStencilFunc >( face
+			list.emplace< OpType::eStencilFunc >( face
 				, convert( newCompareOp )
 				, newReference
-				, newCompareMask ) );
+				, newCompareMask );
 			saveCompareOp = newCompareOp;
 			saveReference = newReference;
 			saveCompareMask = newCompareMask;
@@ -338,10 +338,10 @@ namespace ashes::gl
 			, VkStencilOp & savePassOp
 			, GlCullMode face )
 		{
-			list.emplace_back( makeCmd< OpType::eStencilOp >( face
+			list.emplace< OpType::eStencilOp >( face
 				, convert( newFailOp )
 				, convert( newDepthFailOp )
-				, convert( newPassOp ) ) );
+				, convert( newPassOp ) );
 			saveFailOp = newFailOp;
 			saveDepthFailOp = newDepthFailOp;
 			savePassOp = newPassOp;
@@ -395,8 +395,8 @@ namespace ashes::gl
 				, state.depthBoundsTestEnable
 				&& ( state.minDepthBounds != 0.0f || state.maxDepthBounds != 0.0f ) ) )
 			{
-				list.emplace_back( makeCmd< OpType::eDepthRange >( state.minDepthBounds
-					, state.maxDepthBounds ) );
+				list.emplace< OpType::eDepthRange >( state.minDepthBounds
+					, state.maxDepthBounds );
 			}
 		}
 
@@ -405,8 +405,8 @@ namespace ashes::gl
 		{
 			if ( state.patchControlPoints )
 			{
-				list.emplace_back( makeCmd< OpType::ePatchParameter >( GL_PATCH_VERTICES
-					, int( state.patchControlPoints ) ) );
+				list.emplace< OpType::ePatchParameter >( GL_PATCH_VERTICES
+					, int( state.patchControlPoints ) );
 			}
 		}
 
@@ -529,7 +529,7 @@ namespace ashes::gl
 		doCheckSave( &context->getState() );
 		CmdList list;
 		apply( list, state, true );
-		applyList( context, list );
+		applyBuffer( context, list );
 	}
 
 	void ContextStateStack::apply( CmdList & list
@@ -567,86 +567,61 @@ namespace ashes::gl
 				{
 					if ( m_renderArea == VkExtent2D{ ~0u, ~0u } )
 					{
-						auto index = list.size();
-						list.push_back( makeCmd< OpType::eApplyViewports >( firstViewport
+						auto & cmd = list.emplace< OpType::eApplyViewports >( firstViewport
 							, uint32_t( viewports.size() )
-							, viewports ) );
-						preExecuteActions.emplace_back( [index]( CmdList & plist
+							, viewports );
+						preExecuteActions.emplace_back( [pCmd = &cmd]( CmdList &
 							, ContextStateStack const & stack )
 							{
-								Command * pCmd = nullptr;
-								auto it = plist[index].begin();
-
-								if ( map( it, plist[index].end(), pCmd ) )
-								{
-									assert( pCmd->op.type == OpType::eApplyViewports );
-									CmdApplyViewports & oldCmd = map< OpType::eApplyViewports >( *pCmd );
-									ctxt::adjust( ashes::makeArrayView( reinterpret_cast< ctxt::MocVkViewport * >( oldCmd.viewports.data() )
-										, reinterpret_cast< ctxt::MocVkViewport * >( oldCmd.viewports.data() ) + oldCmd.count )
-										, stack.m_renderArea );
-								}
+								CmdApplyViewports & oldCmd = *pCmd;
+								ctxt::adjust( ashes::makeArrayView( reinterpret_cast< ctxt::MocVkViewport * >( oldCmd.viewports.data() )
+									, reinterpret_cast< ctxt::MocVkViewport * >( oldCmd.viewports.data() ) + oldCmd.count )
+									, stack.m_renderArea );
 							} );
 					}
 					else
 					{
-						list.push_back( makeCmd< OpType::eApplyViewports >( firstViewport
+						list.emplace< OpType::eApplyViewports >( firstViewport
 							, uint32_t( viewports.size() )
-							, ctxt::adjust( viewports, m_renderArea ) ) );
+							, ctxt::adjust( viewports, m_renderArea ) );
 					}
 
-					list.push_back( makeCmd< OpType::eApplyDepthRanges >( firstViewport
+					list.emplace< OpType::eApplyDepthRanges >( firstViewport
 						, uint32_t( viewports.size() )
-						, viewports ) );
+						, viewports );
 				}
 				else if ( m_renderArea == VkExtent2D{ ~0u, ~0u } )
 				{
-					auto index = list.size();
-					list.push_back( makeCmd< OpType::eApplyViewport >( viewports.front() ) );
-					preExecuteActions.emplace_back( [index]( CmdList & plist
+					auto & cmd = list.emplace< OpType::eApplyViewport >( viewports.front() );
+					preExecuteActions.emplace_back( [pCmd = &cmd]( CmdList &
 						, ContextStateStack const & stack )
 						{
-							Command * pCmd = nullptr;
-							auto it = plist[index].begin();
-
-							if ( map( it, plist[index].end(), pCmd ) )
-							{
-								assert( pCmd->op.type == OpType::eApplyViewport );
-								CmdApplyViewport const & oldCmd = map< OpType::eApplyViewport >( *pCmd );
-								ctxt::adjust( oldCmd.viewport, stack.m_renderArea );
-							}
+							CmdApplyViewport const & oldCmd = *pCmd;
+							ctxt::adjust( oldCmd.viewport, stack.m_renderArea );
 						} );
 				}
 				else
 				{
-					list.push_back( makeCmd< OpType::eApplyViewport >( ctxt::adjust( viewports.front(), m_renderArea ) ) );
+					list.emplace< OpType::eApplyViewport >( ctxt::adjust( viewports.front(), m_renderArea ) );
 				}
 			}
 			else if ( m_renderArea == VkExtent2D{ ~0u, ~0u } )
 			{
-				auto index = list.size();
-				list.push_back( makeCmd< OpType::eApplyViewport >( VkViewport{ 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f } ) );
-				preExecuteActions.emplace_back( [index]( CmdList & plist
+				auto & cmd = list.emplace< OpType::eApplyViewport >( VkViewport{ 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f } );
+				preExecuteActions.emplace_back( [pCmd = &cmd]( CmdList &
 					, ContextStateStack const & stack )
 					{
-						Command * pCmd = nullptr;
-						auto it = plist[index].begin();
-
-						if ( map( it, plist[index].end(), pCmd ) )
+						pCmd->viewport = VkViewport
 						{
-							assert( pCmd->op.type == OpType::eApplyViewport );
-							CmdApplyViewport & oldCmd = map< OpType::eApplyViewport >( *pCmd );
-							oldCmd.viewport = VkViewport
-							{
-								0.0f, 0.0f,
-								float( stack.m_renderArea.width ), float( stack.m_renderArea.height ),
-								0.0f, 1.0f
-							};
-						}
+							0.0f, 0.0f,
+							float( stack.m_renderArea.width ), float( stack.m_renderArea.height ),
+							0.0f, 1.0f
+						};
 					} );
 			}
 			else
 			{
-				list.push_back( makeCmd< OpType::eApplyViewport >( VkViewport{ 0.0f, 0.0f, float( m_renderArea.width ), float( m_renderArea.height ), 0.0f, 1.0f } ) );
+				list.emplace< OpType::eApplyViewport >( VkViewport{ 0.0f, 0.0f, float( m_renderArea.width ), float( m_renderArea.height ), 0.0f, 1.0f } );
 			}
 
 			setCurrentViewports( viewports );
@@ -673,100 +648,74 @@ namespace ashes::gl
 				{
 					if ( m_renderArea == VkExtent2D{ ~0u, ~0u } )
 					{
-						auto index = list.size();
-						list.push_back( makeCmd< OpType::eApplyScissors >( firstScissor
+						auto & cmd = list.emplace< OpType::eApplyScissors >( firstScissor
 							, uint32_t( scissors.size() )
-							, scissors ) );
-						preExecuteActions.emplace_back( [index]( CmdList & plist
+							, scissors );
+						preExecuteActions.emplace_back( [pCmd = &cmd]( CmdList &
 							, ContextStateStack const & stack )
 							{
 								if ( stack.isRtot() )
 								{
-									Command * pCmd = nullptr;
-									auto it = plist[index].begin();
-
-									if ( map( it, plist[index].end(), pCmd ) )
-									{
-										assert( pCmd->op.type == OpType::eApplyScissors );
-										CmdApplyScissors & oldCmd = map< OpType::eApplyScissors >( *pCmd );
-										ctxt::adjust( ashes::makeArrayView( reinterpret_cast< ctxt::MocVkScissor * >( oldCmd.scissors.data() )
-											, reinterpret_cast< ctxt::MocVkScissor * >( oldCmd.scissors.data() ) + oldCmd.count )
-											, stack.m_renderArea );
-									}
+									CmdApplyScissors & oldCmd = *pCmd;
+									ctxt::adjust( ashes::makeArrayView( reinterpret_cast< ctxt::MocVkScissor * >( oldCmd.scissors.data() )
+										, reinterpret_cast< ctxt::MocVkScissor * >( oldCmd.scissors.data() ) + oldCmd.count )
+										, stack.m_renderArea );
 								}
 							} );
 					}
 					else if ( isRtot() )
 					{
-						list.push_back( makeCmd< OpType::eApplyScissors >( firstScissor
+						list.emplace< OpType::eApplyScissors >( firstScissor
 							, uint32_t( scissors.size() )
-							, ctxt::adjust( scissors, m_renderArea ) ) );
+							, ctxt::adjust( scissors, m_renderArea ) );
 					}
 					else
 					{
-						list.push_back( makeCmd< OpType::eApplyScissors >( firstScissor
+						list.emplace< OpType::eApplyScissors >( firstScissor
 							, uint32_t( scissors.size() )
-							, scissors ) );
+							, scissors );
 					}
 				}
 				else if ( m_renderArea == VkExtent2D{ ~0u, ~0u } )
 				{
-					auto index = list.size();
-					list.push_back( makeCmd< OpType::eApplyScissor >( VkRect2D{} ) );
-					preExecuteActions.emplace_back( [index]( CmdList & plist
+					auto & cmd = list.emplace< OpType::eApplyScissor >( VkRect2D{} );
+					preExecuteActions.emplace_back( [pCmd = &cmd]( CmdList &
 						, ContextStateStack const & stack )
 						{
 							if ( stack.isRtot() )
 							{
-								Command * pCmd = nullptr;
-								auto it = plist[index].begin();
-
-								if ( map( it, plist[index].end(), pCmd ) )
+								pCmd->scissor = VkRect2D
 								{
-									assert( pCmd->op.type == OpType::eApplyScissor );
-									CmdApplyScissor & oldCmd = map< OpType::eApplyScissor >( *pCmd );
-									oldCmd.scissor = VkRect2D
-									{
-										{ 0, 0 },
-										{ stack.m_renderArea.width, stack.m_renderArea.height },
-									};
-								}
+									{ 0, 0 },
+									{ stack.m_renderArea.width, stack.m_renderArea.height },
+								};
 							}
 						} );
 				}
 				else if ( isRtot() )
 				{
-					list.push_back( makeCmd< OpType::eApplyScissor >( ctxt::adjust( scissors.front(), m_renderArea ) ) );
+					list.emplace< OpType::eApplyScissor >( ctxt::adjust( scissors.front(), m_renderArea ) );
 				}
 				else
 				{
-					list.push_back( makeCmd< OpType::eApplyScissor >( scissors.front() ) );
+					list.emplace< OpType::eApplyScissor >( scissors.front() );
 				}
 			}
 			else if ( m_renderArea == VkExtent2D{ ~0u, ~0u } )
 			{
-				auto index = list.size();
-				list.push_back( makeCmd< OpType::eApplyScissor >( VkRect2D{ {}, {} } ) );
-				preExecuteActions.emplace_back( [index]( CmdList & plist
+				auto & cmd = list.emplace< OpType::eApplyScissor >( VkRect2D{ {}, {} } );
+				preExecuteActions.emplace_back( [pCmd = &cmd]( CmdList &
 					, ContextStateStack const & stack )
 					{
 						if ( stack.isRtot() )
 						{
-							Command * pCmd = nullptr;
-							auto it = plist[index].begin();
-
-							if ( map( it, plist[index].end(), pCmd ) )
-							{
-								assert( pCmd->op.type == OpType::eApplyScissor );
-								CmdApplyScissor oldCmd = map< OpType::eApplyScissor >( *pCmd );
-								oldCmd.scissor = VkRect2D{ { 0, 0 }, stack.m_renderArea };
-							}
+							pCmd->scissor = VkRect2D{ { 0, 0 }, stack.m_renderArea };
 						}
 					} );
 			}
 			else
 			{
-				list.push_back( makeCmd< OpType::eApplyScissor >( VkRect2D{ {}, m_renderArea } ) );
+				list.emplace< OpType::eApplyScissor >( VkRect2D{ {}, m_renderArea } );
 			}
 
 			setCurrentScissors( scissors );
@@ -782,11 +731,11 @@ namespace ashes::gl
 		{
 			if ( enable )
 			{
-				list.push_back( makeCmd< OpType::eEnable >( GL_FRAMEBUFFER_SRGB ) );
+				list.emplace< OpType::eEnable >( GL_FRAMEBUFFER_SRGB );
 			}
 			else
 			{
-				list.push_back( makeCmd< OpType::eDisable >( GL_FRAMEBUFFER_SRGB ) );
+				list.emplace< OpType::eDisable >( GL_FRAMEBUFFER_SRGB );
 			}
 
 			m_save->sRGB = enable;
@@ -800,7 +749,7 @@ namespace ashes::gl
 
 		if ( align != m_save->packAlign )
 		{
-			list.push_back( makeCmd< OpType::ePixelStore >( GL_PACK_ALIGNMENT, align ) );
+			list.emplace< OpType::ePixelStore >( GL_PACK_ALIGNMENT, align );
 			m_save->packAlign = align;
 		}
 	}
@@ -812,7 +761,7 @@ namespace ashes::gl
 
 		if ( align != m_save->unpackAlign )
 		{
-			list.push_back( makeCmd< OpType::ePixelStore >( GL_UNPACK_ALIGNMENT, align ) );
+			list.emplace< OpType::ePixelStore >( GL_UNPACK_ALIGNMENT, align );
 			m_save->unpackAlign = align;
 		}
 	}
@@ -1007,12 +956,12 @@ namespace ashes::gl
 		if ( ( force || newState.cullMode != save.cullMode )
 			&& enableCulling )
 		{
-			list.emplace_back( makeCmd< OpType::eCullFace >( mode ) );
+			list.emplace< OpType::eCullFace >( mode );
 		}
 
 		if ( force || newState.frontFace != save.frontFace )
 		{
-			list.emplace_back( makeCmd< OpType::eFrontFace >( convert( newState.frontFace ) ) );
+			list.emplace< OpType::eFrontFace >( convert( newState.frontFace ) );
 		}
 
 		if ( force || newState.polygonMode != save.polygonMode )
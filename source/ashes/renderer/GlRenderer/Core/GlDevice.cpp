@@ -22,6 +22,7 @@ See LICENSE file in root folder.
 #include "Miscellaneous/GlDeviceMemory.hpp"
 #include "Miscellaneous/GlDummyIndexBuffer.hpp"
 #include "Miscellaneous/GlQueryPool.hpp"
+#include "Miscellaneous/GlWorkerPool.hpp"
 #include "Pipeline/GlPipelineLayout.hpp"
 #include "RenderPass/GlFrameBuffer.hpp"
 #include "RenderPass/GlRenderPass.hpp"
@@ -264,12 +265,38 @@ namespace ashes::gl
 			, m_enabledFeatures );
 		doInitialiseQueues();
 		doInitialiseContextDependent();
+
+		if ( hasVertexAttribBinding( m_physicalDevice ) )
+		{
+			m_vertexArrayCache = std::make_unique< VertexArrayCache >( get( this ) );
+		}
 	}
 
 	Device::~Device()noexcept
 	{
 		if ( m_currentContext )
 		{
+			// The submission threads need the context to finish their work.
+			drainQueues();
+			auto & counters = m_currentContext->getLockCounters();
+			reportInfo( get( this )
+				, VK_SUCCESS
+				, "Context locks"
+				, ( "locks: " + std::to_string( counters.locks.load() )
+					+ ", make current: " + std::to_string( counters.makeCurrents.load() )
+					+ ", releases: " + std::to_string( counters.releases.load() )
+					+ ", handoffs: " + std::to_string( counters.handoffs.load() ) ) );
+			reportInfo( get( this )
+				, VK_SUCCESS
+				, "Mapped uploads"
+				, ( "requested bytes: " + std::to_string( m_mappedUploads.requested.load() )
+					+ ", uploaded bytes: " + std::to_string( m_mappedUploads.uploaded.load() ) ) );
+			reportInfo( get( this )
+				, VK_SUCCESS
+				, "Descriptor binds"
+				, ( "requested: " + std::to_string( m_descriptorBinds.requested.load() )
+					+ ", skipped: " + std::to_string( m_descriptorBinds.skipped.load() )
+					+ ", recorded: " + std::to_string( m_descriptorBinds.recorded.load() ) ) );
 			auto context = getContext();
 
 			for ( auto const & [_, creates] : m_queues )
@@ -281,6 +308,7 @@ namespace ashes::gl
 			}
 
 			doCleanupContextDependent();
+			m_vertexArrayCache.reset();
 
 			if ( m_dummyIndexed.indexMemory )
 			{
@@ -371,6 +399,7 @@ namespace ashes::gl
 	{
 		if ( m_currentContext )
 		{
+			drainQueues();
 			auto context = getContext();
 			glLogEmptyCall( context
 				, glFinish );
@@ -591,6 +620,22 @@ namespace ashes::gl
 		return ContextLock{ *m_currentContext, get( this ) };
 	}
 
+	WorkerPool & Device::getWorkerPool()const
+	{
+		std::lock_guard< std::mutex > lock{ m_workerPoolMutex };
+
+		if ( !m_workerPool )
+		{
+			// The calling thread takes part in the work, hence the - 1.
+			auto threadCount = std::thread::hardware_concurrency();
+			m_workerPool = std::make_unique< WorkerPool >( threadCount > 1u
+				? threadCount - 1u
+				: 0u );
+		}
+
+		return *m_workerPool;
+	}
+
 	void Device::doInitialiseQueues()
 	{
 		for ( auto itQueue = m_createInfos.pQueueCreateInfos;
@@ -611,6 +656,28 @@ namespace ashes::gl
 		}
 	}
 
+	void Device::drainQueues()const
+	{
+		for ( auto const & [_, creates] : m_queues )
+		{
+			for ( auto queue : creates.queues )
+			{
+				get( queue )->drain();
+			}
+		}
+	}
+
+	void Device::replayHeldSubmissions()const
+	{
+		for ( auto const & [_, creates] : m_queues )
+		{
+			for ( auto queue : creates.queues )
+			{
+				get( queue )->replayHeld();
+			}
+		}
+	}
+
 	void Device::doInitialiseDummy()const
 	{
 		if ( !m_dummyIndexed.indexBuffer )
@@ -710,6 +777,11 @@ namespace ashes::gl
 
 		cleanupBlitSrcFbo();
 		cleanupBlitDstFbo();
+
+		if ( m_vertexArrayCache )
+		{
+			m_vertexArrayCache->cleanup();
+		}
 	}
 
 	Device * Device::getDevice( VkDevice device )
@@ -720,34 +792,32 @@ namespace ashes::gl
 #if VK_EXT_debug_utils || VK_EXT_debug_marker
 
 	void Device::doRegisterObject( uint64_t object
-		, [[maybe_unused]] uint32_t objectType
+		, uint32_t objectType
 		, std::string const & typeName )const
 	{
-		std::stringstream stream;
-		stream.imbue( std::locale{ "C" } );
-		stream << "Created " << typeName
-			<< " [0x" << std::hex << std::setw( 8u ) << std::setfill( '0' ) << object << "]";
-		m_allocated.try_emplace( object, typeName );
+		m_allocated.insert( object
+			, { objectType, &typeName } );
 	}
 
 	void Device::doUnregisterObject( uint64_t object )const noexcept
 	{
-		auto it = m_allocated.find( object );
-		assert( it != m_allocated.end() );
-		if ( it != m_allocated.end() )
-			m_allocated.erase( it );
+		[[maybe_unused]] auto found = m_allocated.erase( object );
+		assert( found );
 	}
 
 	void Device::doReportRegisteredObjects()const noexcept
 	{
 		try
 		{
-			for ( auto const & [_, alloc] : m_allocated )
-			{
-				std::stringstream stream;
-				stream << "Leaked [" << alloc.type << "]";
-				logError( stream.str().c_str() );
-			}
+			m_allocated.forEach( []( uint64_t object
+				, ObjectAllocation const & alloc )
+				{
+					std::stringstream stream;
+					stream.imbue( std::locale{ "C" } );
+					stream << "Leaked [" << *alloc.typeName << "]"
+						<< " [0x" << std::hex << std::setw( 8u ) << std::setfill( '0' ) << object << "]";
+					logError( stream.str().c_str() );
+				} );
 		}
 		catch ( ... )
 		{
@@ -796,4 +866,24 @@ namespace ashes::gl
 	{
 		return hasProgramInterfaceQuery( get( device )->getPhysicalDevice() );
 	}
+
+	bool hasProgramBinary( VkDevice device )noexcept
+	{
+		return hasProgramBinary( get( device )->getPhysicalDevice() );
+	}
+
+	bool hasBufferStorage( VkDevice device )noexcept
+	{
+		return hasBufferStorage( get( device )->getPhysicalDevice() );
+	}
+
+	bool hasMultiBind( VkDevice device )noexcept
+	{
+		return hasMultiBind( get( device )->getPhysicalDevice() );
+	}
+
+	bool hasVertexAttribBinding( VkDevice device )noexcept
+	{
+		return hasVertexAttribBinding( get( device )->getPhysicalDevice() );
+	}
 }
@@ -8,6 +8,10 @@ See LICENSE file in root folder
 #include "renderer/GlRenderer/Core/GlContextLock.hpp"
 #include "renderer/GlRenderer/Core/GlPhysicalDevice.hpp"
 
+#include <ashes/common/HandleRegistry.hpp>
+
+#include <atomic>
+#include <mutex>
 #include <unordered_map>
 
 namespace ashes::gl
@@ -594,6 +598,23 @@ namespace ashes::gl
 		}
 	};
 
+	template<>
+	struct AshesDebugTypeTraits< DescriptorUpdateTemplate >
+	{
+#if VK_EXT_debug_utils
+		static VkObjectType constexpr UtilsValue = VK_OBJECT_TYPE_DESCRIPTOR_UPDATE_TEMPLATE;
+#endif
+#if VK_EXT_debug_report || VK_EXT_debug_marker
+		static VkDebugReportObjectTypeEXT constexpr ReportValue = VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_EXT;
+#endif
+		static inline std::string const Name{ "VkDescriptorUpdateTemplate" };
+
+		static std::string const & getName()
+		{
+			return Name;
+		}
+	};
+
 	template<>
 	struct AshesDebugTypeTraits< Framebuffer >
 	{
@@ -667,6 +688,60 @@ namespace ashes::gl
 	{
 		friend class Instance;
 
+	public:
+		/**
+		*\brief
+		*	Counts of the graphics pipelines program variants (back buffer and RTOT).
+		*/
+		struct ProgramVariantsCounters
+		{
+			//! The variants built, at pipeline creation or on first use.
+			std::atomic< uint64_t > built{};
+			//! The variants whose build was deferred to their first use.
+			std::atomic< uint64_t > deferred{};
+			//! The deferred variants whose build failed at their first use.
+			std::atomic< uint64_t > failed{};
+		};
+		/**
+		*\brief
+		*	Counts of the bytes uploaded from the device memories shadow copies, on unmap or flush.
+		*/
+		struct MappedUploadCounters
+		{
+			//! The bytes unmapped or flushed by the application.
+			std::atomic< uint64_t > requested{};
+			//! The bytes actually uploaded, once the unmodified pages are skipped.
+			std::atomic< uint64_t > uploaded{};
+		};
+		/**
+		*\brief
+		*	Counts of the descriptor binds recorded through ARB_multi_bind.
+		*/
+		struct DescriptorBindCounters
+		{
+			//! The units binds requested by vkCmdBindDescriptorSets.
+			std::atomic< uint64_t > requested{};
+			//! The units binds skipped, since they were already bound.
+			std::atomic< uint64_t > skipped{};
+			//! The commands actually recorded for them.
+			std::atomic< uint64_t > recorded{};
+		};
+		/**
+		*\brief
+		*	Counts of the VAOs held by the vertex layouts cache.
+		*/
+		struct VertexArrayCounters
+		{
+			//! The VAOs created since the device creation.
+			std::atomic< uint64_t > created{};
+			//! The VAOs created since the last present.
+			std::atomic< uint64_t > createdInFrame{};
+			//! The VAOs created during the last presented frame.
+			std::atomic< uint64_t > createdLastFrame{};
+			//! The VAOs destroyed to stay under VertexArrayCache::MaxVaos.
+			std::atomic< uint64_t > evicted{};
+		};
+
 	public:
 		Device( VkAllocationCallbacks const * callbacks
 			, VkInstance instance
@@ -683,6 +758,20 @@ namespace ashes::gl
 			, VkImageSubresource const & subresource
 			, VkSubresourceLayout & layout )const;
 		VkResult waitIdle()const;
+		/**
+		*\brief
+		*	Waits until the queues submission threads, if any, have processed all submissions.
+		*\remarks
+		*	Must not be called while holding the context.
+		*/
+		void drainQueues()const;
+		/**
+		*\brief
+		*	Replays the queues submissions that were held back by waits for host signals or event sets, now covered.
+		*\remarks
+		*	Must not be called while holding the context.
+		*/
+		void replayHeldSubmissions()const;
 #if VK_EXT_debug_utils
 		VkResult setDebugUtilsObjectName( VkDebugUtilsObjectNameInfoEXT const & nameInfo )const;
 		VkResult setDebugUtilsObjectTag( VkDebugUtilsObjectTagInfoEXT const & tagInfo )const;
@@ -710,6 +799,11 @@ namespace ashes::gl
 		void link( VkSurfaceKHR surface );
 		void unlink()noexcept;
 		ContextLock getContext()const noexcept;
+		/**
+		*\brief
+		*	The worker threads used for CPU only work, created on first use.
+		*/
+		WorkerPool & getWorkerPool()const;
 
 		VkPhysicalDeviceFeatures const & getEnabledFeatures()const noexcept
 		{
@@ -763,6 +857,34 @@ namespace ashes::gl
 			return m_callbacks;
 		}
 
+		ProgramVariantsCounters & getProgramVariantsCounters()const noexcept
+		{
+			return m_programVariants;
+		}
+
+		MappedUploadCounters & getMappedUploadCounters()const noexcept
+		{
+			return m_mappedUploads;
+		}
+
+		DescriptorBindCounters & getDescriptorBindCounters()const noexcept
+		{
+			return m_descriptorBinds;
+		}
+
+		VertexArrayCounters & getVertexArrayCounters()const noexcept
+		{
+			return m_vertexArrays;
+		}
+		/**
+		*\brief
+		*	The vertex layouts cache, null when ARB_vertex_attrib_binding isn't supported.
+		*/
+		VertexArrayCache * getVertexArrayCache()const noexcept
+		{
+			return m_vertexArrayCache.get();
+		}
+
 	private:
 		void doInitialiseQueues();
 		void doInitialiseDummy()const;
@@ -794,6 +916,13 @@ namespace ashes::gl
 		QueueCreateCountMap m_queues;
 		mutable ContextPtr m_ownContext;
 		mutable Context * m_currentContext;
+		mutable std::mutex m_workerPoolMutex;
+		mutable WorkerPoolPtr m_workerPool;
+		mutable ProgramVariantsCounters m_programVariants;
+		mutable MappedUploadCounters m_mappedUploads;
+		mutable DescriptorBindCounters m_descriptorBinds;
+		mutable VertexArrayCounters m_vertexArrays;
+		VertexArrayCachePtr m_vertexArrayCache;
 		struct Vertex
 		{
 			float x;
@@ -816,15 +945,12 @@ namespace ashes::gl
 
 		struct ObjectAllocation
 		{
-			explicit ObjectAllocation( std::string ptype )
-				: type{ std::move( ptype ) }
-			{
-			}
-
-			std::string type;
+			uint32_t objectType;
+			//! Points to the type's static name, only formatted when the object is reported as leaked.
+			std::string const * typeName;
 		};
 
-		mutable std::unordered_map< size_t, ObjectAllocation > m_allocated;
+		mutable HandleRegistry< ObjectAllocation > m_allocated;
 
 	public:
 		template< typename AshesType >
@@ -883,4 +1009,8 @@ namespace ashes::gl
 	bool hasTextureViews( VkDevice device )noexcept;
 	bool hasViewportArrays( VkDevice device )noexcept;
 	bool hasProgramInterfaceQuery( VkDevice device )noexcept;
+	bool hasProgramBinary( VkDevice device )noexcept;
+	bool hasBufferStorage( VkDevice device )noexcept;
+	bool hasMultiBind( VkDevice device )noexcept;
+	bool hasVertexAttribBinding( VkDevice device )noexcept;
 }
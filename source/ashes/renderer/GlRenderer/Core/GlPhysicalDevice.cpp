@@ -6,6 +6,7 @@ See LICENSE file in root folder.
 
 #include "Core/GlInstance.hpp"
 #include "Core/GlDevice.hpp"
+#include "Core/GlPhysicalDeviceCache.hpp"
 #include "Miscellaneous/GlScreenHelpers.hpp"
 
 #include "ashesgl_api.hpp"
@@ -19,9 +20,11 @@ See LICENSE file in root folder.
 #endif
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstring>
 #include <iterator>
+#include <limits>
 #include <stdexcept>
 
 #ifdef max
@@ -67,6 +70,36 @@ namespace ashes::gl
 			return hash;
 		}
 
+		// GL program binaries are only valid for the exact same driver, hence the UUID
+		// is built from the driver strings, using FNV-1a to be stable from one run to another.
+		static void doGetPipelineCacheUUID( char const * vendor
+			, char const * renderer
+			, char const * version
+			, uint8_t ( & result )[VK_UUID_SIZE] )
+		{
+			uint64_t constexpr prime = 0x100000001B3ULL;
+			std::array< uint64_t, 2u > hashes{ 0xCBF29CE484222325ULL, 0x84222325CBF29CE4ULL };
+
+			for ( auto & hash : hashes )
+			{
+				for ( auto str : { vendor, renderer, version } )
+				{
+					for ( auto c = str; c && *c; ++c )
+					{
+						hash ^= uint8_t( *c );
+						hash *= prime;
+					}
+
+					// Separator, to distinguish "ab"+"c" from "a"+"bc".
+					hash ^= 0xFFu;
+					hash *= prime;
+				}
+			}
+
+			static_assert( sizeof( hashes ) == VK_UUID_SIZE );
+			std::memcpy( result, hashes.data(), VK_UUID_SIZE );
+		}
+
 		static uint32_t doGetVendorID( std::string vendorName )
 		{
 			uint32_t result = 0u;
@@ -142,11 +175,17 @@ namespace ashes::gl
 #if VK_EXT_inline_uniform_block
 			VkExtensionProperties{ VK_EXT_INLINE_UNIFORM_BLOCK_EXTENSION_NAME, VK_EXT_INLINE_UNIFORM_BLOCK_SPEC_VERSION },
 #endif
+#if VK_KHR_descriptor_update_template
+			VkExtensionProperties{ VK_KHR_DESCRIPTOR_UPDATE_TEMPLATE_EXTENSION_NAME, VK_KHR_DESCRIPTOR_UPDATE_TEMPLATE_SPEC_VERSION },
+#endif
 #if VK_KHR_maintenance1
 			VkExtensionProperties{ VK_KHR_MAINTENANCE1_EXTENSION_NAME, VK_KHR_MAINTENANCE1_SPEC_VERSION },
 #endif
 #if VK_KHR_portability_subset
 			VkExtensionProperties{ VK_KHR_PORTABILITY_SUBSET_EXTENSION_NAME, VK_KHR_PORTABILITY_SUBSET_SPEC_VERSION },
+#endif
+#if VK_KHR_timeline_semaphore
+			VkExtensionProperties{ VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME, VK_KHR_TIMELINE_SEMAPHORE_SPEC_VERSION },
 #endif
 		};
 	}
@@ -243,399 +282,408 @@ namespace ashes::gl
 			else
 			{
 				ContextLock context{ get( m_instance )->getCurrentContext() };
-				assert( context->m_glGetInternalformativ );
-				auto internal = getInternalFormat( fmt );
+				it->second = doQueryFormatProperties( context, fmt );
+			}
+		}
 
-				if ( isCompressedFormat( fmt ) )
-				{
-					internal = physdev::getCompressedFormatSupport( m_features, fmt, internal );
-				}
+		return it->second;
+	}
 
-				if ( internal != GL_INTERNAL_UNSUPPORTED )
-				{
-					GlFormatPropertyResult support = GL_FORMAT_PROPERTY_UNSUPPORTED;
-					glLogCall( context, glGetInternalformativ
-						, GL_TEXTURE_2D
-						, internal
-						, GL_FORMAT_PROPERTY_IS_SUPPORTED
-						, 1
-						, reinterpret_cast< GLint * >( &support ) );
+	VkFormatProperties PhysicalDevice::doQueryFormatProperties( ContextLock const & context
+		, VkFormat fmt )const
+	{
+		VkFormatProperties properties{};
+		assert( context->m_glGetInternalformativ );
+		auto internal = getInternalFormat( fmt );
 
-					if ( support == GL_FORMAT_PROPERTY_SUPPORTED )
-					{
+		if ( isCompressedFormat( fmt ) )
+		{
+			internal = physdev::getCompressedFormatSupport( m_features, fmt, internal );
+		}
+
+		if ( internal != GL_INTERNAL_UNSUPPORTED )
+		{
+			GlFormatPropertyResult support = GL_FORMAT_PROPERTY_UNSUPPORTED;
+			glLogCall( context, glGetInternalformativ
+				, GL_TEXTURE_2D
+				, internal
+				, GL_FORMAT_PROPERTY_IS_SUPPORTED
+				, 1
+				, reinterpret_cast< GLint * >( &support ) );
+
+			if ( support == GL_FORMAT_PROPERTY_SUPPORTED )
+			{
 #if defined( VK_KHR_maintenance ) || defined( VK_API_VERSION_1_1 )
+				support = GL_FORMAT_PROPERTY_UNSUPPORTED;
+				glLogCall( context, glGetInternalformativ
+					, GL_TEXTURE_2D
+					, internal
+					, GL_FORMAT_PROPERTY_READ_PIXELS
+					, 1
+					, reinterpret_cast< GLint * >( &support ) );
+
+				if ( support != GL_FORMAT_PROPERTY_UNSUPPORTED )
+				{
+					if ( isSRGBFormat( fmt ) )
+					{
 						support = GL_FORMAT_PROPERTY_UNSUPPORTED;
 						glLogCall( context, glGetInternalformativ
 							, GL_TEXTURE_2D
 							, internal
-							, GL_FORMAT_PROPERTY_READ_PIXELS
+							, GL_FORMAT_PROPERTY_SRGB_READ
 							, 1
 							, reinterpret_cast< GLint * >( &support ) );
 
 						if ( support != GL_FORMAT_PROPERTY_UNSUPPORTED )
 						{
-							if ( isSRGBFormat( fmt ) )
-							{
-								support = GL_FORMAT_PROPERTY_UNSUPPORTED;
-								glLogCall( context, glGetInternalformativ
-									, GL_TEXTURE_2D
-									, internal
-									, GL_FORMAT_PROPERTY_SRGB_READ
-									, 1
-									, reinterpret_cast< GLint * >( &support ) );
-
-								if ( support != GL_FORMAT_PROPERTY_UNSUPPORTED )
-								{
-									properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_BLIT_SRC_BIT;
-								}
-							}
-							else
-							{
-								properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_BLIT_SRC_BIT;
-							}
+							properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_BLIT_SRC_BIT;
 						}
+					}
+					else
+					{
+						properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_BLIT_SRC_BIT;
+					}
+				}
+
+				support = GL_FORMAT_PROPERTY_UNSUPPORTED;
+				glLogCall( context, glGetInternalformativ
+					, GL_TEXTURE_2D
+					, internal
+					, GL_FORMAT_PROPERTY_RENDERABLE
+					, 1
+					, reinterpret_cast< GLint * >( &support ) );
 
+				if ( support != GL_FORMAT_PROPERTY_UNSUPPORTED )
+				{
+					if ( isSRGBFormat( fmt ) )
+					{
 						support = GL_FORMAT_PROPERTY_UNSUPPORTED;
 						glLogCall( context, glGetInternalformativ
 							, GL_TEXTURE_2D
 							, internal
-							, GL_FORMAT_PROPERTY_RENDERABLE
+							, GL_FORMAT_PROPERTY_SRGB_WRITE
 							, 1
 							, reinterpret_cast< GLint * >( &support ) );
 
 						if ( support != GL_FORMAT_PROPERTY_UNSUPPORTED )
 						{
-							if ( isSRGBFormat( fmt ) )
-							{
-								support = GL_FORMAT_PROPERTY_UNSUPPORTED;
-								glLogCall( context, glGetInternalformativ
-									, GL_TEXTURE_2D
-									, internal
-									, GL_FORMAT_PROPERTY_SRGB_WRITE
-									, 1
-									, reinterpret_cast< GLint * >( &support ) );
-
-								if ( support != GL_FORMAT_PROPERTY_UNSUPPORTED )
-								{
-									properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_BLIT_SRC_BIT;
-									properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_BLIT_DST_BIT;
-								}
-							}
-							else
-							{
-								properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_BLIT_DST_BIT;
-								properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_BLIT_SRC_BIT;
-							}
+							properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_BLIT_SRC_BIT;
+							properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_BLIT_DST_BIT;
 						}
+					}
+					else
+					{
+						properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_BLIT_DST_BIT;
+						properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_BLIT_SRC_BIT;
+					}
+				}
 #endif
+				support = GL_FORMAT_PROPERTY_UNSUPPORTED;
+				glLogCall( context, glGetInternalformativ
+					, GL_TEXTURE_2D
+					, internal
+					, GL_FORMAT_PROPERTY_RENDERABLE
+					, 1
+					, reinterpret_cast< GLint * >( &support ) );
+
+				if ( support != GL_FORMAT_PROPERTY_UNSUPPORTED )
+				{
+					if ( isDepthStencilFormat( fmt ) )
+					{
 						support = GL_FORMAT_PROPERTY_UNSUPPORTED;
 						glLogCall( context, glGetInternalformativ
 							, GL_TEXTURE_2D
 							, internal
-							, GL_FORMAT_PROPERTY_RENDERABLE
+							, GL_FORMAT_PROPERTY_DEPTH_RENDERABLE
 							, 1
 							, reinterpret_cast< GLint * >( &support ) );
 
 						if ( support != GL_FORMAT_PROPERTY_UNSUPPORTED )
 						{
-							if ( isDepthStencilFormat( fmt ) )
+							support = GL_FORMAT_PROPERTY_UNSUPPORTED;
+							glLogCall( context, glGetInternalformativ
+								, GL_TEXTURE_2D
+								, internal
+								, GL_FORMAT_PROPERTY_STENCIL_RENDERABLE
+								, 1
+								, reinterpret_cast< GLint * >( &support ) );
+
+							if ( support != GL_FORMAT_PROPERTY_UNSUPPORTED )
 							{
-								support = GL_FORMAT_PROPERTY_UNSUPPORTED;
-								glLogCall( context, glGetInternalformativ
-									, GL_TEXTURE_2D
-									, internal
-									, GL_FORMAT_PROPERTY_DEPTH_RENDERABLE
-									, 1
-									, reinterpret_cast< GLint * >( &support ) );
-
-								if ( support != GL_FORMAT_PROPERTY_UNSUPPORTED )
-								{
-									support = GL_FORMAT_PROPERTY_UNSUPPORTED;
-									glLogCall( context, glGetInternalformativ
-										, GL_TEXTURE_2D
-										, internal
-										, GL_FORMAT_PROPERTY_STENCIL_RENDERABLE
-										, 1
-										, reinterpret_cast< GLint * >( &support ) );
-
-									if ( support != GL_FORMAT_PROPERTY_UNSUPPORTED )
-									{
-										properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT;
+								properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT;
 #if defined( VK_KHR_maintenance ) || defined( VK_API_VERSION_1_1 )
-										properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_BLIT_SRC_BIT;
-										properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_BLIT_DST_BIT;
-#endif
-									}
-								}
-							}
-							else if ( isDepthFormat( fmt ) )
-							{
-								support = GL_FORMAT_PROPERTY_UNSUPPORTED;
-								glLogCall( context, glGetInternalformativ
-									, GL_TEXTURE_2D
-									, internal
-									, GL_FORMAT_PROPERTY_DEPTH_RENDERABLE
-									, 1
-									, reinterpret_cast< GLint * >( &support ) );
-
-								if ( support != GL_FORMAT_PROPERTY_UNSUPPORTED )
-								{
-									properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT;
-#if defined( VK_KHR_maintenance ) || defined( VK_API_VERSION_1_1 )
-									properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_BLIT_SRC_BIT;
-									properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_BLIT_DST_BIT;
-#endif
-								}
-							}
-							else if ( isStencilFormat( fmt ) )
-							{
-								support = GL_FORMAT_PROPERTY_UNSUPPORTED;
-								glLogCall( context, glGetInternalformativ
-									, GL_TEXTURE_2D
-									, internal
-									, GL_FORMAT_PROPERTY_STENCIL_RENDERABLE
-									, 1
-									, reinterpret_cast< GLint * >( &support ) );
-
-								if ( support != GL_FORMAT_PROPERTY_UNSUPPORTED )
-								{
-									properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT;
-#if defined( VK_KHR_maintenance ) || defined( VK_API_VERSION_1_1 )
-									properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_BLIT_SRC_BIT;
-									properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_BLIT_DST_BIT;
-#endif
-								}
-							}
-							else
-							{
-								support = GL_FORMAT_PROPERTY_UNSUPPORTED;
-								glLogCall( context, glGetInternalformativ
-									, GL_TEXTURE_2D
-									, internal
-									, GL_FORMAT_PROPERTY_COLOR_RENDERABLE
-									, 1
-									, reinterpret_cast< GLint * >( &support ) );
-
-								if ( support != GL_FORMAT_PROPERTY_UNSUPPORTED )
-								{
-									properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BIT;
-#if defined( VK_KHR_maintenance ) || defined( VK_API_VERSION_1_1 )
-									properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_BLIT_SRC_BIT;
-									properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_BLIT_DST_BIT;
+								properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_BLIT_SRC_BIT;
+								properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_BLIT_DST_BIT;
 #endif
-									support = GL_FORMAT_PROPERTY_UNSUPPORTED;
-									glLogCall( context, glGetInternalformativ
-										, GL_TEXTURE_2D
-										, internal
-										, GL_FORMAT_PROPERTY_BLEND
-										, 1
-										, reinterpret_cast< GLint * >( &support ) );
-
-									if ( support != GL_FORMAT_PROPERTY_UNSUPPORTED )
-									{
-										properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BLEND_BIT;
-									}
-								}
 							}
 						}
-
+					}
+					else if ( isDepthFormat( fmt ) )
+					{
 						support = GL_FORMAT_PROPERTY_UNSUPPORTED;
 						glLogCall( context, glGetInternalformativ
 							, GL_TEXTURE_2D
 							, internal
-							, GL_FORMAT_PROPERTY_FRAGMENT_TEXTURE
+							, GL_FORMAT_PROPERTY_DEPTH_RENDERABLE
 							, 1
 							, reinterpret_cast< GLint * >( &support ) );
 
-						if ( support != 0 )
+						if ( support != GL_FORMAT_PROPERTY_UNSUPPORTED )
 						{
-							properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT;
-							properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_TRANSFER_SRC_BIT;
-							properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_TRANSFER_DST_BIT;
+							properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT;
 #if defined( VK_KHR_maintenance ) || defined( VK_API_VERSION_1_1 )
 							properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_BLIT_SRC_BIT;
+							properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_BLIT_DST_BIT;
 #endif
 						}
-
+					}
+					else if ( isStencilFormat( fmt ) )
+					{
 						support = GL_FORMAT_PROPERTY_UNSUPPORTED;
 						glLogCall( context, glGetInternalformativ
 							, GL_TEXTURE_2D
 							, internal
-							, GL_FORMAT_PROPERTY_FILTER
+							, GL_FORMAT_PROPERTY_STENCIL_RENDERABLE
 							, 1
 							, reinterpret_cast< GLint * >( &support ) );
 
-						if ( support != 0 )
+						if ( support != GL_FORMAT_PROPERTY_UNSUPPORTED )
 						{
-							properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT;
-							properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_TRANSFER_SRC_BIT;
-							properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_TRANSFER_DST_BIT;
-							properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT;
+							properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT;
+#if defined( VK_KHR_maintenance ) || defined( VK_API_VERSION_1_1 )
+							properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_BLIT_SRC_BIT;
+							properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_BLIT_DST_BIT;
+#endif
 						}
-
+					}
+					else
+					{
 						support = GL_FORMAT_PROPERTY_UNSUPPORTED;
 						glLogCall( context, glGetInternalformativ
 							, GL_TEXTURE_2D
 							, internal
-							, GL_FORMAT_PROPERTY_SHADER_IMAGE_LOAD
+							, GL_FORMAT_PROPERTY_COLOR_RENDERABLE
 							, 1
 							, reinterpret_cast< GLint * >( &support ) );
 
-						if ( support != 0 )
+						if ( support != GL_FORMAT_PROPERTY_UNSUPPORTED )
 						{
-							properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT;
+							properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BIT;
+#if defined( VK_KHR_maintenance ) || defined( VK_API_VERSION_1_1 )
+							properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_BLIT_SRC_BIT;
+							properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_BLIT_DST_BIT;
+#endif
+							support = GL_FORMAT_PROPERTY_UNSUPPORTED;
+							glLogCall( context, glGetInternalformativ
+								, GL_TEXTURE_2D
+								, internal
+								, GL_FORMAT_PROPERTY_BLEND
+								, 1
+								, reinterpret_cast< GLint * >( &support ) );
+
+							if ( support != GL_FORMAT_PROPERTY_UNSUPPORTED )
+							{
+								properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BLEND_BIT;
+							}
 						}
+					}
+				}
 
-						support = GL_FORMAT_PROPERTY_UNSUPPORTED;
-						glLogCall( context, glGetInternalformativ
-							, GL_TEXTURE_2D
-							, internal
-							, GL_FORMAT_PROPERTY_SHADER_IMAGE_ATOMIC
-							, 1
-							, reinterpret_cast< GLint * >( &support ) );
+				support = GL_FORMAT_PROPERTY_UNSUPPORTED;
+				glLogCall( context, glGetInternalformativ
+					, GL_TEXTURE_2D
+					, internal
+					, GL_FORMAT_PROPERTY_FRAGMENT_TEXTURE
+					, 1
+					, reinterpret_cast< GLint * >( &support ) );
 
-						if ( support != 0 )
-						{
-							properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_STORAGE_IMAGE_ATOMIC_BIT;
-						}
+				if ( support != 0 )
+				{
+					properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT;
+					properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_TRANSFER_SRC_BIT;
+					properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_TRANSFER_DST_BIT;
+#if defined( VK_KHR_maintenance ) || defined( VK_API_VERSION_1_1 )
+					properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_BLIT_SRC_BIT;
+#endif
+				}
 
-						support = GL_FORMAT_PROPERTY_UNSUPPORTED;
-						glLogCall( context, glGetInternalformativ
-							, GL_TEXTURE_BUFFER
-							, internal
-							, GL_FORMAT_PROPERTY_FRAGMENT_TEXTURE
-							, 1
-							, reinterpret_cast< GLint * >( &support ) );
+				support = GL_FORMAT_PROPERTY_UNSUPPORTED;
+				glLogCall( context, glGetInternalformativ
+					, GL_TEXTURE_2D
+					, internal
+					, GL_FORMAT_PROPERTY_FILTER
+					, 1
+					, reinterpret_cast< GLint * >( &support ) );
 
-						if ( support != 0 )
-						{
-							properties.bufferFeatures |= VK_FORMAT_FEATURE_UNIFORM_TEXEL_BUFFER_BIT;
-							properties.bufferFeatures |= VK_FORMAT_FEATURE_TRANSFER_SRC_BIT;
-							properties.bufferFeatures |= VK_FORMAT_FEATURE_TRANSFER_DST_BIT;
-						}
+				if ( support != 0 )
+				{
+					properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT;
+					properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_TRANSFER_SRC_BIT;
+					properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_TRANSFER_DST_BIT;
+					properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT;
+				}
 
-						support = GL_FORMAT_PROPERTY_UNSUPPORTED;
-						glLogCall( context, glGetInternalformativ
-							, GL_TEXTURE_BUFFER
-							, internal
-							, GL_FORMAT_PROPERTY_SHADER_IMAGE_LOAD
-							, 1
-							, reinterpret_cast< GLint * >( &support ) );
+				support = GL_FORMAT_PROPERTY_UNSUPPORTED;
+				glLogCall( context, glGetInternalformativ
+					, GL_TEXTURE_2D
+					, internal
+					, GL_FORMAT_PROPERTY_SHADER_IMAGE_LOAD
+					, 1
+					, reinterpret_cast< GLint * >( &support ) );
 
-						if ( support != 0 )
-						{
-							properties.bufferFeatures |= VK_FORMAT_FEATURE_STORAGE_TEXEL_BUFFER_BIT;
-						}
+				if ( support != 0 )
+				{
+					properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT;
+				}
 
-						support = GL_FORMAT_PROPERTY_UNSUPPORTED;
-						glLogCall( context, glGetInternalformativ
-							, GL_TEXTURE_BUFFER
-							, internal
-							, GL_FORMAT_PROPERTY_SHADER_IMAGE_ATOMIC
-							, 1
-							, reinterpret_cast< GLint * >( &support ) );
+				support = GL_FORMAT_PROPERTY_UNSUPPORTED;
+				glLogCall( context, glGetInternalformativ
+					, GL_TEXTURE_2D
+					, internal
+					, GL_FORMAT_PROPERTY_SHADER_IMAGE_ATOMIC
+					, 1
+					, reinterpret_cast< GLint * >( &support ) );
 
-						if ( support != 0 )
-						{
-							properties.bufferFeatures |= VK_FORMAT_FEATURE_STORAGE_TEXEL_BUFFER_ATOMIC_BIT;
-						}
+				if ( support != 0 )
+				{
+					properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_STORAGE_IMAGE_ATOMIC_BIT;
+				}
+
+				support = GL_FORMAT_PROPERTY_UNSUPPORTED;
+				glLogCall( context, glGetInternalformativ
+					, GL_TEXTURE_BUFFER
+					, internal
+					, GL_FORMAT_PROPERTY_FRAGMENT_TEXTURE
+					, 1
+					, reinterpret_cast< GLint * >( &support ) );
+
+				if ( support != 0 )
+				{
+					properties.bufferFeatures |= VK_FORMAT_FEATURE_UNIFORM_TEXEL_BUFFER_BIT;
+					properties.bufferFeatures |= VK_FORMAT_FEATURE_TRANSFER_SRC_BIT;
+					properties.bufferFeatures |= VK_FORMAT_FEATURE_TRANSFER_DST_BIT;
+				}
+
+				support = GL_FORMAT_PROPERTY_UNSUPPORTED;
+				glLogCall( context, glGetInternalformativ
+					, GL_TEXTURE_BUFFER
+					, internal
+					, GL_FORMAT_PROPERTY_SHADER_IMAGE_LOAD
+					, 1
+					, reinterpret_cast< GLint * >( &support ) );
+
+				if ( support != 0 )
+				{
+					properties.bufferFeatures |= VK_FORMAT_FEATURE_STORAGE_TEXEL_BUFFER_BIT;
+				}
+
+				support = GL_FORMAT_PROPERTY_UNSUPPORTED;
+				glLogCall( context, glGetInternalformativ
+					, GL_TEXTURE_BUFFER
+					, internal
+					, GL_FORMAT_PROPERTY_SHADER_IMAGE_ATOMIC
+					, 1
+					, reinterpret_cast< GLint * >( &support ) );
+
+				if ( support != 0 )
+				{
+					properties.bufferFeatures |= VK_FORMAT_FEATURE_STORAGE_TEXEL_BUFFER_ATOMIC_BIT;
+				}
 
 #if defined( VK_KHR_maintenance ) || defined( VK_API_VERSION_1_1 )
-						support = GL_FORMAT_PROPERTY_UNSUPPORTED;
-						glLogCall( context, glGetInternalformativ
-							, GL_TEXTURE_2D
-							, internal
-							, GL_FORMAT_PROPERTY_READ_PIXELS
-							, 1
-							, reinterpret_cast< GLint * >( &support ) );
+				support = GL_FORMAT_PROPERTY_UNSUPPORTED;
+				glLogCall( context, glGetInternalformativ
+					, GL_TEXTURE_2D
+					, internal
+					, GL_FORMAT_PROPERTY_READ_PIXELS
+					, 1
+					, reinterpret_cast< GLint * >( &support ) );
 
-						if ( support != 0 )
-						{
-							properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_TRANSFER_SRC_BIT;
-							properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_TRANSFER_DST_BIT;
-						}
+				if ( support != 0 )
+				{
+					properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_TRANSFER_SRC_BIT;
+					properties.optimalTilingFeatures |= VK_FORMAT_FEATURE_TRANSFER_DST_BIT;
+				}
 
-						support = GL_FORMAT_PROPERTY_UNSUPPORTED;
-						glLogCall( context, glGetInternalformativ
-							, GL_TEXTURE_BUFFER
-							, internal
-							, GL_FORMAT_PROPERTY_READ_PIXELS
-							, 1
-							, reinterpret_cast< GLint * >( &support ) );
+				support = GL_FORMAT_PROPERTY_UNSUPPORTED;
+				glLogCall( context, glGetInternalformativ
+					, GL_TEXTURE_BUFFER
+					, internal
+					, GL_FORMAT_PROPERTY_READ_PIXELS
+					, 1
+					, reinterpret_cast< GLint * >( &support ) );
 
-						if ( support != 0 )
-						{
-							properties.bufferFeatures |= VK_FORMAT_FEATURE_TRANSFER_DST_BIT;
-							properties.bufferFeatures |= VK_FORMAT_FEATURE_TRANSFER_SRC_BIT;
-						}
+				if ( support != 0 )
+				{
+					properties.bufferFeatures |= VK_FORMAT_FEATURE_TRANSFER_DST_BIT;
+					properties.bufferFeatures |= VK_FORMAT_FEATURE_TRANSFER_SRC_BIT;
+				}
 #endif
-					}
+			}
 
-					if ( !isCompressedFormat( fmt ) )
-					{
-						GlType dataType = getType( fmt );
+			if ( !isCompressedFormat( fmt ) )
+			{
+				GlType dataType = getType( fmt );
 
-						switch ( dataType )
-						{
-						case ashes::gl::GL_TYPE_I8:
-							properties.bufferFeatures |= VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT;
-							break;
-						case ashes::gl::GL_TYPE_UI8:
-							properties.bufferFeatures |= VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT;
-							break;
-						case ashes::gl::GL_TYPE_I16:
-							properties.bufferFeatures |= VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT;
-							break;
-						case ashes::gl::GL_TYPE_UI16:
-							properties.bufferFeatures |= VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT;
-							break;
-						case ashes::gl::GL_TYPE_I32:
-							properties.bufferFeatures |= VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT;
-							break;
-						case ashes::gl::GL_TYPE_UI32:
-							properties.bufferFeatures |= VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT;
-							break;
-						case ashes::gl::GL_TYPE_F32:
-							properties.bufferFeatures |= VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT;
-							break;
-						case ashes::gl::GL_TYPE_F16:
-							properties.bufferFeatures |= VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT;
-							break;
-						case ashes::gl::GL_TYPE_US_4_4_4_4:
-							break;
-						case ashes::gl::GL_TYPE_US_5_5_5_1:
-							break;
-						case ashes::gl::GL_TYPE_UI_8_8_8_8:
-							properties.bufferFeatures |= VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT;
-							break;
-						case ashes::gl::GL_TYPE_UI_8_8_8_8_REV:
-							properties.bufferFeatures |= VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT;
-							break;
-						case ashes::gl::GL_TYPE_UI_2_10_10_10_REV:
-							properties.bufferFeatures |= VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT;
-							break;
-						case ashes::gl::GL_TYPE_US_5_6_5:
-							break;
-						case ashes::gl::GL_TYPE_UI_24_8:
-							break;
-						case ashes::gl::GL_TYPE_32F_UI24_8:
-							break;
-						case ashes::gl::GL_UI_5_9_9_9_REV:
-							break;
-						case ashes::gl::GL_UI_10F_11F_11F_REV:
-							properties.bufferFeatures |= VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT;
-							break;
-						default:
-							break;
-						}
-					}
+				switch ( dataType )
+				{
+				case ashes::gl::GL_TYPE_I8:
+					properties.bufferFeatures |= VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT;
+					break;
+				case ashes::gl::GL_TYPE_UI8:
+					properties.bufferFeatures |= VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT;
+					break;
+				case ashes::gl::GL_TYPE_I16:
+					properties.bufferFeatures |= VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT;
+					break;
+				case ashes::gl::GL_TYPE_UI16:
+					properties.bufferFeatures |= VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT;
+					break;
+				case ashes::gl::GL_TYPE_I32:
+					properties.bufferFeatures |= VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT;
+					break;
+				case ashes::gl::GL_TYPE_UI32:
+					properties.bufferFeatures |= VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT;
+					break;
+				case ashes::gl::GL_TYPE_F32:
+					properties.bufferFeatures |= VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT;
+					break;
+				case ashes::gl::GL_TYPE_F16:
+					properties.bufferFeatures |= VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT;
+					break;
+				case ashes::gl::GL_TYPE_US_4_4_4_4:
+					break;
+				case ashes::gl::GL_TYPE_US_5_5_5_1:
+					break;
+				case ashes::gl::GL_TYPE_UI_8_8_8_8:
+					properties.bufferFeatures |= VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT;
+					break;
+				case ashes::gl::GL_TYPE_UI_8_8_8_8_REV:
+					properties.bufferFeatures |= VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT;
+					break;
+				case ashes::gl::GL_TYPE_UI_2_10_10_10_REV:
+					properties.bufferFeatures |= VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT;
+					break;
+				case ashes::gl::GL_TYPE_US_5_6_5:
+					break;
+				case ashes::gl::GL_TYPE_UI_24_8:
+					break;
+				case ashes::gl::GL_TYPE_32F_UI24_8:
+					break;
+				case ashes::gl::GL_UI_5_9_9_9_REV:
+					break;
+				case ashes::gl::GL_UI_10F_11F_11F_REV:
+					properties.bufferFeatures |= VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT;
+					break;
+				default:
+					break;
 				}
-
-				properties.linearTilingFeatures = properties.optimalTilingFeatures;
 			}
 		}
 
-		return it->second;
+		properties.linearTilingFeatures = properties.optimalTilingFeatures;
+
+		return properties;
 	}
 
 	VkResult PhysicalDevice::getImageFormatProperties( VkFormat format
@@ -888,6 +936,52 @@ namespace ashes::gl
 	}
 
 	void PhysicalDevice::doInitialise()
+	{
+		ContextLock context{ get( m_instance )->getCurrentContext() };
+		PhysicalDeviceSnapshot snapshot;
+		snapshot.vendor = reinterpret_cast< char const * >( context->glGetString( GL_INFO_VENDOR ) );
+		snapshot.renderer = reinterpret_cast< char const * >( context->glGetString( GL_INFO_RENDERER ) );
+		snapshot.version = reinterpret_cast< char const * >( context->glGetString( GL_INFO_VERSION ) );
+		snapshot.extensions = get( m_instance )->getExtensions().getExtensionNames();
+		auto cacheEnabled = isPhysicalDeviceCacheEnabled();
+
+		if ( cacheEnabled
+			&& loadPhysicalDeviceSnapshot( snapshot ) )
+		{
+			m_features = snapshot.features;
+			m_properties = snapshot.properties;
+			m_glFeatures = snapshot.glFeatures;
+			m_formatProperties = std::move( snapshot.formatProperties );
+			m_properties.apiVersion = get( m_instance )->getApiVersion();
+		}
+		else
+		{
+			doInitialiseGlFeatures( context );
+			doInitialiseFeatures( context );
+			doInitialiseProperties( context );
+
+			if ( cacheEnabled )
+			{
+				// Cold cache: the whole format table is filled now, for the next runs to skip its queries.
+				doInitialiseFormatProperties( context );
+				snapshot.features = m_features;
+				snapshot.properties = m_properties;
+				snapshot.glFeatures = m_glFeatures;
+				snapshot.formatProperties = m_formatProperties;
+				savePhysicalDeviceSnapshot( snapshot );
+			}
+		}
+
+		doInitialiseMemoryProperties( context );
+		doInitialiseQueueProperties();
+		doInitialiseDisplayProperties();
+		doInitialisePortability();
+		doInitialiseDriverProperties();
+		doInitialiseInlineUniformBlock( context );
+		doInitialiseTimelineSemaphore();
+	}
+
+	void PhysicalDevice::doInitialiseGlFeatures( ContextLock const & context )
 	{
 		m_glFeatures.has420PackExtensions = find( ARB_shading_language_420pack );
 		m_glFeatures.hasCopyImage = find( ARB_copy_image );
@@ -896,16 +990,20 @@ namespace ashes::gl
 		m_glFeatures.hasTextureViews = find( ARB_texture_view );
 		m_glFeatures.hasViewportArrays = find( ARB_viewport_array );
 		m_glFeatures.hasProgramInterfaceQuery = find( ARB_program_interface_query );
+		m_glFeatures.hasBufferStorage = find( ARB_buffer_storage );
+		m_glFeatures.hasMultiBind = find( ARB_multi_bind );
+		m_glFeatures.hasVertexAttribBinding = find( ARB_vertex_attrib_binding );
+		m_glFeatures.hasProgramBinary = find( ARB_get_program_binary );
 
-		ContextLock context{ get( m_instance )->getCurrentContext() };
-		doInitialiseMemoryProperties( context );
-		doInitialiseFeatures( context );
-		doInitialiseProperties( context );
-		doInitialiseQueueProperties();
-		doInitialiseDisplayProperties();
-		doInitialisePortability();
-		doInitialiseDriverProperties();
-		doInitialiseInlineUniformBlock( context );
+		if ( m_glFeatures.hasProgramBinary )
+		{
+			// Some drivers expose the extension without supporting any binary format.
+			GLint formats{};
+			glLogCall( context, glGetIntegerv
+				, GL_VALUE_NAME_NUM_PROGRAM_BINARY_FORMATS
+				, &formats );
+			m_glFeatures.hasProgramBinary = formats > 0;
+		}
 	}
 
 	void PhysicalDevice::doInitialiseFeatures( ContextLock const & context )
@@ -985,7 +1083,10 @@ namespace ashes::gl
 		strncat( m_properties.deviceName
 			, " (gl)"
 			, VK_MAX_PHYSICAL_DEVICE_NAME_SIZE - 1 );
-		std::memset( m_properties.pipelineCacheUUID, 0u, sizeof( m_properties.pipelineCacheUUID ) );
+		physdev::doGetPipelineCacheUUID( reinterpret_cast< char const * >( context->glGetString( GL_INFO_VENDOR ) )
+			, reinterpret_cast< char const * >( context->glGetString( GL_INFO_RENDERER ) )
+			, reinterpret_cast< char const * >( context->glGetString( GL_INFO_VERSION ) )
+			, m_properties.pipelineCacheUUID );
 		m_properties.vendorID = physdev::doGetVendorID( reinterpret_cast< char const * >( context->glGetString( GL_INFO_VENDOR ) ) );
 		m_properties.deviceType = VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU;
 		m_properties.driverVersion = 0;
@@ -1272,6 +1373,36 @@ namespace ashes::gl
 #endif
 	}
 
+	void PhysicalDevice::doInitialiseTimelineSemaphore()
+	{
+#if VK_KHR_timeline_semaphore
+
+		m_timelineSemaphoreFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR;
+		m_timelineSemaphoreFeatures.pNext = nullptr;
+		m_timelineSemaphoreFeatures.timelineSemaphore = VK_TRUE;
+
+		m_timelineSemaphoreProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_PROPERTIES_KHR;
+		m_timelineSemaphoreProperties.pNext = nullptr;
+		m_timelineSemaphoreProperties.maxTimelineSemaphoreValueDifference = std::numeric_limits< uint64_t >::max();
+
+#endif
+	}
+
+	void PhysicalDevice::doInitialiseFormatProperties( ContextLock const & context )
+	{
+		if ( !find( ARB_internalformat_query2 ) )
+		{
+			// Nothing to query, the table is filled lazily.
+			return;
+		}
+
+		for ( auto fmt = uint32_t( VK_FORMAT_R4G4_UNORM_PACK8 ); fmt <= uint32_t( VK_FORMAT_ASTC_12x12_SRGB_BLOCK ); ++fmt )
+		{
+			m_formatProperties.try_emplace( VkFormat( fmt )
+				, doQueryFormatProperties( context, VkFormat( fmt ) ) );
+		}
+	}
+
 	bool has420PackExtensions( VkPhysicalDevice physicalDevice )noexcept
 	{
 		return get( physicalDevice )->getGlFeatures().has420PackExtensions != 0;
@@ -1311,4 +1442,24 @@ namespace ashes::gl
 	{
 		return get( physicalDevice )->getGlFeatures().hasProgramInterfaceQuery != 0;
 	}
+
+	bool hasProgramBinary( VkPhysicalDevice physicalDevice )noexcept
+	{
+		return get( physicalDevice )->getGlFeatures().hasProgramBinary != 0;
+	}
+
+	bool hasBufferStorage( VkPhysicalDevice physicalDevice )noexcept
+	{
+		return get( physicalDevice )->getGlFeatures().hasBufferStorage != 0;
+	}
+
+	bool hasMultiBind( VkPhysicalDevice physicalDevice )noexcept
+	{
+		return get( physicalDevice )->getGlFeatures().hasMultiBind != 0;
+	}
+
+	bool hasVertexAttribBinding( VkPhysicalDevice physicalDevice )noexcept
+	{
+		return get( physicalDevice )->getGlFeatures().hasVertexAttribBinding != 0;
+	}
 }
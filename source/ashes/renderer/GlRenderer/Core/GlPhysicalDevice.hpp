@@ -68,6 +68,16 @@ namespace ashes::gl
 			return m_inlineUniformBlockProperties;
 		}
 #endif
+#if VK_KHR_timeline_semaphore
+		VkPhysicalDeviceTimelineSemaphoreFeaturesKHR getTimelineSemaphoreFeatures()const noexcept
+		{
+			return m_timelineSemaphoreFeatures;
+		}
+		VkPhysicalDeviceTimelineSemaphorePropertiesKHR getTimelineSemaphoreProperties()const noexcept
+		{
+			return m_timelineSemaphoreProperties;
+		}
+#endif
 
 		bool find( VkExtensionProperties const & name )const;
 		bool findAny( VkExtensionPropertiesArray const & names )const;
@@ -87,6 +97,7 @@ namespace ashes::gl
 
 	private:
 		void doInitialise();
+		void doInitialiseGlFeatures( ContextLock const & context );
 		void doInitialiseProperties( ContextLock const & context );
 		void doInitialiseFeatures( ContextLock const & context );
 		void doInitialiseMemoryProperties( ContextLock const & context );
@@ -95,6 +106,14 @@ namespace ashes::gl
 		void doInitialiseDriverProperties();
 		void doInitialisePortability();
 		void doInitialiseInlineUniformBlock( ContextLock const & context );
+		void doInitialiseTimelineSemaphore();
+		/**
+		*\brief
+		*	Fills the whole format properties table, in one pass.
+		*/
+		void doInitialiseFormatProperties( ContextLock const & context );
+		VkFormatProperties doQueryFormatProperties( ContextLock const & context
+			, VkFormat fmt )const;
 
 	private:
 		VkInstance m_instance;
@@ -117,6 +136,10 @@ namespace ashes::gl
 		VkPhysicalDeviceInlineUniformBlockFeaturesEXT m_inlineUniformBlockFeatures{};
 		VkPhysicalDeviceInlineUniformBlockPropertiesEXT m_inlineUniformBlockProperties{};
 #endif
+#if VK_KHR_timeline_semaphore
+		VkPhysicalDeviceTimelineSemaphoreFeaturesKHR m_timelineSemaphoreFeatures{};
+		VkPhysicalDeviceTimelineSemaphorePropertiesKHR m_timelineSemaphoreProperties{};
+#endif
 #ifdef VK_KHR_display
 		std::vector< std::string > m_displayNames;
 		std::vector< VkDisplayPropertiesKHR >m_displays;
@@ -132,4 +155,8 @@ namespace ashes::gl
 	bool hasTextureViews( VkPhysicalDevice physicalDevice )noexcept;
 	bool hasViewportArrays( VkPhysicalDevice physicalDevice )noexcept;
 	bool hasProgramInterfaceQuery( VkPhysicalDevice physicalDevice )noexcept;
+	bool hasProgramBinary( VkPhysicalDevice physicalDevice )noexcept;
+	bool hasBufferStorage( VkPhysicalDevice physicalDevice )noexcept;
+	bool hasMultiBind( VkPhysicalDevice physicalDevice )noexcept;
+	bool hasVertexAttribBinding( VkPhysicalDevice physicalDevice )noexcept;
 }
@@ -0,0 +1,246 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#include "Core/GlPhysicalDeviceCache.hpp"
+
+#include "Miscellaneous/GlBinaryStream.hpp"
+
+#include <ashes/common/FileUtils.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+
+#ifndef AshesGL_VersionMajor
+#	define AshesGL_VersionMajor 0
+#	define AshesGL_VersionMinor 0
+#	define AshesGL_VersionBuild 0
+#endif
+
+namespace ashes::gl
+{
+	namespace devcache
+	{
+		static uint32_t constexpr FileMagic = 0x43444741u;// "AGDC"
+		// Bumped whenever the file layout changes.
+		static uint32_t constexpr FileVersion = 2u;
+		/**
+		*\brief
+		*	Identifies the renderer build that wrote a snapshot, the features it reports depending on it.
+		*\return
+		*	The renderer version, and the stamp of its library file.
+		*/
+		static std::string const & getBuildIdentity()
+		{
+			static std::string const result = []()
+			{
+				auto path = ashes::getModulePath( reinterpret_cast< void const * >( &isPhysicalDeviceCacheEnabled ) );
+				return std::to_string( AshesGL_VersionMajor )
+					+ "." + std::to_string( AshesGL_VersionMinor )
+					+ "." + std::to_string( AshesGL_VersionBuild )
+					+ "/" + ashes::getFileStamp( path );
+			}();
+			return result;
+		}
+
+		static std::string getFilePath( PhysicalDeviceSnapshot const & snapshot )
+		{
+			auto directory = ashes::getCacheDirectory();
+
+			if ( directory.empty() )
+			{
+				return directory;
+			}
+
+			// FNV-1a, to be stable from one run to another.
+			uint64_t hash = 0xCBF29CE484222325ULL;
+
+			for ( auto str : { &snapshot.vendor, &snapshot.renderer, &snapshot.version } )
+			{
+				for ( auto c : *str )
+				{
+					hash ^= uint8_t( c );
+					hash *= 0x100000001B3ULL;
+				}
+
+				// Separator, to distinguish "ab"+"c" from "a"+"bc".
+				hash ^= 0xFFu;
+				hash *= 0x100000001B3ULL;
+			}
+
+			std::stringstream stream;
+			stream.imbue( std::locale{ "C" } );
+			stream << std::hex << std::setfill( '0' ) << std::setw( 16 ) << hash << ".gldevice.bin";
+			return directory / stream.str();
+		}
+	}
+
+	bool isPhysicalDeviceCacheEnabled()
+	{
+		static bool const result = []()
+		{
+			auto value = std::getenv( "ASHES_GL_DEVICE_CACHE" );
+			return ( value == nullptr || std::string{ value } != "0" )
+				&& !ashes::getCacheDirectory().empty();
+		}();
+		return result;
+	}
+
+	bool loadPhysicalDeviceSnapshot( PhysicalDeviceSnapshot & snapshot )
+	{
+		std::ifstream file{ devcache::getFilePath( snapshot ), std::ios::binary };
+
+		if ( !file )
+		{
+			return false;
+		}
+
+		ByteArray data{ std::istreambuf_iterator< char >{ file }
+			, std::istreambuf_iterator< char >{} };
+		BinaryReader reader{ data };
+		uint32_t magic{};
+		uint32_t version{};
+		uint32_t structSizes[3]{};
+		std::string build;
+		std::string vendor;
+		std::string renderer;
+		std::string driverVersion;
+		uint32_t count{};
+
+		if ( !reader.read( magic )
+			|| magic != devcache::FileMagic
+			|| !reader.read( version )
+			|| version != devcache::FileVersion
+			|| !reader.read( structSizes )
+			|| structSizes[0] != sizeof( VkPhysicalDeviceFeatures )
+			|| structSizes[1] != sizeof( VkPhysicalDeviceProperties )
+			|| structSizes[2] != sizeof( GlPhysicalDeviceFeatures )
+			|| !reader.read( build )
+			|| build != devcache::getBuildIdentity()
+			|| !reader.read( vendor )
+			|| vendor != snapshot.vendor
+			|| !reader.read( renderer )
+			|| renderer != snapshot.renderer
+			|| !reader.read( driverVersion )
+			|| driverVersion != snapshot.version
+			|| !reader.read( count ) )
+		{
+			return false;
+		}
+
+		// The extensions may be overridden from the environment, for the same driver.
+		StringArray extensions( count );
+
+		for ( auto & extension : extensions )
+		{
+			if ( !reader.read( extension ) )
+			{
+				return false;
+			}
+		}
+
+		if ( extensions != snapshot.extensions )
+		{
+			return false;
+		}
+
+		PhysicalDeviceSnapshot result{ snapshot };
+
+		if ( !reader.read( result.features )
+			|| !reader.read( result.properties )
+			|| !reader.read( result.glFeatures )
+			|| !reader.read( count ) )
+		{
+			return false;
+		}
+
+		for ( uint32_t i = 0u; i < count; ++i )
+		{
+			uint32_t format{};
+			VkFormatProperties properties{};
+
+			if ( !reader.read( format )
+				|| !reader.read( properties ) )
+			{
+				return false;
+			}
+
+			result.formatProperties.emplace( VkFormat( format ), properties );
+		}
+
+		snapshot = std::move( result );
+		return true;
+	}
+
+	void savePhysicalDeviceSnapshot( PhysicalDeviceSnapshot const & snapshot )
+	{
+		auto path = devcache::getFilePath( snapshot );
+
+		if ( path.empty() )
+		{
+			return;
+		}
+
+		ByteArray data;
+		BinaryWriter writer{ data };
+		writer.write( devcache::FileMagic );
+		writer.write( devcache::FileVersion );
+		writer.write( uint32_t( sizeof( VkPhysicalDeviceFeatures ) ) );
+		writer.write( uint32_t( sizeof( VkPhysicalDeviceProperties ) ) );
+		writer.write( uint32_t( sizeof( GlPhysicalDeviceFeatures ) ) );
+		writer.write( devcache::getBuildIdentity() );
+		writer.write( snapshot.vendor );
+		writer.write( snapshot.renderer );
+		writer.write( snapshot.version );
+		writer.write( uint32_t( snapshot.extensions.size() ) );
+
+		for ( auto & extension : snapshot.extensions )
+		{
+			writer.write( extension );
+		}
+
+		writer.write( snapshot.features );
+		writer.write( snapshot.properties );
+		writer.write( snapshot.glFeatures );
+		writer.write( uint32_t( snapshot.formatProperties.size() ) );
+
+		for ( auto & [format, properties] : snapshot.formatProperties )
+		{
+			writer.write( uint32_t( format ) );
+			writer.write( properties );
+		}
+
+		// Written to a temporary file first, so that concurrent processes never read a partial snapshot.
+		auto tmpPath = path + "."
+			+ std::to_string( std::chrono::high_resolution_clock::now().time_since_epoch().count() )
+			+ ".tmp";
+		{
+			std::ofstream file{ tmpPath, std::ios::binary | std::ios::trunc };
+
+			if ( !file )
+			{
+				return;
+			}
+
+			file.write( reinterpret_cast< char const * >( data.data() ), std::streamsize( data.size() ) );
+
+			if ( !file )
+			{
+				file.close();
+				std::remove( tmpPath.c_str() );
+				return;
+			}
+		}
+
+		if ( std::rename( tmpPath.c_str(), path.c_str() ) != 0 )
+		{
+			// Most likely another process already wrote it.
+			std::remove( tmpPath.c_str() );
+		}
+	}
+}
@@ -0,0 +1,43 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#pragma once
+
+#include "renderer/GlRenderer/GlRendererPrerequisites.hpp"
+
+namespace ashes::gl
+{
+	/**
+	*\brief
+	*	The capabilities of a GL driver, which don't change from one run to another.
+	*/
+	struct PhysicalDeviceSnapshot
+	{
+		std::string vendor;
+		std::string renderer;
+		std::string version;
+		StringArray extensions;
+		VkPhysicalDeviceFeatures features{};
+		VkPhysicalDeviceProperties properties{};
+		GlPhysicalDeviceFeatures glFeatures{};
+		std::map< VkFormat, VkFormatProperties > formatProperties;
+	};
+	/**
+	*\return
+	*	\p false if ASHES_GL_DEVICE_CACHE is set to 0, or if there is no user cache directory.
+	*/
+	bool isPhysicalDeviceCacheEnabled();
+	/**
+	*\brief
+	*	Loads the snapshot saved for \p snapshot's driver strings, from the user cache directory.
+	*\return
+	*	\p false if there is none, or if the driver doesn't expose the same extensions anymore.
+	*/
+	bool loadPhysicalDeviceSnapshot( PhysicalDeviceSnapshot & snapshot );
+	/**
+	*\brief
+	*	Saves \p snapshot in the user cache directory, for the next runs on the same driver.
+	*/
+	void savePhysicalDeviceSnapshot( PhysicalDeviceSnapshot const & snapshot );
+}
@@ -13,6 +13,45 @@
 
 namespace ashes::gl
 {
+	namespace dset
+	{
+		static void allocateSlots( LayoutBindingWrites & writes )
+		{
+			switch ( writes.descriptorType )
+			{
+			case VK_DESCRIPTOR_TYPE_SAMPLER:
+			case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+			case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+			case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+			case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+				writes.images.resize( writes.descriptorCount );
+				writes.written.resize( writes.descriptorCount );
+				break;
+			case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+			case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+				writes.texelBufferViews.resize( writes.descriptorCount );
+				writes.written.resize( writes.descriptorCount );
+				break;
+			case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+			case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+			case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+			case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+				writes.buffers.resize( writes.descriptorCount );
+				writes.written.resize( writes.descriptorCount );
+				break;
+#if VK_EXT_inline_uniform_block
+			case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT:
+				// The whole block is a single uniform buffer.
+				writes.buffers.resize( 1u );
+				writes.written.resize( 1u );
+				break;
+#endif
+			default:
+				break;
+			}
+		}
+	}
+
 	DescriptorSet::DescriptorSet( VkAllocationCallbacks const * allocInfo
 		, VkDescriptorPool pool
 		, VkDescriptorSetLayout layout )
@@ -30,7 +69,7 @@ namespace ashes::gl
 				binding.descriptorType,
 				{}
 			};
-			m_writes.try_emplace( binding.binding, bindingWrites );
+			dset::allocateSlots( m_writes.try_emplace( binding.binding, bindingWrites ).first->second );
 		}
 
 		for ( auto & [_, write] : m_writes )
@@ -101,7 +140,7 @@ namespace ashes::gl
 	{
 		unregisterObject( m_device, *this );
 
-		for ( auto const & inlineUbo : m_inlineUbos )
+		for ( auto const & [_, inlineUbo] : m_inlineUbos )
 		{
 			deallocate( inlineUbo->buffer
 				, m_allocInfo );
@@ -110,61 +149,138 @@ namespace ashes::gl
 		}
 	}
 
-	void DescriptorSet::mergeWrites( LayoutBindingWrites & writes, VkWriteDescriptorSet const & write )
+	void DescriptorSet::mergeWrites( LayoutBindingWrites & writes
+		, VkWriteDescriptorSet const & write
+		, uint32_t srcIndex
+		, uint32_t dstArrayElement
+		, uint32_t count )
 	{
-		writes.writes.push_back( write );
-		auto & myWrite = writes.writes.back();
+		for ( uint32_t i = 0u; i < count; ++i )
+		{
+			auto src = srcIndex + i;
+			auto dst = dstArrayElement + i;
 
-#if VK_EXT_inline_uniform_block
+			if ( !writes.images.empty() )
+			{
+				writes.images[dst] = write.pImageInfo[src];
+			}
+			else if ( !writes.buffers.empty() )
+			{
+				writes.buffers[dst] = write.pBufferInfo[src];
+			}
+			else if ( !writes.texelBufferViews.empty() )
+			{
+				writes.texelBufferViews[dst] = write.pTexelBufferView[src];
+			}
 
-		if ( auto inlineUniform = tryGet< VkWriteDescriptorSetInlineUniformBlockEXT >( myWrite.pNext );
-			inlineUniform )
-		{
-			writes.descriptorCount /= inlineUniform->dataSize;
-			myWrite.descriptorCount /= inlineUniform->dataSize;
-			auto device = get( m_pool )->getDevice();
-			auto inlineUbo = createInlineUbo( device
-				, *inlineUniform
-				, get( get( get( m_pool )->getDevice() )->getPhysicalDevice() )->getMemoryProperties()
-				, ashes::gl::vkCreateBuffer
-				, ashes::gl::vkGetBufferMemoryRequirements
-				, ashes::gl::vkAllocateMemory
-				, ashes::gl::vkBindBufferMemory
-				, ashes::gl::vkMapMemory
-				, ashes::gl::vkFlushMappedMemoryRanges
-				, ashes::gl::vkUnmapMemory );
-			myWrite.pBufferInfo = &inlineUbo->info;
-			m_inlineUbos.emplace_back( std::move( inlineUbo ) );
+			writes.written[dst] = true;
 		}
 
-#endif
+		updateWrites( writes );
+	}
 
-		if ( myWrite.pBufferInfo )
-		{
-			m_buffersInfos.emplace_back( myWrite.pBufferInfo, myWrite.pBufferInfo + myWrite.descriptorCount );
-			myWrite.pBufferInfo = m_buffersInfos.back().data();
-		}
+	void DescriptorSet::updateWrites( LayoutBindingWrites & writes )
+	{
+		writes.writes.clear();
+		auto count = uint32_t( writes.written.size() );
+		uint32_t index = 0u;
 
-		if ( myWrite.pImageInfo )
+		while ( index < count )
 		{
-			m_imagesInfos.emplace_back( myWrite.pImageInfo, myWrite.pImageInfo + myWrite.descriptorCount );
-			myWrite.pImageInfo = m_imagesInfos.back().data();
+			if ( !writes.written[index] )
+			{
+				++index;
+				continue;
+			}
+
+			auto first = index;
+
+			while ( index < count && writes.written[index] )
+			{
+				++index;
+			}
+
+			writes.writes.push_back( { VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET
+				, nullptr
+				, get( this )
+				, writes.binding
+				, first
+				, index - first
+				, writes.descriptorType
+				, ( writes.images.empty() ? nullptr : writes.images.data() + first )
+				, ( writes.buffers.empty() ? nullptr : writes.buffers.data() + first )
+				, ( writes.texelBufferViews.empty() ? nullptr : writes.texelBufferViews.data() + first ) } );
 		}
+	}
+
+#if VK_EXT_inline_uniform_block
 
-		if ( myWrite.pTexelBufferView )
+	void DescriptorSet::mergeInlineUniform( LayoutBindingWrites & writes
+		, VkWriteDescriptorSetInlineUniformBlockEXT const & inlineUniform )
+	{
+		auto device = get( m_pool )->getDevice();
+		auto inlineUbo = createInlineUbo( device
+			, inlineUniform
+			, get( get( device )->getPhysicalDevice() )->getMemoryProperties()
+			, ashes::gl::vkCreateBuffer
+			, ashes::gl::vkGetBufferMemoryRequirements
+			, ashes::gl::vkAllocateMemory
+			, ashes::gl::vkBindBufferMemory
+			, ashes::gl::vkMapMemory
+			, ashes::gl::vkFlushMappedMemoryRanges
+			, ashes::gl::vkUnmapMemory );
+		auto & slot = m_inlineUbos[writes.binding];
+
+		if ( slot )
 		{
-			m_texelBufferViews.emplace_back( myWrite.pTexelBufferView, myWrite.pTexelBufferView + myWrite.descriptorCount );
-			myWrite.pTexelBufferView = m_texelBufferViews.back().data();
+			// The previous block isn't referenced anymore.
+			deallocate( slot->buffer
+				, m_allocInfo );
+			deallocate( slot->memory
+				, m_allocInfo );
 		}
+
+		slot = std::move( inlineUbo );
+		writes.buffers[0] = slot->info;
+		writes.written[0] = true;
+		updateWrites( writes );
 	}
 
+#endif
+
 	void DescriptorSet::update( VkWriteDescriptorSet const & write )
 	{
 		auto it = m_writes.find( write.dstBinding );
 		assert( it != m_writes.end() );
-		assert( it->second.descriptorType == write.descriptorType );
 		assert( write.dstSet == get( this ) );
-		mergeWrites( it->second, write );
+
+#if VK_EXT_inline_uniform_block
+
+		if ( auto inlineUniform = tryGet< VkWriteDescriptorSetInlineUniformBlockEXT >( write.pNext );
+			inlineUniform )
+		{
+			mergeInlineUniform( it->second, *inlineUniform );
+			return;
+		}
+
+#endif
+
+		// A write overflowing its binding continues on the next ones.
+		uint32_t srcIndex = 0u;
+		auto dstArrayElement = write.dstArrayElement;
+
+		while ( srcIndex < write.descriptorCount
+			&& it != m_writes.end() )
+		{
+			auto & writes = it->second;
+			assert( writes.descriptorType == write.descriptorType );
+			auto count = std::min( write.descriptorCount - srcIndex
+				, uint32_t( writes.written.size() ) - std::min( dstArrayElement, uint32_t( writes.written.size() ) ) );
+			mergeWrites( writes, write, srcIndex, dstArrayElement, count );
+			srcIndex += count;
+			dstArrayElement = 0u;
+			++it;
+		}
 	}
 
 	void DescriptorSet::update( VkCopyDescriptorSet const & )
@@ -22,7 +22,13 @@ namespace ashes::gl
 		uint32_t binding;
 		uint32_t descriptorCount;
 		VkDescriptorType descriptorType;
+		// The written descriptors, one VkWriteDescriptorSet per contiguous range of written array elements.
 		VkWriteDescriptorSetArray writes;
+		// The descriptor slots, one per array element, overwritten in place by the updates.
+		std::vector< VkDescriptorImageInfo > images;
+		std::vector< VkDescriptorBufferInfo > buffers;
+		std::vector< VkBufferView > texelBufferViews;
+		std::vector< bool > written;
 	};
 	using LayoutBindingWritesArray = std::vector< LayoutBindingWrites * >;
 	using LayoutBindingWritesMap = std::map< uint32_t, LayoutBindingWrites >;
@@ -100,17 +106,24 @@ namespace ashes::gl
 		}
 
 	private:
-		void mergeWrites( LayoutBindingWrites & writes, VkWriteDescriptorSet const & write );
+		void mergeWrites( LayoutBindingWrites & writes
+			, VkWriteDescriptorSet const & write
+			, uint32_t srcIndex
+			, uint32_t dstArrayElement
+			, uint32_t count );
+		void updateWrites( LayoutBindingWrites & writes );
+#if VK_EXT_inline_uniform_block
+		void mergeInlineUniform( LayoutBindingWrites & writes
+			, VkWriteDescriptorSetInlineUniformBlockEXT const & inlineUniform );
+#endif
 
 	private:
 		VkDevice m_device;
 		VkAllocationCallbacks const * m_allocInfo;
 		VkDescriptorPool m_pool;
 		VkDescriptorSetLayout m_layout;
-		std::vector< std::vector< VkDescriptorImageInfo > > m_imagesInfos;
-		std::vector< std::vector< VkDescriptorBufferInfo > > m_buffersInfos;
-		std::vector< std::vector< VkBufferView > > m_texelBufferViews;
-		InlineUboArray m_inlineUbos;
+		// The inline uniform blocks buffers, by binding.
+		std::map< uint32_t, InlineUboPtr > m_inlineUbos;
 		LayoutBindingWritesMap m_writes;
 		LayoutBindingWritesArray m_combinedTextureSamplers;
 		LayoutBindingWritesArray m_samplers;
@@ -0,0 +1,59 @@
+#include "Descriptor/GlDescriptorUpdateTemplate.hpp"
+
+#include "Descriptor/GlDescriptorSet.hpp"
+#include "Descriptor/GlDescriptorSetLayout.hpp"
+#include "Pipeline/GlPipelineLayout.hpp"
+
+#include "ashesgl_api.hpp"
+
+namespace ashes::gl
+{
+	namespace updtpl
+	{
+		static VkDescriptorSetLayoutBindingArray getBindings( VkDescriptorUpdateTemplateCreateInfo const & createInfo )
+		{
+			auto layout = createInfo.descriptorSetLayout;
+
+#if VK_KHR_push_descriptor
+
+			if ( createInfo.templateType == VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_PUSH_DESCRIPTORS_KHR )
+			{
+				// The set layout is ignored, the pipeline layout's one is used.
+				auto & setLayouts = get( createInfo.pipelineLayout )->getDescriptorsLayouts();
+				assert( createInfo.set < setLayouts.size() );
+				layout = setLayouts[createInfo.set];
+			}
+
+#endif
+
+			auto & setLayout = *get( layout );
+			return VkDescriptorSetLayoutBindingArray{ setLayout.begin(), setLayout.end() };
+		}
+	}
+
+	DescriptorUpdateTemplate::DescriptorUpdateTemplate( [[maybe_unused]] VkAllocationCallbacks const * allocInfo
+		, VkDevice device
+		, VkDescriptorUpdateTemplateCreateInfo const & createInfo )
+		: m_device{ device }
+		, m_program{ createInfo, updtpl::getBindings( createInfo ) }
+	{
+		registerObject( m_device, *this );
+	}
+
+	DescriptorUpdateTemplate::~DescriptorUpdateTemplate()noexcept
+	{
+		unregisterObject( m_device, *this );
+	}
+
+	void DescriptorUpdateTemplate::update( VkDescriptorSet descriptorSet
+		, void const * pData )const
+	{
+		auto & set = *get( descriptorSet );
+		m_program.apply( descriptorSet
+			, pData
+			, [&set]( VkWriteDescriptorSet const & write )
+			{
+				set.update( write );
+			} );
+	}
+}
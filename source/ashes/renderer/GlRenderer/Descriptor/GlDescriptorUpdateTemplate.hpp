@@ -0,0 +1,41 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#ifndef ___GlRenderer_DescriptorUpdateTemplate_HPP___
+#define ___GlRenderer_DescriptorUpdateTemplate_HPP___
+#pragma once
+
+#include "renderer/GlRenderer/GlRendererPrerequisites.hpp"
+
+#include <renderer/RendererCommon/DescriptorUpdateTemplate.hpp>
+
+namespace ashes::gl
+{
+	class DescriptorUpdateTemplate
+		: public AutoIdIcdObject< DescriptorUpdateTemplate >
+	{
+	public:
+		DescriptorUpdateTemplate( VkAllocationCallbacks const * allocInfo
+			, VkDevice device
+			, VkDescriptorUpdateTemplateCreateInfo const & createInfo );
+		~DescriptorUpdateTemplate()noexcept;
+		/**
+		*\brief
+		*	Updates \p descriptorSet from the user data, as described by the template.
+		*/
+		void update( VkDescriptorSet descriptorSet
+			, void const * pData )const;
+
+		DescriptorUpdateProgram const & getProgram()const noexcept
+		{
+			return m_program;
+		}
+
+	private:
+		VkDevice m_device;
+		DescriptorUpdateProgram m_program;
+	};
+}
+
+#endif
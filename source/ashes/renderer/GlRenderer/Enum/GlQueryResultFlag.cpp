@@ -12,6 +12,9 @@ namespace ashes::gl
 		case GL_QUERY_RESULT:
 			return "GL_QUERY_RESULT";
 
+		case GL_QUERY_RESULT_AVAILABLE:
+			return "GL_QUERY_RESULT_AVAILABLE";
+
 		case GL_QUERY_RESULT_NO_WAIT:
 			return "GL_QUERY_RESULT_NO_WAIT";
 
@@ -23,6 +26,11 @@ namespace ashes::gl
 
 	std::string getName( GlQueryResultFlags value )
 	{
+		if ( value == GL_QUERY_RESULT_AVAILABLE )
+		{
+			return getName( GL_QUERY_RESULT_AVAILABLE );
+		}
+
 		std::string result;
 		std::string sep;
 
@@ -48,11 +56,13 @@ namespace ashes::gl
 
 	GlQueryResultFlags convertQueryResultFlags( VkQueryResultFlags const & flags )
 	{
-		if ( ashes::checkFlag( flags, VK_QUERY_RESULT_WITH_AVAILABILITY_BIT ) )
+		// A partial result can be any value up to the final one, so the final one is fine.
+		if ( ashes::checkFlag( flags, VK_QUERY_RESULT_WAIT_BIT )
+			|| ashes::checkFlag( flags, VK_QUERY_RESULT_PARTIAL_BIT ) )
 		{
-			return GL_QUERY_RESULT_NO_WAIT;
+			return GL_QUERY_RESULT;
 		}
 
-		return GL_QUERY_RESULT;
+		return GL_QUERY_RESULT_NO_WAIT;
 	}
 }
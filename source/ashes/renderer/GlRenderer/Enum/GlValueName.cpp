@@ -294,6 +294,32 @@ namespace ashes::gl
 			return "GL_GPU_MEMORY_INFO_TOTAL_AVAILABLE_MEMORY_NVX";
 		case GL_VALUE_NAME_TEXTURE_FREE_MEMORY_ATI:
 			return "GL_TEXTURE_FREE_MEMORY_ATI";
+		case GL_VALUE_NAME_NUM_PROGRAM_BINARY_FORMATS:
+			return "GL_NUM_PROGRAM_BINARY_FORMATS";
+		case GL_VALUE_NAME_LINE_WIDTH:
+			return "GL_LINE_WIDTH";
+		case GL_VALUE_NAME_CULL_FACE_MODE:
+			return "GL_CULL_FACE_MODE";
+		case GL_VALUE_NAME_FRONT_FACE:
+			return "GL_FRONT_FACE";
+		case GL_VALUE_NAME_DEPTH_WRITEMASK:
+			return "GL_DEPTH_WRITEMASK";
+		case GL_VALUE_NAME_DEPTH_FUNC:
+			return "GL_DEPTH_FUNC";
+		case GL_VALUE_NAME_UNPACK_ALIGNMENT:
+			return "GL_UNPACK_ALIGNMENT";
+		case GL_VALUE_NAME_PACK_ALIGNMENT:
+			return "GL_PACK_ALIGNMENT";
+		case GL_VALUE_NAME_ACTIVE_TEXTURE:
+			return "GL_ACTIVE_TEXTURE";
+		case GL_VALUE_NAME_PROGRAM_PIPELINE_BINDING:
+			return "GL_PROGRAM_PIPELINE_BINDING";
+		case GL_VALUE_NAME_CURRENT_PROGRAM:
+			return "GL_CURRENT_PROGRAM";
+		case GL_VALUE_NAME_DRAW_FRAMEBUFFER_BINDING:
+			return "GL_DRAW_FRAMEBUFFER_BINDING";
+		case GL_VALUE_NAME_READ_FRAMEBUFFER_BINDING:
+			return "GL_READ_FRAMEBUFFER_BINDING";
 		default:
 			assert( false && "Unsupported GlValueName" );
 			return "GlValueName_UNKNOWN";
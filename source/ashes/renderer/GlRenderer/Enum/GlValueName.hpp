@@ -156,6 +156,19 @@ namespace ashes::gl
 		GL_VALUE_NAME_SUBPIXEL_BITS = 0x0D50,
 		GL_VALUE_NAME_GPU_MEMORY_INFO_TOTAL_AVAILABLE_MEMORY_NVX = 0x9048,
 		GL_VALUE_NAME_TEXTURE_FREE_MEMORY_ATI = 0x87FC,
+		GL_VALUE_NAME_NUM_PROGRAM_BINARY_FORMATS = 0x87FE,
+		GL_VALUE_NAME_LINE_WIDTH = 0x0B21,
+		GL_VALUE_NAME_CULL_FACE_MODE = 0x0B45,
+		GL_VALUE_NAME_FRONT_FACE = 0x0B46,
+		GL_VALUE_NAME_DEPTH_WRITEMASK = 0x0B72,
+		GL_VALUE_NAME_DEPTH_FUNC = 0x0B74,
+		GL_VALUE_NAME_UNPACK_ALIGNMENT = 0x0CF5,
+		GL_VALUE_NAME_PACK_ALIGNMENT = 0x0D05,
+		GL_VALUE_NAME_ACTIVE_TEXTURE = 0x84E0,
+		GL_VALUE_NAME_PROGRAM_PIPELINE_BINDING = 0x825A,
+		GL_VALUE_NAME_CURRENT_PROGRAM = 0x8B8D,
+		GL_VALUE_NAME_DRAW_FRAMEBUFFER_BINDING = 0x8CA6,
+		GL_VALUE_NAME_READ_FRAMEBUFFER_BINDING = 0x8CAA,
 	};
 	std::string getName( GlValueName value );
 	inline std::string toString( GlValueName value ) { return getName( value ); }
@@ -204,27 +204,27 @@ namespace ashes::gl
 	{
 		if ( target == GL_TEXTURE_1D )
 		{
-			list.push_back( makeCmd< OpType::eFramebufferTexture1D >( fboTarget
+			list.emplace< OpType::eFramebufferTexture1D >( fboTarget
 				, GlAttachmentPoint( point + pindex )
 				, target
 				, object
-				, pmipLevel ) );
+				, pmipLevel );
 		}
 		else if ( target == GL_TEXTURE_2D
 			|| target == GL_TEXTURE_2D_MULTISAMPLE )
 		{
-			list.push_back( makeCmd< OpType::eFramebufferTexture2D >( fboTarget
+			list.emplace< OpType::eFramebufferTexture2D >( fboTarget
 				, GlAttachmentPoint( point + pindex )
 				, target
 				, object
-				, pmipLevel ) );
+				, pmipLevel );
 		}
 		else
 		{
-			list.push_back( makeCmd< OpType::eFramebufferTexture >( fboTarget
+			list.emplace< OpType::eFramebufferTexture >( fboTarget
 				, GlAttachmentPoint( point + pindex )
 				, object
-				, pmipLevel ) );
+				, pmipLevel );
 		}
 	}
 
@@ -262,29 +262,29 @@ namespace ashes::gl
 	{
 		if ( target == GL_TEXTURE_1D )
 		{
-			list.push_back( makeCmd< OpType::eFramebufferTexture1D >( fboTarget
+			list.emplace< OpType::eFramebufferTexture1D >( fboTarget
 				, GlAttachmentPoint( point + pindex )
 				, target
 				, object
-				, pmipLevel ) );
+				, pmipLevel );
 		}
 		else if ( target == GL_TEXTURE_2D
 			|| target == GL_TEXTURE_2D_MULTISAMPLE )
 		{
-			list.push_back( makeCmd< OpType::eFramebufferTexture2D >( fboTarget
+			list.emplace< OpType::eFramebufferTexture2D >( fboTarget
 				, GlAttachmentPoint( point + pindex )
 				, target
 				, object
-				, pmipLevel ) );
+				, pmipLevel );
 		}
 		else if ( target == GL_TEXTURE_3D )
 		{
-			list.push_back( makeCmd< OpType::eFramebufferTexture3D >( fboTarget
+			list.emplace< OpType::eFramebufferTexture3D >( fboTarget
 				, GlAttachmentPoint( point + pindex )
 				, target
 				, object
 				, pmipLevel
-				, layer ) );
+				, layer );
 		}
 		else if ( target == GL_TEXTURE_CUBE
 			|| target == GL_TEXTURE_1D_ARRAY
@@ -292,18 +292,18 @@ namespace ashes::gl
 			|| target == GL_TEXTURE_2D_MULTISAMPLE_ARRAY
 			|| target == GL_TEXTURE_CUBE_ARRAY )
 		{
-			list.push_back( makeCmd< OpType::eFramebufferTextureLayer >( fboTarget
+			list.emplace< OpType::eFramebufferTextureLayer >( fboTarget
 				, GlAttachmentPoint( point + pindex )
 				, object
 				, pmipLevel
-				, layer ) );
+				, layer );
 		}
 		else
 		{
-			list.push_back( makeCmd< OpType::eFramebufferTexture >( fboTarget
+			list.emplace< OpType::eFramebufferTexture >( fboTarget
 				, GlAttachmentPoint( point + pindex )
 				, object
-				, pmipLevel ) );
+				, pmipLevel );
 		}
 	}
 
@@ -345,29 +345,29 @@ namespace ashes::gl
 	{
 		if ( target == GL_TEXTURE_1D )
 		{
-			list.push_back( makeCmd< OpType::eFramebufferTexture1D >( fboTarget
+			list.emplace< OpType::eFramebufferTexture1D >( fboTarget
 				, GlAttachmentPoint( point + pindex )
 				, target
 				, object
-				, pmipLevel ) );
+				, pmipLevel );
 		}
 		else if ( target == GL_TEXTURE_2D
 			|| target == GL_TEXTURE_2D_MULTISAMPLE )
 		{
-			list.push_back( makeCmd< OpType::eFramebufferTexture2D >( fboTarget
+			list.emplace< OpType::eFramebufferTexture2D >( fboTarget
 				, GlAttachmentPoint( point + pindex )
 				, target
 				, object
-				, pmipLevel ) );
+				, pmipLevel );
 		}
 		else if ( target == GL_TEXTURE_3D )
 		{
-			list.push_back( makeCmd< OpType::eFramebufferTexture3D >( fboTarget
+			list.emplace< OpType::eFramebufferTexture3D >( fboTarget
 				, GlAttachmentPoint( point + pindex )
 				, target
 				, object
 				, pmipLevel
-				, slice ) );
+				, slice );
 		}
 		else if ( target == GL_TEXTURE_CUBE
 			|| target == GL_TEXTURE_1D_ARRAY
@@ -375,18 +375,18 @@ namespace ashes::gl
 			|| target == GL_TEXTURE_2D_MULTISAMPLE_ARRAY
 			|| target == GL_TEXTURE_CUBE_ARRAY )
 		{
-			list.push_back( makeCmd< OpType::eFramebufferTextureLayer >( fboTarget
+			list.emplace< OpType::eFramebufferTextureLayer >( fboTarget
 				, GlAttachmentPoint( point + pindex )
 				, object
 				, pmipLevel
-				, layer ) );
+				, layer );
 		}
 		else
 		{
-			list.push_back( makeCmd< OpType::eFramebufferTexture >( fboTarget
+			list.emplace< OpType::eFramebufferTexture >( fboTarget
 				, GlAttachmentPoint( point + pindex )
 				, object
-				, pmipLevel ) );
+				, pmipLevel );
 		}
 	}
 
@@ -422,11 +422,11 @@ namespace ashes::gl
 				stack.applySRGBStatus( list, isSrgb );
 			}
 
-			list.push_back( makeCmd< OpType::eReadBuffer >( point ) );
+			list.emplace< OpType::eReadBuffer >( point );
 		}
 
 #if !defined( NDEBUG )
-		list.push_back( makeCmd< OpType::eCheckFramebuffer >() );
+		list.emplace< OpType::eCheckFramebuffer >();
 #endif
 	}
 
@@ -440,11 +440,11 @@ namespace ashes::gl
 				stack.applySRGBStatus( list, isSrgb );
 			}
 
-			list.push_back( makeCmd< OpType::eDrawBuffers >( point ) );
+			list.emplace< OpType::eDrawBuffers >( point );
 		}
 
 #if !defined( NDEBUG )
-		list.push_back( makeCmd< OpType::eCheckFramebuffer >() );
+		list.emplace< OpType::eCheckFramebuffer >();
 #endif
 	}
 
@@ -135,6 +135,8 @@ namespace ashes::gl
 
 	struct ContextState;
 
+	class CmdChunkPool;
+	class CmdList;
 	class CommandBase;
 	class Context;
 	class ContextImpl;
@@ -143,7 +145,11 @@ namespace ashes::gl
 	class ExtensionsHandler;
 	class FrameBufferAttachment;
 	class GeometryBuffers;
+	class VertexArrayCache;
+	class VertexLayout;
 	class ShaderProgram;
+	class SubmitThread;
+	class WorkerPool;
 
 	using ContextPtr = std::unique_ptr< Context >;
 	using CommandPtr = std::unique_ptr< CommandBase >;
@@ -154,10 +160,12 @@ namespace ashes::gl
 	using ContextStateArray = std::vector< ContextState >;
 
 	using ShaderProgramPtr = std::unique_ptr< ShaderProgram >;
+	using WorkerPoolPtr = std::unique_ptr< WorkerPool >;
 	
 	using GeometryBuffersRef = std::reference_wrapper< GeometryBuffers >;
 	using GeometryBuffersPtr = std::unique_ptr< GeometryBuffers >;
 	using GeometryBuffersRefArray = std::vector< GeometryBuffersRef >;
+	using VertexArrayCachePtr = std::unique_ptr< VertexArrayCache >;
 	using VkDeviceMemorySet = std::unordered_set< VkDeviceMemory >;
 
 	struct GlPhysicalDeviceFeatures
@@ -170,6 +178,10 @@ namespace ashes::gl
 		VkBool32 hasTextureViews;
 		VkBool32 hasViewportArrays;
 		VkBool32 hasProgramInterfaceQuery;
+		VkBool32 hasProgramBinary;
+		VkBool32 hasBufferStorage;
+		VkBool32 hasMultiBind;
+		VkBool32 hasVertexAttribBinding;
 	};
 
 	struct AttachmentDescription
@@ -194,8 +206,6 @@ namespace ashes::gl
 	using DeviceMemoryDestroySignal = Signal< DeviceMemoryDestroyFunc >;
 	using DeviceMemoryDestroyConnection = SignalConnection< DeviceMemoryDestroySignal >;
 
-	using CmdBuffer = UInt32Array;
-	using CmdList = std::vector< CmdBuffer >;
 	using PreExecuteAction = std::function< void( CmdList &, ContextStateStack const & ) >;
 	using PreExecuteActions = std::vector< PreExecuteAction >;
 
@@ -16,6 +16,7 @@
 
 #pragma warning( push )
 #pragma warning( disable: 5262 )
+#include <atomic>
 #include <mutex>
 #pragma warning( pop )
 
@@ -24,6 +25,21 @@ namespace ashes::gl
 	class Image
 		: public IcdObject
 	{
+	public:
+		/**
+		*\brief
+		*	Counts of the mip chain regenerations, following uploads of the image memory.
+		*/
+		struct MipmapsCounters
+		{
+			//! The memory uploads that updated the image.
+			std::atomic< uint64_t > uploads{};
+			//! The mip chains regenerated after such an upload.
+			std::atomic< uint64_t > generations{};
+			//! The regenerations skipped, because the same upload also supplied the other levels.
+			std::atomic< uint64_t > skipped{};
+		};
+
 	public:
 		Image( VkAllocationCallbacks const * allocInfo
 			, VkDevice device
@@ -154,6 +170,10 @@ namespace ashes::gl
 		{
 			return *m_binding;
 		}
+		MipmapsCounters & getMipmapsCounters()const noexcept
+		{
+			return m_mipmaps;
+		}
 
 	private:
 		void doInitialiseMemoryRequirements();
@@ -169,6 +189,7 @@ namespace ashes::gl
 		VkMemoryRequirements m_memoryRequirements{};
 		std::mutex m_mtx;
 		ImageViewCache m_views;
+		mutable MipmapsCounters m_mipmaps;
 	};
 }
 
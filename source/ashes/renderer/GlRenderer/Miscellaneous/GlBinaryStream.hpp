@@ -0,0 +1,177 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "renderer/GlRenderer/Shader/GlShaderDesc.hpp"
+
+#include <cstring>
+#include <type_traits>
+
+namespace ashes::gl
+{
+	/**
+	*\brief
+	*	Appends raw values to a bytes buffer, for the caches serialisation.
+	*/
+	class BinaryWriter
+	{
+	public:
+		explicit BinaryWriter( ByteArray & data )
+			: m_data{ data }
+		{
+		}
+
+		void write( void const * data
+			, size_t size )
+		{
+			auto bytes = reinterpret_cast< uint8_t const * >( data );
+			m_data.insert( m_data.end(), bytes, bytes + size );
+		}
+
+		template< typename ValueT >
+		void write( ValueT const & value )
+		{
+			static_assert( std::is_trivially_copyable_v< ValueT > );
+			write( &value, sizeof( ValueT ) );
+		}
+
+		void write( std::string const & value )
+		{
+			write( uint32_t( value.size() ) );
+			write( value.data(), value.size() );
+		}
+
+		void write( ByteArray const & value )
+		{
+			write( uint32_t( value.size() ) );
+			write( value.data(), value.size() );
+		}
+
+	private:
+		ByteArray & m_data;
+	};
+
+	/**
+	*\brief
+	*	Reads back values written by a BinaryWriter.
+	*\remarks
+	*	Each read is bounds checked, since the data may come from the user.
+	*/
+	class BinaryReader
+	{
+	public:
+		explicit BinaryReader( ByteArray const & data )
+			: m_cur{ data.data() }
+			, m_end{ data.data() + data.size() }
+		{
+		}
+
+		bool read( void * data
+			, size_t size )
+		{
+			if ( size_t( m_end - m_cur ) < size )
+			{
+				return false;
+			}
+
+			std::memcpy( data, m_cur, size );
+			m_cur += size;
+			return true;
+		}
+
+		template< typename ValueT >
+		bool read( ValueT & value )
+		{
+			static_assert( std::is_trivially_copyable_v< ValueT > );
+			return read( &value, sizeof( ValueT ) );
+		}
+
+		bool read( std::string & value )
+		{
+			uint32_t size{};
+
+			if ( !read( size )
+				|| size_t( m_end - m_cur ) < size )
+			{
+				return false;
+			}
+
+			value.assign( reinterpret_cast< char const * >( m_cur ), size );
+			m_cur += size;
+			return true;
+		}
+
+		bool read( ByteArray & value )
+		{
+			uint32_t size{};
+
+			if ( !read( size )
+				|| size_t( m_end - m_cur ) < size )
+			{
+				return false;
+			}
+
+			value.assign( m_cur, m_cur + size );
+			m_cur += size;
+			return true;
+		}
+
+	private:
+		uint8_t const * m_cur;
+		uint8_t const * m_end;
+	};
+
+	inline void write( BinaryWriter & writer
+		, ConstantsLayout const & value )
+	{
+		writer.write( uint32_t( value.size() ) );
+
+		for ( auto & constant : value )
+		{
+			writer.write( uint32_t( constant.stageFlag ) );
+			writer.write( constant.name );
+			writer.write( constant.location );
+			writer.write( uint32_t( constant.format ) );
+			writer.write( constant.size );
+			writer.write( constant.arraySize );
+			writer.write( constant.offset );
+		}
+	}
+
+	inline bool read( BinaryReader & reader
+		, ConstantsLayout & value )
+	{
+		uint32_t count{};
+
+		if ( !reader.read( count ) )
+		{
+			return false;
+		}
+
+		for ( uint32_t i = 0u; i < count; ++i )
+		{
+			ConstantDesc constant{};
+			uint32_t stageFlag{};
+			uint32_t format{};
+
+			if ( !reader.read( stageFlag )
+				|| !reader.read( constant.name )
+				|| !reader.read( constant.location )
+				|| !reader.read( format )
+				|| !reader.read( constant.size )
+				|| !reader.read( constant.arraySize )
+				|| !reader.read( constant.offset ) )
+			{
+				return false;
+			}
+
+			constant.stageFlag = VkShaderStageFlagBits( stageFlag );
+			constant.format = ConstantFormat( format );
+			value.push_back( std::move( constant ) );
+		}
+
+		return true;
+	}
+}
@@ -428,7 +428,7 @@ namespace ashes::gl
 #	define glLogNonVoidEmptyCall( lock, name, ... )\
 	executeNonVoidFunction( lock, ashes::gl::getContext( lock ).m_##name, #name )
 #	define glLogCommand( list, name )\
-	list.push_back( makeCmd< OpType::eLogCommand >( name ) );
+	list.emplace< OpType::eLogCommand >( name );
 #elif defined( NDEBUG )
 #	define glLogEmptyCall( lock, name )\
 	( ( lock->m_##name() ), glCallCheckOutOfMemory( lock ) )
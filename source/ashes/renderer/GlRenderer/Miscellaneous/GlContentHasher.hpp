@@ -0,0 +1,90 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "renderer/GlRenderer/GlRendererPrerequisites.hpp"
+
+#include <string_view>
+#include <type_traits>
+
+namespace ashes::gl
+{
+	/**
+	*\brief
+	*	A 128 bits content hash, used as a key for caches that can be persisted.
+	*/
+	struct ContentHash
+	{
+		uint64_t low{};
+		uint64_t high{};
+
+	private:
+		friend bool operator==( ContentHash const & lhs
+			, ContentHash const & rhs )noexcept
+		{
+			return lhs.low == rhs.low
+				&& lhs.high == rhs.high;
+		}
+
+		friend bool operator!=( ContentHash const & lhs
+			, ContentHash const & rhs )noexcept
+		{
+			return !operator==( lhs, rhs );
+		}
+	};
+
+	struct ContentHashHasher
+	{
+		size_t operator()( ContentHash const & value )const noexcept
+		{
+			return size_t( value.low ^ value.high );
+		}
+	};
+
+	/**
+	*\brief
+	*	Computes a ContentHash from raw bytes.
+	*\remarks
+	*	Unlike std::hash, the result is the same from one run to another,
+	*	it uses two independent 64 bits lanes (FNV-1a, and a multiply-rotate one).
+	*/
+	class ContentHasher
+	{
+	public:
+		void add( void const * data
+			, size_t size )noexcept
+		{
+			auto bytes = static_cast< uint8_t const * >( data );
+
+			for ( auto it = bytes; it != bytes + size; ++it )
+			{
+				m_value.low = ( m_value.low ^ *it ) * 0x100000001B3ULL;
+				m_value.high = ( m_value.high ^ *it ) * 0x9E3779B97F4A7C15ULL;
+				m_value.high = ( m_value.high << 29u ) | ( m_value.high >> 35u );
+			}
+		}
+
+		template< typename ValueT >
+		void add( ValueT const & value )noexcept
+		{
+			static_assert( std::is_trivially_copyable_v< ValueT > );
+			add( &value, sizeof( ValueT ) );
+		}
+
+		void add( std::string_view value )noexcept
+		{
+			add( uint32_t( value.size() ) );
+			add( value.data(), value.size() );
+		}
+
+		ContentHash const & get()const noexcept
+		{
+			return m_value;
+		}
+
+	private:
+		ContentHash m_value{ 0xCBF29CE484222325ULL, 0x84222325CBF29CE4ULL };
+	};
+}
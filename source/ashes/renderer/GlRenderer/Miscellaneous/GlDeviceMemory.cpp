@@ -33,6 +33,14 @@ namespace ashes::gl
 			return memProps.memoryTypes[memoryTypeIndex].propertyFlags;
 		}
 
+		static bool usePersistentMapping( VkDevice device
+			, VkMemoryPropertyFlags flags )
+		{
+			return hasBufferStorage( device )
+				&& ashes::checkFlag( flags, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT )
+				&& ashes::checkFlag( flags, VK_MEMORY_PROPERTY_HOST_COHERENT_BIT );
+		}
+
 #if !defined( NDEBUG )
 
 		static uint32_t constexpr ControlValueCount = 64u;
@@ -83,14 +91,55 @@ namespace ashes::gl
 		: m_device{ device }
 		, m_allocateInfo{ std::move( allocateInfo ) }
 		, m_flags{ mem::getFlags( m_device, m_allocateInfo.memoryTypeIndex ) }
+		, m_mapFlags{ convertMemoryMapFlags( m_flags ) }
 	{
-		m_data.resize( allocateInfo.allocationSize + mem::ControlValueCount );
-		mem::initControlValue( m_data );
 		// Create the buffer effectively owning the data
 		auto context = get( m_device )->getContext();
-		m_internal = context->createBuffer( GL_BUFFER_TARGET_COPY_WRITE
-			, GLsizeiptr( m_allocateInfo.allocationSize )
-			, getBufferDataUsageFlags( m_flags ) );
+
+		if ( mem::usePersistentMapping( m_device, m_flags ) )
+		{
+			// Host visible memory is directly the GL buffer, mapped once for all.
+			m_internal = context->createStorageBuffer( GL_BUFFER_TARGET_COPY_WRITE
+				, GLsizeiptr( m_allocateInfo.allocationSize )
+				, gl4::convertMemoryPropertyFlags( m_flags ) | gl4::GL_MEMORY_PROPERTY_DYNAMIC_STORAGE_BIT );
+			m_mapFlags = GL_MEMORY_MAP_READ_BIT
+				| GL_MEMORY_MAP_WRITE_BIT
+				| GL_MEMORY_MAP_PERSISTENT_BIT
+				| GL_MEMORY_MAP_COHERENT_BIT;
+			glLogCall( context
+				, glBindBuffer
+				, GL_BUFFER_TARGET_COPY_WRITE
+				, m_internal );
+			auto mapped = glLogNonVoidCall( context
+				, glMapBufferRange
+				, GL_BUFFER_TARGET_COPY_WRITE
+				, 0
+				, GLsizeiptr( m_allocateInfo.allocationSize )
+				, m_mapFlags );
+			m_persistent = static_cast< uint8_t * >( mapped );
+			glLogCall( context
+				, glBindBuffer
+				, GL_BUFFER_TARGET_COPY_WRITE
+				, 0u );
+
+			if ( !m_persistent )
+			{
+				context->deleteBuffer( m_internal );
+				m_internal = GL_INVALID_INDEX;
+				m_mapFlags = convertMemoryMapFlags( m_flags );
+			}
+		}
+
+		if ( !m_persistent )
+		{
+			m_data.resize( m_allocateInfo.allocationSize + mem::ControlValueCount );
+			mem::initControlValue( m_data );
+			m_pages = std::make_unique< DirtyPageTracker >( m_allocateInfo.allocationSize );
+			m_internal = context->createBuffer( GL_BUFFER_TARGET_COPY_WRITE
+				, GLsizeiptr( m_allocateInfo.allocationSize )
+				, getBufferDataUsageFlags( m_flags ) );
+		}
+
 		registerObject( m_device, *this );
 	}
 
@@ -98,6 +147,7 @@ namespace ashes::gl
 	{
 		unregisterObject( m_device, *this );
 		auto context = get( m_device )->getContext();
+		// A persistently mapped buffer is implicitly unmapped by its deletion.
 		context->deleteBuffer( m_internal );
 	}
 
@@ -132,6 +182,7 @@ namespace ashes::gl
 			if ( auto const & binding = *it->second;
 				!m_data.empty() && binding.isMapped() )
 			{
+				// In persistent mode, the buffer binding already is the GL buffer.
 				auto context = get( m_device )->getContext();
 				binding.upload( context
 					, m_data
@@ -180,7 +231,7 @@ namespace ashes::gl
 			}
 
 			if ( auto const & binding = *it->second;
-				!m_data.empty() && binding.isMapped() )
+				binding.isMapped() )
 			{
 				auto context = get( m_device )->getContext();
 				glLogCall( context
@@ -189,7 +240,7 @@ namespace ashes::gl
 					, getInternal() );
 				binding.upload( context
 					, m_data
-					, BindingRange{ 0u, m_data.size() } );
+					, BindingRange{ 0u, getSize() } );
 				glLogCall( context
 					, glBindBuffer
 					, GL_BUFFER_TARGET_PIXEL_UNPACK
@@ -247,51 +298,26 @@ namespace ashes::gl
 	void DeviceMemory::upload( ContextLock const & context
 		, BindingRange const & range )const noexcept
 	{
-		assert( !m_data.empty() );
-		glLogCall( context
-			, glBindBuffer
-			, GL_BUFFER_TARGET_COPY_WRITE
-			, getInternal() );
-		auto result = glLogNonVoidCall( context
-			, glMapBufferRange
-			, GL_BUFFER_TARGET_COPY_WRITE
-			, GLintptr( range.getOffset() )
-			, GLsizei( range.getSize() )
-			, GL_MEMORY_MAP_WRITE_BIT );
-
-		if ( result )
+		if ( !m_persistent )
 		{
-			std::memcpy( result, m_data.data() + range.getOffset(), range.getSize() );
-			glLogCall( context
-				, glUnmapBuffer
-				, GL_BUFFER_TARGET_COPY_WRITE );
+			assert( !m_data.empty() );
+			doUploadData( context, range );
+			// Not hashed, that would cost as much as the upload.
+			m_pages->invalidate( range );
 		}
 
-		glLogCall( context
-			, glBindBuffer
-			, GL_BUFFER_TARGET_COPY_WRITE
-			, 0u );
-		glLogCall( context
-			, glBindBuffer
-			, GL_BUFFER_TARGET_PIXEL_UNPACK
-			, getInternal() );
-
-		for ( auto const & [_, binding] : m_bindings )
-		{
-			binding->upload( context
-				, m_data
-				, range );
-		}
-
-		glLogCall( context
-			, glBindBuffer
-			, GL_BUFFER_TARGET_PIXEL_UNPACK
-			, 0u );
+		doUploadBindings( context, range );
 	}
 
 	void DeviceMemory::download( ContextLock const & context
 		, BindingRange const & range )const noexcept
 	{
+		if ( m_persistent )
+		{
+			// Coherent mapping, the GPU writes are already visible.
+			return;
+		}
+
 		assert( !m_data.empty() );
 		glLogCall( context
 			, glBindBuffer
@@ -310,6 +336,7 @@ namespace ashes::gl
 			glLogCall( context
 				, glUnmapBuffer
 				, GL_BUFFER_TARGET_COPY_READ );
+			m_pages->synchronise( m_data.data(), range );
 		}
 
 		glLogCall( context
@@ -330,13 +357,16 @@ namespace ashes::gl
 		}
 
 		m_mappedRange = BindingRange{ offset, size };
+		m_flushed = false;
 
 		for ( auto & [key, binding] : m_bindings )
 		{
 			binding->map( m_mappedRange );
 		}
 
-		*data = m_data.data() + offset;
+		*data = ( m_persistent
+			? m_persistent + offset
+			: m_data.data() + offset );
 		m_dirty = true;
 		return VK_SUCCESS;
 	}
@@ -353,11 +383,25 @@ namespace ashes::gl
 		}
 
 		m_dirty = false;
-		mem::checkControlValue( m_data );
 
-		if ( size != 0 )
+		if ( !m_persistent )
 		{
-			upload( context, range.getOffset(), range.getSize() );
+			mem::checkControlValue( m_data );
+		}
+
+		if ( size == 0 )
+		{
+			return VK_SUCCESS;
+		}
+
+		if ( m_persistent )
+		{
+			upload( context, range );
+		}
+		else
+		{
+			doUploadDirty( context, range );
+			m_flushed = true;
 		}
 
 		return VK_SUCCESS;
@@ -375,7 +419,11 @@ namespace ashes::gl
 		}
 
 		m_dirty = true;
-		mem::checkControlValue( m_data );
+
+		if ( !m_persistent )
+		{
+			mem::checkControlValue( m_data );
+		}
 
 		if ( size != 0 )
 		{
@@ -394,12 +442,88 @@ namespace ashes::gl
 			dirty = binding->unmap() || dirty;
 		}
 
-		if ( m_mappedRange )
+		// When the application flushed its writes, only the flushed ranges are compared with the GL buffer.
+		// Otherwise the whole mapped range is uploaded, without hashing it.
+		if ( m_mappedRange
+			&& !m_flushed )
 		{
-			upload( context, m_mappedRange.getOffset(), m_mappedRange.getSize() );
+			upload( context, m_mappedRange );
 		}
 
 		m_mappedRange = BindingRange{};
+		m_flushed = false;
+	}
+
+	void DeviceMemory::invalidatePages( BindingRange const & range )const noexcept
+	{
+		if ( m_pages )
+		{
+			m_pages->invalidate( range );
+		}
+	}
+
+	void DeviceMemory::doUploadData( ContextLock const & context
+		, BindingRange const & range )const noexcept
+	{
+		glLogCall( context
+			, glBindBuffer
+			, GL_BUFFER_TARGET_COPY_WRITE
+			, getInternal() );
+		glLogCall( context
+			, glBufferSubData
+			, GL_BUFFER_TARGET_COPY_WRITE
+			, GLintptr( range.getOffset() )
+			, GLsizeiptr( range.getSize() )
+			, m_data.data() + range.getOffset() );
+		glLogCall( context
+			, glBindBuffer
+			, GL_BUFFER_TARGET_COPY_WRITE
+			, 0u );
+	}
+
+	void DeviceMemory::doUploadDirty( ContextLock const & context
+		, BindingRange const & range )const noexcept
+	{
+		auto spans = m_pages->collect( m_data.data(), range );
+		VkDeviceSize uploaded{};
+
+		for ( auto & span : spans )
+		{
+			doUploadData( context, span );
+			uploaded += span.getSize();
+		}
+
+		auto & counters = get( m_device )->getMappedUploadCounters();
+		counters.requested += range.getSize();
+		counters.uploaded += uploaded;
+
+		if ( !spans.empty() )
+		{
+			doUploadBindings( context
+				, BindingRange{ spans.front().getMin()
+					, spans.back().getMax() - spans.front().getMin() } );
+		}
+	}
+
+	void DeviceMemory::doUploadBindings( ContextLock const & context
+		, BindingRange const & range )const noexcept
+	{
+		glLogCall( context
+			, glBindBuffer
+			, GL_BUFFER_TARGET_PIXEL_UNPACK
+			, getInternal() );
+
+		for ( auto const & [_, binding] : m_bindings )
+		{
+			binding->upload( context
+				, m_data
+				, range );
+		}
+
+		glLogCall( context
+			, glBindBuffer
+			, GL_BUFFER_TARGET_PIXEL_UNPACK
+			, 0u );
 	}
 
 	//************************************************************************************************
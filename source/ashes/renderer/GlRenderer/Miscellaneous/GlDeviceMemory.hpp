@@ -8,6 +8,7 @@ See LICENSE file in root folder
 
 #include "renderer/GlRenderer/Enum/GlMemoryMapFlag.hpp"
 #include "renderer/GlRenderer/Miscellaneous/GlDeviceMemoryBinding.hpp"
+#include "renderer/GlRenderer/Miscellaneous/GlDirtyPageTracker.hpp"
 
 namespace ashes::gl
 {
@@ -41,6 +42,12 @@ namespace ashes::gl
 			, VkDeviceSize offset
 			, VkDeviceSize size )const noexcept;
 		void unlock( ContextLock const & context )const noexcept;
+		/**
+		*\brief
+		*	To be called when the GPU may have written \p range of the GL buffer,
+		*	the shadow copy pages over it are then considered dirty.
+		*/
+		void invalidatePages( BindingRange const & range )const noexcept;
 
 		void upload( ContextLock const & context
 			, VkDeviceSize offset
@@ -65,6 +72,22 @@ namespace ashes::gl
 		{
 			return m_device;
 		}
+		/**
+		*\brief
+		*	Tells if the GL buffer is persistently mapped, in which case there is no shadow copy.
+		*/
+		bool isPersistentlyMapped()const noexcept
+		{
+			return m_persistent != nullptr;
+		}
+
+	private:
+		void doUploadData( ContextLock const & context
+			, BindingRange const & range )const noexcept;
+		void doUploadDirty( ContextLock const & context
+			, BindingRange const & range )const noexcept;
+		void doUploadBindings( ContextLock const & context
+			, BindingRange const & range )const noexcept;
 
 	public:
 		DeviceMemoryDestroySignal onDestroy;
@@ -78,6 +101,12 @@ namespace ashes::gl
 		std::vector< std::pair< VkDeviceSize, DeviceMemoryBindingPtr > > m_bindings;
 		mutable bool m_dirty = true;
 		mutable BindingRange m_mappedRange;
+		// Tells if ranges of the current mapping were flushed.
+		mutable bool m_flushed{};
 		mutable ByteArray m_data;
+		// The persistent and coherent mapping of the GL buffer, replaces m_data when available.
+		uint8_t * m_persistent{};
+		// The pages of m_data modified since their last synchronisation with the GL buffer.
+		std::unique_ptr< DirtyPageTracker > m_pages;
 	};
 }
@@ -0,0 +1,147 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#include "Miscellaneous/GlDirtyPageTracker.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace ashes::gl
+{
+	DirtyPageTracker::DirtyPageTracker( VkDeviceSize size )
+		: m_size{ size }
+		, m_hashes( size_t( ( size + PageSize - 1u ) / PageSize ) )
+		, m_synchronised( m_hashes.size(), false )
+	{
+	}
+
+	void DirtyPageTracker::synchronise( uint8_t const * data
+		, BindingRange const & range )
+	{
+		auto clamped = range.intersect( BindingRange{ 0u, m_size } );
+
+		if ( !clamped )
+		{
+			return;
+		}
+
+		std::lock_guard< std::mutex > lock{ m_mutex };
+
+		for ( auto page = doGetFirstPage( clamped ); page <= doGetLastPage( clamped ); ++page )
+		{
+			m_hashes[page] = doHashPage( data, page );
+			m_synchronised[page] = true;
+		}
+	}
+
+	void DirtyPageTracker::invalidate( BindingRange const & range )
+	{
+		auto clamped = range.intersect( BindingRange{ 0u, m_size } );
+
+		if ( !clamped )
+		{
+			return;
+		}
+
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		std::fill( m_synchronised.begin() + ptrdiff_t( doGetFirstPage( clamped ) )
+			, m_synchronised.begin() + ptrdiff_t( doGetLastPage( clamped ) + 1u )
+			, false );
+	}
+
+	std::vector< BindingRange > DirtyPageTracker::collect( uint8_t const * data
+		, BindingRange const & range )
+	{
+		std::vector< BindingRange > result;
+		auto clamped = range.intersect( BindingRange{ 0u, m_size } );
+
+		if ( !clamped )
+		{
+			return result;
+		}
+
+		std::lock_guard< std::mutex > lock{ m_mutex };
+
+		for ( auto page = doGetFirstPage( clamped ); page <= doGetLastPage( clamped ); ++page )
+		{
+			auto span = doGetPageRange( page );
+
+			if ( !m_synchronised[page]
+				&& clamped.intersect( span ).getSize() != span.getSize() )
+			{
+				// Only the flushed part is known to be up to date, the GPU may have written the rest.
+				span = clamped.intersect( span );
+			}
+			else
+			{
+				// The whole page is uploaded, so that a later flush of its other parts can rely on the hash.
+				auto hash = doHashPage( data, page );
+
+				if ( m_synchronised[page]
+					&& m_hashes[page] == hash )
+				{
+					continue;
+				}
+
+				m_hashes[page] = hash;
+				m_synchronised[page] = true;
+			}
+
+			if ( !result.empty()
+				&& result.back().getMax() == span.getMin() )
+			{
+				result.back() = BindingRange{ result.back().getOffset()
+					, result.back().getSize() + span.getSize() };
+			}
+			else
+			{
+				result.push_back( span );
+			}
+		}
+
+		return result;
+	}
+
+	size_t DirtyPageTracker::doGetFirstPage( BindingRange const & range )const noexcept
+	{
+		return size_t( range.getMin() / PageSize );
+	}
+
+	size_t DirtyPageTracker::doGetLastPage( BindingRange const & range )const noexcept
+	{
+		return size_t( ( range.getMax() - 1u ) / PageSize );
+	}
+
+	BindingRange DirtyPageTracker::doGetPageRange( size_t page )const noexcept
+	{
+		auto offset = VkDeviceSize( page ) * PageSize;
+		return BindingRange{ offset, std::min( PageSize, m_size - offset ) };
+	}
+
+	uint64_t DirtyPageTracker::doHashPage( uint8_t const * data
+		, size_t page )const noexcept
+	{
+		// Processes 8 bytes at a time, since it runs over each flushed range.
+		auto begin = data + page * PageSize;
+		auto size = size_t( std::min( PageSize, m_size - page * PageSize ) );
+		auto end = begin + size;
+		uint64_t result = 0xCBF29CE484222325ULL ^ size;
+		auto it = begin;
+
+		for ( ; it + sizeof( uint64_t ) <= end; it += sizeof( uint64_t ) )
+		{
+			uint64_t value;
+			std::memcpy( &value, it, sizeof( uint64_t ) );
+			result = ( result ^ value ) * 0x9E3779B97F4A7C15ULL;
+			result ^= result >> 32u;
+		}
+
+		for ( ; it != end; ++it )
+		{
+			result = ( result ^ *it ) * 0x100000001B3ULL;
+		}
+
+		return result;
+	}
+}
@@ -0,0 +1,65 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "renderer/GlRenderer/Miscellaneous/GlDeviceMemoryBinding.hpp"
+
+#include <mutex>
+#include <vector>
+
+namespace ashes::gl
+{
+	/**
+	*\brief
+	*	Tracks, at a page granularity, which parts of a device memory shadow copy differ from the GL buffer.
+	*\remarks
+	*	Each page holds the hash of its content when it was last synchronised with the GL buffer.
+	*	A page is dirty when its content no longer matches that hash, or when it isn't known to be synchronised
+	*	(never synchronised, or invalidated since, when the GPU may have written it).
+	*	The pages are invalidated at replay, maybe on a submission thread, hence the tracker is thread safe.
+	*/
+	class DirtyPageTracker
+	{
+	public:
+		static VkDeviceSize constexpr PageSize = 4096u;
+
+	public:
+		explicit DirtyPageTracker( VkDeviceSize size );
+		/**
+		*\brief
+		*	Records the pages overlapping \p range as synchronised with the GL buffer.
+		*/
+		void synchronise( uint8_t const * data
+			, BindingRange const & range );
+		/**
+		*\brief
+		*	Records the pages overlapping \p range as not synchronised with the GL buffer anymore.
+		*/
+		void invalidate( BindingRange const & range );
+		/**
+		*\return
+		*	The dirty parts of \p range, as page aligned spans, coalesced.
+		*\remarks
+		*	A dirty page is returned whole, and considered synchronised afterwards,
+		*	unless it's partly out of \p range and not synchronised: the GPU may have written the rest of it,
+		*	so only its part in \p range is returned, and it stays not synchronised.
+		*/
+		std::vector< BindingRange > collect( uint8_t const * data
+			, BindingRange const & range );
+
+	private:
+		size_t doGetFirstPage( BindingRange const & range )const noexcept;
+		size_t doGetLastPage( BindingRange const & range )const noexcept;
+		uint64_t doHashPage( uint8_t const * data
+			, size_t page )const noexcept;
+		BindingRange doGetPageRange( size_t page )const noexcept;
+
+	private:
+		std::mutex m_mutex;
+		VkDeviceSize m_size;
+		std::vector< uint64_t > m_hashes;
+		std::vector< bool > m_synchronised;
+	};
+}
@@ -60,10 +60,12 @@ namespace ashes::gl
 	makeGlExtension( 4, 3, ARB_texture_buffer_range );
 	makeGlExtension( 4, 3, ARB_texture_storage_multisample );
 	makeGlExtension( 4, 3, ARB_texture_view );
+	makeGlExtension( 4, 3, ARB_vertex_attrib_binding );
 	makeGlExtension( 4, 3, KHR_debug );
 	// Core since OpenGL 4.4
 	makeGlExtension( 4, 4, ARB_buffer_storage );
 	makeGlExtension( 4, 4, ARB_clear_texture );
+	makeGlExtension( 4, 4, ARB_multi_bind );
 	// Core since OpenGL 4.5
 	makeGlExtension( 4, 5, ARB_clip_control );
 	makeGlExtension( 4, 5, ARB_gl_spirv );
@@ -77,6 +79,7 @@ namespace ashes::gl
 	makeGlExtension( NotInCore, NotInCore, ARB_debug_output );
 	makeGlExtension( NotInCore, NotInCore, ARB_gpu_shader_int64 );
 	makeGlExtension( NotInCore, NotInCore, ARB_gpu_shader_fp64 );
+	makeGlExtension( NotInCore, NotInCore, ARB_parallel_shader_compile );
 	makeGlExtension( NotInCore, NotInCore, ARB_pipeline_statistics_query );
 	makeGlExtension( NotInCore, NotInCore, ARB_sparse_buffer );
 	makeGlExtension( NotInCore, NotInCore, ARB_sparse_texture2 );
@@ -85,6 +88,7 @@ namespace ashes::gl
 	makeGlExtension( NotInCore, NotInCore, EXT_shader_image_load_formatted );
 	makeGlExtension( NotInCore, NotInCore, EXT_texture_compression_s3tc );
 	makeGlExtension( NotInCore, NotInCore, EXT_texture_sRGB );
+	makeGlExtension( NotInCore, NotInCore, KHR_parallel_shader_compile );
 	makeGlExtension( NotInCore, NotInCore, KHR_texture_compression_astc_ldr );
 	makeGlExtension( NotInCore, NotInCore, KHR_texture_compression_astc_hdr );
 #undef makeGlExtension
@@ -124,6 +128,11 @@ namespace ashes::gl
 			return m_features;
 		}
 
+		StringArray const & getExtensionNames()const noexcept
+		{
+			return m_deviceExtensionNames;
+		}
+
 	private:
 		StringArray m_deviceExtensionNames;
 		StringArray m_deviceSPIRVExtensionNames;
@@ -9,6 +9,8 @@ See LICENSE file in root folder
 
 #include "ashesgl_api.hpp"
 
+#include <algorithm>
+
 #pragma warning( disable: 4127 )
 
 namespace ashes::gl
@@ -141,6 +143,30 @@ namespace ashes::gl
 			m_updateRegions.push_back( bufferCopyRegion );
 			offset += levelSize;
 		}
+
+		// And the other mip levels, uploaded only when the application writes them in memory.
+		auto alignment = uint32_t( getMinimalSize( m_texture->getFormatVk() ) );
+		offset = 0u;
+
+		for ( uint32_t layer = 0; layer < m_texture->getArrayLayers(); layer++ )
+		{
+			bufferCopyRegion.imageSubresource.baseArrayLayer = layer;
+
+			for ( uint32_t level = 1u; level < m_texture->getMipLevels(); ++level )
+			{
+				bufferCopyRegion.imageSubresource.mipLevel = level;
+				bufferCopyRegion.imageExtent = getSubresourceDimensions( m_texture->getDimensions(), level );
+				bufferCopyRegion.bufferOffset = offset
+					+ getLevelsSize( m_texture->getDimensions()
+						, m_texture->getFormatVk()
+						, 0u
+						, level
+						, alignment );
+				m_levelRegions.push_back( bufferCopyRegion );
+			}
+
+			offset += levelSize;
+		}
 	}
 
 	ImageMemoryBinding::~ImageMemoryBinding()noexcept
@@ -193,6 +219,8 @@ namespace ashes::gl
 		}
 
 		setupUpdateRegions( inter );
+		auto begin = inter.getOffset() - getOffset();
+		auto end = begin + inter.getSize();
 		glLogCall( context
 			, glPixelStorei
 			, GL_UNPACK_ALIGNMENT
@@ -207,19 +235,40 @@ namespace ashes::gl
 			updateRegion( context, m_updateRegions[i] );
 		}
 
-		if ( m_texture->getMipLevels() > 1
-			&& !isCompressedFormat( m_texture->getFormatVk() ) )
+		bool baseWritten = std::any_of( m_updateRegions.begin()
+			, m_updateRegions.end()
+			, [this, begin, end]( VkBufferImageCopy const & region )
+			{
+				return isInRange( region, begin, end );
+			} );
+		bool levelsWritten = false;
+
+		for ( auto & region : m_levelRegions )
 		{
-			if ( context->hasMemoryBarrier() )
+			if ( isInRange( region, begin, end ) )
 			{
-				glLogCall( context
-					, glMemoryBarrier
-					, GL_MEMORY_BARRIER_TEXTURE_UPDATE );
+				updateRegion( context, region );
+				levelsWritten = true;
 			}
+		}
 
-			glLogCall( context
-				, glGenerateMipmap
-				, m_texture->getTarget() );
+		auto & counters = m_texture->getMipmapsCounters();
+		++counters.uploads;
+
+		// The mip chain is regenerated from the base level, unless the same upload supplies the other levels.
+		if ( baseWritten
+			&& m_texture->getMipLevels() > 1
+			&& !isCompressedFormat( m_texture->getFormatVk() ) )
+		{
+			if ( levelsWritten )
+			{
+				++counters.skipped;
+			}
+			else
+			{
+				doGenerateMipmaps( context );
+				++counters.generations;
+			}
 		}
 
 		glLogCall( context
@@ -228,6 +277,32 @@ namespace ashes::gl
 			, 0u );
 	}
 
+	bool ImageMemoryBinding::isInRange( VkBufferImageCopy const & region
+		, VkDeviceSize begin
+		, VkDeviceSize end )const
+	{
+		auto size = ashes::getSize( region.imageExtent
+			, m_texture->getFormatVk()
+			, 0u
+			, uint32_t( getMinimalSize( m_texture->getFormatVk() ) ) );
+		return region.bufferOffset < end
+			&& region.bufferOffset + size > begin;
+	}
+
+	void ImageMemoryBinding::doGenerateMipmaps( ContextLock const & context )const
+	{
+		if ( context->hasMemoryBarrier() )
+		{
+			glLogCall( context
+				, glMemoryBarrier
+				, GL_MEMORY_BARRIER_TEXTURE_UPDATE );
+		}
+
+		glLogCall( context
+			, glGenerateMipmap
+			, m_texture->getTarget() );
+	}
+
 	void ImageMemoryBinding::setImage1D( ContextLock const & context )
 	{
 		if ( false && isCompressedFormat( m_texture->getFormatVk() ) )
@@ -558,8 +633,7 @@ namespace ashes::gl
 		if ( isCompressedFormat( m_texture->getFormatVk() ) )
 		{
 			auto layerSize = ashes::getSize( copyInfo.imageExtent
-				, m_texture->getFormatVk()
-				, copyInfo.imageSubresource.mipLevel );
+				, m_texture->getFormatVk() );
 
 			switch ( m_texture->getTarget() )
 			{
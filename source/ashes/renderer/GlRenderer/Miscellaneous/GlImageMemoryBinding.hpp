@@ -39,10 +39,16 @@ namespace ashes::gl
 		void setupUpdateRegions( BindingRange const & range )const;
 		void updateRegion( ContextLock const & context
 			, VkBufferImageCopy const & copyInfo )const;
+		bool isInRange( VkBufferImageCopy const & region
+			, VkDeviceSize begin
+			, VkDeviceSize end )const;
+		void doGenerateMipmaps( ContextLock const & context )const;
 
 	private:
 		Image * m_texture;
 		std::vector< VkBufferImageCopy > m_updateRegions;
+		//! The regions of the mip levels above the base one, layer by layer.
+		std::vector< VkBufferImageCopy > m_levelRegions;
 		mutable size_t m_beginRegion{ 0u };
 		mutable size_t m_endRegion{ 0u };
 	};
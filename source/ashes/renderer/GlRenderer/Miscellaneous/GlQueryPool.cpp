@@ -1,10 +1,15 @@
 #include "Miscellaneous/GlQueryPool.hpp"
 
+#include "Command/GlSubmitThread.hpp"
 #include "Core/GlDevice.hpp"
 #include "Miscellaneous/GlCallLogger.hpp"
 
 #include "ashesgl_api.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
 namespace ashes::gl
 {
 	QueryPool::QueryPool( [[maybe_unused]] VkAllocationCallbacks const * allocInfo
@@ -15,6 +20,7 @@ namespace ashes::gl
 		, m_queryCount{ createInfo.queryCount }
 		, m_pipelineStatistics{ getQueryTypes( createInfo.pipelineStatistics ) }
 		, m_names( size_t( m_queryCount ), GLuint( GL_INVALID_INDEX ) )
+		, m_pending( m_names.size() )
 	{
 		assert( m_queryType != VK_QUERY_TYPE_PIPELINE_STATISTICS
 			|| m_queryCount == m_pipelineStatistics.size()
@@ -45,44 +51,166 @@ namespace ashes::gl
 		, VkQueryResultFlags flags
 		, void * buffer )const
 	{
-		assert( firstQuery + queryCount <= m_names.size() );
 		auto begin = m_names.begin() + firstQuery;
-		auto end = begin + ( m_queryType == VK_QUERY_TYPE_PIPELINE_STATISTICS ? uint32_t( m_pipelineStatistics.size() ) : queryCount );
+		auto end = doGetEnd( firstQuery, queryCount );
+		auto is64 = checkFlag( flags, VK_QUERY_RESULT_64_BIT );
+		auto valueSize = is64
+			? sizeof( GLuint64 )
+			: sizeof( GLuint );
+		auto withAvailability = checkFlag( flags, VK_QUERY_RESULT_WITH_AVAILABILITY_BIT );
+		auto wait = checkFlag( flags, VK_QUERY_RESULT_WAIT_BIT );
+		auto partial = checkFlag( flags, VK_QUERY_RESULT_PARTIAL_BIT );
+		stride = stride
+			? stride
+			: ( withAvailability ? 2u * valueSize : valueSize );
 		auto buf = reinterpret_cast< uint8_t * >( buffer );
+		auto write = [is64]( uint8_t * dst, GLuint64 value )
+		{
+			if ( is64 )
+			{
+				std::memcpy( dst, &value, sizeof( GLuint64 ) );
+			}
+			else
+			{
+				auto value32 = GLuint( value );
+				std::memcpy( dst, &value32, sizeof( GLuint ) );
+			}
+		};
+		VkResult result = VK_SUCCESS;
 
-		if ( checkFlag( flags, VK_QUERY_RESULT_64_BIT ) )
+		for ( auto it = begin; it != end; ++it )
 		{
-			stride = stride
-				? stride
-				: sizeof( GLuint64 );
+			GLuint available = GL_TRUE;
 
-			for ( auto it = begin; it != end; ++it )
+			if ( doIsPending( size_t( std::distance( m_names.begin(), it ) ) ) )
+			{
+				// Not replayed yet, the GL query holds a previous result, if any.
+				available = GL_FALSE;
+			}
+			else if ( !wait )
 			{
+				glLogCall( context
+					, glGetQueryObjectuiv
+					, *it
+					, GL_QUERY_RESULT_AVAILABLE
+					, &available );
+			}
+
+			if ( available )
+			{
+				GLuint64 value{};
 				glLogCall( context
 					, glGetQueryObjectui64v
 					, *it
-					, convertQueryResultFlags( flags )
-					, reinterpret_cast< GLuint64 * >( buf ) );
-				buf += stride;
+					, GL_QUERY_RESULT
+					, &value );
+				write( buf, value );
+			}
+			else
+			{
+				result = VK_NOT_READY;
+
+				if ( partial )
+				{
+					write( buf, 0u );
+				}
+			}
+
+			if ( withAvailability )
+			{
+				write( buf + valueSize, available );
 			}
+
+			buf += stride;
 		}
-		else
+
+		return result;
+	}
+
+	void QueryPool::setPending( uint32_t query
+		, SubmitThread const & thread
+		, uint64_t serial )const
+	{
+		// A pipeline statistics query uses one name per statistic.
+		auto count = m_queryType == VK_QUERY_TYPE_PIPELINE_STATISTICS
+			? m_pipelineStatistics.size()
+			: 1u;
+		std::lock_guard< std::mutex > lock{ m_pendingMutex };
+
+		for ( auto index = size_t( query ); index < std::min( size_t( query ) + count, m_pending.size() ); ++index )
 		{
-			stride = stride
-				? stride
-				: sizeof( GLuint );
+			m_pending[index] = { &thread, serial };
+		}
+	}
 
-			for ( auto it = begin; it != end; ++it )
+	void QueryPool::resolveResults( ContextLock const & context
+		, uint32_t firstQuery
+		, uint32_t queryCount
+		, VkDeviceSize stride
+		, VkQueryResultFlags flags
+		, VkDeviceSize bufferOffset )const
+	{
+		auto begin = m_names.begin() + firstQuery;
+		auto end = doGetEnd( firstQuery, queryCount );
+		auto is64 = checkFlag( flags, VK_QUERY_RESULT_64_BIT );
+		auto valueSize = is64
+			? sizeof( GLuint64 )
+			: sizeof( GLuint );
+		auto withAvailability = checkFlag( flags, VK_QUERY_RESULT_WITH_AVAILABILITY_BIT );
+		auto resultFlags = convertQueryResultFlags( flags );
+		stride = stride
+			? stride
+			: ( withAvailability ? 2u * valueSize : valueSize );
+		auto offset = intptr_t( bufferOffset );
+		auto write = [&context, is64]( GLuint name, GLenum pname, intptr_t dst )
+		{
+			if ( is64 )
+			{
+				glLogCall( context
+					, glGetQueryObjectui64v
+					, name
+					, pname
+					, reinterpret_cast< GLuint64 * >( getBufferOffset( dst ) ) );
+			}
+			else
 			{
 				glLogCall( context
 					, glGetQueryObjectuiv
-					, *it
-					, convertQueryResultFlags( flags )
-					, reinterpret_cast< GLuint * >( buf ) );
-				buf += stride;
+					, name
+					, pname
+					, reinterpret_cast< GLuint * >( getBufferOffset( dst ) ) );
 			}
+		};
+
+		for ( auto it = begin; it != end; ++it )
+		{
+			write( *it, resultFlags, offset );
+
+			if ( withAvailability )
+			{
+				write( *it, GL_QUERY_RESULT_AVAILABLE, offset + intptr_t( valueSize ) );
+			}
+
+			offset += intptr_t( stride );
 		}
+	}
+
+	bool QueryPool::doIsPending( size_t index )const
+	{
+		std::lock_guard< std::mutex > lock{ m_pendingMutex };
+		auto & [thread, serial] = m_pending[index];
+		return thread
+			&& !thread->isDone( serial );
+	}
 
-		return VK_SUCCESS;
+	std::vector< GLuint >::const_iterator QueryPool::doGetEnd( uint32_t firstQuery
+		, uint32_t queryCount )const
+	{
+		assert( firstQuery + queryCount <= m_names.size() );
+		return m_names.begin()
+			+ firstQuery
+			+ ( m_queryType == VK_QUERY_TYPE_PIPELINE_STATISTICS
+				? uint32_t( m_pipelineStatistics.size() )
+				: queryCount );
 	}
 }
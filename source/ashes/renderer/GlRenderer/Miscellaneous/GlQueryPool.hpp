@@ -6,6 +6,8 @@ See LICENSE file in root folder
 
 #include "renderer/GlRenderer/GlRendererPrerequisites.hpp"
 
+#include <mutex>
+
 namespace ashes::gl
 {
 	class QueryPool
@@ -17,12 +19,39 @@ namespace ashes::gl
 			, VkQueryPoolCreateInfo const & createInfo );
 		~QueryPool()noexcept;
 
+		/**
+		*\brief
+		*	Retrieves the results in host memory.
+		*\remarks
+		*	Without VK_QUERY_RESULT_WAIT_BIT, the availability of each query is checked first,
+		*	so that an unavailable query never stalls.
+		*	A query written by a submission still pending in a submission thread is unavailable.
+		*/
 		VkResult getResults( ContextLock const & context
 			, uint32_t firstQuery
 			, uint32_t queryCount
 			, VkDeviceSize stride
 			, VkQueryResultFlags flags
 			, void * buffer )const;
+		/**
+		*\brief
+		*	Tells that \p query is written by a submission, not available before \p thread has processed it.
+		*/
+		void setPending( uint32_t query
+			, SubmitThread const & thread
+			, uint64_t serial )const;
+		/**
+		*\brief
+		*	Writes the results to the buffer bound to GL_QUERY_BUFFER, in one pass.
+		*\remarks
+		*	The GPU writes the values and the availabilities, so the CPU never waits.
+		*/
+		void resolveResults( ContextLock const & context
+			, uint32_t firstQuery
+			, uint32_t queryCount
+			, VkDeviceSize stride
+			, VkQueryResultFlags flags
+			, VkDeviceSize bufferOffset )const;
 
 		auto begin()const
 		{
@@ -49,12 +78,20 @@ namespace ashes::gl
 			return m_device;
 		}
 
+	private:
+		bool doIsPending( size_t index )const;
+		std::vector< GLuint >::const_iterator doGetEnd( uint32_t firstQuery
+			, uint32_t queryCount )const;
+
 	private:
 		VkDevice m_device;
 		VkQueryType m_queryType;
 		uint32_t m_queryCount;
 		std::vector< GlQueryType > m_pipelineStatistics;
 		std::vector< GLuint > m_names;
+		//! Per name, the submission thread and serial of the last submission writing it.
+		mutable std::vector< std::pair< SubmitThread const *, uint64_t > > m_pending;
+		mutable std::mutex m_pendingMutex;
 	};
 }
 
@@ -0,0 +1,115 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#include "Miscellaneous/GlWorkerPool.hpp"
+
+#include <atomic>
+
+namespace ashes::gl
+{
+	WorkerPool::WorkerPool( uint32_t threadCount )
+	{
+		m_threads.reserve( threadCount );
+
+		for ( uint32_t i = 0u; i < threadCount; ++i )
+		{
+			m_threads.emplace_back( [this]()
+				{
+					doRun();
+				} );
+		}
+	}
+
+	WorkerPool::~WorkerPool()noexcept
+	{
+		{
+			std::lock_guard< std::mutex > lock{ m_mutex };
+			m_stopped = true;
+		}
+
+		m_wakeUp.notify_all();
+
+		for ( auto & thread : m_threads )
+		{
+			thread.join();
+		}
+	}
+
+	void WorkerPool::parallelFor( size_t count
+		, std::function< void( size_t ) > const & func )
+	{
+		auto helpers = std::min( size_t( m_threads.size() )
+			, count > 0u ? count - 1u : 0u );
+
+		if ( !helpers )
+		{
+			for ( size_t i = 0u; i < count; ++i )
+			{
+				func( i );
+			}
+
+			return;
+		}
+
+		std::atomic< size_t > next{ 0u };
+		size_t pending = helpers;
+		auto work = [&next, &func, count]()
+		{
+			for ( auto i = next++; i < count; i = next++ )
+			{
+				func( i );
+			}
+		};
+
+		{
+			std::lock_guard< std::mutex > lock{ m_mutex };
+
+			for ( size_t i = 0u; i < helpers; ++i )
+			{
+				m_tasks.emplace_back( [this, &work, &pending]()
+					{
+						work();
+						std::lock_guard< std::mutex > taskLock{ m_mutex };
+						--pending;
+						m_taskDone.notify_all();
+					} );
+			}
+		}
+
+		m_wakeUp.notify_all();
+		work();
+		std::unique_lock< std::mutex > lock{ m_mutex };
+		m_taskDone.wait( lock
+			, [&pending]()
+			{
+				return pending == 0u;
+			} );
+	}
+
+	void WorkerPool::doRun()noexcept
+	{
+		std::unique_lock< std::mutex > lock{ m_mutex };
+
+		while ( true )
+		{
+			m_wakeUp.wait( lock
+				, [this]()
+				{
+					return m_stopped || !m_tasks.empty();
+				} );
+
+			if ( m_tasks.empty() )
+			{
+				// Only reached when stopped.
+				return;
+			}
+
+			auto task = std::move( m_tasks.front() );
+			m_tasks.pop_front();
+			lock.unlock();
+			task();
+			lock.lock();
+		}
+	}
+}
@@ -0,0 +1,57 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#pragma once
+
+#include "renderer/GlRenderer/GlRendererPrerequisites.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace ashes::gl
+{
+	/**
+	*\brief
+	*	A small pool of worker threads, used to run CPU only work (no GL calls) in parallel.
+	*/
+	class WorkerPool
+	{
+	public:
+		WorkerPool( WorkerPool const & ) = delete;
+		WorkerPool( WorkerPool && ) = delete;
+		WorkerPool & operator=( WorkerPool const & ) = delete;
+		WorkerPool & operator=( WorkerPool && ) = delete;
+
+		explicit WorkerPool( uint32_t threadCount );
+		~WorkerPool()noexcept;
+		/**
+		*\brief
+		*	Calls \p func for each index in [0, count), and returns when all calls are done.
+		*\remarks
+		*	The calling thread takes part in the work.
+		*	\p func must not throw.
+		*/
+		void parallelFor( size_t count
+			, std::function< void( size_t ) > const & func );
+
+		uint32_t getThreadCount()const noexcept
+		{
+			return uint32_t( m_threads.size() );
+		}
+
+	private:
+		void doRun()noexcept;
+
+	private:
+		std::vector< std::thread > m_threads;
+		std::mutex m_mutex;
+		std::condition_variable m_wakeUp;
+		std::condition_variable m_taskDone;
+		std::deque< std::function< void() > > m_tasks;
+		bool m_stopped{};
+	};
+}
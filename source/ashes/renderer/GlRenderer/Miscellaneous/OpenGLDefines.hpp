@@ -56,6 +56,7 @@ namespace ashes::gl
 	static GLuint constexpr GL_NO_ERROR = 0;
 	static GLboolean constexpr GL_TRUE = 1;
 	static GLboolean constexpr GL_FALSE = 0;
+	static GLuint64 constexpr GL_TIMEOUT_IGNORED = ~( 0ull );
 
 	enum GlDebugOutput
 		: GLenum
@@ -112,6 +113,12 @@ namespace ashes::gl
 		GL_PATCH_VERTICES = 0x8E72,
 	};
 
+	enum ProgramBinaryParameter : GLenum
+	{
+		GL_PROGRAM_BINARY_RETRIEVABLE_HINT = 0x8257,
+		GL_PROGRAM_BINARY_LENGTH = 0x8741,
+	};
+
 	enum ContextFlag
 	{
 		GL_CONTEXT_FLAG_FORWARD_COMPATIBLE_BIT = 0x0001,
@@ -146,12 +153,18 @@ namespace ashes::gl
 	using PFN_glBindBuffer = void ( GLAPIENTRY * )( GlBufferTarget target, GLuint buffer );
 	using PFN_glBindBufferBase = void ( GLAPIENTRY * )( GlBufferTarget target, GLuint index, GLuint buffer );
 	using PFN_glBindBufferRange = void ( GLAPIENTRY * )( GlBufferTarget target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size );
+	using PFN_glBindBuffersRange = void ( GLAPIENTRY * )( GlBufferTarget target, GLuint first, GLsizei count, const GLuint * buffers, const GLintptr * offsets, const GLsizeiptr * sizes );
 	using PFN_glBindFramebuffer = void ( GLAPIENTRY * )( GlFrameBufferTarget target, GLuint framebuffer );
 	using PFN_glBindImageTexture = void ( GLAPIENTRY * )( GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format );
+	using PFN_glBindImageTextures = void ( GLAPIENTRY * )( GLuint first, GLsizei count, const GLuint * textures );
 	using PFN_glBindProgramPipeline = void ( GLAPIENTRY * )( GLuint pipeline );
 	using PFN_glBindSampler = void ( GLAPIENTRY * )( GLuint unit, GLuint sampler );
+	using PFN_glBindSamplers = void ( GLAPIENTRY * )( GLuint first, GLsizei count, const GLuint * samplers );
 	using PFN_glBindTexture = void ( GLAPIENTRY * )( GlTextureType target, GLuint texture );
+	using PFN_glBindTextures = void ( GLAPIENTRY * )( GLuint first, GLsizei count, const GLuint * textures );
 	using PFN_glBindVertexArray = void ( GLAPIENTRY * )( GLuint array );
+	using PFN_glBindVertexBuffer = void ( GLAPIENTRY * )( GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride );
+	using PFN_glBindVertexBuffers = void ( GLAPIENTRY * )( GLuint first, GLsizei count, const GLuint * buffers, const GLintptr * offsets, const GLsizei * strides );
 	using PFN_glBlendColor = void ( GLAPIENTRY * )( GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha );
 	using PFN_glBlendEquationSeparate = void ( GLAPIENTRY * )( GLenum modeRGB, GLenum modeAlpha );
 	using PFN_glBlendEquationSeparatei = void ( GLAPIENTRY * )( GLuint buf, GLenum modeRGB, GLenum modeAlpha );
@@ -257,6 +270,7 @@ namespace ashes::gl
 	using PFN_glGetInteger64i_v = void( GLAPIENTRY * )( GlValueName target, GLuint index, GLint64 * data );
 	using PFN_glGetInternalformativ = void ( GLAPIENTRY * )( GlTextureType target, GlInternal internalformat, GlFormatProperty pname, GLsizei bufSize, GLint * params );
 	using PFN_glGetInternalformati64v = void ( GLAPIENTRY * )( GlTextureType target, GlInternal internalformat, GlFormatProperty pname, GLsizei bufSize, GLint64 * params );
+	using PFN_glGetProgramBinary = void ( GLAPIENTRY * )( GLuint program, GLsizei bufSize, GLsizei * length, GLenum * binaryFormat, void * binary );
 	using PFN_glGetProgramInfoLog = void ( GLAPIENTRY * )( GLuint program, GLsizei bufSize, GLsizei* length, GLchar* infoLog );
 	using PFN_glGetProgramInterfaceiv = void ( GLAPIENTRY * )( GLuint program, GLenum programInterface, GLenum pname, GLint * params );
 	using PFN_glGetProgramiv = void ( GLAPIENTRY * )( GLuint program, GLenum pname, GLint* param );
@@ -279,11 +293,13 @@ namespace ashes::gl
 	using PFN_glGetUniformIndices = void ( GLAPIENTRY * )( GLuint program, GLsizei uniformCount, const char ** uniformNames, GLuint *uniformIndices );
 	using PFN_glInvalidateBufferSubData = void ( GLAPIENTRY * )( GLuint buffer, GLintptr offset, GLsizeiptr length );
 	using PFN_glIsBuffer = GLboolean ( GLAPIENTRY * )( GLuint buffer );
+	using PFN_glIsEnabled = GLboolean ( GLAPIENTRY * )( GlTweak cap );
 	using PFN_glLineWidth = void ( GLAPIENTRY * )( GLfloat width );
 	using PFN_glLinkProgram = void ( GLAPIENTRY * )( GLuint program );
 	using PFN_glLogicOp = void ( GLAPIENTRY * )( GLenum opcode );
 	using PFN_glMapBuffer = void * ( GLAPIENTRY * )( GlBufferTarget target, GLbitfield access );
 	using PFN_glMapBufferRange = void * ( GLAPIENTRY * )( GlBufferTarget target, GLintptr offset, GLsizeiptr length, GLbitfield access );
+	using PFN_glMaxShaderCompilerThreads = void ( GLAPIENTRY * )( GLuint count );
 	using PFN_glMemoryBarrier = void ( GLAPIENTRY * )( GlMemoryBarrierFlags barriers );
 	using PFN_glMinSampleShading = void ( GLAPIENTRY * )( GLfloat value );
 	using PFN_glMultiDrawArraysIndirect = void ( GLAPIENTRY * )( GLenum mode, const void * indirect, GLsizei drawcount, GLsizei stride );
@@ -296,6 +312,7 @@ namespace ashes::gl
 	using PFN_glPolygonOffsetClamp = void ( GLAPIENTRY * )( GLfloat factor, GLfloat units, GLfloat clamp );
 	using PFN_glPopDebugGroup = void ( GLAPIENTRY * )();
 	using PFN_glPrimitiveRestartIndex = void ( GLAPIENTRY * )( GLuint index );
+	using PFN_glProgramBinary = void ( GLAPIENTRY * )( GLuint program, GLenum binaryFormat, const void * binary, GLsizei length );
 	using PFN_glProgramParameteri = void ( GLAPIENTRY * )( GLuint program, GLenum pname, GLint value );
 	using PFN_glProgramUniform1fv = void ( GLAPIENTRY * )( GLuint program, GLint location, GLsizei count, const GLfloat * value );
 	using PFN_glProgramUniform1iv = void ( GLAPIENTRY * )( GLuint program, GLint location, GLsizei count, const GLint * value );
@@ -365,11 +382,16 @@ namespace ashes::gl
 	using PFN_glUnmapBuffer = GLboolean( GLAPIENTRY * )( GlBufferTarget target );
 	using PFN_glUseProgram = void ( GLAPIENTRY * )( GLuint program );
 	using PFN_glUseProgramStages = void ( GLAPIENTRY * )( GLuint pipeline, GlShaderStageFlags stages, GLuint program );
+	using PFN_glVertexAttribBinding = void ( GLAPIENTRY * )( GLuint attribindex, GLuint bindingindex );
 	using PFN_glVertexAttribDivisor = void ( GLAPIENTRY * )( GLuint index, GLuint divisor );
+	using PFN_glVertexAttribFormat = void ( GLAPIENTRY * )( GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset );
+	using PFN_glVertexAttribIFormat = void ( GLAPIENTRY * )( GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset );
 	using PFN_glVertexAttribIPointer = void ( GLAPIENTRY * )( GLuint index, GLint size, GLenum type, GLsizei stride, const void* pointer );
 	using PFN_glVertexAttribPointer = void ( GLAPIENTRY * )( GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void* pointer );
+	using PFN_glVertexBindingDivisor = void ( GLAPIENTRY * )( GLuint bindingindex, GLuint divisor );
 	using PFN_glViewport = void ( GLAPIENTRY * )( GLint x, GLint y, GLsizei width, GLsizei height );
 	using PFN_glViewportArrayv = void ( GLAPIENTRY * )( GLuint first, GLsizei count, const GLfloat * v );
+	using PFN_glWaitSync = void ( GLAPIENTRY * )( GLsync GLsync, GLbitfield flags, GLuint64 timeout );
 }
 
 #pragma clang diagnostic pop
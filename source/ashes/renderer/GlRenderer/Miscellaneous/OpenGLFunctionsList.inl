@@ -34,6 +34,7 @@ GL_LIB_BASE_FUNCTION( GetTexLevelParameterfv )
 GL_LIB_BASE_FUNCTION( GetTexLevelParameteriv )
 GL_LIB_BASE_FUNCTION( GetTexParameterfv )
 GL_LIB_BASE_FUNCTION( GetTexParameteriv )
+GL_LIB_BASE_FUNCTION( IsEnabled )
 GL_LIB_BASE_FUNCTION( LineWidth )
 GL_LIB_BASE_FUNCTION( LogicOp )
 GL_LIB_BASE_FUNCTION( PolygonMode )
@@ -178,6 +179,7 @@ GL_LIB_FUNCTION( UseProgram )
 GL_LIB_FUNCTION( VertexAttribDivisor )
 GL_LIB_FUNCTION( VertexAttribPointer )
 GL_LIB_FUNCTION( VertexAttribIPointer )
+GL_LIB_FUNCTION( WaitSync )
 
 #undef GL_LIB_FUNCTION
 
@@ -193,8 +195,14 @@ GL_LIB_FUNCTION_OPT( DebugMessageCallbackAMD )
 #	define GL_LIB_FUNCTION_EXT( x, ... )
 #endif
 
+GL_LIB_FUNCTION_EXT( BindBuffersRange, "ARB", ARB_multi_bind )
 GL_LIB_FUNCTION_EXT( BindImageTexture, "ARB", ARB_shader_image_load_store )
+GL_LIB_FUNCTION_EXT( BindImageTextures, "ARB", ARB_multi_bind )
 GL_LIB_FUNCTION_EXT( BindProgramPipeline, "ARB", ARB_separate_shader_objects )
+GL_LIB_FUNCTION_EXT( BindSamplers, "ARB", ARB_multi_bind )
+GL_LIB_FUNCTION_EXT( BindTextures, "ARB", ARB_multi_bind )
+GL_LIB_FUNCTION_EXT( BindVertexBuffer, "ARB", ARB_vertex_attrib_binding )
+GL_LIB_FUNCTION_EXT( BindVertexBuffers, "ARB", ARB_multi_bind )
 GL_LIB_FUNCTION_EXT( BlendEquationSeparatei, "ARB", ARB_draw_buffers_blend )
 GL_LIB_FUNCTION_EXT( BlendFuncSeparatei, "ARB", ARB_draw_buffers_blend )
 GL_LIB_FUNCTION_EXT( BufferStorage, "ARB", ARB_buffer_storage )
@@ -215,11 +223,13 @@ GL_LIB_FUNCTION_EXT( GetIntegeri_v, "ARB", ARB_viewport_array )
 GL_LIB_FUNCTION_EXT( GetInteger64i_v, "ARB", ARB_viewport_array )
 GL_LIB_FUNCTION_EXT( GetInternalformativ, "ARB", ARB_internalformat_query )
 GL_LIB_FUNCTION_EXT( GetInternalformati64v, "ARB", ARB_internalformat_query2 )
+GL_LIB_FUNCTION_EXT( GetProgramBinary, "ARB", ARB_get_program_binary )
 GL_LIB_FUNCTION_EXT( GetProgramInterfaceiv, "ARB", ARB_program_interface_query )
 GL_LIB_FUNCTION_EXT( GetProgramResourceiv, "ARB", ARB_program_interface_query )
 GL_LIB_FUNCTION_EXT( GetProgramResourceIndex, "ARB", ARB_program_interface_query )
 GL_LIB_FUNCTION_EXT( GetProgramResourceName, "ARB", ARB_program_interface_query )
 GL_LIB_FUNCTION_EXT( InvalidateBufferSubData, "ARB", ARB_invalidate_subdata )
+GL_LIB_FUNCTION_EXT( MaxShaderCompilerThreads, "KHR", KHR_parallel_shader_compile, "ARB", ARB_parallel_shader_compile )
 GL_LIB_FUNCTION_EXT( MemoryBarrier, "ARB", ARB_shader_image_load_store )
 GL_LIB_FUNCTION_EXT( MinSampleShading, "ARB", ARB_sample_shading )
 GL_LIB_FUNCTION_EXT( MultiDrawArraysIndirect, "ARB", ARB_multi_draw_indirect )
@@ -229,6 +239,7 @@ GL_LIB_FUNCTION_EXT( ObjectPtrLabel, "KHR", KHR_debug, "ARB", ARB_debug_output )
 GL_LIB_FUNCTION_EXT( PatchParameteri, "ARB", ARB_tessellation_shader )
 GL_LIB_FUNCTION_EXT( PolygonOffsetClamp, "EXT", EXT_polygon_offset_clamp )
 GL_LIB_FUNCTION_EXT( PopDebugGroup, "KHR", KHR_debug )
+GL_LIB_FUNCTION_EXT( ProgramBinary, "ARB", ARB_get_program_binary )
 GL_LIB_FUNCTION_EXT( ProgramParameteri, "ARB", ARB_get_program_binary )
 GL_LIB_FUNCTION_EXT( ProgramUniform1fv, "ARB", ARB_separate_shader_objects )
 GL_LIB_FUNCTION_EXT( ProgramUniform1iv, "ARB", ARB_separate_shader_objects )
@@ -257,6 +268,10 @@ GL_LIB_FUNCTION_EXT( TexStorage3D, "ARB", ARB_texture_storage )
 GL_LIB_FUNCTION_EXT( TexStorage3DMultisample, "ARB", ARB_texture_storage_multisample )
 GL_LIB_FUNCTION_EXT( TextureView, "ARB", ARB_texture_view )
 GL_LIB_FUNCTION_EXT( UseProgramStages, "ARB", ARB_separate_shader_objects )
+GL_LIB_FUNCTION_EXT( VertexAttribBinding, "ARB", ARB_vertex_attrib_binding )
+GL_LIB_FUNCTION_EXT( VertexAttribFormat, "ARB", ARB_vertex_attrib_binding )
+GL_LIB_FUNCTION_EXT( VertexAttribIFormat, "ARB", ARB_vertex_attrib_binding )
+GL_LIB_FUNCTION_EXT( VertexBindingDivisor, "ARB", ARB_vertex_attrib_binding )
 GL_LIB_FUNCTION_EXT( ViewportArrayv, "ARB", ARB_viewport_array )
 
 #undef GL_LIB_FUNCTION_EXT
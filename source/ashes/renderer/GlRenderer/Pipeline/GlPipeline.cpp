@@ -2,6 +2,7 @@
 
 #include "Buffer/GlBuffer.hpp"
 #include "Command/Commands/GlBindPipelineCommand.hpp"
+#include "Core/GlContextShadow.hpp"
 #include "Core/GlDevice.hpp"
 #include "Core/GlInstance.hpp"
 #include "Miscellaneous/GlValidator.hpp"
@@ -24,6 +25,8 @@
 #include <ashes/common/Hash.hpp>
 
 #include <algorithm>
+#include <cstdlib>
+#include <string_view>
 
 #if defined( interface )
 #	undef interface
@@ -250,6 +253,60 @@ namespace ashes::gl
 			}
 		}
 
+		/**
+		*\brief
+		*	Tells if both program variants of the graphics pipelines must be built at creation.
+		*	Otherwise, the RTOT one is built at creation, and the back buffer one on first use.
+		*/
+		static bool isEagerProgramsBuild()
+		{
+			static bool const result = []()
+			{
+				auto value = std::getenv( "ASHES_GL_EAGER_PROGRAMS" );
+				return value
+					&& *value
+					&& std::string_view{ value } != "0";
+			}();
+			return result;
+		}
+
+		template< typename FuncT >
+		static VkResult doProcessPrograms( VkPipeline pipeline
+			, std::array< ShaderProgram *, 2u > const & programs
+			, std::string const & step
+			, FuncT func )noexcept
+		{
+			VkResult result = VK_ERROR_INITIALIZATION_FAILED;
+
+			try
+			{
+				for ( auto program : programs )
+				{
+					if ( program )
+					{
+						func( *program );
+					}
+				}
+
+				result = VK_SUCCESS;
+			}
+			catch ( Exception & exc )
+			{
+				result = exc.getResult();
+				reportError( pipeline, result, step, exc.what() );
+			}
+			catch ( std::exception & exc )
+			{
+				reportError( pipeline, result, step, exc.what() );
+			}
+			catch ( ... )
+			{
+				reportError( pipeline, result, step, "Unknown error" );
+			}
+
+			return result;
+		}
+
 		static ShaderBindings doReworkBindings( ShaderBindings const & srcBindings
 			, VkDescriptorSet descriptorSet
 			, uint32_t descriptorSetIndex
@@ -317,6 +374,7 @@ namespace ashes::gl
 
 	Pipeline::Pipeline( [[maybe_unused]] VkAllocationCallbacks const * allocInfo
 		, VkDevice device
+		, VkPipelineCache pipelineCache
 		, VkGraphicsPipelineCreateInfo const & createInfo )
 		: m_device{ device }
 		, m_flags{ createInfo.flags }
@@ -354,25 +412,39 @@ namespace ashes::gl
 		, m_subpass{ createInfo.subpass }
 		, m_basePipelineHandle{ createInfo.basePipelineHandle }
 		, m_basePipelineIndex{ createInfo.basePipelineIndex }
-		, m_backPipeline{ std::make_unique< ShaderProgram >( m_device, &m_backContextState, get( this ), m_stages, m_layout, createInfo.flags, m_renderPass, m_vertexInputState, true ) }
-		, m_rtotPipeline{ std::make_unique< ShaderProgram >( m_device, &m_rtotContextState, get( this ), m_stages, m_layout, createInfo.flags, m_renderPass, m_vertexInputState, false ) }
+		, m_backPipeline{ std::make_unique< ShaderProgram >( m_device, &m_backContextState, get( this ), pipelineCache, m_stages, m_layout, createInfo.flags, m_renderPass, m_vertexInputState, true ) }
+		, m_rtotPipeline{ std::make_unique< ShaderProgram >( m_device, &m_rtotContextState, get( this ), pipelineCache, m_stages, m_layout, createInfo.flags, m_renderPass, m_vertexInputState, false ) }
+		, m_programs{ m_rtotPipeline.get()
+			, ( pipe::isEagerProgramsBuild()
+				? m_backPipeline.get()
+				: nullptr ) }
+		, m_deferredProgram{ ( pipe::isEagerProgramsBuild()
+			? nullptr
+			: m_backPipeline.get() ) }
 		, m_vertexInputStateHash{ ( m_vertexInputState
 			? pipe::doHash( m_vertexInputState.value() )
 			: 0u ) }
 	{
+		if ( m_deferredProgram )
+		{
+			++get( m_device )->getProgramVariantsCounters().deferred;
+		}
+
 		get( m_layout )->addPipeline( get( this ) );
 		registerObject( m_device, *this );
 	}
 
 	Pipeline::Pipeline( [[maybe_unused]] VkAllocationCallbacks const * allocInfo
 		, VkDevice device
+		, VkPipelineCache pipelineCache
 		, VkComputePipelineCreateInfo createInfo )
 		: m_device{ device }
 		, m_stages{ makeVector( &createInfo.stage, 1u ) }
 		, m_layout{ createInfo.layout }
 		, m_basePipelineHandle{ createInfo.basePipelineHandle }
 		, m_basePipelineIndex{ createInfo.basePipelineIndex }
-		, m_compPipeline{ std::make_unique< ShaderProgram >( m_device, nullptr, get( this ), m_stages, m_layout, createInfo.flags, m_renderPass, m_vertexInputState ) }
+		, m_compPipeline{ std::make_unique< ShaderProgram >( m_device, nullptr, get( this ), pipelineCache, m_stages, m_layout, createInfo.flags, m_renderPass, m_vertexInputState ) }
+		, m_programs{ m_compPipeline.get(), nullptr }
 	{
 		get( m_layout )->addPipeline( get( this ) );
 		registerObject( m_device, *this );
@@ -388,6 +460,40 @@ namespace ashes::gl
 		}
 	}
 
+	VkResult Pipeline::prepare()noexcept
+	{
+		return pipe::doProcessPrograms( get( this )
+			, m_programs
+			, "Pipeline programs preparation"
+			, []( ShaderProgram & program )
+			{
+				program.prepare();
+			} );
+	}
+
+	VkResult Pipeline::submit( ContextLock const & context )noexcept
+	{
+		return pipe::doProcessPrograms( get( this )
+			, m_programs
+			, "Pipeline programs submission"
+			, [&context]( ShaderProgram & program )
+			{
+				program.submit( context );
+			} );
+	}
+
+	VkResult Pipeline::finish( ContextLock const & context )noexcept
+	{
+		return pipe::doProcessPrograms( get( this )
+			, m_programs
+			, "Pipeline programs link"
+			, [this, &context]( ShaderProgram & program )
+			{
+				program.finish( context );
+				++get( m_device )->getProgramVariantsCounters().built;
+			} );
+	}
+
 	GeometryBuffers * Pipeline::findGeometryBuffers( VboBindings const & vbos
 		, IboBinding const & ibo )const
 	{
@@ -413,7 +519,7 @@ namespace ashes::gl
 				, vbos
 				, ibo
 				, m_vertexInputState.value()
-				, m_backPipeline->program.inputs
+				, m_rtotPipeline->program.inputs
 				, type ) );
 
 		for ( auto const & [_, vbo] : vbos )
@@ -459,13 +565,9 @@ namespace ashes::gl
 		{
 			result = m_compPipeline->constantsPcb;
 		}
-		else if ( isRtot )
-		{
-			result = m_rtotPipeline->constantsPcb;
-		}
 		else
 		{
-			result = m_backPipeline->constantsPcb;
+			result = doGetProgram( isRtot ).constantsPcb;
 		}
 
 		result.offset = pushConstants.offset;
@@ -526,7 +628,7 @@ namespace ashes::gl
 					it->second = pipe::doReworkBindings( it->second
 						, descriptorSet
 						, descriptorSetIndex
-						, m_backPipeline->program );
+						, m_rtotPipeline->program );
 				}
 			}
 
@@ -540,9 +642,7 @@ namespace ashes::gl
 	ConstantsLayout const & Pipeline::getPushConstantsDesc( bool isRtot )const
 	{
 		assert( !m_compPipeline );
-		return ( isRtot
-			? m_rtotPipeline->program.pcb
-			: m_backPipeline->program.pcb );
+		return doGetProgram( isRtot ).program.pcb;
 	}
 
 	ConstantsLayout const & Pipeline::getPushConstantsDesc()const
@@ -550,4 +650,58 @@ namespace ashes::gl
 		assert( m_compPipeline );
 		return m_compPipeline->program.pcb;
 	}
+
+	ConstantsLayout const & Pipeline::getBackPushConstantsDesc( ContextLock const & context )const
+	{
+		assert( !m_compPipeline );
+		return doGetBackProgram( context ).program.pcb;
+	}
+
+	ShaderProgram & Pipeline::doGetProgram( bool isRtot )const
+	{
+		// The deferred variant is only built at replay, see doGetBackProgram.
+		assert( isRtot || isBackProgramReady() );
+		return ( isRtot
+			? *m_rtotPipeline
+			: *m_backPipeline );
+	}
+
+	ShaderProgram & Pipeline::doGetBackProgram( ContextLock const & context )const
+	{
+		if ( !isBackProgramReady() )
+		{
+			std::lock_guard< std::mutex > lock{ m_deferredMutex };
+
+			if ( !m_deferredDone.load( std::memory_order_relaxed ) )
+			{
+				auto result = pipe::doProcessPrograms( get( this )
+					, { m_deferredProgram, nullptr }
+					, "Pipeline deferred program build"
+					, [&context]( ShaderProgram & program )
+					{
+						program.prepare();
+						program.submit( context );
+						program.finish( context );
+					} );
+				// The build binds its own program pipeline, behind the replay's back.
+				context->getShadow().invalidateBindings();
+				auto & counters = get( m_device )->getProgramVariantsCounters();
+
+				if ( result == VK_SUCCESS )
+				{
+					++counters.built;
+				}
+				else
+				{
+					// Already reported, and not attempted again at each replay.
+					++counters.failed;
+					m_deferredFailed.store( true, std::memory_order_relaxed );
+				}
+
+				m_deferredDone.store( true, std::memory_order_release );
+			}
+		}
+
+		return *m_backPipeline;
+	}
 }
@@ -16,6 +16,9 @@
 #include <renderer/RendererCommon/ShaderBindings.hpp>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <mutex>
 #include <unordered_map>
 
 namespace ashes::gl
@@ -37,9 +40,11 @@ namespace ashes::gl
 		/**@{*/
 		Pipeline( VkAllocationCallbacks const * allocInfo
 			, VkDevice device
+			, VkPipelineCache pipelineCache
 			, VkGraphicsPipelineCreateInfo const & createInfo );
 		Pipeline( VkAllocationCallbacks const * allocInfo
 			, VkDevice device
+			, VkPipelineCache pipelineCache
 			, VkComputePipelineCreateInfo createInfo );
 		~Pipeline()noexcept;
 		GeometryBuffers * findGeometryBuffers( VboBindings const & vbos
@@ -54,6 +59,22 @@ namespace ashes::gl
 			, uint32_t descriptorSetIndex )const;
 		ConstantsLayout const & getPushConstantsDesc( bool isRtot )const;
 		ConstantsLayout const & getPushConstantsDesc()const;
+		/**
+		*\brief
+		*	Builds the back buffer program variant, if it is not built yet.
+		*\remarks
+		*	Only called at replay, with the context lock the replay holds.
+		*/
+		ConstantsLayout const & getBackPushConstantsDesc( ContextLock const & context )const;
+		/**
+		*name
+		*	Programs build steps, see ShaderProgram.
+		*/
+		/**@{*/
+		VkResult prepare()noexcept;
+		VkResult submit( ContextLock const & context )noexcept;
+		VkResult finish( ContextLock const & context )noexcept;
+		/**@}*/
 
 		bool isCompute()const noexcept
 		{
@@ -72,24 +93,64 @@ namespace ashes::gl
 			return m_rtotContextState;
 		}
 
-		GLuint getBackProgram()const noexcept
+		GLuint getBackProgram()const
+		{
+			assert( !isCompute() );
+			auto & program = doGetProgram( false );
+			return isBackProgramFailed()
+				? 0u
+				: program.program.program;
+		}
+		/**
+		*\brief
+		*	Builds the back buffer program variant, if it is not built yet.
+		*\return
+		*	The program, 0 if its build failed.
+		*\remarks
+		*	Only called at replay, with the context lock the replay holds.
+		*/
+		GLuint getBackProgram( ContextLock const & context )const
 		{
 			assert( !isCompute() );
-			assert( m_backPipeline != nullptr );
-			return m_backPipeline->program.program;
+			auto & program = doGetBackProgram( context );
+			return isBackProgramFailed()
+				? 0u
+				: program.program.program;
+		}
+		/**
+		*\return
+		*	\p false if the back buffer program variant is only built at its first replay, and it didn't happen yet.
+		*/
+		bool isBackProgramReady()const noexcept
+		{
+			assert( !isCompute() );
+			return !m_deferredProgram
+				|| m_deferredDone.load( std::memory_order_acquire );
+		}
+		/**
+		*\return
+		*	\p true if the back buffer program variant build failed at its first replay.
+		*	The error has then been reported, and no program is bound in place of the broken one.
+		*/
+		bool isBackProgramFailed()const noexcept
+		{
+			return m_deferredFailed.load( std::memory_order_acquire );
 		}
 
-		GLuint getRtotProgram()const noexcept
+		GLuint getRtotProgram()const
 		{
 			assert( !isCompute() );
-			assert( m_rtotPipeline != nullptr );
-			return m_rtotPipeline->program.program;
+			return doGetProgram( true ).program.program;
 		}
 
 		GLuint getCompProgram()const noexcept
 		{
 			assert( isCompute() );
-			return m_compPipeline->modules.front();
+			// Modules names are only kept when using program pipelines.
+			auto & modules = m_compPipeline->modules;
+			return ( modules.empty() || !modules.front() )
+				? m_compPipeline->program.program
+				: modules.front();
 		}
 
 		auto const & getInputAssemblyState()const noexcept
@@ -192,6 +253,10 @@ namespace ashes::gl
 			return m_vertexInputStateHash;
 		}
 
+	private:
+		ShaderProgram & doGetProgram( bool isRtot )const;
+		ShaderProgram & doGetBackProgram( ContextLock const & context )const;
+
 	private:
 		VkDevice m_device;
 		VkPipelineCreateFlags m_flags{};
@@ -210,6 +275,13 @@ namespace ashes::gl
 		ShaderProgramPtr m_backPipeline{};
 		ShaderProgramPtr m_rtotPipeline{};
 		ShaderProgramPtr m_compPipeline{};
+		std::array< ShaderProgram *, 2u > m_programs{};
+		// The program variant that is only built at its first replay (nullptr when built at creation).
+		ShaderProgram * m_deferredProgram{};
+		mutable std::mutex m_deferredMutex;
+		// Set once the deferred variant build was attempted, whatever its result.
+		mutable std::atomic< bool > m_deferredDone{};
+		mutable std::atomic< bool > m_deferredFailed{};
 		mutable std::vector< std::pair< size_t, GeometryBuffersPtr > > m_geometryBuffers;
 		mutable std::unordered_map< GLuint, DeviceMemoryDestroyConnection > m_connections;
 		mutable std::unordered_map< uint64_t, ShaderBindings > m_dsBindings;
@@ -2,30 +2,67 @@
 
 #include "Core/GlDevice.hpp"
 #include "Core/GlPhysicalDevice.hpp"
+#include "Descriptor/GlDescriptorSetLayout.hpp"
+#include "Miscellaneous/GlBinaryStream.hpp"
+#include "Miscellaneous/GlContentHasher.hpp"
+#include "Pipeline/GlPipelineLayout.hpp"
+#include "Shader/GlShaderModule.hpp"
 
 #include "ashesgl_api.hpp"
 
 namespace ashes::gl
 {
+	namespace cache
+	{
+		// Bumped whenever the serialised layout or the key content changes.
+		static uint32_t constexpr DataVersion = 1u;
+
+		static void write( BinaryWriter & writer
+			, ContentHash const & key
+			, PipelineCache::ProgramBinary const & value )
+		{
+			writer.write( key );
+			writer.write( uint32_t( value.format ) );
+			writer.write( value.data );
+			write( writer, value.constants );
+		}
+
+		static bool read( BinaryReader & reader
+			, ContentHash & key
+			, PipelineCache::ProgramBinary & value )
+		{
+			uint32_t format{};
+			bool result = reader.read( key )
+				&& reader.read( format )
+				&& reader.read( value.data )
+				&& read( reader, value.constants );
+			value.format = GLenum( format );
+			return result;
+		}
+	}
+
 	PipelineCache::PipelineCache( [[maybe_unused]] VkAllocationCallbacks const * allocInfo
 		, VkDevice device
 		, VkPipelineCacheCreateInfo createInfo )
 		: m_header{ sizeof( Header )
-			, 1u
+			, VK_PIPELINE_CACHE_HEADER_VERSION_ONE
 			, get( get( device )->getPhysicalDevice() )->getProperties().vendorID
 			, get( get( device )->getPhysicalDevice() )->getProperties().deviceID
 			, {} }
 		, m_device{ device }
-		, m_createInfo{ std::move( createInfo ) }
 	{
-		m_data.resize( sizeof( Header ) + m_createInfo.initialDataSize );
-		auto buffer = m_data.data();
-		std::memcpy( buffer, &m_header, sizeof( Header ) );
-		buffer += sizeof( Header );
+		auto & uuid = get( get( device )->getPhysicalDevice() )->getProperties().pipelineCacheUUID;
+		std::copy( std::begin( uuid ), std::end( uuid ), m_header.pipelineCacheUUID.begin() );
 
-		if ( m_createInfo.pInitialData && m_createInfo.initialDataSize )
+		if ( createInfo.pInitialData && createInfo.initialDataSize )
 		{
-			std::memcpy( buffer, m_createInfo.pInitialData, m_createInfo.initialDataSize );
+			auto begin = reinterpret_cast< uint8_t const * >( createInfo.pInitialData );
+
+			// Data coming from another driver, or an older version, is silently ignored.
+			if ( !doLoad( ByteArray{ begin, begin + createInfo.initialDataSize } ) )
+			{
+				m_programs.clear();
+			}
 		}
 
 		registerObject( m_device, *this );
@@ -36,8 +73,175 @@ namespace ashes::gl
 		unregisterObject( m_device, *this );
 	}
 
-	VkResult PipelineCache::merge( [[maybe_unused]] ArrayView< VkPipelineCache const > pipelines )const
+	ContentHash PipelineCache::makeProgramKey( VkPipelineShaderStageCreateInfoArray const & stages
+		, VkPipelineLayout layout
+		, VkPipelineCreateFlags createFlags
+		, bool invertY )
+	{
+		ContentHasher hasher;
+		hasher.add( cache::DataVersion );
+		hasher.add( createFlags );
+		hasher.add( invertY );
+		hasher.add( uint32_t( stages.size() ) );
+
+		for ( auto & stage : stages )
+		{
+			auto & code = get( stage.module )->getCode();
+			hasher.add( stage.stage );
+			hasher.add( stage.flags );
+			hasher.add( std::string_view{ stage.pName } );
+			hasher.add( uint32_t( code.size() ) );
+			hasher.add( code.data(), code.size() * sizeof( uint32_t ) );
+
+			if ( auto spec = stage.pSpecializationInfo )
+			{
+				hasher.add( spec->mapEntryCount );
+
+				for ( auto & entry : makeArrayView( spec->pMapEntries, spec->mapEntryCount ) )
+				{
+					hasher.add( entry.constantID );
+					hasher.add( entry.offset );
+					hasher.add( uint64_t( entry.size ) );
+				}
+
+				hasher.add( uint64_t( spec->dataSize ) );
+				hasher.add( spec->pData, spec->dataSize );
+			}
+			else
+			{
+				hasher.add( 0u );
+			}
+		}
+
+		if ( layout )
+		{
+			auto & setLayouts = get( layout )->getDescriptorsLayouts();
+			hasher.add( uint32_t( setLayouts.size() ) );
+
+			for ( auto & setLayout : setLayouts )
+			{
+				for ( auto & binding : *get( setLayout ) )
+				{
+					hasher.add( binding.binding );
+					hasher.add( binding.descriptorType );
+					hasher.add( binding.descriptorCount );
+					hasher.add( binding.stageFlags );
+				}
+
+				hasher.add( ~0u );
+			}
+
+			for ( auto & range : get( layout )->getPushConstants() )
+			{
+				hasher.add( range.stageFlags );
+				hasher.add( range.offset );
+				hasher.add( range.size );
+			}
+		}
+
+		return hasher.get();
+	}
+
+	VkResult PipelineCache::merge( ArrayView< VkPipelineCache const > pipelines )
 	{
+		for ( auto & srcCache : pipelines )
+		{
+			auto src = get( srcCache );
+
+			if ( src == this )
+			{
+				continue;
+			}
+
+			std::scoped_lock lock{ m_mutex, src->m_mutex };
+
+			for ( auto & [key, binary] : src->m_programs )
+			{
+				m_programs.try_emplace( key, binary );
+			}
+		}
+
 		return VK_SUCCESS;
 	}
+
+	bool PipelineCache::findProgram( ContentHash const & key
+		, ProgramBinary & result )const
+	{
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		auto it = m_programs.find( key );
+
+		if ( it == m_programs.end() )
+		{
+			return false;
+		}
+
+		result = it->second;
+		return true;
+	}
+
+	void PipelineCache::addProgram( ContentHash const & key
+		, ProgramBinary binary )
+	{
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		m_programs.insert_or_assign( key, std::move( binary ) );
+	}
+
+	void PipelineCache::removeProgram( ContentHash const & key )
+	{
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		m_programs.erase( key );
+	}
+
+	ByteArray PipelineCache::getData()const
+	{
+		ByteArray result;
+		BinaryWriter writer{ result };
+		writer.write( m_header );
+		writer.write( cache::DataVersion );
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		writer.write( uint32_t( m_programs.size() ) );
+
+		for ( auto & [key, binary] : m_programs )
+		{
+			cache::write( writer, key, binary );
+		}
+
+		return result;
+	}
+
+	bool PipelineCache::doLoad( ByteArray const & data )
+	{
+		BinaryReader reader{ data };
+		Header header{};
+		uint32_t version{};
+		uint32_t count{};
+
+		if ( !reader.read( header )
+			|| header.headerLength != m_header.headerLength
+			|| header.headerVersion != m_header.headerVersion
+			|| header.vendorID != m_header.vendorID
+			|| header.deviceID != m_header.deviceID
+			|| header.pipelineCacheUUID != m_header.pipelineCacheUUID
+			|| !reader.read( version )
+			|| version != cache::DataVersion
+			|| !reader.read( count ) )
+		{
+			return false;
+		}
+
+		for ( uint32_t i = 0u; i < count; ++i )
+		{
+			ContentHash key{};
+			ProgramBinary binary;
+
+			if ( !cache::read( reader, key, binary ) )
+			{
+				return false;
+			}
+
+			m_programs.emplace( key, std::move( binary ) );
+		}
+
+		return true;
+	}
 }
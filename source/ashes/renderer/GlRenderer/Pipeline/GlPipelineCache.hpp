@@ -9,18 +9,33 @@
 #pragma once
 
 #include "renderer/GlRenderer/GlRendererPrerequisites.hpp"
+#include "renderer/GlRenderer/Miscellaneous/GlContentHasher.hpp"
+#include "renderer/GlRenderer/Shader/GlShaderDesc.hpp"
 
 #include <common/ArrayView.hpp>
 
+#include <mutex>
+#include <unordered_map>
+
 namespace ashes::gl
 {
 	/**
 	*\brief
-	*	Un pipeline de rendu.
+	*	Holds the GL program binaries retrieved from linked programs,
+	*	and serialises them through vkGetPipelineCacheData.
 	*/
 	class PipelineCache
 		: public AutoIdIcdObject< PipelineCache >
 	{
+	public:
+		struct ProgramBinary
+		{
+			GLenum format{};
+			ByteArray data;
+			//! The merged push constants layout, as it was before the program link.
+			ConstantsLayout constants;
+		};
+
 	public:
 		/**
 		*name
@@ -32,19 +47,33 @@ namespace ashes::gl
 			, VkPipelineCacheCreateInfo createInfo );
 		~PipelineCache()noexcept;
 		/**@}*/
+		/**
+		*\brief
+		*	Computes the key identifying a program built from the given inputs.
+		*\remarks
+		*	The render pass doesn't influence the generated GLSL, hence it isn't part of the key.
+		*/
+		static ContentHash makeProgramKey( VkPipelineShaderStageCreateInfoArray const & stages
+			, VkPipelineLayout layout
+			, VkPipelineCreateFlags createFlags
+			, bool invertY );
 
-		VkResult merge( ArrayView< VkPipelineCache const > pipelines )const;
-
-		ByteArray const & getData()const
-		{
-			return m_data;
-		}
+		VkResult merge( ArrayView< VkPipelineCache const > pipelines );
+		bool findProgram( ContentHash const & key
+			, ProgramBinary & result )const;
+		void addProgram( ContentHash const & key
+			, ProgramBinary binary );
+		void removeProgram( ContentHash const & key );
+		ByteArray getData()const;
 
 		VkDevice getDevice()const
 		{
 			return m_device;
 		}
 
+	private:
+		bool doLoad( ByteArray const & data );
+
 	private:
 		struct Header
 		{
@@ -58,8 +87,8 @@ namespace ashes::gl
 	private:
 		Header m_header;
 		VkDevice m_device;
-		VkPipelineCacheCreateInfo m_createInfo;
-		ByteArray m_data;
+		mutable std::mutex m_mutex;
+		std::unordered_map< ContentHash, ProgramBinary, ContentHashHasher > m_programs;
 	};
 }
 
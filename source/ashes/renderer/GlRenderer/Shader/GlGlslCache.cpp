@@ -0,0 +1,183 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#include "Shader/GlGlslCache.hpp"
+
+#include "Miscellaneous/GlBinaryStream.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+
+namespace ashes::gl
+{
+	namespace glsl
+	{
+		static uint32_t constexpr FileMagic = 0x4C534741u;// "AGSL"
+		// Bumped whenever the file layout changes.
+		static uint32_t constexpr FileVersion = 1u;
+
+		static std::string getCacheDirectory()
+		{
+			std::string result;
+
+			if ( auto dir = std::getenv( "ASHES_GL_SHADER_CACHE_DIR" ) )
+			{
+				result = dir;
+
+				if ( !result.empty()
+					&& result.back() != '/'
+					&& result.back() != '\\' )
+				{
+					result += '/';
+				}
+			}
+
+			return result;
+		}
+	}
+
+	GlslCache::GlslCache()
+		: m_directory{ glsl::getCacheDirectory() }
+	{
+	}
+
+	bool GlslCache::find( ContentHash const & key
+		, Entry & result )
+	{
+		{
+			std::lock_guard< std::mutex > lock{ m_mutex };
+
+			if ( auto it = m_entries.find( key );
+				it != m_entries.end() )
+			{
+				result = it->second;
+				++m_hits;
+				return true;
+			}
+		}
+
+		if ( !m_directory.empty()
+			&& doLoad( key, result ) )
+		{
+			std::lock_guard< std::mutex > lock{ m_mutex };
+			m_entries.try_emplace( key, result );
+			++m_hits;
+			return true;
+		}
+
+		++m_misses;
+		return false;
+	}
+
+	void GlslCache::add( ContentHash const & key
+		, Entry entry )
+	{
+		if ( !m_directory.empty() )
+		{
+			doSave( key, entry );
+		}
+
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		m_entries.insert_or_assign( key, std::move( entry ) );
+	}
+
+	std::string GlslCache::doGetFilePath( ContentHash const & key )const
+	{
+		std::stringstream stream;
+		stream.imbue( std::locale{ "C" } );
+		stream << m_directory
+			<< std::hex << std::setfill( '0' )
+			<< std::setw( 16 ) << key.high
+			<< std::setw( 16 ) << key.low
+			<< ".glsl.bin";
+		return stream.str();
+	}
+
+	bool GlslCache::doLoad( ContentHash const & key
+		, Entry & result )const
+	{
+		std::ifstream file{ doGetFilePath( key ), std::ios::binary };
+
+		if ( !file )
+		{
+			return false;
+		}
+
+		ByteArray data{ std::istreambuf_iterator< char >{ file }
+			, std::istreambuf_iterator< char >{} };
+		BinaryReader reader{ data };
+		uint32_t magic{};
+		uint32_t version{};
+		ContentHash fileKey{};
+		Entry entry;
+
+		if ( !reader.read( magic )
+			|| magic != glsl::FileMagic
+			|| !reader.read( version )
+			|| version != glsl::FileVersion
+			|| !reader.read( fileKey )
+			|| fileKey != key
+			|| !reader.read( entry.source )
+			|| !read( reader, entry.constants ) )
+		{
+			return false;
+		}
+
+		result = std::move( entry );
+		return true;
+	}
+
+	void GlslCache::doSave( ContentHash const & key
+		, Entry const & entry )const
+	{
+		ByteArray data;
+		BinaryWriter writer{ data };
+		writer.write( glsl::FileMagic );
+		writer.write( glsl::FileVersion );
+		writer.write( key );
+		writer.write( entry.source );
+		write( writer, entry.constants );
+
+		// Written to a temporary file first, so that concurrent processes never read a partial entry.
+		auto path = doGetFilePath( key );
+		auto tmpPath = path + "."
+			+ std::to_string( std::chrono::high_resolution_clock::now().time_since_epoch().count() )
+			+ "." + std::to_string( reinterpret_cast< uintptr_t >( &entry ) )
+			+ ".tmp";
+		{
+			std::ofstream file{ tmpPath, std::ios::binary | std::ios::trunc };
+
+			if ( !file )
+			{
+				return;
+			}
+
+			file.write( reinterpret_cast< char const * >( data.data() ), std::streamsize( data.size() ) );
+
+			if ( !file )
+			{
+				file.close();
+				std::remove( tmpPath.c_str() );
+				return;
+			}
+		}
+
+		if ( std::rename( tmpPath.c_str(), path.c_str() ) != 0 )
+		{
+			// Most likely another process already wrote it.
+			std::remove( tmpPath.c_str() );
+		}
+	}
+
+	GlslCache & getGlslCache()
+	{
+		static GlslCache result;
+		return result;
+	}
+}
@@ -0,0 +1,67 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#pragma once
+
+#include "renderer/GlRenderer/Miscellaneous/GlContentHasher.hpp"
+#include "renderer/GlRenderer/Shader/GlShaderDesc.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+namespace ashes::gl
+{
+	/**
+	*\brief
+	*	Process wide cache of the SPIR-V to GLSL translations.
+	*\remarks
+	*	The key is computed by the caller, from everything that influences the generated GLSL.
+	*	When the ASHES_GL_SHADER_CACHE_DIR environment variable is set, the entries
+	*	are also written to, and read from, that folder (one file per entry).
+	*/
+	class GlslCache
+	{
+	public:
+		struct Entry
+		{
+			std::string source;
+			ConstantsLayout constants;
+		};
+
+	public:
+		GlslCache();
+
+		bool find( ContentHash const & key
+			, Entry & result );
+		void add( ContentHash const & key
+			, Entry entry );
+
+		uint64_t getHitCount()const noexcept
+		{
+			return m_hits;
+		}
+
+		uint64_t getMissCount()const noexcept
+		{
+			return m_misses;
+		}
+
+	private:
+		std::string doGetFilePath( ContentHash const & key )const;
+		bool doLoad( ContentHash const & key
+			, Entry & result )const;
+		void doSave( ContentHash const & key
+			, Entry const & entry )const;
+
+	private:
+		std::string m_directory;
+		std::mutex m_mutex;
+		std::unordered_map< ContentHash, Entry, ContentHashHasher > m_entries;
+		std::atomic< uint64_t > m_hits{};
+		std::atomic< uint64_t > m_misses{};
+	};
+
+	GlslCache & getGlslCache();
+}
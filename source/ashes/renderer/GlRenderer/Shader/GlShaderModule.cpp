@@ -8,8 +8,11 @@ See LICENSE file in root folder.
 #include "Core/GlPhysicalDevice.hpp"
 #include "Core/GlInstance.hpp"
 #include "Miscellaneous/GlValidator.hpp"
+#include "Pipeline/GlPipelineLayout.hpp"
+#include "Shader/GlGlslCache.hpp"
 
 #include <iostream>
+#include <mutex>
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Walloc-zero"
 #include <regex>
@@ -34,6 +37,13 @@ namespace ashes::gl
 	{
 		static uint32_t constexpr OpCodeSPIRV = 0x07230203;
 
+		/**
+		*\brief
+		*	Sets the global locale to "C" while SPIRV-Cross runs.
+		*\remarks
+		*	Translations may run concurrently, so the locale is only
+		*	changed by the first guard, and restored by the last one.
+		*/
 		struct BlockLocale
 		{
 			BlockLocale( BlockLocale const & ) = delete;
@@ -43,14 +53,24 @@ namespace ashes::gl
 
 			BlockLocale()
 			{
-				m_prvLoc = std::locale::global( std::locale{ "C" } );
+				std::lock_guard< std::mutex > lock{ getMutex() };
+
+				if ( !getCount()++ )
+				{
+					getPrvLoc() = std::locale::global( std::locale{ "C" } );
+				}
 			}
 
 			~BlockLocale()noexcept
 			{
 				try
 				{
-					std::locale::global( m_prvLoc );
+					std::lock_guard< std::mutex > lock{ getMutex() };
+
+					if ( !--getCount() )
+					{
+						std::locale::global( getPrvLoc() );
+					}
 				}
 				catch ( ... )
 				{
@@ -59,7 +79,23 @@ namespace ashes::gl
 			}
 
 		private:
-			std::locale m_prvLoc;
+			static std::mutex & getMutex()
+			{
+				static std::mutex result;
+				return result;
+			}
+
+			static uint32_t & getCount()
+			{
+				static uint32_t result{};
+				return result;
+			}
+
+			static std::locale & getPrvLoc()
+			{
+				static std::locale result;
+				return result;
+			}
 		};
 	}
 
@@ -641,6 +677,70 @@ namespace ashes::gl
 			}
 		}
 
+		static void doHash( ContentHasher & hasher
+			, ShaderBindingMap const & bindings )
+		{
+			hasher.add( uint32_t( bindings.size() ) );
+
+			for ( auto & [key, index] : bindings )
+			{
+				hasher.add( key );
+				hasher.add( index );
+			}
+		}
+
+		// Everything that can change the output of compileSpvToGlsl must be part of the key.
+		static ContentHash doMakeGlslKey( VkDevice device
+			, VkPipelineLayout pipelineLayout
+			, VkPipelineCreateFlags createFlags
+			, UInt32Array const & shader
+			, VkShaderStageFlagBits previousStage
+			, VkShaderStageFlagBits currentStage
+			, VkPipelineShaderStageCreateInfo const & state
+			, bool invertY )
+		{
+			static uint32_t constexpr KeyVersion = 1u;
+			ContentHasher hasher;
+			hasher.add( KeyVersion );
+			hasher.add( get( getInstance( device ) )->getExtensions().getShaderVersion() );
+			hasher.add( hasProgramPipelines( device ) );
+			hasher.add( get( getInstance( device ) )->getFeatures().hasBaseInstance );
+			hasher.add( createFlags );
+			hasher.add( invertY );
+			hasher.add( previousStage );
+			hasher.add( currentStage );
+			hasher.add( uint32_t( shader.size() ) );
+			hasher.add( shader.data(), shader.size() * sizeof( uint32_t ) );
+
+			if ( auto spec = state.pSpecializationInfo )
+			{
+				hasher.add( spec->mapEntryCount );
+
+				for ( auto & entry : makeArrayView( spec->pMapEntries, spec->mapEntryCount ) )
+				{
+					hasher.add( entry.constantID );
+					hasher.add( entry.offset );
+					hasher.add( uint64_t( entry.size ) );
+				}
+
+				hasher.add( uint64_t( spec->dataSize ) );
+				hasher.add( spec->pData, spec->dataSize );
+			}
+			else
+			{
+				hasher.add( 0u );
+			}
+
+			auto & bindings = get( pipelineLayout )->getShaderBindings();
+			doHash( hasher, bindings.ubo );
+			doHash( hasher, bindings.sbo );
+			doHash( hasher, bindings.img );
+			doHash( hasher, bindings.tex );
+			doHash( hasher, bindings.tbo );
+			doHash( hasher, bindings.ibo );
+			return hasher.get();
+		}
+
 		template< typename CompileT >
 		static VkResult compileChecked( CompileT comp )
 		{
@@ -683,6 +783,24 @@ namespace ashes::gl
 			{
 				isGlsl = false;
 #if GlRenderer_USE_SPIRV_CROSS
+				auto & cache = getGlslCache();
+				auto key = doMakeGlslKey( device
+					, pipelineLayout
+					, createFlags
+					, shader
+					, previousStage
+					, currentStage
+					, state
+					, invertY );
+
+				if ( GlslCache::Entry entry;
+					cache.find( key, entry ) )
+				{
+					constants = std::move( entry.constants );
+					result = std::move( entry.source );
+					return VK_SUCCESS;
+				}
+
 				gl::shader::BlockLocale guard;
 				spirv_cross::CompilerGLSL compiler{ shader };
 				spirv_cross::ShaderResources resources = compiler.get_shader_resources();
@@ -705,6 +823,12 @@ namespace ashes::gl
 						result = compiler.compile();
 					} );
 				doReworkFrontFace( invertY, result );
+
+				if ( vkres == VK_SUCCESS )
+				{
+					cache.add( key, { result, constants } );
+				}
+
 				return vkres;
 #else
 				throw ashes::BaseException{ "Can't parse SPIR-V shaders, pull submodule SpirvCross" };
@@ -842,16 +966,13 @@ namespace ashes::gl
 		unregisterObject( m_device, *this );
 	}
 
-	VkResult ShaderModule::compile( VkPipeline pipeline
-		, VkPipelineShaderStageCreateInfo const * previousState
+	VkResult ShaderModule::translate( VkPipelineShaderStageCreateInfo const * previousState
 		, VkPipelineShaderStageCreateInfo const & currentState
 		, VkPipelineLayout pipelineLayout
 		, VkPipelineCreateFlags createFlags
 		, bool invertY
-		, ShaderDesc & result )
+		, ShaderTranslation & result )const
 	{
-		auto context = get( m_device )->getContext();
-		bool isGlsl;
 		auto res = common::shader::compileSpvToGlsl( m_device
 			, pipelineLayout
 			, createFlags
@@ -863,58 +984,46 @@ namespace ashes::gl
 			, currentState.stage
 			, currentState
 			, invertY
-			, m_constants
-			, isGlsl
-			, m_source );
+			, result.constants
+			, result.isGlsl
+			, result.source );
 
-		if ( res == VK_SUCCESS )
+		if ( res == VK_SUCCESS
+			&& !hasProgramPipelines( m_device ) )
 		{
-			if ( !hasProgramPipelines( m_device ) )
+			if ( result.source.find( "samplerCubeArray" ) != std::string::npos )
 			{
-				result = compileCombined( context
-					, currentState );
+				std::regex regex{ R"(#version[ ]*\d*)" };
+				result.source = std::regex_replace( result.source.data()
+					, regex
+					, R"($&
+#extension GL_ARB_texture_cube_map_array: enable
+)" );
 			}
-			else
+
+			if ( result.source.find( "gl_ViewportIndex" ) != std::string::npos )
 			{
-				result = compileSeparate( context
-					, pipeline
-					, currentState
-					, isGlsl );
+				std::regex regex{ R"(#version[ ]*\d*)" };
+				result.source = std::regex_replace( result.source.data()
+					, regex
+					, R"($&
+#extension GL_ARB_viewport_array: enable
+)" );
 			}
 		}
 
 		return res;
 	}
 
-	ShaderDesc ShaderModule::compileCombined( ContextLock const & context
-		, VkPipelineShaderStageCreateInfo const & state )
+	GLuint ShaderModule::compileCombined( ContextLock const & context
+		, VkPipelineShaderStageCreateInfo const & state
+		, ShaderTranslation const & translation )const
 	{
 		auto shader = glLogNonVoidCall( context
 			, glCreateShader
 			, getShaderStage( state.stage ) );
-
-		if ( m_source.find( "samplerCubeArray" ) != std::string::npos )
-		{
-			std::regex regex{ R"(#version[ ]*\d*)" };
-			m_source = std::regex_replace( m_source.data()
-				, regex
-				, R"($&
-#extension GL_ARB_texture_cube_map_array: enable
-)" );
-		}
-
-		if ( m_source.find( "gl_ViewportIndex" ) != std::string::npos )
-		{
-			std::regex regex{ R"(#version[ ]*\d*)" };
-			m_source = std::regex_replace( m_source.data()
-				, regex
-				, R"($&
-#extension GL_ARB_viewport_array: enable
-)" );
-		}
-
-		auto length = int( m_source.size() );
-		char const * data = m_source.data();
+		auto length = int( translation.source.size() );
+		char const * data = translation.source.data();
 		glLogCall( context
 			, glShaderSource
 			, shader
@@ -924,25 +1033,25 @@ namespace ashes::gl
 		glLogCall( context
 			, glCompileShader
 			, shader );
-		ShaderDesc result{};
+		return shader;
+	}
 
-		if ( gl3::shader::checkCompileErrors( context
+	bool ShaderModule::checkCombined( ContextLock const & context
+		, GLuint shader
+		, ShaderTranslation const & translation )const
+	{
+		return gl3::shader::checkCompileErrors( context
 			, get( this )
 			, shader
-			, m_source ) )
-		{
-			result.program = shader;
-		}
-
-		return result;
+			, translation.source );
 	}
 
 	ShaderDesc ShaderModule::compileSeparate( ContextLock const & context
 		, VkPipeline pipeline
 		, VkPipelineShaderStageCreateInfo const & state
-		, bool isGlsl )
+		, ShaderTranslation & translation )const
 	{
-		char const * data = m_source.data();
+		char const * data = translation.source.data();
 		auto programObject = glLogNonVoidCall( context
 			, glCreateShaderProgramv
 			, getShaderStage( state.stage )
@@ -953,22 +1062,22 @@ namespace ashes::gl
 			, programObject
 			, 1u
 			, "Separate shader link"
-			, m_source );
-		ShaderDesc result{ isGlsl };
+			, translation.source );
+		ShaderDesc result{ translation.isGlsl };
 
 		if ( usable )
 		{
-			for ( auto & constant : m_constants )
+			for ( auto & constant : translation.constants )
 			{
 				constant.program = programObject;
 			}
 
 			result = getShaderDesc( context
-				, m_constants
+				, translation.constants
 				, state.stage
 				, programObject );
 			result.program = programObject;
-			result.isGlsl = isGlsl;
+			result.isGlsl = translation.isGlsl;
 			result.stageFlags = state.stage;
 		}
 		else
@@ -16,6 +16,17 @@ namespace ashes::gl
 		, std::string const & from
 		, std::string const & source = std::string{} );
 
+	/**
+	*\brief
+	*	The result of the translation of a shader module, for one pipeline stage.
+	*/
+	struct ShaderTranslation
+	{
+		std::string source;
+		ConstantsLayout constants;
+		bool isGlsl{};
+	};
+
 	class ShaderModule
 		: public AutoIdIcdObject< ShaderModule >
 	{
@@ -25,17 +36,40 @@ namespace ashes::gl
 			, VkShaderModuleCreateInfo const & createInfo );
 		~ShaderModule()noexcept;
 
-		VkResult compile( VkPipeline pipeline
-			, VkPipelineShaderStageCreateInfo const * previousState
+		/**
+		*\brief
+		*	Generates the GLSL source for the given stage.
+		*\remarks
+		*	Doesn't issue any GL call, and can be called concurrently.
+		*/
+		VkResult translate( VkPipelineShaderStageCreateInfo const * previousState
 			, VkPipelineShaderStageCreateInfo const & currentState
 			, VkPipelineLayout pipelineLayout
 			, VkPipelineCreateFlags createFlags
 			, bool invertY
-			, ShaderDesc & result );
+			, ShaderTranslation & result )const;
+		/**
+		*\brief
+		*	Creates the shader object and starts its compilation, without waiting for its status.
+		*/
+		GLuint compileCombined( ContextLock const & context
+			, VkPipelineShaderStageCreateInfo const & state
+			, ShaderTranslation const & translation )const;
+		/**
+		*\brief
+		*	Checks the compilation status of a shader object created by compileCombined.
+		*/
+		bool checkCombined( ContextLock const & context
+			, GLuint shader
+			, ShaderTranslation const & translation )const;
+		ShaderDesc compileSeparate( ContextLock const & context
+			, VkPipeline pipeline
+			, VkPipelineShaderStageCreateInfo const & state
+			, ShaderTranslation & translation )const;
 
-		ConstantsLayout const & getConstants()const
+		UInt32Array const & getCode()const
 		{
-			return m_constants;
+			return m_code;
 		}
 
 		VkDevice getDevice()const
@@ -43,18 +77,8 @@ namespace ashes::gl
 			return m_device;
 		}
 
-	private:
-		ShaderDesc compileCombined( ContextLock const & context
-			, VkPipelineShaderStageCreateInfo const & state );
-		ShaderDesc compileSeparate( ContextLock const & context
-			, VkPipeline pipeline
-			, VkPipelineShaderStageCreateInfo const & state
-			, bool isGlsl );
-
 	private:
 		VkDevice m_device;
 		UInt32Array m_code;
-		mutable std::string m_source;
-		mutable ConstantsLayout m_constants;
 	};
 }
@@ -6,6 +6,7 @@ See LICENSE file in root folder.
 
 #include "Core/GlDevice.hpp"
 #include "Miscellaneous/GlValidator.hpp"
+#include "Pipeline/GlPipelineCache.hpp"
 #include "Shader/GlShaderModule.hpp"
 
 #include "ashesgl_api.hpp"
@@ -16,13 +17,13 @@ namespace ashes::gl
 {
 	namespace shader
 	{
-		static ConstantsLayout mergeConstants( VkPipelineShaderStageCreateInfoArray const & stages )
+		static ConstantsLayout mergeConstants( std::vector< ShaderTranslation > const & translations )
 		{
 			ConstantsLayout result;
 
-			for ( auto & stage : stages )
+			for ( auto & translation : translations )
 			{
-				if ( auto & constants = get( stage.module )->getConstants();
+				if ( auto & constants = translation.constants;
 					!constants.empty() )
 				{
 					if ( result.empty() )
@@ -176,6 +177,7 @@ namespace ashes::gl
 	ShaderProgram::ShaderProgram( VkDevice device
 		, ContextState const * state
 		, VkPipeline pipeline
+		, VkPipelineCache pipelineCache
 		, VkPipelineShaderStageCreateInfoArray stages
 		, VkPipelineLayout layout
 		, VkPipelineCreateFlags createFlags
@@ -183,77 +185,149 @@ namespace ashes::gl
 		, Optional< VkPipelineVertexInputStateCreateInfo > const & vertexInputState
 		, bool invertY )
 		: m_device{ device }
+		, m_state{ state }
+		, m_pipeline{ pipeline }
+		, m_layout{ layout }
+		, m_createFlags{ createFlags }
+		, m_renderPass{ renderPass }
+		, m_vertexInputState{ vertexInputState }
+		, m_invertY{ invertY }
 		, bindings{ get( layout )->getShaderBindings() }
 		, stages{ std::move( stages ) }
 	{
-		auto context = get( m_device )->getContext();
+		for ( auto & stage : this->stages )
+		{
+			stageFlags |= stage.stage;
+		}
 
-		if ( state )
+		// Program binaries are only supported for the combined programs.
+		if ( pipelineCache
+			&& !hasProgramPipelines( m_device )
+			&& hasProgramBinary( m_device ) )
 		{
-			ContextStateStack stack{ device };
-			stack.apply( context
-				, *state );
+			m_cache = get( pipelineCache );
 		}
+	}
 
-		std::vector< ShaderDesc > descs;
-		VkPipelineShaderStageCreateInfo const * previousStage{ nullptr };
+	ShaderProgram::~ShaderProgram()noexcept
+	{
+		auto context = get( m_device )->getContext();
 
-		for ( auto & stage : this->stages )
+		if ( hasProgramPipelines( m_device ) )
 		{
-			stageFlags |= stage.stage;
-			ShaderDesc desc{};
+			doCleanupProgramPipeline( context );
+		}
+		else
+		{
+			doCleanupShaderProgram( context );
+		}
+	}
 
-			if ( auto result = get( stage.module )->compile( pipeline
-					, previousStage
-					, stage
-					, layout
-					, createFlags
-					, invertY
-					, desc );
-				result != VK_SUCCESS )
-			{
-				throw Exception{ result, "ShaderModule compilation" };
-			}
+	void ShaderProgram::prepare()
+	{
+		if ( m_cache )
+		{
+			m_cacheKey = PipelineCache::makeProgramKey( stages
+				, m_layout
+				, m_createFlags
+				, m_invertY );
+			m_fromBinary = m_cache->findProgram( m_cacheKey, m_binary );
+		}
 
-			descs.push_back( desc );
-			previousStage = &stage;
+		if ( !m_fromBinary )
+		{
+			doTranslate();
 		}
+	}
 
-		if ( hasProgramPipelines( m_device ) )
+	void ShaderProgram::submit( ContextLock const & context )
+	{
+		if ( m_state )
 		{
-			doInitProgramPipeline( context
-				, descs
-				, layout
-				, renderPass
-				, vertexInputState );
+			ContextStateStack stack{ m_device };
+			stack.apply( context
+				, *m_state );
+		}
+
+		if ( m_fromBinary )
+		{
+			doSubmitBinary( context );
+		}
+		else if ( hasProgramPipelines( m_device ) )
+		{
+			// Separate programs are linked at creation, there is nothing to defer.
+			std::vector< ShaderDesc > descs;
+			auto it = m_translations.begin();
+
+			for ( auto & stage : stages )
+			{
+				descs.push_back( get( stage.module )->compileSeparate( context
+					, m_pipeline
+					, stage
+					, *it ) );
+				++it;
+			}
+
+			doInitProgramPipeline( context, descs );
+			m_translations.clear();
 		}
 		else
 		{
-			doInitShaderProgram( context
-				, pipeline
-				, descs );
+			doSubmitShaderProgram( context );
 		}
 	}
 
-	ShaderProgram::~ShaderProgram()noexcept
+	void ShaderProgram::finish( ContextLock const & context )
 	{
-		auto context = get( m_device )->getContext();
+		if ( m_fromBinary )
+		{
+			if ( doFinishBinary( context ) )
+			{
+				return;
+			}
 
-		if ( hasProgramPipelines( m_device ) )
+			// The driver can reject a binary it produced itself (e.g. hardware change),
+			// the program is then fully rebuilt.
+			m_fromBinary = false;
+			doTranslate();
+			doSubmitShaderProgram( context );
+		}
+
+		if ( !hasProgramPipelines( m_device ) )
 		{
-			doCleanupProgramPipeline( context );
+			doFinishShaderProgram( context );
 		}
-		else
+	}
+
+	void ShaderProgram::doTranslate()
+	{
+		VkPipelineShaderStageCreateInfo const * previousStage{ nullptr };
+		m_translations.clear();
+
+		for ( auto & stage : stages )
 		{
-			doCleanupShaderProgram( context );
+			ShaderTranslation translation;
+
+			if ( auto result = get( stage.module )->translate( previousStage
+					, stage
+					, m_layout
+					, m_createFlags
+					, m_invertY
+					, translation );
+				result != VK_SUCCESS )
+			{
+				throw Exception{ result, "ShaderModule compilation" };
+			}
+
+			m_translations.push_back( std::move( translation ) );
+			previousStage = &stage;
 		}
+
+		m_constants = shader::mergeConstants( m_translations );
 	}
 
 	void ShaderProgram::doInitProgramPipeline( ContextLock const & context
-		, std::vector< ShaderDesc > const & descs
-		, VkPipelineLayout layout
-		, VkRenderPass renderPass
-		, Optional< VkPipelineVertexInputStateCreateInfo > const & vertexInputState )
+		, std::vector< ShaderDesc > const & descs )
 	{
 		program = shader::merge( descs );
 		glLogCreateCall( context
@@ -292,51 +366,89 @@ namespace ashes::gl
 		constantsPcb.size = size;
 
 		if ( get( getInstance( m_device ) )->isValidationEnabled()
-			&& renderPass != nullptr )
+			&& m_renderPass != nullptr )
 		{
 			validatePipeline( context
 				, program.program
-				, vertexInputState.value()
-				, renderPass );
+				, m_vertexInputState.value()
+				, m_renderPass );
 		}
 	}
 
-	void ShaderProgram::doInitShaderProgram( ContextLock const & context
-		, VkPipeline pipeline
-		, std::vector< ShaderDesc > const & descs )
+	void ShaderProgram::doSubmitShaderProgram( ContextLock const & context )
 	{
 		auto programObject = glLogNonVoidEmptyCall( context
 			, glCreateProgram );
-		bool isGlsl = true;
+		auto it = m_translations.begin();
 
-		for ( auto & desc : descs )
+		for ( auto & stage : stages )
 		{
+			auto shader = get( stage.module )->compileCombined( context
+				, stage
+				, *it );
 			glLogCall( context
 				, glAttachShader
 				, programObject
-				, desc.program );
-			modules.push_back( desc.program );
-			isGlsl = isGlsl && desc.isGlsl;
+				, shader );
+			modules.push_back( shader );
+			++it;
+		}
+
+		if ( m_cache )
+		{
+			glLogCall( context
+				, glProgramParameteri
+				, programObject
+				, GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+				, GL_TRUE );
 		}
 
 		glLogCall( context
 			, glLinkProgram
 			, programObject );
+		program.program = programObject;
+	}
 
-		if ( checkLinkErrors( context
-			, pipeline
-			, programObject
-			, int( modules.size() )
-			, "Shader program link" ) )
+	void ShaderProgram::doFinishShaderProgram( ContextLock const & context )
+	{
+		auto programObject = program.program;
+		bool compiled = true;
+
+		for ( size_t i = 0u; i < stages.size(); ++i )
 		{
-			auto constants = shader::mergeConstants( stages );
+			compiled = get( stages[i].module )->checkCombined( context
+				, modules[i]
+				, m_translations[i] )
+				&& compiled;
+		}
+
+		if ( compiled
+			&& checkLinkErrors( context
+				, m_pipeline
+				, programObject
+				, int( modules.size() )
+				, "Shader program link" ) )
+		{
+			if ( m_cache )
+			{
+				doStoreBinary( context
+					, programObject );
+			}
+
 			program = getShaderDesc( context
-				, constants
+				, m_constants
 				, VkShaderStageFlagBits( stageFlags )
 				, programObject );
 			program.program = programObject;
 			program.stageFlags = stageFlags;
 		}
+		else
+		{
+			glLogCall( context
+				, glDeleteProgram
+				, programObject );
+			program.program = 0;
+		}
 
 		for ( auto & shaderName : modules )
 		{
@@ -348,6 +460,86 @@ namespace ashes::gl
 				shaderName = 0;
 			}
 		}
+
+		m_translations.clear();
+	}
+
+	void ShaderProgram::doSubmitBinary( ContextLock const & context )
+	{
+		auto programObject = glLogNonVoidEmptyCall( context
+			, glCreateProgram );
+		glLogCall( context
+			, glProgramBinary
+			, programObject
+			, m_binary.format
+			, m_binary.data.data()
+			, GLsizei( m_binary.data.size() ) );
+		program.program = programObject;
+	}
+
+	bool ShaderProgram::doFinishBinary( ContextLock const & context )
+	{
+		auto programObject = program.program;
+		GLint linked{};
+		glLogCall( context
+			, glGetProgramiv
+			, programObject
+			, GL_INFO_LINK_STATUS
+			, &linked );
+
+		if ( !linked )
+		{
+			glLogCall( context
+				, glDeleteProgram
+				, programObject );
+			program.program = 0;
+			m_cache->removeProgram( m_cacheKey );
+			m_binary = {};
+			return false;
+		}
+
+		program = getShaderDesc( context
+			, m_binary.constants
+			, VkShaderStageFlagBits( stageFlags )
+			, programObject );
+		program.program = programObject;
+		program.stageFlags = stageFlags;
+		m_binary = {};
+		return true;
+	}
+
+	void ShaderProgram::doStoreBinary( ContextLock const & context
+		, GLuint programObject )
+	{
+		GLint length{};
+		glLogCall( context
+			, glGetProgramiv
+			, programObject
+			, GL_PROGRAM_BINARY_LENGTH
+			, &length );
+
+		if ( length <= 0 )
+		{
+			return;
+		}
+
+		PipelineCache::ProgramBinary binary;
+		binary.data.resize( size_t( length ) );
+		binary.constants = m_constants;
+		GLsizei written{};
+		glLogCall( context
+			, glGetProgramBinary
+			, programObject
+			, GLsizei( binary.data.size() )
+			, &written
+			, &binary.format
+			, binary.data.data() );
+
+		if ( written > 0 )
+		{
+			binary.data.resize( size_t( written ) );
+			m_cache->addProgram( m_cacheKey, std::move( binary ) );
+		}
 	}
 
 	void ShaderProgram::doCleanupProgramPipeline( ContextLock const & context )noexcept
@@ -382,5 +574,17 @@ namespace ashes::gl
 				, program.program );
 			program.program = 0;
 		}
+
+		// Only remains when the program was submitted but never finished.
+		for ( auto & shaderName : modules )
+		{
+			if ( shaderName )
+			{
+				glLogCall( context
+					, glDeleteShader
+					, shaderName );
+				shaderName = 0;
+			}
+		}
 	}
 }
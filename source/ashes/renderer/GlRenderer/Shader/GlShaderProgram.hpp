@@ -4,18 +4,30 @@ See LICENSE file in root folder.
 */
 #pragma once
 
+#include "Miscellaneous/GlContentHasher.hpp"
+#include "Pipeline/GlPipelineCache.hpp"
 #include "Shader/GlShaderDesc.hpp"
+#include "Shader/GlShaderModule.hpp"
 
 #include <renderer/RendererCommon/ShaderBindings.hpp>
 
 namespace ashes::gl
 {
+	/**
+	*\brief
+	*	The GL program of a pipeline.
+	*\remarks
+	*	The construction only stores the inputs, the program is built in three steps:
+	*	prepare (CPU only, can run concurrently), then submit and finish (on the context thread).
+	*	Submitting several programs before finishing them lets the driver compile them in parallel.
+	*/
 	class ShaderProgram
 	{
 	public:
 		ShaderProgram( VkDevice device
 			, ContextState const * state
 			, VkPipeline pipeline
+			, VkPipelineCache pipelineCache
 			, VkPipelineShaderStageCreateInfoArray stages
 			, VkPipelineLayout layout
 			, VkPipelineCreateFlags createFlags
@@ -23,9 +35,39 @@ namespace ashes::gl
 			, Optional< VkPipelineVertexInputStateCreateInfo > const & vertexInputState
 			, bool invertY = false );
 		~ShaderProgram()noexcept;
+		/**
+		*\brief
+		*	Looks up the pipeline cache, and generates the GLSL sources when needed.
+		*\remarks
+		*	Doesn't issue any GL call.
+		*/
+		void prepare();
+		/**
+		*\brief
+		*	Issues the compile and link calls, without waiting for their results.
+		*/
+		void submit( ContextLock const & context );
+		/**
+		*\brief
+		*	Checks the compile and link results, and retrieves the program layout.
+		*/
+		void finish( ContextLock const & context );
 
 	private:
 		VkDevice m_device;
+		ContextState const * m_state;
+		VkPipeline m_pipeline;
+		PipelineCache * m_cache{};
+		ContentHash m_cacheKey{};
+		VkPipelineLayout m_layout;
+		VkPipelineCreateFlags m_createFlags;
+		VkRenderPass m_renderPass;
+		Optional< VkPipelineVertexInputStateCreateInfo > m_vertexInputState;
+		bool m_invertY;
+		std::vector< ShaderTranslation > m_translations;
+		ConstantsLayout m_constants;
+		PipelineCache::ProgramBinary m_binary;
+		bool m_fromBinary{};
 
 	public:
 		PushConstantsDesc constantsPcb{};
@@ -36,14 +78,15 @@ namespace ashes::gl
 		VkShaderStageFlags stageFlags{};
 
 	private:
+		void doTranslate();
 		void doInitProgramPipeline( ContextLock const & context
-			, std::vector< ShaderDesc > const & descs
-			, VkPipelineLayout layout
-			, VkRenderPass renderPass
-			, Optional< VkPipelineVertexInputStateCreateInfo > const & vertexInputState );
-		void doInitShaderProgram( ContextLock const & context
-			, VkPipeline pipeline
 			, std::vector< ShaderDesc > const & descs );
+		void doSubmitShaderProgram( ContextLock const & context );
+		void doFinishShaderProgram( ContextLock const & context );
+		void doSubmitBinary( ContextLock const & context );
+		bool doFinishBinary( ContextLock const & context );
+		void doStoreBinary( ContextLock const & context
+			, GLuint programObject );
 		void doCleanupProgramPipeline( ContextLock const & context )noexcept;
 		void doCleanupShaderProgram( ContextLock const & context )noexcept;
 	};
@@ -20,27 +20,114 @@ namespace ashes::gl
 	Event::~Event()noexcept
 	{
 		unregisterObject( m_device, *this );
+
+		if ( m_sync )
+		{
+			auto context = get( m_device )->getContext();
+			doDeleteSync( context );
+		}
 	}
 
-	VkResult Event::getStatus()const
+	VkResult Event::getStatus()
 	{
+		{
+			std::lock_guard< std::mutex > lock{ m_mutex };
+
+			if ( !m_sync )
+			{
+				return m_status;
+			}
+		}
+
+		auto context = get( m_device )->getContext();
+		std::lock_guard< std::mutex > lock{ m_mutex };
+
+		if ( m_sync )
+		{
+			GLint value;
+			GLsizei size;
+			glLogCall( context
+				, glGetSynciv
+				, m_sync
+				, GL_WAIT_RESULT_SYNC_STATUS
+				, GLsizei( sizeof( value ) )
+				, &size
+				, &value );
+
+			if ( value == GL_WAIT_RESULT_UNSIGNALED )
+			{
+				return VK_EVENT_RESET;
+			}
+
+			doDeleteSync( context );
+		}
+
 		return m_status;
 	}
 
-	void Event::updateStatus( VkResult status )
+	bool Event::isSet()const noexcept
 	{
-		m_status = status;
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		return m_status == VK_EVENT_SET;
 	}
 
 	VkResult Event::set()
 	{
-		updateStatus( VK_EVENT_SET );
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		m_status = VK_EVENT_SET;
 		return VK_SUCCESS;
 	}
 
 	VkResult Event::reset()
 	{
-		updateStatus( VK_EVENT_RESET );
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		m_status = VK_EVENT_RESET;
 		return VK_SUCCESS;
 	}
+
+	void Event::set( ContextLock const & context )
+	{
+		auto sync = glLogNonVoidCall( context
+			, glFenceSync
+			, GL_WAIT_FLAG_SYNC_GPU_COMMANDS_COMPLETE
+			, 0u );
+
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		doDeleteSync( context );
+		m_sync = sync;
+		m_status = VK_EVENT_SET;
+	}
+
+	void Event::reset( ContextLock const & context )
+	{
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		doDeleteSync( context );
+		m_status = VK_EVENT_RESET;
+	}
+
+	void Event::wait( ContextLock const & context )
+	{
+		std::lock_guard< std::mutex > lock{ m_mutex };
+
+		// Nothing to wait for if set from the host, the submission was held back until then.
+		if ( m_sync )
+		{
+			glLogCall( context
+				, glWaitSync
+				, m_sync
+				, 0u
+				, GL_TIMEOUT_IGNORED );
+		}
+	}
+
+	void Event::doDeleteSync( ContextLock const & context )
+	{
+		if ( m_sync )
+		{
+			glLogCall( context
+				, glDeleteSync
+				, m_sync );
+			m_sync = nullptr;
+		}
+	}
 }
@@ -6,8 +6,19 @@ See LICENSE file in root folder
 
 #include "renderer/GlRenderer/GlRendererPrerequisites.hpp"
 
+#include <mutex>
+
 namespace ashes::gl
 {
+	/**
+	*\brief
+	*	An event, set either from the host or from a queue.
+	*\remarks
+	*	A queue set inserts a sync in the GL stream, so that a queue wait only makes the GPU wait for it.
+	*	A submission waiting for a host set is held back by its queue until the event is set,
+	*	so a queue wait never blocks on the CPU.
+	*	Lock order: the device context, then the event.
+	*/
 	class Event
 		: public AutoIdIcdObject< Event >
 	{
@@ -15,19 +26,59 @@ namespace ashes::gl
 		Event( VkAllocationCallbacks const * allocInfo
 			, VkDevice device );
 		~Event()noexcept;
-
-		VkResult getStatus()const;
-		void updateStatus( VkResult status );
+		/**
+		*\return
+		*	The status seen from the host, an event set by a queue being set once the GPU has reached it.
+		*\remarks
+		*	Must not be called while holding the device context.
+		*/
+		VkResult getStatus();
+		/**
+		*\return
+		*	\p true if the event was set, from the host or by a queue, the latter maybe not reached by the GPU yet.
+		*/
+		bool isSet()const noexcept;
+		/**
+		*\brief
+		*	Sets the event from the host, and wakes up the queue waits.
+		*/
 		VkResult set();
+		/**
+		*\brief
+		*	Resets the event from the host.
+		*/
 		VkResult reset();
+		/**
+		*\brief
+		*	Sets the event from a queue.
+		*/
+		void set( ContextLock const & context );
+		/**
+		*\brief
+		*	Resets the event from a queue.
+		*/
+		void reset( ContextLock const & context );
+		/**
+		*\brief
+		*	Waits for the event from a queue, on the GPU if it was set by a queue.
+		*\remarks
+		*	The submission must have been held back until isSet() returned \p true.
+		*/
+		void wait( ContextLock const & context );
 
 		VkDevice getDevice()const noexcept
 		{
 			return m_device;
 		}
 
+	private:
+		void doDeleteSync( ContextLock const & context );
+
 	private:
 		VkDevice m_device;
+		mutable std::mutex m_mutex;
 		VkResult m_status{ VK_EVENT_RESET };
+		//! The sync inserted by the last queue set, until the host sees it reached.
+		GLsync m_sync{};
 	};
 }
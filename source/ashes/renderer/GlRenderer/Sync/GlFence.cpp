@@ -4,6 +4,7 @@ See LICENSE file in root folder.
 */
 #include "Sync/GlFence.hpp"
 
+#include "Command/GlSubmitThread.hpp"
 #include "Core/GlDevice.hpp"
 
 #include "ashesgl_api.hpp"
@@ -22,6 +23,7 @@ namespace ashes::gl
 	Fence::~Fence()noexcept
 	{
 		unregisterObject( m_device, *this );
+		waitSubmitted();
 
 		if ( m_fence )
 		{
@@ -42,6 +44,19 @@ namespace ashes::gl
 				, GL_WAIT_FLAG_SYNC_GPU_COMMANDS_COMPLETE
 				, 0u );
 		}
+
+		{
+			std::lock_guard< std::mutex > lock{ m_heldMutex };
+
+			if ( !m_held )
+			{
+				return;
+			}
+
+			m_held = false;
+		}
+
+		m_inserted.notify_all();
 	}
 
 	VkResult Fence::wait( ContextLock const & context
@@ -61,9 +76,11 @@ namespace ashes::gl
 				return VK_TIMEOUT;
 			}
 
-			if ( forceWait )
+			// A pending fence has already been waited for, without the context, by waitSubmitted.
+			if ( forceWait
+				&& isSubmitted() )
 			{
-				std::this_thread::sleep_for( std::chrono::milliseconds( timeout ) );
+				std::this_thread::sleep_for( std::chrono::nanoseconds( timeout ) );
 			}
 
 			return VK_TIMEOUT;
@@ -91,6 +108,10 @@ namespace ashes::gl
 			, m_fence );
 		m_fence = nullptr;
 		m_signaled = false;
+		m_submitThread = nullptr;
+		m_submitSerial = 0u;
+		std::lock_guard< std::mutex > lock{ m_heldMutex };
+		m_held = false;
 	}
 
 	VkResult Fence::getStatus( ContextLock const & context )
@@ -116,4 +137,62 @@ namespace ashes::gl
 			? VK_SUCCESS
 			: VK_NOT_READY;
 	}
+
+	void Fence::setPending( SubmitThread const & thread
+		, uint64_t serial )
+	{
+		m_submitThread = &thread;
+		m_submitSerial = serial;
+	}
+
+	void Fence::setHeld()
+	{
+		std::lock_guard< std::mutex > lock{ m_heldMutex };
+		m_firstUse = false;
+		m_held = true;
+	}
+
+	void Fence::waitSubmitted()const
+	{
+		if ( m_submitThread )
+		{
+			m_submitThread->wait( m_submitSerial );
+		}
+
+		std::unique_lock< std::mutex > lock{ m_heldMutex };
+		m_inserted.wait( lock
+			, [this]()
+			{
+				return !m_held;
+			} );
+	}
+
+	bool Fence::waitSubmitted( std::chrono::steady_clock::time_point deadline )const
+	{
+		if ( m_submitThread
+			&& !m_submitThread->wait( m_submitSerial, deadline ) )
+		{
+			return false;
+		}
+
+		std::unique_lock< std::mutex > lock{ m_heldMutex };
+		return m_inserted.wait_until( lock
+			, deadline
+			, [this]()
+			{
+				return !m_held;
+			} );
+	}
+
+	bool Fence::isSubmitted()const
+	{
+		if ( m_submitThread
+			&& !m_submitThread->isDone( m_submitSerial ) )
+		{
+			return false;
+		}
+
+		std::lock_guard< std::mutex > lock{ m_heldMutex };
+		return !m_held;
+	}
 }
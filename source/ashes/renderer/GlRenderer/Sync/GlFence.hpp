@@ -6,6 +6,10 @@ See LICENSE file in root folder
 
 #include "renderer/GlRenderer/GlRendererPrerequisites.hpp"
 
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
 namespace ashes::gl
 {
 	class Fence
@@ -24,6 +28,39 @@ namespace ashes::gl
 			, bool ignoreFirst );
 		void reset( ContextLock const & context );
 		VkResult getStatus( ContextLock const & context );
+		/**
+		*\brief
+		*	Tells the fence will be inserted by \p thread, once it has processed the given submission.
+		*/
+		void setPending( SubmitThread const & thread
+			, uint64_t serial );
+		/**
+		*\brief
+		*	Tells the fence will be inserted when its queue replays the submission it holds back.
+		*/
+		void setHeld();
+		/**
+		*\brief
+		*	Waits until the fence has been inserted, if it's pending in a submission thread or held back by its queue.
+		*\remarks
+		*	Must not be called while holding the device context.
+		*/
+		void waitSubmitted()const;
+		/**
+		*\brief
+		*	Waits until the fence has been inserted, if it's pending in a submission thread or held back by its queue,
+		*	or until \p deadline.
+		*\return
+		*	\p false if the fence is still pending.
+		*\remarks
+		*	Must not be called while holding the device context.
+		*/
+		bool waitSubmitted( std::chrono::steady_clock::time_point deadline )const;
+		/**
+		*\return
+		*	\p false if the fence is still pending in a submission thread or held back by its queue.
+		*/
+		bool isSubmitted()const;
 
 		GLsync getInternal()const
 		{
@@ -45,5 +82,10 @@ namespace ashes::gl
 		VkDevice m_device;
 		bool m_firstUse{ true };
 		bool m_signaled{ false };
+		SubmitThread const * m_submitThread{};
+		uint64_t m_submitSerial{};
+		mutable std::mutex m_heldMutex;
+		mutable std::condition_variable m_inserted;
+		bool m_held{};
 	};
 }
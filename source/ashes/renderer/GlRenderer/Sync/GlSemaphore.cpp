@@ -8,11 +8,169 @@ See LICENSE file in root folder.
 
 #include "ashesgl_api.hpp"
 
+#include <algorithm>
+#include <chrono>
+
 namespace ashes::gl
 {
+	namespace semaphore
+	{
+		using Clock = std::chrono::steady_clock;
+		/**
+		*\brief
+		*	Notified on any semaphore change, for the waits on several semaphores.
+		*/
+		struct Changes
+		{
+			std::mutex mutex;
+			std::condition_variable changed;
+			uint64_t generation{};
+		};
+
+		static Changes & getChanges()
+		{
+			static Changes result;
+			return result;
+		}
+
+		static uint64_t getGeneration()
+		{
+			auto & changes = getChanges();
+			std::lock_guard< std::mutex > lock{ changes.mutex };
+			return changes.generation;
+		}
+		/**
+		*\brief
+		*	Waits for a semaphore change after \p generation, or until \p deadline.
+		*\return
+		*	\p false if the deadline has been reached.
+		*/
+		static bool waitChange( uint64_t generation
+			, Optional< Clock::time_point > const & deadline )
+		{
+			auto & changes = getChanges();
+			std::unique_lock< std::mutex > lock{ changes.mutex };
+			auto predicate = [&changes, generation]()
+			{
+				return changes.generation != generation;
+			};
+
+			if ( !deadline )
+			{
+				changes.changed.wait( lock, predicate );
+				return true;
+			}
+
+			return changes.changed.wait_until( lock, *deadline, predicate );
+		}
+
+		static VkResult convert( GLenum result )
+		{
+			switch ( result )
+			{
+			case GL_WAIT_RESULT_ALREADY_SIGNALED:
+			case GL_WAIT_RESULT_CONDITION_SATISFIED:
+				return VK_SUCCESS;
+			case GL_WAIT_RESULT_TIMEOUT_EXPIRED:
+				return VK_TIMEOUT;
+			default:
+				return VK_ERROR_DEVICE_LOST;
+			}
+		}
+
+		static bool isTimeline( VkSemaphoreCreateInfo const & createInfo )
+		{
+#if VK_KHR_timeline_semaphore
+			auto pNext = reinterpret_cast< VkBaseInStructure const * >( createInfo.pNext );
+
+			while ( pNext )
+			{
+				if ( pNext->sType == VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR )
+				{
+					return reinterpret_cast< VkSemaphoreTypeCreateInfoKHR const * >( pNext )->semaphoreType == VK_SEMAPHORE_TYPE_TIMELINE_KHR;
+				}
+
+				pNext = pNext->pNext;
+			}
+#endif
+
+			return false;
+		}
+
+		static uint64_t getInitialValue( VkSemaphoreCreateInfo const & createInfo )
+		{
+#if VK_KHR_timeline_semaphore
+			auto pNext = reinterpret_cast< VkBaseInStructure const * >( createInfo.pNext );
+
+			while ( pNext )
+			{
+				if ( pNext->sType == VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR )
+				{
+					return reinterpret_cast< VkSemaphoreTypeCreateInfoKHR const * >( pNext )->initialValue;
+				}
+
+				pNext = pNext->pNext;
+			}
+#endif
+
+			return 0u;
+		}
+		/**
+		*\return
+		*	The deadline for \p timeout, none if it's long enough to be infinite, which also avoids overflowing it.
+		*/
+		static Optional< Clock::time_point > getDeadline( uint64_t timeout )
+		{
+			static uint64_t const infinite = uint64_t( std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::hours{ 24u * 365u } ).count() );
+
+			if ( timeout >= infinite )
+			{
+				return nullopt;
+			}
+
+			return Clock::now() + std::chrono::nanoseconds{ timeout };
+		}
+
+		static bool isSignaled( ContextLock const & context
+			, GLsync sync )
+		{
+			GLint value;
+			GLsizei size;
+			glLogCall( context
+				, glGetSynciv
+				, sync
+				, GL_WAIT_RESULT_SYNC_STATUS
+				, GLsizei( sizeof( value ) )
+				, &size
+				, &value );
+			return value != GL_WAIT_RESULT_UNSIGNALED;
+		}
+		/**
+		*\return
+		*	The nanoseconds left before \p deadline, \p timeout if there is no deadline.
+		*/
+		static uint64_t getRemaining( Optional< Clock::time_point > const & deadline
+			, uint64_t timeout )
+		{
+			if ( !deadline )
+			{
+				return timeout;
+			}
+
+			auto now = Clock::now();
+			return *deadline > now
+				? uint64_t( std::chrono::duration_cast< std::chrono::nanoseconds >( *deadline - now ).count() )
+				: 0u;
+		}
+	}
+
 	Semaphore::Semaphore( [[maybe_unused]] VkAllocationCallbacks const * allocInfo
-		, VkDevice device )
+		, VkDevice device
+		, VkSemaphoreCreateInfo const & createInfo )
 		: m_device{ device }
+		, m_timeline{ semaphore::isTimeline( createInfo ) }
+		, m_value{ semaphore::getInitialValue( createInfo ) }
+		, m_enqueued{ m_value }
 	{
 		registerObject( m_device, *this );
 	}
@@ -20,5 +178,344 @@ namespace ashes::gl
 	Semaphore::~Semaphore()noexcept
 	{
 		unregisterObject( m_device, *this );
+
+		if ( !m_pending.empty() )
+		{
+			auto context = get( m_device )->getContext();
+
+			for ( auto & pending : m_pending )
+			{
+				glLogCall( context
+					, glDeleteSync
+					, pending.second );
+			}
+		}
+	}
+
+	void Semaphore::enqueueSignal( uint64_t value )noexcept
+	{
+		if ( m_timeline )
+		{
+			std::lock_guard< std::mutex > lock{ m_mutex };
+			m_enqueued = std::max( m_enqueued, value );
+		}
+	}
+
+	bool Semaphore::isCovered( uint64_t value )const noexcept
+	{
+		if ( !m_timeline )
+		{
+			// A binary semaphore wait must be submitted after its signal.
+			return true;
+		}
+
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		return m_enqueued >= value;
+	}
+
+	void Semaphore::signal( ContextLock const & context
+		, uint64_t value )
+	{
+		auto sync = glLogNonVoidCall( context
+			, glFenceSync
+			, GL_WAIT_FLAG_SYNC_GPU_COMMANDS_COMPLETE
+			, 0u );
+
+		{
+			std::lock_guard< std::mutex > lock{ m_mutex };
+
+			if ( m_timeline )
+			{
+				// Drop the signals already reached, so that the list stays short.
+				doUpdate( context );
+				m_pending.emplace_back( value, sync );
+			}
+			else
+			{
+				if ( !m_pending.empty() )
+				{
+					// Signalled again without having been waited for.
+					glLogCall( context
+						, glDeleteSync
+						, m_pending.front().second );
+					m_pending.clear();
+				}
+
+				m_pending.emplace_back( 1u, sync );
+			}
+		}
+
+		doNotify();
+	}
+
+	void Semaphore::wait( ContextLock const & context
+		, uint64_t value )
+	{
+		std::lock_guard< std::mutex > lock{ m_mutex };
+
+		if ( m_timeline )
+		{
+			if ( m_value < value )
+			{
+				if ( auto sync = doFindCovering( value ) )
+				{
+					glLogCall( context
+						, glWaitSync
+						, sync
+						, 0u
+						, GL_TIMEOUT_IGNORED );
+				}
+			}
+		}
+		else if ( !m_pending.empty() )
+		{
+			// The wait unsignals the semaphore, GL keeps the sync alive until the wait is done.
+			glLogCall( context
+				, glWaitSync
+				, m_pending.front().second
+				, 0u
+				, GL_TIMEOUT_IGNORED );
+			glLogCall( context
+				, glDeleteSync
+				, m_pending.front().second );
+			m_pending.clear();
+		}
+	}
+
+	void Semaphore::signal( uint64_t value )
+	{
+		{
+			std::lock_guard< std::mutex > lock{ m_mutex };
+			m_value = std::max( m_value, value );
+			m_enqueued = std::max( m_enqueued, value );
+		}
+
+		doNotify();
+	}
+
+	uint64_t Semaphore::getCounterValue()
+	{
+		auto context = get( m_device )->getContext();
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		doUpdate( context );
+		return m_value;
+	}
+
+	VkResult Semaphore::wait( uint64_t value
+		, uint64_t timeout )
+	{
+		auto deadline = semaphore::getDeadline( timeout );
+
+		while ( true )
+		{
+			if ( isReached( value ) )
+			{
+				return VK_SUCCESS;
+			}
+
+			if ( isInserted( value ) )
+			{
+				auto result = waitInserted( get( m_device )->getContext()
+					, value
+					, semaphore::getRemaining( deadline, timeout ) );
+
+				if ( result != VK_NOT_READY )
+				{
+					return result;
+				}
+			}
+
+			// The signal isn't inserted yet: wait for it, or for a host signal, without holding the context.
+			std::unique_lock< std::mutex > lock{ m_mutex };
+			auto predicate = [this, value]()
+			{
+				return m_value >= value
+					|| doFindCovering( value ) != nullptr;
+			};
+
+			if ( !deadline )
+			{
+				m_changed.wait( lock, predicate );
+			}
+			else if ( !m_changed.wait_until( lock, *deadline, predicate ) )
+			{
+				return VK_TIMEOUT;
+			}
+		}
+	}
+
+	bool Semaphore::isReached( uint64_t value )const noexcept
+	{
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		return m_value >= value;
+	}
+
+	bool Semaphore::isInserted( uint64_t value )const noexcept
+	{
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		return doFindCovering( value ) != nullptr;
+	}
+
+	VkResult Semaphore::waitInserted( ContextLock const & context
+		, uint64_t value
+		, uint64_t timeout )
+	{
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		doUpdate( context );
+
+		if ( m_value >= value )
+		{
+			return VK_SUCCESS;
+		}
+
+		auto sync = doFindCovering( value );
+
+		if ( !sync )
+		{
+			return VK_NOT_READY;
+		}
+
+		// The covering sync is signaled after the value is reached, in the stream order.
+		return semaphore::convert( glLogNonVoidCall( context
+			, glClientWaitSync
+			, sync
+			, GL_WAIT_FLAG_SYNC_FLUSH_COMMANDS_BIT
+			, timeout ) );
+	}
+
+	void Semaphore::doUpdate( ContextLock const & context )
+	{
+		auto it = m_pending.begin();
+
+		// The syncs are inserted in the same stream, so they are signaled in order.
+		while ( it != m_pending.end()
+			&& semaphore::isSignaled( context, it->second ) )
+		{
+			m_value = std::max( m_value, it->first );
+			glLogCall( context
+				, glDeleteSync
+				, it->second );
+			++it;
+		}
+
+		m_pending.erase( m_pending.begin(), it );
+	}
+
+	void Semaphore::doNotify()
+	{
+		m_changed.notify_all();
+		auto & changes = semaphore::getChanges();
+
+		{
+			std::lock_guard< std::mutex > lock{ changes.mutex };
+			++changes.generation;
+		}
+
+		changes.changed.notify_all();
+	}
+
+	GLsync Semaphore::doFindCovering( uint64_t value )const noexcept
+	{
+		auto it = std::find_if( m_pending.begin()
+			, m_pending.end()
+			, [value]( std::pair< uint64_t, GLsync > const & lookup )
+			{
+				return lookup.first >= value;
+			} );
+		return it == m_pending.end()
+			? nullptr
+			: it->second;
+	}
+
+	VkResult waitSemaphores( ArrayView< VkSemaphore const > semaphores
+		, uint64_t const * values
+		, bool waitAny
+		, uint64_t timeout )
+	{
+		auto deadline = semaphore::getDeadline( timeout );
+
+		if ( !waitAny )
+		{
+			for ( auto handle : semaphores )
+			{
+				auto result = get( handle )->wait( *values
+					, semaphore::getRemaining( deadline, timeout ) );
+
+				if ( result != VK_SUCCESS )
+				{
+					return result;
+				}
+
+				++values;
+			}
+
+			return VK_SUCCESS;
+		}
+
+		while ( true )
+		{
+			// Taken before the checks, so that a change made after them isn't missed.
+			auto generation = semaphore::getGeneration();
+			std::vector< size_t > inserted;
+
+			for ( size_t i = 0u; i < semaphores.size(); ++i )
+			{
+				auto current = get( semaphores[i] );
+
+				if ( current->isReached( values[i] ) )
+				{
+					return VK_SUCCESS;
+				}
+
+				if ( current->isInserted( values[i] ) )
+				{
+					inserted.push_back( i );
+				}
+			}
+
+			if ( inserted.empty() )
+			{
+				// Only host signals, or signals yet to be inserted, can set the values.
+				if ( !semaphore::waitChange( generation, deadline ) )
+				{
+					return VK_TIMEOUT;
+				}
+
+				continue;
+			}
+
+			// The GPU sets the values: check each of them, then wait a slice on the first one,
+			// so that a host signal of another semaphore isn't missed for long.
+			{
+				auto context = get( get( semaphores[0] )->getDevice() )->getContext();
+
+				for ( auto index : inserted )
+				{
+					auto result = get( semaphores[index] )->waitInserted( context, values[index], 0u );
+
+					if ( result != VK_TIMEOUT
+						&& result != VK_NOT_READY )
+					{
+						return result;
+					}
+				}
+
+				auto slice = uint64_t( std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::milliseconds{ 1 } ).count() );
+				auto result = get( semaphores[inserted.front()] )->waitInserted( context
+					, values[inserted.front()]
+					, std::min( slice, semaphore::getRemaining( deadline, timeout ) ) );
+
+				if ( result != VK_TIMEOUT
+					&& result != VK_NOT_READY )
+				{
+					return result;
+				}
+			}
+
+			if ( semaphore::getRemaining( deadline, timeout ) == 0u )
+			{
+				return VK_TIMEOUT;
+			}
+		}
 	}
 }
@@ -6,22 +6,134 @@ See LICENSE file in root folder.
 
 #include "renderer/GlRenderer/GlRendererPrerequisites.hpp"
 
+#include <condition_variable>
+#include <mutex>
+
 namespace ashes::gl
 {
+	/**
+	*\brief
+	*	A semaphore, backed by GL sync objects.
+	*\remarks
+	*	The signal operations insert a sync in the GL stream, and the wait operations
+	*	use glWaitSync, so that the GPU waits without stalling the CPU.
+	*	A binary semaphore holds at most one pending signal, consumed by its wait.
+	*	A timeline semaphore holds its pending signals, sorted by value, until they are reached.
+	*	Lock order: the device context, then the semaphore.
+	*/
 	class Semaphore
 		: public AutoIdIcdObject< Semaphore >
 	{
 	public:
 		Semaphore( VkAllocationCallbacks const * allocInfo
-			, VkDevice device );
+			, VkDevice device
+			, VkSemaphoreCreateInfo const & createInfo );
 		~Semaphore()noexcept;
+		/**
+		*\brief
+		*	Records that a submitted batch will signal the semaphore with \p value.
+		*\remarks
+		*	Called when the batch is submitted, which may be before it's replayed.
+		*/
+		void enqueueSignal( uint64_t value )noexcept;
+		/**
+		*\return
+		*	\p true if \p value is reached, or will be by an already submitted signal.
+		*/
+		bool isCovered( uint64_t value )const noexcept;
+		/**
+		*\brief
+		*	Inserts a sync signalling the semaphore with \p value, in the GL stream.
+		*/
+		void signal( ContextLock const & context
+			, uint64_t value );
+		/**
+		*\brief
+		*	Makes the GPU wait for the semaphore to reach \p value.
+		*/
+		void wait( ContextLock const & context
+			, uint64_t value );
+		/**
+		*\brief
+		*	Signals a timeline semaphore from the host.
+		*/
+		void signal( uint64_t value );
+		/**
+		*\brief
+		*	Retrieves a timeline semaphore's current value.
+		*/
+		uint64_t getCounterValue();
+		/**
+		*\brief
+		*	Waits, on the CPU, for a timeline semaphore to reach \p value.
+		*\param[in] timeout
+		*	The timeout, in nanoseconds.
+		*\remarks
+		*	Must not be called while holding the device context.
+		*/
+		VkResult wait( uint64_t value
+			, uint64_t timeout );
+		/**
+		*\return
+		*	\p true if \p value is known to be reached, without checking the GL syncs.
+		*/
+		bool isReached( uint64_t value )const noexcept;
+		/**
+		*\return
+		*	\p true if an inserted signal will set \p value, its GL sync then tells when.
+		*/
+		bool isInserted( uint64_t value )const noexcept;
+		/**
+		*\brief
+		*	Waits, on the CPU, for the GL sync signalling \p value.
+		*\param[in] timeout
+		*	The timeout, in nanoseconds.
+		*\return
+		*	VK_NOT_READY if no inserted signal sets \p value.
+		*/
+		VkResult waitInserted( ContextLock const & context
+			, uint64_t value
+			, uint64_t timeout );
+
+		bool isTimeline()const noexcept
+		{
+			return m_timeline;
+		}
 
 		VkDevice getDevice()const
 		{
 			return m_device;
 		}
 
+	private:
+		void doUpdate( ContextLock const & context );
+		void doNotify();
+		GLsync doFindCovering( uint64_t value )const noexcept;
+
 	private:
 		VkDevice m_device;
+		bool m_timeline{};
+		mutable std::mutex m_mutex;
+		mutable std::condition_variable m_changed;
+		//! The value known to be reached.
+		uint64_t m_value{};
+		//! The highest value an enqueued signal will set.
+		uint64_t m_enqueued{};
+		//! The inserted signals, in increasing values.
+		std::vector< std::pair< uint64_t, GLsync > > m_pending;
 	};
+	/**
+	*\brief
+	*	Waits, on the CPU, for all or any of the given timeline semaphores to reach their value.
+	*\param[in] timeout
+	*	The timeout, in nanoseconds.
+	*\remarks
+	*	Must not be called while holding the device context.
+	*	The device context is only used for values set by inserted signals,
+	*	others are waited for on a condition notified by any semaphore change.
+	*/
+	VkResult waitSemaphores( ArrayView< VkSemaphore const > semaphores
+		, uint64_t const * values
+		, bool waitAny
+		, uint64_t timeout );
 }
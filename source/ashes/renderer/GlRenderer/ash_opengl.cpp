@@ -1,19 +1,53 @@
 #include "Core/GlContext.hpp"
+#include "Miscellaneous/GlWorkerPool.hpp"
 
 #include "ashesgl_api.hpp"
 
 #include <renderer/GlRenderer/Miscellaneous/GlWindow.hpp>
 #include <renderer/GlRenderer/Miscellaneous/GlExtensionsHandler.hpp>
+#include <renderer/RendererCommon/ProcAddrTable.hpp>
 
 #include <ashes/common/Exception.hpp>
 
+#include <chrono>
 #include <cstring>
 #include <iostream>
+#include <thread>
 
 namespace ashes::gl
 {
 	namespace details
 	{
+		//! The longest a wait for any fence blocks on one of them, before checking the others.
+		static uint64_t constexpr FencePollPeriod = 1000000u;
+
+		static std::chrono::steady_clock::time_point getDeadline( uint64_t timeout )noexcept
+		{
+			auto now = std::chrono::steady_clock::now();
+			auto max = std::chrono::steady_clock::time_point::max();
+			auto left = std::chrono::duration_cast< std::chrono::nanoseconds >( max - now ).count();
+
+			if ( timeout >= uint64_t( left ) )
+			{
+				return max;
+			}
+
+			return now + std::chrono::nanoseconds{ int64_t( timeout ) };
+		}
+
+		static uint64_t getRemaining( std::chrono::steady_clock::time_point deadline )noexcept
+		{
+			if ( deadline == std::chrono::steady_clock::time_point::max() )
+			{
+				return ~uint64_t( 0u );
+			}
+
+			auto remaining = std::chrono::duration_cast< std::chrono::nanoseconds >( deadline - std::chrono::steady_clock::now() ).count();
+			return remaining > 0
+				? uint64_t( remaining )
+				: 0u;
+		}
+
 		template< typename PropT >
 		static VkResult getCountedProps( std::vector< PropT > const & props
 			, uint32_t * pPropertyCount
@@ -54,6 +88,88 @@ namespace ashes::gl
 			*pPropertyCount = uint32_t( props.size() );
 			return VK_SUCCESS;
 		}
+
+		/**
+		*\brief
+		*	Creates the pipelines in batch:
+		*	the GLSL generation is spread over the device worker threads,
+		*	then all programs are submitted, before checking any of them,
+		*	so that drivers supporting parallel shader compile can overlap them.
+		*/
+		template< typename CreateInfoT >
+		static VkResult createPipelines( VkDevice device
+			, VkPipelineCache pipelineCache
+			, uint32_t createInfoCount
+			, CreateInfoT const * pCreateInfos
+			, VkAllocationCallbacks const * pAllocator
+			, VkPipeline * pPipelines )
+		{
+			std::vector< VkResult > results( createInfoCount, VK_SUCCESS );
+
+			for ( uint32_t i = 0u; i < createInfoCount; ++i )
+			{
+				results[i] = allocate( pPipelines[i]
+					, pAllocator
+					, device
+					, pipelineCache
+					, pCreateInfos[i] );
+			}
+
+			auto prepare = [&results, pPipelines]( size_t index )
+			{
+				if ( results[index] == VK_SUCCESS )
+				{
+					results[index] = get( pPipelines[index] )->prepare();
+				}
+			};
+
+			if ( createInfoCount > 1u )
+			{
+				get( device )->getWorkerPool().parallelFor( createInfoCount, prepare );
+			}
+			else if ( createInfoCount == 1u )
+			{
+				prepare( 0u );
+			}
+
+			{
+				auto context = get( device )->getContext();
+
+				for ( uint32_t i = 0u; i < createInfoCount; ++i )
+				{
+					if ( results[i] == VK_SUCCESS )
+					{
+						results[i] = get( pPipelines[i] )->submit( context );
+					}
+				}
+
+				for ( uint32_t i = 0u; i < createInfoCount; ++i )
+				{
+					if ( results[i] == VK_SUCCESS )
+					{
+						results[i] = get( pPipelines[i] )->finish( context );
+					}
+				}
+			}
+
+			VkResult result = VK_SUCCESS;
+
+			for ( uint32_t i = 0u; i < createInfoCount; ++i )
+			{
+				if ( results[i] != VK_SUCCESS )
+				{
+					deallocate( pPipelines[i], pAllocator );
+
+					if ( result == VK_SUCCESS )
+					{
+						// Error codes are negative, they can't be merged as unsigned values.
+						result = results[i];
+					}
+				}
+			}
+
+			return result;
+		}
 	}
 
 #pragma region Vulkan 1.0
@@ -445,11 +561,16 @@ namespace ashes::gl
 		uint32_t fenceCount,
 		const VkFence* pFences )
 	{
+		for ( uint32_t i = 0u; i < fenceCount; ++i )
+		{
+			get( pFences[i] )->waitSubmitted();
+		}
+
 		auto context = get( device )->getContext();
 
 		for ( uint32_t i = 0u; i < fenceCount; ++i )
 		{
-			get( *pFences )->reset( context );
+			get( pFences[i] )->reset( context );
 		}
 
 		return VK_SUCCESS;
@@ -459,6 +580,11 @@ namespace ashes::gl
 		VkDevice device,
 		VkFence fence )
 	{
+		if ( !get( fence )->isSubmitted() )
+		{
+			return VK_NOT_READY;
+		}
+
 		auto context = get( device )->getContext();
 		return get( fence )->getStatus( context );
 	}
@@ -470,34 +596,98 @@ namespace ashes::gl
 		VkBool32 waitAll,
 		uint64_t timeout )
 	{
-		auto context = get( device )->getContext();
+		auto deadline = details::getDeadline( timeout );
 
 		if ( waitAll )
 		{
+			// The fences pending in a submission thread need it to take the context.
+			for ( uint32_t i = 0u; i < fenceCount; ++i )
+			{
+				if ( !get( pFences[i] )->waitSubmitted( deadline ) )
+				{
+					return VK_TIMEOUT;
+				}
+			}
+
+			auto context = get( device )->getContext();
 			VkResult result = VK_SUCCESS;
 
 			for ( uint32_t i = 0u; i < fenceCount; ++i )
 			{
 				result = std::max( result
-					, get( *pFences )->wait( context, timeout, true, i > 0u ) );
+					, get( *pFences )->wait( context, details::getRemaining( deadline ), true, i > 0u ) );
 				++pFences;
 			}
 
 			return result;
 		}
 
-		VkResult result = fenceCount
-			? VK_TIMEOUT
-			: VK_SUCCESS;
-
-		for ( uint32_t i = 0u; i < fenceCount; ++i )
+		if ( !fenceCount )
 		{
-			result = std::min( result
-				, get( *pFences )->wait( context, timeout, false, i > 0u ) );
-			++pFences;
+			return VK_SUCCESS;
 		}
 
-		return result;
+		while ( true )
+		{
+			// Polls the fences already inserted, the first signaled one ends the wait.
+			Fence * pending{};
+			Fence * submitted{};
+
+			{
+				auto context = get( device )->getContext();
+
+				for ( uint32_t i = 0u; i < fenceCount; ++i )
+				{
+					auto fence = get( pFences[i] );
+
+					if ( !fence->isSubmitted() )
+					{
+						pending = pending ? pending : fence;
+					}
+					else if ( fence->wait( context, 0u, false, true ) == VK_SUCCESS )
+					{
+						return VK_SUCCESS;
+					}
+					else
+					{
+						submitted = submitted ? submitted : fence;
+					}
+				}
+
+				auto remaining = details::getRemaining( deadline );
+
+				if ( !remaining )
+				{
+					return VK_TIMEOUT;
+				}
+
+				if ( !pending
+					&& submitted
+					&& submitted->hasInternal() )
+				{
+					// All fences are inserted, block on one of them for a short while.
+					if ( submitted->wait( context, std::min( remaining, details::FencePollPeriod ), false, true ) == VK_SUCCESS )
+					{
+						return VK_SUCCESS;
+					}
+
+					continue;
+				}
+			}
+
+			// Without the context, so that the submission thread can process the pending fence.
+			auto next = std::min< std::chrono::steady_clock::time_point >( deadline
+				, std::chrono::steady_clock::now() + std::chrono::nanoseconds{ details::FencePollPeriod } );
+
+			if ( pending )
+			{
+				pending->waitSubmitted( next );
+			}
+			else
+			{
+				std::this_thread::sleep_until( next );
+			}
+		}
 	}
 
 	VkResult VKAPI_CALL vkCreateSemaphore(
@@ -509,7 +699,8 @@ namespace ashes::gl
 		assert( pSemaphore );
 		return allocate( *pSemaphore
 			, pAllocator
-			, device );
+			, device
+			, *pCreateInfo );
 	}
 
 	void VKAPI_CALL vkDestroySemaphore(
@@ -551,7 +742,9 @@ namespace ashes::gl
 		VkDevice device,
 		VkEvent event )
 	{
-		return get( event )->set();
+		get( event )->set();
+		get( device )->replayHeldSubmissions();
+		return VK_SUCCESS;
 	}
 
 	VkResult VKAPI_CALL vkResetEvent(
@@ -592,6 +785,12 @@ namespace ashes::gl
 		VkDeviceSize stride,
 		VkQueryResultFlags flags )
 	{
+		if ( checkFlag( flags, VK_QUERY_RESULT_WAIT_BIT ) )
+		{
+			// The queries may still be pending in a submission thread.
+			get( device )->drainQueues();
+		}
+
 		auto context = get( device )->getContext();
 		return get( queryPool )->getResults( context
 			, firstQuery
@@ -759,7 +958,7 @@ namespace ashes::gl
 		size_t* pDataSize,
 		void* pData )
 	{
-		auto & data = get( pipelineCache )->getData();
+		auto data = get( pipelineCache )->getData();
 		auto expectedSize = *pDataSize;
 		*pDataSize = data.size();
 
@@ -768,7 +967,7 @@ namespace ashes::gl
 			return VK_SUCCESS;
 		}
 
-		if ( expectedSize != data.size() )
+		if ( expectedSize < data.size() )
 		{
 			*pDataSize = 0u;
 			return VK_INCOMPLETE;
@@ -798,20 +997,12 @@ namespace ashes::gl
 		VkPipeline* pPipelines )
 	{
 		assert( pPipelines );
-		VkResult result = VK_SUCCESS;
-
-		for ( uint32_t i = 0u; i < createInfoCount; ++i )
-		{
-			auto tmp = allocate( *pPipelines
-				, pAllocator
-				, device
-				, *pCreateInfos );
-			result = VkResult( std::max< uint32_t >( tmp, result ) );
-			++pPipelines;
-			++pCreateInfos;
-		}
-
-		return result;
+		return details::createPipelines( device
+			, pipelineCache
+			, createInfoCount
+			, pCreateInfos
+			, pAllocator
+			, pPipelines );
 	}
 
 	VkResult VKAPI_CALL vkCreateComputePipelines(
@@ -823,20 +1014,12 @@ namespace ashes::gl
 		VkPipeline* pPipelines )
 	{
 		assert( pPipelines );
-		VkResult result = VK_SUCCESS;
-
-		for ( uint32_t i = 0u; i < createInfoCount; ++i )
-		{
-			auto tmp = allocate( *pPipelines
-				, pAllocator
-				, device
-				, *pCreateInfos );
-			result = VkResult( std::max< uint32_t >( tmp, result ) );
-			++pPipelines;
-			++pCreateInfos;
-		}
-
-		return result;
+		return details::createPipelines( device
+			, pipelineCache
+			, createInfoCount
+			, pCreateInfos
+			, pAllocator
+			, pPipelines );
 	}
 
 	void VKAPI_CALL vkDestroyPipeline(
@@ -1755,6 +1938,14 @@ namespace ashes::gl
 				pNext->pNext = next;
 			}
 #endif
+#if VK_KHR_timeline_semaphore
+			if ( pNext->sType == VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR )
+			{
+				auto next = pNext->pNext;
+				*reinterpret_cast< VkPhysicalDeviceTimelineSemaphoreFeaturesKHR * >( pNext ) = get( physicalDevice )->getTimelineSemaphoreFeatures();
+				pNext->pNext = next;
+			}
+#endif
 
 			pNext = pNext->pNext;
 		}
@@ -1791,6 +1982,14 @@ namespace ashes::gl
 				pNext->pNext = next;
 			}
 #endif
+#if VK_KHR_timeline_semaphore
+			if ( pNext->sType == VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_PROPERTIES_KHR )
+			{
+				auto next = pNext->pNext;
+				*reinterpret_cast< VkPhysicalDeviceTimelineSemaphorePropertiesKHR * >( pNext ) = get( physicalDevice )->getTimelineSemaphoreProperties();
+				pNext->pNext = next;
+			}
+#endif
 
 			pNext = pNext->pNext;
 		}
@@ -1873,6 +2072,7 @@ namespace ashes::gl
 		VkCommandPool commandPool,
 		VkCommandPoolTrimFlags flags )
 	{
+		get( commandPool )->trim();
 	}
 
 	void VKAPI_CALL vkGetDeviceQueue2(
@@ -1906,7 +2106,11 @@ namespace ashes::gl
 		const VkAllocationCallbacks* pAllocator,
 		VkDescriptorUpdateTemplate* pDescriptorUpdateTemplate )
 	{
-		return reportUnsupported( device, "vkCreateDescriptorUpdateTemplate" );
+		assert( pDescriptorUpdateTemplate );
+		return allocate( *pDescriptorUpdateTemplate
+			, pAllocator
+			, device
+			, *pCreateInfo );
 	}
 
 	void VKAPI_CALL vkDestroyDescriptorUpdateTemplate(
@@ -1914,7 +2118,7 @@ namespace ashes::gl
 		VkDescriptorUpdateTemplate descriptorUpdateTemplate,
 		const VkAllocationCallbacks* pAllocator )
 	{
-		reportUnsupported( device, "vkDestroyDescriptorUpdateTemplate" );
+		deallocate( descriptorUpdateTemplate, pAllocator );
 	}
 
 	void VKAPI_CALL vkUpdateDescriptorSetWithTemplate(
@@ -1923,7 +2127,7 @@ namespace ashes::gl
 		VkDescriptorUpdateTemplate descriptorUpdateTemplate,
 		const void* pData )
 	{
-		reportUnsupported( device, "vkUpdateDescriptorSetWithTemplate" );
+		get( descriptorUpdateTemplate )->update( descriptorSet, pData );
 	}
 
 	void VKAPI_CALL vkGetPhysicalDeviceExternalBufferProperties(
@@ -2033,7 +2237,8 @@ namespace ashes::gl
 		VkSemaphore semaphore,
 		uint64_t * pValue )
 	{
-		return reportUnsupported( device, "vkGetSemaphoreCounterValue" );
+		*pValue = get( semaphore )->getCounterValue();
+		return VK_SUCCESS;
 	}
 
 	VKAPI_ATTR VkResult VKAPI_CALL vkWaitSemaphores(
@@ -2041,14 +2246,19 @@ namespace ashes::gl
 		const VkSemaphoreWaitInfo * pWaitInfo,
 		uint64_t timeout )
 	{
-		return reportUnsupported( device, "vkWaitSemaphores" );
+		return waitSemaphores( makeArrayView( pWaitInfo->pSemaphores, pWaitInfo->semaphoreCount )
+			, pWaitInfo->pValues
+			, checkFlag( pWaitInfo->flags, VK_SEMAPHORE_WAIT_ANY_BIT )
+			, timeout );
 	}
 
 	VKAPI_ATTR VkResult VKAPI_CALL vkSignalSemaphore(
 		VkDevice device,
 		const VkSemaphoreSignalInfo * pSignalInfo )
 	{
-		return reportUnsupported( device, "vkSignalSemaphore" );
+		get( pSignalInfo->semaphore )->signal( pSignalInfo->value );
+		get( device )->replayHeldSubmissions();
+		return VK_SUCCESS;
 	}
 
 	VKAPI_ATTR VkDeviceAddress VKAPI_CALL vkGetBufferDeviceAddress(
@@ -2085,7 +2295,8 @@ namespace ashes::gl
 		VkSemaphore semaphore,
 		uint64_t * pValue )
 	{
-		return reportUnsupported( device, "vkGetSemaphoreCounterValueKHR" );
+		*pValue = get( semaphore )->getCounterValue();
+		return VK_SUCCESS;
 	}
 
 	VKAPI_ATTR VkResult VKAPI_CALL vkWaitSemaphoresKHR(
@@ -2093,14 +2304,19 @@ namespace ashes::gl
 		const VkSemaphoreWaitInfoKHR * pWaitInfo,
 		uint64_t timeout )
 	{
-		return reportUnsupported( device, "vkWaitSemaphoresKHR" );
+		return waitSemaphores( makeArrayView( pWaitInfo->pSemaphores, pWaitInfo->semaphoreCount )
+			, pWaitInfo->pValues
+			, checkFlag( pWaitInfo->flags, VK_SEMAPHORE_WAIT_ANY_BIT_KHR )
+			, timeout );
 	}
 
 	VKAPI_ATTR VkResult VKAPI_CALL vkSignalSemaphoreKHR(
 		VkDevice device,
 		const VkSemaphoreSignalInfoKHR * pSignalInfo )
 	{
-		return reportUnsupported( device, "vkSignalSemaphoreKHR" );
+		get( pSignalInfo->semaphore )->signal( pSignalInfo->value );
+		get( device )->replayHeldSubmissions();
+		return VK_SUCCESS;
 	}
 #endif
 #pragma endregion
@@ -2395,6 +2611,14 @@ namespace ashes::gl
 				pNext->pNext = next;
 			}
 #endif
+#if VK_KHR_timeline_semaphore
+			if ( pNext->sType == VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR )
+			{
+				auto next = pNext->pNext;
+				*reinterpret_cast< VkPhysicalDeviceTimelineSemaphoreFeaturesKHR * >( pNext ) = get( physicalDevice )->getTimelineSemaphoreFeatures();
+				pNext->pNext = next;
+			}
+#endif
 
 			pNext = pNext->pNext;
 		}
@@ -2429,6 +2653,14 @@ namespace ashes::gl
 				pNext->pNext = next;
 			}
 #endif
+#if VK_KHR_timeline_semaphore
+			if ( pNext->sType == VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_PROPERTIES_KHR )
+			{
+				auto next = pNext->pNext;
+				*reinterpret_cast< VkPhysicalDeviceTimelineSemaphorePropertiesKHR * >( pNext ) = get( physicalDevice )->getTimelineSemaphoreProperties();
+				pNext->pNext = next;
+			}
+#endif
 
 			pNext = pNext->pNext;
 		}
@@ -2550,6 +2782,7 @@ namespace ashes::gl
 		VkCommandPool commandPool,
 		VkCommandPoolTrimFlagsKHR flags )
 	{
+		get( commandPool )->trim();
 	}
 
 #endif
@@ -2670,7 +2903,11 @@ namespace ashes::gl
 		const VkAllocationCallbacks* pAllocator,
 		VkDescriptorUpdateTemplate* pDescriptorUpdateTemplate )
 	{
-		return reportUnsupported( device, "vkCreateDescriptorUpdateTemplateKHR" );
+		assert( pDescriptorUpdateTemplate );
+		return allocate( *pDescriptorUpdateTemplate
+			, pAllocator
+			, device
+			, *pCreateInfo );
 	}
 
 	void VKAPI_CALL vkDestroyDescriptorUpdateTemplateKHR(
@@ -2678,7 +2915,7 @@ namespace ashes::gl
 		VkDescriptorUpdateTemplate descriptorUpdateTemplate,
 		const VkAllocationCallbacks* pAllocator )
 	{
-		reportUnsupported( device, "vkDestroyDescriptorUpdateTemplateKHR" );
+		deallocate( descriptorUpdateTemplate, pAllocator );
 	}
 
 	void VKAPI_CALL vkUpdateDescriptorSetWithTemplateKHR(
@@ -2687,7 +2924,7 @@ namespace ashes::gl
 		VkDescriptorUpdateTemplate descriptorUpdateTemplate,
 		const void* pData )
 	{
-		reportUnsupported( device, "vkUpdateDescriptorSetWithTemplateKHR" );
+		get( descriptorUpdateTemplate )->update( descriptorSet, pData );
 	}
 
 #endif
@@ -4539,108 +4776,85 @@ namespace ashes::gl
 				&& get( device )->hasExtension( extension );
 		}
 
-		using ObjectFunctions = std::map< std::string, PFN_vkVoidFunction, std::less<> >;
-
 #pragma warning( push )
 #pragma warning( disable: 4191 )
 
-		ObjectFunctions const & getInstanceFunctions( VkInstance instance )
+		ProcAddrTable constexpr procAddrTable
 		{
-			static std::map< VkInstance, ObjectFunctions > functions;
-			auto [it, res] = functions.try_emplace( instance );
-
-			if ( res )
+			std::array
 			{
-				if ( instance != nullptr )
-				{
-					it->second =
-					{
-#define VK_LIB_GLOBAL_FUNCTION( v, x )\
-						{ "vk"#x, checkVersion( instance, v ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
-#define VK_LIB_GLOBAL_FUNCTION_EXT( v, n, x )\
-						{ "vk"#x, checkVersionExt( instance, v, n ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
-#define VK_LIB_INSTANCE_FUNCTION( v, x )\
-						{ "vk"#x, checkVersion( instance, v ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
-#define VK_LIB_INSTANCE_FUNCTION_EXT( v, n, x )\
-						{ "vk"#x, checkVersionExt( instance, v, n ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
-#define VK_LIB_PHYSDEVICE_FUNCTION( v, x )\
-						{ "vk"#x, checkVersion( instance, v ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
-#define VK_LIB_PHYSDEVICE_FUNCTION_EXT( v, n, x )\
-						{ "vk"#x, checkVersionExt( instance, v, n ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
-#define VK_LIB_DEVICE_FUNCTION( v, x )\
-						{ "vk"#x, checkVersion( instance, v ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
-#define VK_LIB_DEVICE_FUNCTION_EXT( v, n, x )\
-						{ "vk"#x, checkVersionExt( instance, v, n ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
-#define VK_STATIC_LIB_DEVICE_FUNCTION_EXT( v, n, x )\
-						{ "vk"#x, checkVersion( instance, v ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
-#include <ashes/ashes_functions_list.hpp>
-					};
-				}
-				else
-				{
-					it->second =
-					{
-#define VK_LIB_GLOBAL_FUNCTION( v, x )\
-						{ "vk"#x, PFN_vkVoidFunction( vk##x ) },
-#define VK_LIB_INSTANCE_FUNCTION( v, x )
-#define VK_LIB_PHYSDEVICE_FUNCTION( v, x )
-#define VK_LIB_DEVICE_FUNCTION( v, x )
-#define VK_LIB_GLOBAL_FUNCTION_EXT( v, n, x )
-#define VK_LIB_INSTANCE_FUNCTION_EXT( v, n, x )
-#define VK_LIB_PHYSDEVICE_FUNCTION_EXT( v, n, x )
-#define VK_LIB_DEVICE_FUNCTION_EXT( v, n, x )
-#include <ashes/ashes_functions_list.hpp>
-					};
-				}
+#include <renderer/RendererCommon/ProcAddrEntries.inl>
 			}
+		};
+		using ProcAddrMask = ProcMask< procAddrTable.size() >;
 
-			return it->second;
-		}
-
-		ObjectFunctions const & getPhysicalDeviceFunctions( VkInstance instance )
+		std::array< PFN_vkVoidFunction, procAddrTable.size() > const procAddrFunctions
 		{
-			static std::map< VkInstance, ObjectFunctions > functions;
-			auto [it, res] = functions.try_emplace( instance );
+#include <renderer/RendererCommon/ProcAddrFunctions.inl>
+		};
 
-			if ( res )
-			{
-				it->second =
+		ProcAddrMask const & getInstanceMask( VkInstance instance )
+		{
+			static ProcMaskRegistry< VkInstance, procAddrTable.size() > masks;
+			return masks.get( instance
+				, [instance]( ProcAddrMask & mask )
 				{
-#define VK_LIB_PHYSDEVICE_FUNCTION( v, x )\
-					{ "vk"#x, checkVersion( instance, v ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
-#define VK_LIB_PHYSDEVICE_FUNCTION_EXT( v, n, x )\
-					{ "vk"#x, checkVersionExt( instance, v, n ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
-#include <ashes/ashes_functions_list.hpp>
-				};
-			}
-
-			return it->second;
+					fillProcMask( procAddrTable
+						, mask
+						, [instance]( ProcEntry const & entry )
+						{
+							if ( instance == nullptr )
+							{
+								return entry.scope == ProcScope::eGlobal
+									&& entry.extension.empty();
+							}
+
+							return ( entry.extension.empty() || entry.isStatic )
+								? checkVersion( instance, entry.version )
+								: checkVersionExt( instance, entry.version, entry.extension );
+						} );
+				} );
 		}
 
-		ObjectFunctions const & getDeviceFunctions( VkDevice device )
+		ProcAddrMask const & getPhysicalDeviceMask( VkInstance instance )
 		{
-			static std::map< VkDevice, ObjectFunctions > functions;
-			auto [it, res] = functions.try_emplace( device );
-
-			if ( res )
-			{
-				it->second =
+			static ProcMaskRegistry< VkInstance, procAddrTable.size() > masks;
+			return masks.get( instance
+				, [instance]( ProcAddrMask & mask )
 				{
-#pragma clang diagnostic push
-#pragma clang diagnostic ignored "-Wcast-function-type-strict"
-					{ "vkGetDeviceProcAddr", PFN_vkVoidFunction( vkGetDeviceProcAddr ) },
-#pragma clang diagnostic pop
-#define VK_LIB_DEVICE_FUNCTION( v, x )\
-					{ "vk"#x, checkVersion( device, v ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
-#define VK_LIB_DEVICE_FUNCTION_EXT( v, n, x )\
-					{ "vk"#x, checkVersionExt( device, v, n ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
-#define VK_STATIC_LIB_DEVICE_FUNCTION_EXT( v, n, x )\
-					{ "vk"#x, checkVersionExt( device, v, n ) ? PFN_vkVoidFunction( vk##x ) : PFN_vkVoidFunction( nullptr ) },
-#include <ashes/ashes_functions_list.hpp>
-				};
-			}
+					fillProcMask( procAddrTable
+						, mask
+						, [instance]( ProcEntry const & entry )
+						{
+							return entry.scope == ProcScope::ePhysicalDevice
+								&& ( entry.extension.empty()
+									? checkVersion( instance, entry.version )
+									: checkVersionExt( instance, entry.version, entry.extension ) );
+						} );
+				} );
+		}
 
-			return it->second;
+		ProcAddrMask const & getDeviceMask( VkDevice device )
+		{
+			static ProcMaskRegistry< VkDevice, procAddrTable.size() > masks;
+			return masks.get( device
+				, [device]( ProcAddrMask & mask )
+				{
+					fillProcMask( procAddrTable
+						, mask
+						, [device]( ProcEntry const & entry )
+						{
+							if ( entry.name == "vkGetDeviceProcAddr" )
+							{
+								return true;
+							}
+
+							return entry.scope == ProcScope::eDevice
+								&& ( entry.extension.empty()
+									? checkVersion( device, entry.version )
+									: checkVersionExt( device, entry.version, entry.extension ) );
+						} );
+				} );
 		}
 	}
 
@@ -4697,48 +4911,30 @@ namespace ashes::gl
 		VkInstance instance,
 		const char* pName )
 	{
-		PFN_vkVoidFunction result{ nullptr };
-		auto & functions = getInstanceFunctions( instance );
-
-		if ( auto it = functions.find( pName );
-			it != functions.end() )
-		{
-			result = it->second;
-		}
-
-		return result;
+		return findProcAddr( procAddrTable
+			, procAddrFunctions
+			, getInstanceMask( instance )
+			, pName );
 	}
 
 	PFN_vkVoidFunction VKAPI_CALL vkGetPhysicalDeviceProcAddr(
 		VkInstance instance,
 		const char* pName )
 	{
-		PFN_vkVoidFunction result{ nullptr };
-		auto & functions = getPhysicalDeviceFunctions( instance );
-
-		if ( auto it = functions.find( pName );
-			it != functions.end() )
-		{
-			result = it->second;
-		}
-
-		return result;
+		return findProcAddr( procAddrTable
+			, procAddrFunctions
+			, getPhysicalDeviceMask( instance )
+			, pName );
 	}
 
 	PFN_vkVoidFunction VKAPI_CALL vkGetDeviceProcAddr(
 		VkDevice device,
 		const char* pName )
 	{
-		PFN_vkVoidFunction result{ nullptr };
-		auto & functions = getDeviceFunctions( device );
-
-		if ( auto it = functions.find( pName );
-			it != functions.end() )
-		{
-			result = it->second;
-		}
-
-		return result;
+		return findProcAddr( procAddrTable
+			, procAddrFunctions
+			, getDeviceMask( device )
+			, pName );
 	}
 }
 
@@ -0,0 +1,212 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#include "renderer/RendererCommon/DescriptorUpdateTemplate.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+namespace ashes
+{
+	namespace updtpl
+	{
+		static size_t getElementSize( VkDescriptorType type )
+		{
+			switch ( type )
+			{
+			case VK_DESCRIPTOR_TYPE_SAMPLER:
+			case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+			case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+			case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+			case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+				return sizeof( VkDescriptorImageInfo );
+			case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+			case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+				return sizeof( VkBufferView );
+			default:
+				return sizeof( VkDescriptorBufferInfo );
+			}
+		}
+
+		static bool isInlineUniformBlock( [[maybe_unused]] VkDescriptorType type )
+		{
+#if VK_EXT_inline_uniform_block
+			return type == VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT;
+#else
+			return false;
+#endif
+		}
+		/**
+		*\brief
+		*	Copies the strided descriptors of \p op to \p dst, where they're tightly packed.
+		*/
+		template< typename InfoT >
+		static InfoT const * gather( InfoT * dst
+			, DescriptorUpdateOp const & op
+			, uint8_t const * data )
+		{
+			for ( uint32_t i = 0u; i < op.count; ++i )
+			{
+				std::memcpy( dst + i
+					, data + op.offset + i * op.stride
+					, sizeof( InfoT ) );
+			}
+
+			return dst;
+		}
+	}
+
+	DescriptorUpdateProgram::DescriptorUpdateProgram( VkDescriptorUpdateTemplateCreateInfo const & createInfo
+		, VkDescriptorSetLayoutBindingArray const & bindings )
+	{
+		auto sorted = bindings;
+		std::sort( sorted.begin()
+			, sorted.end()
+			, []( VkDescriptorSetLayoutBinding const & lhs
+				, VkDescriptorSetLayoutBinding const & rhs )
+			{
+				return lhs.binding < rhs.binding;
+			} );
+		m_ops.reserve( createInfo.descriptorUpdateEntryCount );
+
+		for ( auto & entry : makeArrayView( createInfo.pDescriptorUpdateEntries, createInfo.descriptorUpdateEntryCount ) )
+		{
+			if ( !entry.descriptorCount )
+			{
+				continue;
+			}
+
+			if ( updtpl::isInlineUniformBlock( entry.descriptorType ) )
+			{
+				// The count and array element are in bytes, and can't overflow the binding.
+				m_ops.push_back( { entry.descriptorType
+					, entry.dstBinding
+					, entry.dstArrayElement
+					, entry.descriptorCount
+					, entry.offset
+					, entry.stride
+					, true
+					, 0u } );
+				continue;
+			}
+
+			auto it = std::find_if( sorted.begin()
+				, sorted.end()
+				, [&entry]( VkDescriptorSetLayoutBinding const & lookup )
+				{
+					return lookup.binding == entry.dstBinding;
+				} );
+			assert( it != sorted.end() );
+			auto elementSize = updtpl::getElementSize( entry.descriptorType );
+			auto dstArrayElement = entry.dstArrayElement;
+			auto offset = entry.offset;
+			uint32_t remaining = entry.descriptorCount;
+
+			// A write overflowing its binding continues on the next ones.
+			while ( remaining && it != sorted.end() )
+			{
+				if ( dstArrayElement < it->descriptorCount )
+				{
+					assert( it->descriptorType == entry.descriptorType );
+					auto count = std::min( remaining, it->descriptorCount - dstArrayElement );
+					auto packed = count == 1u || entry.stride == elementSize;
+					m_ops.push_back( { entry.descriptorType
+						, it->binding
+						, dstArrayElement
+						, count
+						, offset
+						, entry.stride
+						, packed
+						, ( packed ? 0u : doReserveScratch( entry.descriptorType, count ) ) } );
+					remaining -= count;
+					offset += count * entry.stride;
+					dstArrayElement = 0u;
+				}
+				else
+				{
+					dstArrayElement -= it->descriptorCount;
+				}
+
+				++it;
+			}
+		}
+	}
+
+	size_t DescriptorUpdateProgram::doReserveScratch( VkDescriptorType type
+		, uint32_t count )
+	{
+		size_t result{};
+
+		switch ( type )
+		{
+		case VK_DESCRIPTOR_TYPE_SAMPLER:
+		case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+		case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+		case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+		case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+			result = m_imagesCount;
+			m_imagesCount += count;
+			break;
+		case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+		case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+			result = m_texelBufferViewsCount;
+			m_texelBufferViewsCount += count;
+			break;
+		default:
+			result = m_buffersCount;
+			m_buffersCount += count;
+			break;
+		}
+
+		return result;
+	}
+
+	DescriptorUpdateProgram::Scratch & DescriptorUpdateProgram::doGetScratch()const
+	{
+		// Per thread, since a template may be applied to different sets concurrently.
+		thread_local Scratch result;
+
+		if ( result.images.size() < m_imagesCount )
+		{
+			result.images.resize( m_imagesCount );
+		}
+
+		if ( result.buffers.size() < m_buffersCount )
+		{
+			result.buffers.resize( m_buffersCount );
+		}
+
+		if ( result.texelBufferViews.size() < m_texelBufferViewsCount )
+		{
+			result.texelBufferViews.resize( m_texelBufferViewsCount );
+		}
+
+		return result;
+	}
+
+	void DescriptorUpdateProgram::doGather( VkWriteDescriptorSet & write
+		, Scratch & scratch
+		, DescriptorUpdateOp const & op
+		, uint8_t const * data )
+	{
+		switch ( op.type )
+		{
+		case VK_DESCRIPTOR_TYPE_SAMPLER:
+		case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+		case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+		case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+		case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+			write.pImageInfo = updtpl::gather( scratch.images.data() + op.scratchIndex, op, data );
+			break;
+		case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+		case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+			write.pTexelBufferView = updtpl::gather( scratch.texelBufferViews.data() + op.scratchIndex, op, data );
+			break;
+		default:
+			write.pBufferInfo = updtpl::gather( scratch.buffers.data() + op.scratchIndex, op, data );
+			break;
+		}
+	}
+}
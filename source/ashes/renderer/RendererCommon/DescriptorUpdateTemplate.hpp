@@ -0,0 +1,158 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#pragma once
+
+#ifndef VK_NO_PROTOTYPES
+#	define VK_NO_PROTOTYPES
+#endif
+
+#include <ashes/ashes.hpp>
+
+#pragma warning( push )
+#pragma warning( disable: 4365 )
+#include <vector>
+#pragma warning( pop )
+
+namespace ashes
+{
+	/**
+	*\brief
+	*	One step of a compiled descriptor update template.
+	*\remarks
+	*	It always stays inside its destination binding.
+	*/
+	struct DescriptorUpdateOp
+	{
+		VkDescriptorType type;
+		uint32_t dstBinding;
+		uint32_t dstArrayElement;
+		//! The descriptors count, or the bytes count for inline uniform blocks.
+		uint32_t count;
+		size_t offset;
+		size_t stride;
+		//! Tells if the descriptors are tightly packed in the user data, and can be written at once.
+		bool packed;
+		//! For the descriptors that aren't packed, their index in the scratch storage they're gathered in.
+		size_t scratchIndex;
+	};
+	using DescriptorUpdateOpArray = std::vector< DescriptorUpdateOp >;
+	/**
+	*\brief
+	*	A descriptor update template, flattened into a list of DescriptorUpdateOp.
+	*\remarks
+	*	The entries overflowing their binding are split over the following ones,
+	*	at creation time, so that applying the program doesn't need any lookup.
+	*/
+	class DescriptorUpdateProgram
+	{
+	public:
+		DescriptorUpdateProgram( VkDescriptorUpdateTemplateCreateInfo const & createInfo
+			, VkDescriptorSetLayoutBindingArray const & bindings );
+		/**
+		*\brief
+		*	Turns the user data into VkWriteDescriptorSet, one per op, given one by one to \p write.
+		*\remarks
+		*	The writes point directly into \p pData, or, for the descriptors that aren't packed there,
+		*	into a per thread scratch storage they're gathered in, so they are only valid during the call to \p write.
+		*	Once the scratch storage has grown to the program's needs, nothing is allocated.
+		*/
+		template< typename WriteFuncT >
+		void apply( VkDescriptorSet descriptorSet
+			, void const * pData
+			, WriteFuncT write )const
+		{
+			auto data = static_cast< uint8_t const * >( pData );
+			auto & scratch = doGetScratch();
+
+			for ( auto & op : m_ops )
+			{
+				VkWriteDescriptorSet result{ VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET
+					, nullptr
+					, descriptorSet
+					, op.dstBinding
+					, op.dstArrayElement
+					, op.count
+					, op.type
+					, nullptr
+					, nullptr
+					, nullptr };
+
+#if VK_EXT_inline_uniform_block
+
+				if ( op.type == VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT )
+				{
+					VkWriteDescriptorSetInlineUniformBlockEXT inlineUniform{ VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_INLINE_UNIFORM_BLOCK_EXT
+						, nullptr
+						, op.count
+						, data + op.offset };
+					result.pNext = &inlineUniform;
+					write( result );
+					continue;
+				}
+
+#endif
+
+				if ( op.packed )
+				{
+					doSetInfos( result, data + op.offset );
+					write( result );
+					continue;
+				}
+
+				doGather( result, scratch, op, data );
+				write( result );
+			}
+		}
+
+		DescriptorUpdateOpArray const & getOps()const noexcept
+		{
+			return m_ops;
+		}
+
+	private:
+		struct Scratch
+		{
+			std::vector< VkDescriptorImageInfo > images;
+			std::vector< VkDescriptorBufferInfo > buffers;
+			std::vector< VkBufferView > texelBufferViews;
+		};
+
+		size_t doReserveScratch( VkDescriptorType type
+			, uint32_t count );
+		Scratch & doGetScratch()const;
+		static void doGather( VkWriteDescriptorSet & write
+			, Scratch & scratch
+			, DescriptorUpdateOp const & op
+			, uint8_t const * data );
+		static void doSetInfos( VkWriteDescriptorSet & write
+			, uint8_t const * data )
+		{
+			switch ( write.descriptorType )
+			{
+			case VK_DESCRIPTOR_TYPE_SAMPLER:
+			case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+			case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+			case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+			case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+				write.pImageInfo = reinterpret_cast< VkDescriptorImageInfo const * >( data );
+				break;
+			case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+			case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+				write.pTexelBufferView = reinterpret_cast< VkBufferView const * >( data );
+				break;
+			default:
+				write.pBufferInfo = reinterpret_cast< VkDescriptorBufferInfo const * >( data );
+				break;
+			}
+		}
+
+	private:
+		DescriptorUpdateOpArray m_ops;
+		//! The scratch storage sizes needed by the ops that aren't packed.
+		size_t m_imagesCount{};
+		size_t m_buffersCount{};
+		size_t m_texelBufferViewsCount{};
+	};
+}
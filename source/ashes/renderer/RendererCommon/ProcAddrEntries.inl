@@ -0,0 +1,27 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+/*
+*	Expands ashes_functions_list.hpp to the ProcEntry list of an ashes::ProcAddrTable.
+*	Must be included in the same order as ProcAddrFunctions.inl, for the indices to match.
+*/
+#define VK_LIB_GLOBAL_FUNCTION( v, x )\
+	ashes::ProcEntry{ "vk"#x, ashes::ProcScope::eGlobal, v, {}, false },
+#define VK_LIB_GLOBAL_FUNCTION_EXT( v, n, x )\
+	ashes::ProcEntry{ "vk"#x, ashes::ProcScope::eGlobal, v, n, false },
+#define VK_LIB_INSTANCE_FUNCTION( v, x )\
+	ashes::ProcEntry{ "vk"#x, ashes::ProcScope::eInstance, v, {}, false },
+#define VK_LIB_INSTANCE_FUNCTION_EXT( v, n, x )\
+	ashes::ProcEntry{ "vk"#x, ashes::ProcScope::eInstance, v, n, false },
+#define VK_LIB_PHYSDEVICE_FUNCTION( v, x )\
+	ashes::ProcEntry{ "vk"#x, ashes::ProcScope::ePhysicalDevice, v, {}, false },
+#define VK_LIB_PHYSDEVICE_FUNCTION_EXT( v, n, x )\
+	ashes::ProcEntry{ "vk"#x, ashes::ProcScope::ePhysicalDevice, v, n, false },
+#define VK_LIB_DEVICE_FUNCTION( v, x )\
+	ashes::ProcEntry{ "vk"#x, ashes::ProcScope::eDevice, v, {}, false },
+#define VK_LIB_DEVICE_FUNCTION_EXT( v, n, x )\
+	ashes::ProcEntry{ "vk"#x, ashes::ProcScope::eDevice, v, n, false },
+#define VK_STATIC_LIB_DEVICE_FUNCTION_EXT( v, n, x )\
+	ashes::ProcEntry{ "vk"#x, ashes::ProcScope::eDevice, v, n, true },
+#include <ashes/ashes_functions_list.hpp>
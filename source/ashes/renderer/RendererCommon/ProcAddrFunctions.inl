@@ -0,0 +1,30 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+/*
+*	Expands ashes_functions_list.hpp to the function pointers matching ProcAddrEntries.inl,
+*	resolving vk##x in the including scope.
+*/
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wcast-function-type-strict"
+#define VK_LIB_GLOBAL_FUNCTION( v, x )\
+	PFN_vkVoidFunction( vk##x ),
+#define VK_LIB_GLOBAL_FUNCTION_EXT( v, n, x )\
+	PFN_vkVoidFunction( vk##x ),
+#define VK_LIB_INSTANCE_FUNCTION( v, x )\
+	PFN_vkVoidFunction( vk##x ),
+#define VK_LIB_INSTANCE_FUNCTION_EXT( v, n, x )\
+	PFN_vkVoidFunction( vk##x ),
+#define VK_LIB_PHYSDEVICE_FUNCTION( v, x )\
+	PFN_vkVoidFunction( vk##x ),
+#define VK_LIB_PHYSDEVICE_FUNCTION_EXT( v, n, x )\
+	PFN_vkVoidFunction( vk##x ),
+#define VK_LIB_DEVICE_FUNCTION( v, x )\
+	PFN_vkVoidFunction( vk##x ),
+#define VK_LIB_DEVICE_FUNCTION_EXT( v, n, x )\
+	PFN_vkVoidFunction( vk##x ),
+#define VK_STATIC_LIB_DEVICE_FUNCTION_EXT( v, n, x )\
+	PFN_vkVoidFunction( vk##x ),
+#include <ashes/ashes_functions_list.hpp>
+#pragma clang diagnostic pop
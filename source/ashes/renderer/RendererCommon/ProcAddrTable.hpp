@@ -0,0 +1,389 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#pragma once
+
+#ifndef VK_NO_PROTOTYPES
+#	define VK_NO_PROTOTYPES
+#endif
+
+#include <ashes/ashes.hpp>
+
+#pragma warning( push )
+#pragma warning( disable: 4365 )
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bitset>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+#pragma warning( pop )
+
+namespace ashes
+{
+	/**
+	*\brief
+	*	The dispatchable object a function is retrieved from.
+	*/
+	enum class ProcScope : uint8_t
+	{
+		eGlobal,
+		eInstance,
+		ePhysicalDevice,
+		eDevice,
+	};
+	/**
+	*\brief
+	*	A function from ashes_functions_list.hpp.
+	*/
+	struct ProcEntry
+	{
+		std::string_view name;
+		ProcScope scope;
+		uint32_t version;
+		//! The extension the function belongs to, empty for core and mandatory extension functions.
+		std::string_view extension;
+		//! \p true for the device functions the instance exposes without checking their extension.
+		bool isStatic;
+	};
+	/**
+	*\brief
+	*	FNV-1a hash of a function name.
+	*/
+	constexpr uint32_t hashProcName( std::string_view name )noexcept
+	{
+		uint32_t result = 2166136261u;
+		auto data = name.data();
+
+		for ( size_t i = 0u; i < name.size(); ++i )
+		{
+			result ^= uint32_t( uint8_t( data[i] ) );
+			result *= 16777619u;
+		}
+
+		return result;
+	}
+	/**
+	*\brief
+	*	Remixes a function name hash with a bucket seed.
+	*/
+	constexpr uint32_t mixProcHash( uint32_t hash
+		, uint32_t seed )noexcept
+	{
+		hash ^= seed * 0x9E3779B9u;
+		hash ^= hash >> 16u;
+		hash *= 0x85EBCA6Bu;
+		hash ^= hash >> 13u;
+		hash *= 0xC2B2AE35u;
+		hash ^= hash >> 16u;
+		return hash;
+	}
+
+	constexpr size_t getProcTableSize( size_t count )noexcept
+	{
+		size_t result = 1u;
+
+		while ( result < count )
+		{
+			result <<= 1u;
+		}
+
+		return result;
+	}
+	/**
+	*\brief
+	*	A perfect hash table from a function name to its index in the functions list, built at compile time.
+	*\remarks
+	*	The names are spread in buckets, then each bucket gets the seed that remixes its names to free slots,
+	*	the biggest buckets first.
+	*	A lookup is a single hash of the name, and a single string comparison.
+	*	When a name is listed twice, its first index is kept.
+	*/
+	template< size_t CountT >
+	class ProcAddrTable
+	{
+		static_assert( CountT < 0xFFFFu );
+
+	public:
+		static size_t constexpr BucketCount = getProcTableSize( ( CountT + 1u ) / 2u );
+		static size_t constexpr SlotCount = getProcTableSize( CountT * 2u );
+		static size_t constexpr npos = CountT;
+		static size_t constexpr MaxBucketSize = 16u;
+
+	public:
+		explicit constexpr ProcAddrTable( std::array< ProcEntry, CountT > const & entries )
+			: m_entries{ entries }
+		{
+			uint32_t hashes[CountT]{};
+			uint16_t counts[BucketCount]{};
+
+			for ( size_t i = 0u; i < CountT; ++i )
+			{
+				hashes[i] = hashProcName( m_entries[i].name );
+				++counts[hashes[i] & ( BucketCount - 1u )];
+			}
+
+			// Group the names by bucket, keeping their order.
+			uint16_t offsets[BucketCount + 1u]{};
+			uint16_t next[BucketCount]{};
+			uint16_t sorted[CountT]{};
+
+			for ( size_t bucket = 0u; bucket < BucketCount; ++bucket )
+			{
+				offsets[bucket + 1u] = uint16_t( offsets[bucket] + counts[bucket] );
+				next[bucket] = offsets[bucket];
+			}
+
+			for ( size_t i = 0u; i < CountT; ++i )
+			{
+				sorted[next[hashes[i] & ( BucketCount - 1u )]++] = uint16_t( i );
+			}
+
+			// Sort the buckets by decreasing size.
+			uint16_t starts[MaxBucketSize + 2u]{};
+			uint16_t order[BucketCount]{};
+
+			for ( size_t bucket = 0u; bucket < BucketCount; ++bucket )
+			{
+				if ( counts[bucket] > MaxBucketSize )
+				{
+					throw std::logic_error{ "ProcAddrTable: too many names in a bucket." };
+				}
+
+				++starts[MaxBucketSize - counts[bucket] + 1u];
+			}
+
+			for ( size_t key = 0u; key <= MaxBucketSize; ++key )
+			{
+				starts[key + 1u] = uint16_t( starts[key + 1u] + starts[key] );
+			}
+
+			for ( size_t bucket = 0u; bucket < BucketCount; ++bucket )
+			{
+				order[starts[MaxBucketSize - counts[bucket]]++] = uint16_t( bucket );
+			}
+
+			for ( auto & slot : m_slots )
+			{
+				slot = uint16_t( npos );
+			}
+
+			for ( auto bucket : order )
+			{
+				if ( !counts[bucket] )
+				{
+					break;
+				}
+
+				doPlaceBucket( bucket
+					, hashes
+					, sorted + offsets[bucket]
+					, counts[bucket] );
+			}
+		}
+		/**
+		*\return
+		*	The index of the function named \p name, npos if it isn't listed.
+		*/
+		constexpr size_t find( std::string_view name )const noexcept
+		{
+			auto hash = hashProcName( name );
+			auto seed = m_seeds[hash & ( BucketCount - 1u )];
+			size_t index = m_slots[mixProcHash( hash, seed ) & ( SlotCount - 1u )];
+			return ( index != npos && m_entries[index].name == name )
+				? index
+				: npos;
+		}
+
+		constexpr ProcEntry const & operator[]( size_t index )const noexcept
+		{
+			return m_entries[index];
+		}
+
+		static constexpr size_t size()noexcept
+		{
+			return CountT;
+		}
+
+	private:
+		constexpr void doPlaceBucket( size_t bucket
+			, uint32_t const * hashes
+			, uint16_t const * indices
+			, size_t size )
+		{
+			size_t slots[MaxBucketSize]{};
+
+			for ( uint32_t seed = 0u; seed < 0xFFFFu; ++seed )
+			{
+				size_t placed = 0u;
+				bool found = true;
+
+				for ( size_t i = 0u; i < size && found; ++i )
+				{
+					auto index = indices[i];
+					bool duplicate = false;
+
+					for ( size_t j = 0u; j < i && !duplicate; ++j )
+					{
+						duplicate = m_entries[indices[j]].name == m_entries[index].name;
+					}
+
+					if ( duplicate )
+					{
+						continue;
+					}
+
+					auto slot = mixProcHash( hashes[index], seed ) & ( SlotCount - 1u );
+					found = m_slots[slot] == npos;
+
+					for ( size_t j = 0u; j < placed && found; ++j )
+					{
+						found = slots[j] != slot;
+					}
+
+					slots[placed++] = slot;
+				}
+
+				if ( found )
+				{
+					for ( size_t i = 0u; i < size; ++i )
+					{
+						auto index = indices[i];
+						auto slot = mixProcHash( hashes[index], seed ) & ( SlotCount - 1u );
+
+						if ( m_slots[slot] == npos )
+						{
+							m_slots[slot] = index;
+						}
+					}
+
+					m_seeds[bucket] = uint16_t( seed );
+					return;
+				}
+			}
+
+			throw std::logic_error{ "ProcAddrTable: no seed found for a bucket." };
+		}
+
+	private:
+		std::array< ProcEntry, CountT > m_entries;
+		std::array< uint16_t, BucketCount > m_seeds{};
+		std::array< uint16_t, SlotCount > m_slots{};
+	};
+
+	template< size_t CountT >
+	using ProcMask = std::bitset< CountT >;
+	/**
+	*\brief
+	*	The functions enabled for each instance, physical device, or device handle.
+	*\remarks
+	*	A handle's mask is filled once, under the registry lock, then only read.
+	*	The lookups don't lock: they search the list of filled masks published, through an atomic pointer,
+	*	after each fill. The previous lists are kept, since a lookup may still be reading them.
+	*/
+	template< typename HandleT, size_t CountT >
+	class ProcMaskRegistry
+	{
+		struct Entry
+		{
+			HandleT handle;
+			ProcMask< CountT > const * mask;
+		};
+		using Entries = std::vector< Entry >;
+
+	public:
+		/**
+		*\return
+		*	The mask for \p handle, filled by \p fill on first request.
+		*/
+		template< typename FillFuncT >
+		ProcMask< CountT > const & get( HandleT handle
+			, FillFuncT fill )
+		{
+			if ( auto mask = doFind( m_published.load( std::memory_order_acquire ), handle ) )
+			{
+				return *mask;
+			}
+
+			std::lock_guard< std::mutex > lock{ m_mutex };
+			auto published = m_published.load( std::memory_order_relaxed );
+
+			if ( auto mask = doFind( published, handle ) )
+			{
+				return *mask;
+			}
+
+			ProcMask< CountT > filled;
+			fill( filled );
+			auto & mask = m_masks.emplace_back( filled );
+			auto entries = published
+				? std::make_unique< Entries >( *published )
+				: std::make_unique< Entries >();
+			entries->push_back( { handle, &mask } );
+			m_published.store( entries.get(), std::memory_order_release );
+			m_entries.push_back( std::move( entries ) );
+			return mask;
+		}
+
+	private:
+		static ProcMask< CountT > const * doFind( Entries const * entries
+			, HandleT handle )noexcept
+		{
+			if ( !entries )
+			{
+				return nullptr;
+			}
+
+			auto it = std::find_if( entries->begin()
+				, entries->end()
+				, [handle]( Entry const & lookup )
+				{
+					return lookup.handle == handle;
+				} );
+			return it == entries->end()
+				? nullptr
+				: it->mask;
+		}
+
+	private:
+		std::mutex m_mutex;
+		std::atomic< Entries const * > m_published{};
+		//! The filled masks, a deque keeps their addresses.
+		std::deque< ProcMask< CountT > > m_masks;
+		std::vector< std::unique_ptr< Entries > > m_entries;
+	};
+	/**
+	*\brief
+	*	Fills \p mask with the functions of \p table that pass \p check.
+	*/
+	template< size_t CountT, typename CheckFuncT >
+	void fillProcMask( ProcAddrTable< CountT > const & table
+		, ProcMask< CountT > & mask
+		, CheckFuncT check )
+	{
+		for ( size_t i = 0u; i < CountT; ++i )
+		{
+			mask.set( i, check( table[i] ) );
+		}
+	}
+	/**
+	*\return
+	*	The function named \p name, if it's listed in \p table and enabled in \p mask, \p nullptr otherwise.
+	*/
+	template< size_t CountT >
+	PFN_vkVoidFunction findProcAddr( ProcAddrTable< CountT > const & table
+		, std::array< PFN_vkVoidFunction, CountT > const & functions
+		, ProcMask< CountT > const & mask
+		, std::string_view name )noexcept
+	{
+		auto index = table.find( name );
+		return ( index != table.npos && mask.test( index ) )
+			? functions[index]
+			: nullptr;
+	}
+}
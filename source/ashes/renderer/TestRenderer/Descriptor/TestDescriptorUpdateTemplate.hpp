@@ -0,0 +1,31 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#ifndef ___TestRenderer_DescriptorUpdateTemplate_HPP___
+#define ___TestRenderer_DescriptorUpdateTemplate_HPP___
+#pragma once
+
+#include "renderer/TestRenderer/TestRendererPrerequisites.hpp"
+
+#include <renderer/RendererCommon/DescriptorUpdateTemplate.hpp>
+
+namespace ashes::test
+{
+	class DescriptorUpdateTemplate
+		: public NonCopyable
+	{
+	public:
+		DescriptorUpdateTemplate( VkDevice device
+			, VkDescriptorUpdateTemplateCreateInfo const & createInfo );
+
+		void update( VkDescriptorSet descriptorSet
+			, void const * pData )const;
+
+	private:
+		VkDevice m_device;
+		DescriptorUpdateProgram m_program;
+	};
+}
+
+#endif
@@ -9,6 +9,8 @@
 
 #include "ashestest_api.hpp"
 
+#include <renderer/RendererCommon/ProcAddrTable.hpp>
+
 #include <ashes/common/Exception.hpp>
 
 #include <cstring>
@@ -1893,7 +1895,11 @@ namespace ashes::test
 		const VkAllocationCallbacks* pAllocator,
 		VkDescriptorUpdateTemplate* pDescriptorUpdateTemplate )
 	{
-		return reportUnsupported( device, "vkCreateDescriptorUpdateTemplate" );
+		assert( pDescriptorUpdateTemplate );
+		return allocate( *pDescriptorUpdateTemplate
+			, pAllocator
+			, device
+			, *pCreateInfo );
 	}
 
 	void VKAPI_CALL vkDestroyDescriptorUpdateTemplate(
@@ -1901,7 +1907,7 @@ namespace ashes::test
 		VkDescriptorUpdateTemplate descriptorUpdateTemplate,
 		const VkAllocationCallbacks* pAllocator )
 	{
-		reportUnsupported( device, "vkDestroyDescriptorUpdateTemplate" );
+		deallocate( descriptorUpdateTemplate, pAllocator );
 	}
 
 	void VKAPI_CALL vkUpdateDescriptorSetWithTemplate(
@@ -1910,7 +1916,7 @@ namespace ashes::test
 		VkDescriptorUpdateTemplate descriptorUpdateTemplate,
 		const void* pData )
 	{
-		reportUnsupported( device, "vkUpdateDescriptorSetWithTemplate" );
+		get( descriptorUpdateTemplate )->update( descriptorSet, pData );
 	}
 
 	void VKAPI_CALL vkGetPhysicalDeviceExternalBufferProperties(
@@ -2660,7 +2666,11 @@ namespace ashes::test
 		const VkAllocationCallbacks* pAllocator,
 		VkDescriptorUpdateTemplate* pDescriptorUpdateTemplate )
 	{
-		return reportUnsupported( device, "vkCreateDescriptorUpdateTemplateKHR" );
+		assert( pDescriptorUpdateTemplate );
+		return allocate( *pDescriptorUpdateTemplate
+			, pAllocator
+			, device
+			, *pCreateInfo );
 	}
 
 	void VKAPI_CALL vkDestroyDescriptorUpdateTemplateKHR(
@@ -2668,7 +2678,7 @@ namespace ashes::test
 		VkDescriptorUpdateTemplate descriptorUpdateTemplate,
 		const VkAllocationCallbacks* pAllocator )
 	{
-		reportUnsupported( device, "vkDestroyDescriptorUpdateTemplateKHR" );
+		deallocate( descriptorUpdateTemplate, pAllocator );
 	}
 
 	void VKAPI_CALL vkUpdateDescriptorSetWithTemplateKHR(
@@ -2677,7 +2687,7 @@ namespace ashes::test
 		VkDescriptorUpdateTemplate descriptorUpdateTemplate,
 		const void* pData )
 	{
-		reportUnsupported( device, "vkUpdateDescriptorSetWithTemplateKHR" );
+		get( descriptorUpdateTemplate )->update( descriptorSet, pData );
 	}
 
 #endif
@@ -4554,78 +4564,73 @@ namespace ashes::test
 			&& get( device )->hasExtension( extension );
 	}
 
-	PFN_vkVoidFunction VKAPI_CALL vkGetInstanceProcAddr(
-		VkInstance instance,
-		const char* pName )
+	namespace
 	{
-		PFN_vkVoidFunction result{ nullptr };
-		static std::map< std::string, PFN_vkVoidFunction, std::less<> > functions
+		ProcAddrTable constexpr procAddrTable
 		{
-#define VK_LIB_GLOBAL_FUNCTION( v, x )\
-			{ "vk"#x, PFN_vkVoidFunction( vk##x ) },
-#define VK_LIB_INSTANCE_FUNCTION( v, x )\
-			{ "vk"#x, PFN_vkVoidFunction( vk##x ) },
-#define VK_LIB_PHYSDEVICE_FUNCTION( v, x )\
-			{ "vk"#x, PFN_vkVoidFunction( vk##x ) },
-#define VK_LIB_DEVICE_FUNCTION( v, x )\
-			{ "vk"#x, PFN_vkVoidFunction( vk##x ) },
-#include <ashes/ashes_functions_list.hpp>
+			std::array
+			{
+#include <renderer/RendererCommon/ProcAddrEntries.inl>
+			}
+		};
+		using ProcAddrMask = ProcMask< procAddrTable.size() >;
+
+		std::array< PFN_vkVoidFunction, procAddrTable.size() > const procAddrFunctions
+		{
+#include <renderer/RendererCommon/ProcAddrFunctions.inl>
 		};
 
-		if ( auto it = functions.find( pName );
-			it != functions.end() )
+		template< typename CheckFuncT >
+		ProcAddrMask makeMask( CheckFuncT check )
 		{
-			result = it->second;
+			ProcAddrMask result;
+			fillProcMask( procAddrTable, result, check );
+			return result;
 		}
+	}
 
-		return result;
+	PFN_vkVoidFunction VKAPI_CALL vkGetInstanceProcAddr(
+		VkInstance instance,
+		const char* pName )
+	{
+		static ProcAddrMask const mask = makeMask( []( ProcEntry const & )
+			{
+				return true;
+			} );
+		return findProcAddr( procAddrTable
+			, procAddrFunctions
+			, mask
+			, pName );
 	}
 
 	PFN_vkVoidFunction VKAPI_CALL vkGetPhysicalDeviceProcAddr(
 		VkInstance instance,
 		const char* pName )
 	{
-		PFN_vkVoidFunction result{ nullptr };
-		static std::map< std::string, PFN_vkVoidFunction, std::less<> > functions
-		{
-			{ "vkGetDeviceProcAddr", PFN_vkVoidFunction( vkGetDeviceProcAddr ) },
-#define VK_LIB_PHYSDEVICE_FUNCTION( v, x )\
-			{ "vk"#x, PFN_vkVoidFunction( vk##x ) },
-#include <ashes/ashes_functions_list.hpp>
-		};
-
-		if ( auto it = functions.find( pName );
-			it != functions.end() )
-		{
-			result = it->second;
-		}
-
-		return result;
+		static ProcAddrMask const mask = makeMask( []( ProcEntry const & entry )
+			{
+				return entry.scope == ProcScope::ePhysicalDevice
+					|| entry.name == "vkGetDeviceProcAddr";
+			} );
+		return findProcAddr( procAddrTable
+			, procAddrFunctions
+			, mask
+			, pName );
 	}
 
 	PFN_vkVoidFunction VKAPI_CALL vkGetDeviceProcAddr(
 		VkDevice device,
 		const char* pName )
 	{
-		PFN_vkVoidFunction result{ nullptr };
-		static std::map< std::string, PFN_vkVoidFunction, std::less<> > functions
-		{
-#pragma clang diagnostic push
-#pragma clang diagnostic ignored "-Wcast-function-type-strict"
-			{ "vkGetDeviceProcAddr", PFN_vkVoidFunction( vkGetDeviceProcAddr ) },
-#pragma clang diagnostic pop
-#define VK_LIB_DEVICE_FUNCTION( v, x )\
-			{ "vk"#x, PFN_vkVoidFunction( vk##x ) },
-#include <ashes/ashes_functions_list.hpp>
-		};
-
-		if ( auto it = functions.find( pName );
-			it != functions.end() )
-		{
-			result = it->second;
-		}
-
-		return result;
+		static ProcAddrMask const mask = makeMask( []( ProcEntry const & entry )
+			{
+				return entry.scope == ProcScope::eDevice
+					|| entry.name == "vkGetDeviceProcAddr";
+			} );
+		return findProcAddr( procAddrTable
+			, procAddrFunctions
+			, mask
+			, pName );
 	}
 
 #pragma warning( pop )
@@ -18,6 +18,7 @@ See LICENSE file in root folder.
 #include "Descriptor/TestDescriptorPool.hpp"
 #include "Descriptor/TestDescriptorSet.hpp"
 #include "Descriptor/TestDescriptorSetLayout.hpp"
+#include "Descriptor/TestDescriptorUpdateTemplate.hpp"
 #include "Miscellaneous/TestDeviceMemory.hpp"
 #include "Miscellaneous/TestQueryPool.hpp"
 #include "Image/TestImage.hpp"
@@ -11,6 +11,7 @@ See LICENSE file in root folder.
 #include "ashespp/Core/SwapChain.hpp"
 #include "ashespp/Descriptor/DescriptorPool.hpp"
 #include "ashespp/Descriptor/DescriptorSetLayout.hpp"
+#include "ashespp/Descriptor/DescriptorUpdateTemplate.hpp"
 #include "ashespp/Image/Image.hpp"
 #include "ashespp/Image/Sampler.hpp"
 #include "ashespp/Image/StagingTexture.hpp"
@@ -252,6 +253,24 @@ namespace ashes
 			, flags );
 	}
 
+	DescriptorUpdateTemplatePtr Device::createDescriptorUpdateTemplate( std::string const & debugName
+		, VkDescriptorUpdateTemplateCreateInfo const & createInfo )const
+	{
+		return std::make_unique< DescriptorUpdateTemplate >( *this
+			, debugName
+			, createInfo );
+	}
+
+	DescriptorUpdateTemplatePtr Device::createDescriptorUpdateTemplate( std::string const & debugName
+		, VkDescriptorUpdateTemplateEntryArray entries
+		, DescriptorSetLayout const & layout )const
+	{
+		return std::make_unique< DescriptorUpdateTemplate >( *this
+			, debugName
+			, std::move( entries )
+			, layout );
+	}
+
 	DescriptorPoolPtr Device::createDescriptorPool( VkDescriptorPoolCreateFlags flags
 		, uint32_t maxSets
 		, VkDescriptorPoolSizeArray poolSizes )const
@@ -843,90 +862,91 @@ namespace ashes
 		, std::string const & objectName
 		, std::string const & typeName )const
 	{
-		std::stringstream stream;
-		stream.imbue( std::locale{ "C" } );
-		stream << "Created [0x" << std::hex << std::setw( 8u ) << std::setfill( '0' ) << object << "]"
-			<< " - " << typeName
-			<< " - " << objectName;
-		std::stringstream callStack;
-
-		if ( m_callstackCallback )
+#	if VK_EXT_debug_utils
+		if ( m_instance.checkExtension( VK_EXT_DEBUG_UTILS_EXTENSION_NAME ) )
 		{
-			callStack << m_callstackCallback();
+			setDebugUtilsObjectName(
+				{
+					VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT,
+					nullptr,
+					VkObjectType( objectType ),
+					object,
+					objectName.c_str(),
+				} );
 		}
-
-		{
-			lock_type lock{ m_allocationMutex };
-#	if VK_EXT_debug_utils
-			if ( m_instance.checkExtension( VK_EXT_DEBUG_UTILS_EXTENSION_NAME ) )
-			{
-				setDebugUtilsObjectName(
-					{
-						VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT,
-						nullptr,
-						VkObjectType( objectType ),
-						object,
-						objectName.c_str(),
-					} );
-			}
 #	endif
 #	if VK_EXT_debug_marker
-			if ( m_instance.checkExtension( VK_EXT_DEBUG_MARKER_EXTENSION_NAME ) )
-			{
-				debugMarkerSetObjectName(
-					{
-						VK_STRUCTURE_TYPE_DEBUG_MARKER_OBJECT_NAME_INFO_EXT,
-						nullptr,
-						VkDebugReportObjectTypeEXT( objectType ),
-						object,
-						objectName.c_str(),
-					} );
-			}
+		if ( m_instance.checkExtension( VK_EXT_DEBUG_MARKER_EXTENSION_NAME ) )
+		{
+			debugMarkerSetObjectName(
+				{
+					VK_STRUCTURE_TYPE_DEBUG_MARKER_OBJECT_NAME_INFO_EXT,
+					nullptr,
+					VkDebugReportObjectTypeEXT( objectType ),
+					object,
+					objectName.c_str(),
+				} );
+		}
 #	endif
 
-			if ( !m_allocated.try_emplace( object
-				, typeName, objectName, callStack.str() ).second )
+		auto inserted = m_allocated.insert( object
+			, { objectType
+				, &typeName
+				, objectName
+				, ( m_callstackCallback ? m_callstackCallback() : std::string{} ) } );
+
+		if ( Logger::isTraceEnabled() )
+		{
+			std::stringstream stream;
+			stream.imbue( std::locale{ "C" } );
+			stream << "Created [0x" << std::hex << std::setw( 8u ) << std::setfill( '0' ) << object << "]"
+				<< " - " << typeName
+				<< " - " << objectName;
+
+			if ( !inserted )
 			{
 				stream << " - Already found in allocated objects ?";
 			}
-		}
 
-		Logger::logTrace( stream );
+			Logger::logTrace( stream );
+		}
 	}
 
 	void Device::doUnregisterObject( uint64_t object )const
 	{
-		lock_type lock{ m_allocationMutex };
-		auto it = m_allocated.find( size_t( object ) );
-		std::stringstream stream;
-		stream.imbue( std::locale{ "C" } );
-		stream << "Destroyed [0x" << std::hex << std::setw( 8u ) << std::setfill( '0' ) << object << "]";
+		ObjectAllocation alloc;
+		auto found = m_allocated.erase( object, &alloc );
 
-		if ( it != m_allocated.end() )
+		if ( Logger::isTraceEnabled() )
 		{
-			stream << " - " << it->second.type
-				<< " - " << it->second.name;
-			m_allocated.erase( it );
-		}
-		else
-		{
-			stream << " - Not found in allocated objects ?";
-		}
+			std::stringstream stream;
+			stream.imbue( std::locale{ "C" } );
+			stream << "Destroyed [0x" << std::hex << std::setw( 8u ) << std::setfill( '0' ) << object << "]";
 
-		Logger::logTrace( stream );
+			if ( found )
+			{
+				stream << " - " << *alloc.type
+					<< " - " << alloc.name;
+			}
+			else
+			{
+				stream << " - Not found in allocated objects ?";
+			}
+
+			Logger::logTrace( stream );
+		}
 	}
 
 	void Device::doReportRegisteredObjects()const
 	{
-		lock_type lock{ m_allocationMutex };
-
-		for ( auto const & [size, alloc] : m_allocated )
-		{
-			std::stringstream stream;
-			stream << "Leaked [" << alloc.type << "](" << alloc.name << "), allocation stack:\n";
-			stream << alloc.callstack;
-			log::error << stream.str() << "\n";
-		}
+		m_allocated.forEach( []( uint64_t
+			, ObjectAllocation const & alloc )
+			{
+				std::stringstream stream;
+				stream << "Leaked [" << *alloc.type << "](" << alloc.name << "), allocation stack:\n";
+				stream << alloc.callstack;
+				log::error << stream.str() << "\n";
+			} );
 	}
 
 #endif
@@ -0,0 +1,61 @@
+/*
+This file belongs to Ashes.
+See LICENSE file in root folder.
+*/
+#include "ashespp/Descriptor/DescriptorUpdateTemplate.hpp"
+
+#include "ashespp/Core/Device.hpp"
+#include "ashespp/Descriptor/DescriptorSetLayout.hpp"
+
+namespace ashes
+{
+	DescriptorUpdateTemplate::DescriptorUpdateTemplate( Device const & device
+		, std::string const & debugName
+		, VkDescriptorUpdateTemplateEntryArray entries
+		, DescriptorSetLayout const & layout )
+		: DescriptorUpdateTemplate{ device
+			, debugName
+			, VkDescriptorUpdateTemplateCreateInfo{ VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO
+				, nullptr
+				, 0u
+				, static_cast< uint32_t >( entries.size() )
+				, entries.data()
+				, VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET
+				, layout
+				, VK_PIPELINE_BIND_POINT_GRAPHICS
+				, VK_NULL_HANDLE
+				, 0u } }
+	{
+	}
+
+	DescriptorUpdateTemplate::DescriptorUpdateTemplate( Device const & device
+		, std::string const & debugName
+		, VkDescriptorUpdateTemplateCreateInfo const & createInfo )
+		: VkObject{ debugName }
+		, m_device{ device }
+	{
+		auto res = m_device.vkCreateDescriptorUpdateTemplate( m_device
+			, &createInfo
+			, m_device.getAllocationCallbacks()
+			, &m_internal );
+		checkError( res, "DescriptorUpdateTemplate creation" );
+		registerObject( m_device, debugName, *this );
+	}
+
+	DescriptorUpdateTemplate::~DescriptorUpdateTemplate()noexcept
+	{
+		unregisterObject( m_device, *this );
+		m_device.vkDestroyDescriptorUpdateTemplate( m_device
+			, m_internal
+			, m_device.getAllocationCallbacks() );
+	}
+
+	void DescriptorUpdateTemplate::update( VkDescriptorSet descriptorSet
+		, void const * data )const noexcept
+	{
+		m_device.vkUpdateDescriptorSetWithTemplate( m_device
+			, descriptorSet
+			, m_internal
+			, data );
+	}
+}
@@ -100,7 +100,14 @@ namespace ashes
 
 	void Logger::setTraceCallback( LogCallback callback )
 	{
-		doGetInstance().m_trace = std::move( callback );
+		auto & instance = doGetInstance();
+		instance.m_traceEnabled = bool( callback );
+		instance.m_trace = std::move( callback );
+	}
+
+	bool Logger::isTraceEnabled()
+	{
+		return doGetInstance().m_traceEnabled;
 	}
 
 	void Logger::setDebugCallback( LogCallback callback )
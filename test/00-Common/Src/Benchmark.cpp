@@ -0,0 +1,41 @@
+#include "Benchmark.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+namespace common
+{
+	double benchmark( std::string const & name
+		, uint32_t count
+		, std::function< void( uint32_t ) > const & function )
+	{
+		using Clock = std::chrono::high_resolution_clock;
+		function( 0u );
+		auto begin = Clock::now();
+
+		for ( uint32_t i = 0u; i < count; ++i )
+		{
+			function( i );
+		}
+
+		auto total = std::chrono::duration_cast< std::chrono::nanoseconds >( Clock::now() - begin );
+		auto result = count
+			? double( total.count() ) / count
+			: 0.0;
+		std::stringstream stream;
+		stream.imbue( std::locale{ "C" } );
+		stream << std::fixed << std::setprecision( 3 )
+			<< ( double( total.count() ) / 1000000.0 ) << " ms total, "
+			<< result << " ns per iteration (" << count << " iterations)";
+		printMeasure( name, stream.str() );
+		return result;
+	}
+
+	void printMeasure( std::string const & name
+		, std::string const & value )
+	{
+		std::cout << "[Benchmark] " << name << ": " << value << std::endl;
+	}
+}
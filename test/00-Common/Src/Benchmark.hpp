@@ -0,0 +1,53 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___Common_Benchmark_H___
+#define ___Common_Benchmark_H___
+
+#include "Prerequisites.hpp"
+
+#include <functional>
+#include <string>
+
+namespace common
+{
+	/**
+	*\~english
+	*\brief
+	*	Runs \p function \p count times, after a warm up run, and prints the total and per iteration durations.
+	*\param[in] name
+	*	The measure name.
+	*\param[in] count
+	*	The iterations count.
+	*\param[in] function
+	*	The measured function, called with the iteration index.
+	*\return
+	*	The mean duration of an iteration, in nanoseconds.
+	*\~french
+	*\brief
+	*	Exécute \p function \p count fois, après une exécution de chauffe, et affiche les durées totale et par itération.
+	*\param[in] name
+	*	Le nom de la mesure.
+	*\param[in] count
+	*	Le nombre d'itérations.
+	*\param[in] function
+	*	La fonction mesurée, appelée avec l'indice de l'itération.
+	*\return
+	*	La durée moyenne d'une itération, en nanosecondes.
+	*/
+	double benchmark( std::string const & name
+		, uint32_t count
+		, std::function< void( uint32_t ) > const & function );
+	/**
+	*\~english
+	*\brief
+	*	Prints a measure result.
+	*\~french
+	*\brief
+	*	Affiche le résultat d'une mesure.
+	*/
+	void printMeasure( std::string const & name
+		, std::string const & value );
+}
+
+#endif
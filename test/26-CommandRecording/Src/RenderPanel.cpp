@@ -0,0 +1,164 @@
+#include "RenderPanel.hpp"
+
+#include "Application.hpp"
+#include "MainFrame.hpp"
+
+#include <ashespp/Command/CommandBuffer.hpp>
+#include <ashespp/Core/Surface.hpp>
+
+#include <ashes/common/Exception.hpp>
+
+#include <Benchmark.hpp>
+#include <FileUtils.hpp>
+
+#include <array>
+#include <iomanip>
+#include <sstream>
+
+namespace vkapp
+{
+	namespace
+	{
+		std::array< uint32_t, 3u > const DispatchCounts{ 1000u, 10000u, 50000u };
+		uint32_t const Iterations = 20u;
+	}
+
+	RenderPanel::RenderPanel( wxWindow * parent
+		, wxSize const & size
+		, utils::Instance const & instance )
+		: wxPanel{ parent, wxID_ANY, wxDefaultPosition, size }
+	{
+		try
+		{
+			auto surface = doCreateSurface( instance );
+			std::cout << "Surface created." << std::endl;
+			doCreateDevice( instance, *surface );
+			std::cout << "Logical device created." << std::endl;
+			doCreatePipeline();
+			std::cout << "Compute pipeline created." << std::endl;
+			doBenchmark();
+		}
+		catch ( common::Exception & )
+		{
+			doCleanup();
+			throw;
+		}
+	}
+
+	RenderPanel::~RenderPanel()noexcept
+	{
+		doCleanup();
+	}
+
+	void RenderPanel::doCleanup()noexcept
+	{
+		if ( m_device )
+		{
+			m_device->getDevice().waitIdle();
+			m_pipeline.reset();
+			m_pipelineLayout.reset();
+			m_commandPool.reset();
+			m_queue.reset();
+			m_device.reset();
+		}
+	}
+
+	ashes::SurfacePtr RenderPanel::doCreateSurface( utils::Instance const & instance )
+	{
+		auto handle = common::makeWindowHandle( *this );
+		auto const & gpu = instance.getPhysicalDevice( 0u );
+		return instance.getInstance().createSurface( gpu
+			, std::move( handle ) );
+	}
+
+	void RenderPanel::doCreateDevice( utils::Instance const & instance
+		, ashes::Surface const & surface )
+	{
+		m_device = std::make_unique< utils::Device >( instance.getInstance()
+			, surface );
+		m_queue = m_device->getDevice().getQueue( m_device->getComputeQueueFamily(), 0u );
+		m_commandPool = m_device->getDevice().createCommandPool( m_device->getComputeQueueFamily()
+			, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT );
+	}
+
+	void RenderPanel::doCreatePipeline()
+	{
+		m_pipelineLayout = m_device->getDevice().createPipelineLayout( VkPushConstantRange{ VK_SHADER_STAGE_COMPUTE_BIT
+			, 0u
+			, uint32_t( sizeof( uint32_t ) ) } );
+		std::string shadersFolder = ashes::getPath( ashes::getExecutableDirectory() ) / "share" / AppName / "Shaders";
+
+		if ( !wxFileExists( shadersFolder / "shader.comp" ) )
+		{
+			throw common::Exception{ "Shader files are missing" };
+		}
+
+		ashes::PipelineShaderStageCreateInfo shaderStage
+		{
+			0u,
+			VK_SHADER_STAGE_COMPUTE_BIT,
+			m_device->getDevice().createShaderModule( common::parseShaderFile( m_device->getDevice()
+				, VK_SHADER_STAGE_COMPUTE_BIT
+				, shadersFolder / "shader.comp" ) ),
+			"main",
+			ashes::nullopt,
+		};
+		m_pipeline = m_device->getDevice().createPipeline( ashes::ComputePipelineCreateInfo
+			{
+				0u,
+				std::move( shaderStage ),
+				*m_pipelineLayout,
+			} );
+	}
+
+	void RenderPanel::doRecord( ashes::CommandBuffer const & commandBuffer
+		, uint32_t count )const
+	{
+		commandBuffer.reset();
+		commandBuffer.begin();
+		commandBuffer.bindPipeline( *m_pipeline );
+
+		for ( uint32_t i = 0u; i < count; ++i )
+		{
+			commandBuffer.pushConstants( *m_pipelineLayout
+				, VK_SHADER_STAGE_COMPUTE_BIT
+				, 0u
+				, uint32_t( sizeof( i ) )
+				, &i );
+			commandBuffer.dispatch( 1u, 1u, 1u );
+		}
+
+		commandBuffer.end();
+	}
+
+	void RenderPanel::doBenchmark()
+	{
+		auto commandBuffer = m_commandPool->createCommandBuffer();
+		auto fence = m_device->getDevice().createFence();
+
+		for ( auto count : DispatchCounts )
+		{
+			// Recording reuses the command buffer's storage, from one reset to the next.
+			auto record = common::benchmark( "Record " + std::to_string( count ) + " dispatches"
+				, Iterations
+				, [this, &commandBuffer, count]( uint32_t )
+				{
+					doRecord( *commandBuffer, count );
+				} );
+			auto replay = common::benchmark( "Replay " + std::to_string( count ) + " dispatches"
+				, Iterations
+				, [this, &commandBuffer, &fence]( uint32_t )
+				{
+					m_queue->submit( *commandBuffer, fence.get() );
+					fence->wait( ashes::MaxTimeout );
+					fence->reset();
+				} );
+			std::stringstream stream;
+			stream.imbue( std::locale{ "C" } );
+			stream << std::fixed << std::setprecision( 3 )
+				<< "record " << ( record / count ) << " ns, replay " << ( replay / count ) << " ns";
+			common::printMeasure( "Per dispatch (" + std::to_string( count ) + ")"
+				, stream.str() );
+		}
+	}
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Prerequisites.hpp"
+
+#include <ashespp/Command/CommandPool.hpp>
+#include <ashespp/Core/Device.hpp>
+#include <ashespp/Pipeline/ComputePipeline.hpp>
+#include <ashespp/Pipeline/PipelineLayout.hpp>
+#include <ashespp/Sync/Fence.hpp>
+#include <ashespp/Sync/Queue.hpp>
+
+#include <wx/panel.h>
+
+namespace vkapp
+{
+	/**
+	*\brief
+	*	Measures the cost of recording dispatches in a command buffer, and of replaying them.
+	*/
+	class RenderPanel
+		: public wxPanel
+	{
+	public:
+		RenderPanel( wxWindow * parent
+			, wxSize const & size
+			, utils::Instance const & instance );
+		~RenderPanel()noexcept override;
+
+	private:
+		void doCleanup()noexcept;
+		ashes::SurfacePtr doCreateSurface( utils::Instance const & instance );
+		void doCreateDevice( utils::Instance const & instance
+			, ashes::Surface const & surface );
+		void doCreatePipeline();
+		void doRecord( ashes::CommandBuffer const & commandBuffer
+			, uint32_t count )const;
+		void doBenchmark();
+
+	private:
+		utils::DevicePtr m_device;
+		ashes::QueuePtr m_queue;
+		ashes::CommandPoolPtr m_commandPool;
+		ashes::PipelineLayoutPtr m_pipelineLayout;
+		ashes::ComputePipelinePtr m_pipeline;
+	};
+}
@@ -0,0 +1,134 @@
+#include "RenderPanel.hpp"
+
+#include "Application.hpp"
+#include "MainFrame.hpp"
+
+#include <ashespp/Core/Surface.hpp>
+
+#include <ashes/common/Exception.hpp>
+
+#include <Benchmark.hpp>
+
+#include <cstring>
+
+namespace vkapp
+{
+	namespace
+	{
+		VkDeviceSize const BufferSize = 16u * 1024u * 1024u;
+		uint32_t const Iterations = 50u;
+
+		struct Scenario
+		{
+			std::string name;
+			//! The distance between two written values.
+			VkDeviceSize step;
+			//! The bytes written at each step.
+			VkDeviceSize size;
+			//! Tells if the whole mapping is flushed before unmapping it.
+			bool flush;
+		};
+	}
+
+	RenderPanel::RenderPanel( wxWindow * parent
+		, wxSize const & size
+		, utils::Instance const & instance )
+		: wxPanel{ parent, wxID_ANY, wxDefaultPosition, size }
+	{
+		try
+		{
+			auto surface = doCreateSurface( instance );
+			std::cout << "Surface created." << std::endl;
+			doCreateDevice( instance, *surface );
+			std::cout << "Logical device created." << std::endl;
+			doBenchmark();
+		}
+		catch ( common::Exception & )
+		{
+			doCleanup();
+			throw;
+		}
+	}
+
+	RenderPanel::~RenderPanel()noexcept
+	{
+		doCleanup();
+	}
+
+	void RenderPanel::doCleanup()noexcept
+	{
+		if ( m_device )
+		{
+			m_device->getDevice().waitIdle();
+			m_buffer.reset();
+			m_device.reset();
+		}
+	}
+
+	ashes::SurfacePtr RenderPanel::doCreateSurface( utils::Instance const & instance )
+	{
+		auto handle = common::makeWindowHandle( *this );
+		auto const & gpu = instance.getPhysicalDevice( 0u );
+		return instance.getInstance().createSurface( gpu
+			, std::move( handle ) );
+	}
+
+	void RenderPanel::doCreateDevice( utils::Instance const & instance
+		, ashes::Surface const & surface )
+	{
+		m_device = std::make_unique< utils::Device >( instance.getInstance()
+			, surface );
+		m_buffer = m_device->createBuffer( uint32_t( BufferSize )
+			, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT
+			, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT );
+	}
+
+	void RenderPanel::doBenchmark()
+	{
+		std::vector< Scenario > const scenarios
+		{
+			{ "Sparse writes (16 B / 64 KiB), flush", 64u * 1024u, 16u, true },
+			{ "Sparse writes (16 B / 64 KiB), unmap", 64u * 1024u, 16u, false },
+			{ "Sparse writes (256 B / 1 MiB), flush", 1024u * 1024u, 256u, true },
+			{ "Dense writes (whole mapping), flush", BufferSize, BufferSize, true },
+		};
+		std::vector< uint8_t > values( size_t( BufferSize ), uint8_t{} );
+		VkDeviceSize written{};
+
+		for ( auto & scenario : scenarios )
+		{
+			VkDeviceSize scenarioWritten{};
+			common::benchmark( scenario.name
+				, Iterations
+				, [this, &scenario, &values, &scenarioWritten]( uint32_t index )
+				{
+					auto data = m_buffer->lock( 0u, BufferSize, 0u );
+
+					if ( !data )
+					{
+						throw common::Exception{ "Couldn't map the buffer" };
+					}
+
+					for ( VkDeviceSize offset = 0u; offset < BufferSize; offset += scenario.step )
+					{
+						std::memset( values.data() + offset, int( index & 0xFFu ), size_t( scenario.size ) );
+						std::memcpy( data + offset, values.data() + offset, size_t( scenario.size ) );
+						scenarioWritten += scenario.size;
+					}
+
+					if ( scenario.flush )
+					{
+						m_buffer->flush( 0u, BufferSize );
+					}
+
+					m_buffer->unlock();
+				} );
+			common::printMeasure( scenario.name + ", written bytes"
+				, std::to_string( scenarioWritten ) );
+			written += scenarioWritten;
+		}
+
+		common::printMeasure( "Total written bytes"
+			, std::to_string( written ) + ", compare with the renderer's mapped uploads report, at device destruction" );
+	}
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Prerequisites.hpp"
+
+#include <ashespp/Buffer/Buffer.hpp>
+#include <ashespp/Core/Device.hpp>
+
+#include <wx/panel.h>
+
+namespace vkapp
+{
+	/**
+	*\brief
+	*	Measures the uploads of sparse writes into a large host visible mapping.
+	*\remarks
+	*	The bytes flushed by the application and the ones the renderer actually uploaded
+	*	are reported by the renderer, through the debug callback, when the device is destroyed.
+	*/
+	class RenderPanel
+		: public wxPanel
+	{
+	public:
+		RenderPanel( wxWindow * parent
+			, wxSize const & size
+			, utils::Instance const & instance );
+		~RenderPanel()noexcept override;
+
+	private:
+		void doCleanup()noexcept;
+		ashes::SurfacePtr doCreateSurface( utils::Instance const & instance );
+		void doCreateDevice( utils::Instance const & instance
+			, ashes::Surface const & surface );
+		void doBenchmark();
+
+	private:
+		utils::DevicePtr m_device;
+		ashes::BufferBasePtr m_buffer;
+	};
+}
@@ -0,0 +1,186 @@
+#include "RenderPanel.hpp"
+
+#include "Application.hpp"
+#include "MainFrame.hpp"
+
+#include <ashes/common/BuddyAllocator.hpp>
+#include <ashes/common/DeviceAllocator.hpp>
+
+#include <Benchmark.hpp>
+
+#include <array>
+#include <memory>
+#include <random>
+
+namespace vkapp
+{
+	namespace
+	{
+		uint32_t const Iterations = 200000u;
+		std::array< uint32_t, 3u > const LiveCounts{ 100u, 1000u, 10000u };
+		size_t const MaxAllocationSize = 4096u;
+		/**
+		*\brief
+		*	Buddy allocator traits over a host memory block.
+		*/
+		class HostBuddyTraits
+		{
+		public:
+			using PointerType = uint8_t *;
+
+			struct Block
+			{
+				PointerType data;
+			};
+
+			HostBuddyTraits( size_t size
+				, uint32_t )
+				: m_size{ size }
+				, m_memory{ new uint8_t[size] }
+			{
+			}
+
+			size_t getSize()const noexcept
+			{
+				return m_size;
+			}
+
+			PointerType getPointer( size_t offset )noexcept
+			{
+				return m_memory.get() + offset;
+			}
+
+			size_t getOffset( PointerType pointer )const noexcept
+			{
+				return size_t( pointer - m_memory.get() );
+			}
+
+			Block getNull()const noexcept
+			{
+				return Block{ nullptr };
+			}
+
+			bool isNull( PointerType pointer )const noexcept
+			{
+				return pointer == nullptr;
+			}
+
+			void registerAllocation( PointerType
+				, size_t
+				, size_t )noexcept
+			{
+			}
+
+			void registerDeallocation( PointerType
+				, size_t )noexcept
+			{
+			}
+
+		private:
+			size_t m_size;
+			std::unique_ptr< uint8_t[] > m_memory;
+		};
+		/**
+		*\brief
+		*	Replaces one of the live allocations by a new one, of random size, at each iteration.
+		*/
+		template< typename AllocateFuncT, typename FreeFuncT >
+		void churn( std::string const & name
+			, uint32_t liveCount
+			, AllocateFuncT allocate
+			, FreeFuncT free )
+		{
+			std::mt19937 engine{ 42u };
+			std::uniform_int_distribution< size_t > sizes{ 1u, MaxAllocationSize };
+			std::uniform_int_distribution< uint32_t > indices{ 0u, liveCount - 1u };
+			std::vector< void * > live;
+			live.reserve( liveCount );
+
+			for ( uint32_t i = 0u; i < liveCount; ++i )
+			{
+				live.push_back( allocate( sizes( engine ) ) );
+			}
+
+			common::benchmark( name + ", " + std::to_string( liveCount ) + " live allocations"
+				, Iterations
+				, [&]( uint32_t )
+				{
+					auto & allocation = live[indices( engine )];
+					free( allocation );
+					allocation = allocate( sizes( engine ) );
+				} );
+
+			for ( auto allocation : live )
+			{
+				free( allocation );
+			}
+		}
+	}
+
+	RenderPanel::RenderPanel( wxWindow * parent
+		, wxSize const & size
+		, utils::Instance const & instance )
+		: wxPanel{ parent, wxID_ANY, wxDefaultPosition, size }
+	{
+		for ( auto liveCount : LiveCounts )
+		{
+			doBenchmarkBuddy( liveCount );
+			doBenchmarkCallbacks( liveCount );
+		}
+	}
+
+	void RenderPanel::doBenchmarkBuddy( uint32_t liveCount )
+	{
+		// 16 bytes blocks, 64 MiB.
+		ashes::BuddyAllocatorT< HostBuddyTraits > allocator{ 22u, 16u };
+		churn( "BuddyAllocatorT"
+			, liveCount
+			, [&allocator]( size_t size )
+			{
+				auto result = allocator.allocate( size );
+
+				if ( !result )
+				{
+					throw common::Exception{ "Buddy allocator exhausted" };
+				}
+
+				return static_cast< void * >( result );
+			}
+			, [&allocator]( void * pointer )
+			{
+				allocator.deallocate( static_cast< uint8_t * >( pointer ) );
+			} );
+
+		if ( allocator.getAvailable() != allocator.getSize() )
+		{
+			throw common::Exception{ "Buddy allocator leaked memory" };
+		}
+	}
+
+	void RenderPanel::doBenchmarkCallbacks( uint32_t liveCount )
+	{
+		// The allocator given to the drivers, with its default levels, behind VkAllocationCallbacks.
+		auto allocator = ashes::makeAllocator< HostBuddyTraits >();
+		VkAllocationCallbacks const & callbacks = *allocator;
+		churn( "DeviceAllocatorT callbacks"
+			, liveCount
+			, [&callbacks]( size_t size )
+			{
+				auto result = callbacks.pfnAllocation( callbacks.pUserData
+					, size
+					, 16u
+					, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT );
+
+				if ( !result )
+				{
+					throw common::Exception{ "Device allocator exhausted" };
+				}
+
+				return result;
+			}
+			, [&callbacks]( void * pointer )
+			{
+				callbacks.pfnFree( callbacks.pUserData, pointer );
+			} );
+	}
+}
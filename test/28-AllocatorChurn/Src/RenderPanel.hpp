@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Prerequisites.hpp"
+
+#include <wx/panel.h>
+
+namespace vkapp
+{
+	/**
+	*\brief
+	*	Measures the allocation/free churn of the buddy allocator, with thousands of live allocations.
+	*\remarks
+	*	The allocator works on host memory only, so no device is created.
+	*/
+	class RenderPanel
+		: public wxPanel
+	{
+	public:
+		RenderPanel( wxWindow * parent
+			, wxSize const & size
+			, utils::Instance const & instance );
+
+	private:
+		void doBenchmarkBuddy( uint32_t liveCount );
+		void doBenchmarkCallbacks( uint32_t liveCount );
+	};
+}
@@ -0,0 +1,178 @@
+#include "RenderPanel.hpp"
+
+#include "Application.hpp"
+#include "MainFrame.hpp"
+
+#include <ashespp/Command/CommandBuffer.hpp>
+#include <ashespp/Core/Surface.hpp>
+
+#include <Benchmark.hpp>
+
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+namespace vkapp
+{
+	namespace
+	{
+		uint32_t const BindingCount = 8u;
+		uint32_t const RangeCount = 8u;
+		VkDeviceSize const RangeSize = 256u;
+		uint32_t const Windows = 10u;
+		uint32_t const RewritesPerWindow = 10000u;
+		uint32_t const BindsPerRecord = 100u;
+		uint32_t const Records = 100u;
+		// The last window's binds may be that much slower than the first window's ones, to absorb the timings noise.
+		double const Tolerance = 4.0;
+	}
+
+	RenderPanel::RenderPanel( wxWindow * parent
+		, wxSize const & size
+		, utils::Instance const & instance )
+		: wxPanel{ parent, wxID_ANY, wxDefaultPosition, size }
+	{
+		try
+		{
+			auto surface = doCreateSurface( instance );
+			std::cout << "Surface created." << std::endl;
+			doCreateDevice( instance, *surface );
+			std::cout << "Logical device created." << std::endl;
+			doCreateDescriptorSet();
+			std::cout << "Descriptor set created." << std::endl;
+			doBenchmark();
+		}
+		catch ( common::Exception & )
+		{
+			doCleanup();
+			throw;
+		}
+	}
+
+	RenderPanel::~RenderPanel()noexcept
+	{
+		doCleanup();
+	}
+
+	void RenderPanel::doCleanup()noexcept
+	{
+		if ( m_device )
+		{
+			m_device->getDevice().waitIdle();
+			m_pipelineLayout.reset();
+			m_descriptorSet.reset();
+			m_descriptorPool.reset();
+			m_descriptorLayout.reset();
+			m_buffer.reset();
+			m_commandPool.reset();
+			m_device.reset();
+		}
+	}
+
+	ashes::SurfacePtr RenderPanel::doCreateSurface( utils::Instance const & instance )
+	{
+		auto handle = common::makeWindowHandle( *this );
+		auto const & gpu = instance.getPhysicalDevice( 0u );
+		return instance.getInstance().createSurface( gpu
+			, std::move( handle ) );
+	}
+
+	void RenderPanel::doCreateDevice( utils::Instance const & instance
+		, ashes::Surface const & surface )
+	{
+		m_device = std::make_unique< utils::Device >( instance.getInstance()
+			, surface );
+		m_commandPool = m_device->getDevice().createCommandPool( m_device->getComputeQueueFamily()
+			, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT );
+		m_buffer = m_device->createBuffer( uint32_t( RangeCount * RangeSize )
+			, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT
+			, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT );
+	}
+
+	void RenderPanel::doCreateDescriptorSet()
+	{
+		ashes::VkDescriptorSetLayoutBindingArray bindings;
+
+		for ( uint32_t binding = 0u; binding < BindingCount; ++binding )
+		{
+			bindings.push_back( { binding
+				, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER
+				, 1u
+				, VK_SHADER_STAGE_COMPUTE_BIT
+				, nullptr } );
+		}
+
+		m_descriptorLayout = m_device->getDevice().createDescriptorSetLayout( std::move( bindings ) );
+		m_descriptorPool = m_descriptorLayout->createPool( 1u );
+		m_descriptorSet = m_descriptorPool->createDescriptorSet( 0u );
+		m_pipelineLayout = m_device->getDevice().createPipelineLayout( *m_descriptorLayout );
+		doRewrite( 0u );
+	}
+
+	void RenderPanel::doRewrite( uint32_t index )const
+	{
+		ashes::WriteDescriptorSetArray writes;
+
+		for ( uint32_t binding = 0u; binding < BindingCount; ++binding )
+		{
+			writes.push_back( { binding
+				, 0u
+				, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER
+				, ashes::VkDescriptorBufferInfoArray{ { *m_buffer
+					, ( ( index + binding ) % RangeCount ) * RangeSize
+					, RangeSize } } } );
+		}
+
+		m_descriptorSet->updateBindings( writes );
+	}
+
+	void RenderPanel::doRecordBinds( ashes::CommandBuffer const & commandBuffer )const
+	{
+		commandBuffer.reset();
+		commandBuffer.begin();
+
+		for ( uint32_t i = 0u; i < BindsPerRecord; ++i )
+		{
+			commandBuffer.bindDescriptorSet( *m_descriptorSet
+				, *m_pipelineLayout
+				, VK_PIPELINE_BIND_POINT_COMPUTE );
+		}
+
+		commandBuffer.end();
+	}
+
+	void RenderPanel::doBenchmark()
+	{
+		auto commandBuffer = m_commandPool->createCommandBuffer();
+		std::vector< double > bindCosts;
+
+		for ( uint32_t window = 0u; window < Windows; ++window )
+		{
+			auto rewritten = std::to_string( ( window + 1u ) * RewritesPerWindow );
+			common::benchmark( "Rewrites, up to " + rewritten
+				, RewritesPerWindow
+				, [this, window]( uint32_t index )
+				{
+					doRewrite( window * RewritesPerWindow + index );
+				} );
+			bindCosts.push_back( common::benchmark( "Binds, after " + rewritten + " rewrites"
+				, Records
+				, [this, &commandBuffer]( uint32_t )
+				{
+					doRecordBinds( *commandBuffer );
+				} ) );
+		}
+
+		auto ratio = bindCosts.back() / bindCosts.front();
+		std::stringstream stream;
+		stream.imbue( std::locale{ "C" } );
+		stream << std::fixed << std::setprecision( 3 ) << ratio;
+		common::printMeasure( "Last to first binds cost ratio"
+			, stream.str() );
+
+		if ( ratio > Tolerance )
+		{
+			throw common::Exception{ "Binding the descriptor set gets slower with its rewrites" };
+		}
+	}
+}
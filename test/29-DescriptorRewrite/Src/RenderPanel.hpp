@@ -0,0 +1,51 @@
+#pragma once
+
+#include "Prerequisites.hpp"
+
+#include <ashespp/Buffer/Buffer.hpp>
+#include <ashespp/Command/CommandPool.hpp>
+#include <ashespp/Core/Device.hpp>
+#include <ashespp/Descriptor/DescriptorSet.hpp>
+#include <ashespp/Descriptor/DescriptorSetLayout.hpp>
+#include <ashespp/Descriptor/DescriptorSetPool.hpp>
+#include <ashespp/Pipeline/PipelineLayout.hpp>
+
+#include <wx/panel.h>
+
+namespace vkapp
+{
+	/**
+	*\brief
+	*	Rewrites a descriptor set many times, and checks that binding it doesn't get slower.
+	*\remarks
+	*	A set which keeps every write it received would see its bind cost grow with the rewrites.
+	*/
+	class RenderPanel
+		: public wxPanel
+	{
+	public:
+		RenderPanel( wxWindow * parent
+			, wxSize const & size
+			, utils::Instance const & instance );
+		~RenderPanel()noexcept override;
+
+	private:
+		void doCleanup()noexcept;
+		ashes::SurfacePtr doCreateSurface( utils::Instance const & instance );
+		void doCreateDevice( utils::Instance const & instance
+			, ashes::Surface const & surface );
+		void doCreateDescriptorSet();
+		void doRewrite( uint32_t index )const;
+		void doRecordBinds( ashes::CommandBuffer const & commandBuffer )const;
+		void doBenchmark();
+
+	private:
+		utils::DevicePtr m_device;
+		ashes::CommandPoolPtr m_commandPool;
+		ashes::BufferBasePtr m_buffer;
+		ashes::DescriptorSetLayoutPtr m_descriptorLayout;
+		ashes::DescriptorSetPoolPtr m_descriptorPool;
+		ashes::DescriptorSetPtr m_descriptorSet;
+		ashes::PipelineLayoutPtr m_pipelineLayout;
+	};
+}
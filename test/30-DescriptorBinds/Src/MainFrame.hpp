@@ -0,0 +1,21 @@
+#pragma once
+
+#include "Prerequisites.hpp"
+
+#include <ashespp/Core/Instance.hpp>
+
+#include <MainFrame.hpp>
+
+namespace vkapp
+{
+	class MainFrame
+		: public common::MainFrame
+	{
+	public:
+		MainFrame( wxString const & rendererName
+			, ashes::RendererList const & renderers );
+
+	private:
+		wxWindowPtr< wxPanel > doCreatePanel( wxSize const & size, utils::Instance const & instance )override;
+	};
+}
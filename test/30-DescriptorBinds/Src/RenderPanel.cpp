@@ -0,0 +1,187 @@
+#include "RenderPanel.hpp"
+
+#include "Application.hpp"
+#include "MainFrame.hpp"
+
+#include <ashespp/Command/CommandBuffer.hpp>
+#include <ashespp/Core/Surface.hpp>
+
+#include <Benchmark.hpp>
+
+#include <functional>
+
+namespace vkapp
+{
+	namespace
+	{
+		uint32_t const TextureCount = 16u;
+		uint32_t const SetCount = 2u;
+		uint32_t const BindsPerRecord = 1000u;
+		uint32_t const Records = 20u;
+	}
+
+	RenderPanel::RenderPanel( wxWindow * parent
+		, wxSize const & size
+		, utils::Instance const & instance )
+		: wxPanel{ parent, wxID_ANY, wxDefaultPosition, size }
+	{
+		try
+		{
+			auto surface = doCreateSurface( instance );
+			std::cout << "Surface created." << std::endl;
+			doCreateDevice( instance, *surface );
+			std::cout << "Logical device created." << std::endl;
+			doCreateTextures();
+			std::cout << "Textures created." << std::endl;
+			doCreateDescriptorSets();
+			std::cout << "Descriptor sets created." << std::endl;
+			doBenchmark();
+		}
+		catch ( common::Exception & )
+		{
+			doCleanup();
+			throw;
+		}
+	}
+
+	RenderPanel::~RenderPanel()noexcept
+	{
+		doCleanup();
+	}
+
+	void RenderPanel::doCleanup()noexcept
+	{
+		if ( m_device )
+		{
+			m_device->getDevice().waitIdle();
+			m_pipelineLayout.reset();
+			m_descriptorSets.clear();
+			m_descriptorPool.reset();
+			m_descriptorLayout.reset();
+			m_sampler.reset();
+			m_views.clear();
+			m_textures.clear();
+			m_commandPool.reset();
+			m_device.reset();
+		}
+	}
+
+	ashes::SurfacePtr RenderPanel::doCreateSurface( utils::Instance const & instance )
+	{
+		auto handle = common::makeWindowHandle( *this );
+		auto const & gpu = instance.getPhysicalDevice( 0u );
+		return instance.getInstance().createSurface( gpu
+			, std::move( handle ) );
+	}
+
+	void RenderPanel::doCreateDevice( utils::Instance const & instance
+		, ashes::Surface const & surface )
+	{
+		m_device = std::make_unique< utils::Device >( instance.getInstance()
+			, surface );
+		m_commandPool = m_device->getDevice().createCommandPool( m_device->getGraphicsQueueFamily()
+			, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT );
+	}
+
+	void RenderPanel::doCreateTextures()
+	{
+		for ( uint32_t i = 0u; i < TextureCount; ++i )
+		{
+			m_textures.push_back( m_device->createImage( ashes::ImageCreateInfo
+				{
+					0u,
+					VK_IMAGE_TYPE_2D,
+					VK_FORMAT_R8G8B8A8_UNORM,
+					{ 4u, 4u, 1u },
+					1u,
+					1u,
+					VK_SAMPLE_COUNT_1_BIT,
+					VK_IMAGE_TILING_OPTIMAL,
+					VK_IMAGE_USAGE_SAMPLED_BIT
+				}
+				, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT ) );
+			m_views.push_back( m_textures.back()->createView( VK_IMAGE_VIEW_TYPE_2D
+				, VK_FORMAT_R8G8B8A8_UNORM ) );
+		}
+
+		m_sampler = m_device->getDevice().createSampler( VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE
+			, VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE
+			, VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE
+			, VK_FILTER_NEAREST
+			, VK_FILTER_NEAREST );
+	}
+
+	void RenderPanel::doCreateDescriptorSets()
+	{
+		ashes::VkDescriptorSetLayoutBindingArray bindings;
+
+		for ( uint32_t binding = 0u; binding < TextureCount; ++binding )
+		{
+			bindings.push_back( { binding
+				, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER
+				, 1u
+				, VK_SHADER_STAGE_FRAGMENT_BIT
+				, nullptr } );
+		}
+
+		m_descriptorLayout = m_device->getDevice().createDescriptorSetLayout( std::move( bindings ) );
+		m_descriptorPool = m_descriptorLayout->createPool( SetCount );
+		m_pipelineLayout = m_device->getDevice().createPipelineLayout( *m_descriptorLayout );
+
+		for ( uint32_t set = 0u; set < SetCount; ++set )
+		{
+			m_descriptorSets.push_back( m_descriptorPool->createDescriptorSet( 0u ) );
+			auto & descriptorSet = *m_descriptorSets.back();
+
+			// Each set uses the textures in a different order, so consecutive binds of different sets rebind every unit.
+			for ( uint32_t binding = 0u; binding < TextureCount; ++binding )
+			{
+				descriptorSet.createBinding( m_descriptorLayout->getBinding( binding )
+					, m_views[( binding + set ) % TextureCount]
+					, *m_sampler );
+			}
+
+			descriptorSet.update();
+		}
+	}
+
+	void RenderPanel::doBenchmark()
+	{
+		auto commandBuffer = m_commandPool->createCommandBuffer();
+		auto record = [this, &commandBuffer]( std::function< ashes::DescriptorSet const &( uint32_t ) > const & select )
+		{
+			commandBuffer->reset();
+			commandBuffer->begin();
+
+			for ( uint32_t i = 0u; i < BindsPerRecord; ++i )
+			{
+				commandBuffer->bindDescriptorSet( select( i )
+					, *m_pipelineLayout );
+			}
+
+			commandBuffer->end();
+		};
+		auto requested = std::to_string( uint64_t( Records + 1u ) * BindsPerRecord * TextureCount );
+
+		common::benchmark( "Same set binds, " + requested + " texture binds requested"
+			, Records
+			, [this, &record]( uint32_t )
+			{
+				record( [this]( uint32_t )->ashes::DescriptorSet const &
+					{
+						return *m_descriptorSets[0];
+					} );
+			} );
+		common::benchmark( "Alternating sets binds, " + requested + " texture binds requested"
+			, Records
+			, [this, &record]( uint32_t )
+			{
+				record( [this]( uint32_t index )->ashes::DescriptorSet const &
+					{
+						return *m_descriptorSets[index % SetCount];
+					} );
+			} );
+		common::printMeasure( "Binds counts"
+			, "compare with the renderer's descriptor binds report, at device destruction" );
+	}
+}
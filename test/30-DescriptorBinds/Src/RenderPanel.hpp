@@ -0,0 +1,55 @@
+#pragma once
+
+#include "Prerequisites.hpp"
+
+#include <ashespp/Command/CommandPool.hpp>
+#include <ashespp/Core/Device.hpp>
+#include <ashespp/Descriptor/DescriptorSet.hpp>
+#include <ashespp/Descriptor/DescriptorSetLayout.hpp>
+#include <ashespp/Descriptor/DescriptorSetPool.hpp>
+#include <ashespp/Image/Image.hpp>
+#include <ashespp/Image/ImageView.hpp>
+#include <ashespp/Image/Sampler.hpp>
+#include <ashespp/Pipeline/PipelineLayout.hpp>
+
+#include <wx/panel.h>
+
+namespace vkapp
+{
+	/**
+	*\brief
+	*	Measures the recording of binds of descriptor sets holding many textures.
+	*\remarks
+	*	The bind counts (requested, skipped because redundant, and recorded) are reported
+	*	by the renderer, through the debug callback, when the device is destroyed.
+	*/
+	class RenderPanel
+		: public wxPanel
+	{
+	public:
+		RenderPanel( wxWindow * parent
+			, wxSize const & size
+			, utils::Instance const & instance );
+		~RenderPanel()noexcept override;
+
+	private:
+		void doCleanup()noexcept;
+		ashes::SurfacePtr doCreateSurface( utils::Instance const & instance );
+		void doCreateDevice( utils::Instance const & instance
+			, ashes::Surface const & surface );
+		void doCreateTextures();
+		void doCreateDescriptorSets();
+		void doBenchmark();
+
+	private:
+		utils::DevicePtr m_device;
+		ashes::CommandPoolPtr m_commandPool;
+		std::vector< ashes::ImagePtr > m_textures;
+		std::vector< ashes::ImageView > m_views;
+		ashes::SamplerPtr m_sampler;
+		ashes::DescriptorSetLayoutPtr m_descriptorLayout;
+		ashes::DescriptorSetPoolPtr m_descriptorPool;
+		std::vector< ashes::DescriptorSetPtr > m_descriptorSets;
+		ashes::PipelineLayoutPtr m_pipelineLayout;
+	};
+}
@@ -0,0 +1 @@
+#include "Prerequisites.hpp"
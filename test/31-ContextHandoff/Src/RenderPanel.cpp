@@ -0,0 +1,196 @@
+#include "RenderPanel.hpp"
+
+#include "Application.hpp"
+#include "MainFrame.hpp"
+
+#include <ashespp/Core/Surface.hpp>
+
+#include <Benchmark.hpp>
+
+#include <atomic>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+namespace vkapp
+{
+	namespace
+	{
+		uint32_t const ThreadCount = 2u;
+		uint32_t const BufferSize = 1024u;
+		uint32_t const MapsPerRound = 10000u;
+		uint32_t const Rounds = 5u;
+		/**
+		*\brief
+		*	Runs \p count calls to \p function, spread over ThreadCount threads.
+		*\param[in] alternate
+		*	\p true to have the threads take turns, \p false to let them run concurrently.
+		*/
+		template< typename FuncT >
+		void runThreads( uint32_t count
+			, bool alternate
+			, FuncT function )
+		{
+			std::atomic< uint32_t > turn{};
+			std::vector< std::thread > threads;
+
+			for ( uint32_t index = 0u; index < ThreadCount; ++index )
+			{
+				threads.emplace_back( [index, count, alternate, &turn, &function]()
+					{
+						for ( uint32_t i = index; i < count; i += ThreadCount )
+						{
+							if ( alternate )
+							{
+								while ( turn.load() != i )
+								{
+									std::this_thread::yield();
+								}
+							}
+
+							function( index );
+
+							if ( alternate )
+							{
+								turn.store( i + 1u );
+							}
+						}
+					} );
+			}
+
+			for ( auto & thread : threads )
+			{
+				thread.join();
+			}
+		}
+	}
+
+	RenderPanel::RenderPanel( wxWindow * parent
+		, wxSize const & size
+		, utils::Instance const & instance )
+		: wxPanel{ parent, wxID_ANY, wxDefaultPosition, size }
+	{
+		try
+		{
+			auto surface = doCreateSurface( instance );
+			std::cout << "Surface created." << std::endl;
+			doCreateDevice( instance, *surface );
+			std::cout << "Logical device created." << std::endl;
+			doBenchmark();
+		}
+		catch ( common::Exception & )
+		{
+			doCleanup();
+			throw;
+		}
+	}
+
+	RenderPanel::~RenderPanel()noexcept
+	{
+		doCleanup();
+	}
+
+	void RenderPanel::doCleanup()noexcept
+	{
+		if ( m_device )
+		{
+			m_device->getDevice().waitIdle();
+			m_buffers.clear();
+			m_device.reset();
+		}
+	}
+
+	ashes::SurfacePtr RenderPanel::doCreateSurface( utils::Instance const & instance )
+	{
+		auto handle = common::makeWindowHandle( *this );
+		auto const & gpu = instance.getPhysicalDevice( 0u );
+		return instance.getInstance().createSurface( gpu
+			, std::move( handle ) );
+	}
+
+	void RenderPanel::doCreateDevice( utils::Instance const & instance
+		, ashes::Surface const & surface )
+	{
+		m_device = std::make_unique< utils::Device >( instance.getInstance()
+			, surface );
+
+		// One buffer per thread, so that concurrent threads don't map the same memory.
+		for ( uint32_t index = 0u; index < ThreadCount; ++index )
+		{
+			m_buffers.push_back( m_device->createBuffer( BufferSize
+				, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT
+				, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT ) );
+		}
+	}
+
+	bool RenderPanel::doMapUnmap( ashes::BufferBase const & buffer )const
+	{
+		auto data = buffer.lock( 0u, BufferSize, 0u );
+
+		if ( !data )
+		{
+			return false;
+		}
+
+		data[0] = uint8_t( data[0] + 1u );
+		buffer.unlock();
+		return true;
+	}
+
+	void RenderPanel::doBenchmark()
+	{
+		// The worker threads can't throw, they count the failed maps instead.
+		std::atomic< uint32_t > failures{};
+		auto print = []( std::string const & name
+			, double round )
+		{
+			std::stringstream stream;
+			stream.imbue( std::locale{ "C" } );
+			stream << std::fixed << std::setprecision( 3 ) << ( round / MapsPerRound ) << " ns";
+			common::printMeasure( name + ", per map/unmap"
+				, stream.str() );
+		};
+
+		print( "One thread"
+			, common::benchmark( "One thread, " + std::to_string( MapsPerRound ) + " map/unmap"
+				, Rounds
+				, [this, &failures]( uint32_t )
+				{
+					for ( uint32_t i = 0u; i < MapsPerRound; ++i )
+					{
+						failures += doMapUnmap( *m_buffers[0] ) ? 0u : 1u;
+					}
+				} ) );
+		print( "Alternating threads"
+			, common::benchmark( "Alternating threads, " + std::to_string( MapsPerRound ) + " map/unmap"
+				, Rounds
+				, [this, &failures]( uint32_t )
+				{
+					runThreads( MapsPerRound
+						, true
+						, [this, &failures]( uint32_t index )
+						{
+							failures += doMapUnmap( *m_buffers[index] ) ? 0u : 1u;
+						} );
+				} ) );
+		print( "Concurrent threads"
+			, common::benchmark( "Concurrent threads, " + std::to_string( MapsPerRound ) + " map/unmap"
+				, Rounds
+				, [this, &failures]( uint32_t )
+				{
+					runThreads( MapsPerRound
+						, false
+						, [this, &failures]( uint32_t index )
+						{
+							failures += doMapUnmap( *m_buffers[index] ) ? 0u : 1u;
+						} );
+				} ) );
+		if ( failures )
+		{
+			throw common::Exception{ "Couldn't map the buffers" };
+		}
+
+		common::printMeasure( "Context switches"
+			, "compare with the renderer's context locks report, at device destruction" );
+	}
+}
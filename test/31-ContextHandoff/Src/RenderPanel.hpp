@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Prerequisites.hpp"
+
+#include <ashespp/Buffer/Buffer.hpp>
+#include <ashespp/Core/Device.hpp>
+
+#include <wx/panel.h>
+
+namespace vkapp
+{
+	/**
+	*\brief
+	*	Measures the map/unmap throughput from one thread, and from threads taking turns.
+	*\remarks
+	*	The context locks, make-current and release counts are reported by the renderer,
+	*	through the debug callback, when the device is destroyed.
+	*/
+	class RenderPanel
+		: public wxPanel
+	{
+	public:
+		RenderPanel( wxWindow * parent
+			, wxSize const & size
+			, utils::Instance const & instance );
+		~RenderPanel()noexcept override;
+
+	private:
+		void doCleanup()noexcept;
+		ashes::SurfacePtr doCreateSurface( utils::Instance const & instance );
+		void doCreateDevice( utils::Instance const & instance
+			, ashes::Surface const & surface );
+		bool doMapUnmap( ashes::BufferBase const & buffer )const;
+		void doBenchmark();
+
+	private:
+		utils::DevicePtr m_device;
+		std::vector< ashes::BufferBasePtr > m_buffers;
+	};
+}
@@ -0,0 +1,132 @@
+#include "RenderPanel.hpp"
+
+#include "Application.hpp"
+#include "MainFrame.hpp"
+
+#include <ashespp/Command/CommandBuffer.hpp>
+#include <ashespp/Core/Surface.hpp>
+
+#include <Benchmark.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+namespace vkapp
+{
+	namespace
+	{
+		uint32_t const Samples = 200u;
+		// Leaves the submission the time to start waiting on the event.
+		std::chrono::milliseconds const SetDelay{ 2 };
+	}
+
+	RenderPanel::RenderPanel( wxWindow * parent
+		, wxSize const & size
+		, utils::Instance const & instance )
+		: wxPanel{ parent, wxID_ANY, wxDefaultPosition, size }
+	{
+		try
+		{
+			auto surface = doCreateSurface( instance );
+			std::cout << "Surface created." << std::endl;
+			doCreateDevice( instance, *surface );
+			std::cout << "Logical device created." << std::endl;
+			doBenchmark();
+		}
+		catch ( common::Exception & )
+		{
+			doCleanup();
+			throw;
+		}
+	}
+
+	RenderPanel::~RenderPanel()noexcept
+	{
+		doCleanup();
+	}
+
+	void RenderPanel::doCleanup()noexcept
+	{
+		if ( m_device )
+		{
+			m_device->getDevice().waitIdle();
+			m_commandPool.reset();
+			m_queue.reset();
+			m_device.reset();
+		}
+	}
+
+	ashes::SurfacePtr RenderPanel::doCreateSurface( utils::Instance const & instance )
+	{
+		auto handle = common::makeWindowHandle( *this );
+		auto const & gpu = instance.getPhysicalDevice( 0u );
+		return instance.getInstance().createSurface( gpu
+			, std::move( handle ) );
+	}
+
+	void RenderPanel::doCreateDevice( utils::Instance const & instance
+		, ashes::Surface const & surface )
+	{
+		m_device = std::make_unique< utils::Device >( instance.getInstance()
+			, surface );
+		m_queue = m_device->getDevice().getQueue( m_device->getGraphicsQueueFamily(), 0u );
+		m_commandPool = m_device->getDevice().createCommandPool( m_device->getGraphicsQueueFamily()
+			, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT );
+	}
+
+	void RenderPanel::doBenchmark()
+	{
+		auto event = m_device->getDevice().createEvent();
+		auto fence = m_device->getDevice().createFence();
+		auto commandBuffer = m_commandPool->createCommandBuffer();
+		commandBuffer->begin();
+		commandBuffer->waitEvents( { *event }
+			, VK_PIPELINE_STAGE_HOST_BIT
+			, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT
+			, {}
+			, {}
+			, {} );
+		commandBuffer->end();
+
+		std::vector< double > latencies;
+		latencies.reserve( Samples );
+
+		for ( uint32_t i = 0u; i < Samples; ++i )
+		{
+			event->reset();
+			fence->reset();
+			std::chrono::steady_clock::time_point set;
+			m_queue->submit( *commandBuffer, fence.get() );
+			std::thread setter{ [&event, &set]()
+				{
+					std::this_thread::sleep_for( SetDelay );
+					set = std::chrono::steady_clock::now();
+					event->set();
+				} };
+			auto result = fence->wait( ashes::MaxTimeout );
+			auto woken = std::chrono::steady_clock::now();
+			setter.join();
+
+			if ( result != ashes::WaitResult::eSuccess )
+			{
+				throw common::Exception{ "The submission didn't complete" };
+			}
+
+			latencies.push_back( std::chrono::duration< double, std::micro >( woken - set ).count() );
+		}
+
+		std::sort( latencies.begin(), latencies.end() );
+		std::stringstream stream;
+		stream.imbue( std::locale{ "C" } );
+		stream << std::fixed << std::setprecision( 3 )
+			<< "min " << latencies.front() << " us"
+			<< ", median " << latencies[latencies.size() / 2u] << " us"
+			<< ", 99th percentile " << latencies[( latencies.size() * 99u ) / 100u] << " us"
+			<< ", max " << latencies.back() << " us";
+		common::printMeasure( "vkSetEvent to fence wake-up latency (" + std::to_string( Samples ) + " samples)"
+			, stream.str() );
+	}
+}
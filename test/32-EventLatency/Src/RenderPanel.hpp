@@ -0,0 +1,42 @@
+#pragma once
+
+#include "Prerequisites.hpp"
+
+#include <ashespp/Command/CommandPool.hpp>
+#include <ashespp/Core/Device.hpp>
+#include <ashespp/Sync/Event.hpp>
+#include <ashespp/Sync/Fence.hpp>
+#include <ashespp/Sync/Queue.hpp>
+
+#include <wx/panel.h>
+
+namespace vkapp
+{
+	/**
+	*\brief
+	*	Measures the wake-up latency of a submission waiting on an event, set by the host on another thread.
+	*\remarks
+	*	The latency runs from the vkSetEvent call to the return of the wait on the submission's fence.
+	*/
+	class RenderPanel
+		: public wxPanel
+	{
+	public:
+		RenderPanel( wxWindow * parent
+			, wxSize const & size
+			, utils::Instance const & instance );
+		~RenderPanel()noexcept override;
+
+	private:
+		void doCleanup()noexcept;
+		ashes::SurfacePtr doCreateSurface( utils::Instance const & instance );
+		void doCreateDevice( utils::Instance const & instance
+			, ashes::Surface const & surface );
+		void doBenchmark();
+
+	private:
+		utils::DevicePtr m_device;
+		ashes::QueuePtr m_queue;
+		ashes::CommandPoolPtr m_commandPool;
+	};
+}
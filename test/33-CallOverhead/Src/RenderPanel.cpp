@@ -0,0 +1,163 @@
+#include "RenderPanel.hpp"
+
+#include "Application.hpp"
+#include "MainFrame.hpp"
+
+#include <ashespp/Command/CommandBuffer.hpp>
+#include <ashespp/Core/Surface.hpp>
+
+#include <Benchmark.hpp>
+
+#include <iomanip>
+#include <sstream>
+
+// The loader's exported entry points, VK_NO_PROTOTYPES hides their declarations.
+extern "C"
+{
+	Ashes_API void VKAPI_CALL vkCmdSetLineWidth( VkCommandBuffer commandBuffer
+		, float lineWidth );
+	Ashes_API VkResult VKAPI_CALL vkGetFenceStatus( VkDevice device
+		, VkFence fence );
+}
+
+namespace vkapp
+{
+	namespace
+	{
+		uint32_t const CallsPerRound = 1000000u;
+		uint32_t const Rounds = 10u;
+
+		void printOverhead( std::string const & name
+			, double loader
+			, double direct )
+		{
+			std::stringstream stream;
+			stream.imbue( std::locale{ "C" } );
+			stream << std::fixed << std::setprecision( 3 )
+				<< "loader " << ( loader / CallsPerRound ) << " ns"
+				<< ", direct " << ( direct / CallsPerRound ) << " ns"
+				<< ", overhead " << ( ( loader - direct ) / CallsPerRound ) << " ns";
+			common::printMeasure( name + ", per call"
+				, stream.str() );
+		}
+	}
+
+	RenderPanel::RenderPanel( wxWindow * parent
+		, wxSize const & size
+		, utils::Instance const & instance )
+		: wxPanel{ parent, wxID_ANY, wxDefaultPosition, size }
+	{
+		try
+		{
+			auto surface = doCreateSurface( instance );
+			std::cout << "Surface created." << std::endl;
+			doCreateDevice( instance, *surface );
+			std::cout << "Logical device created." << std::endl;
+			doBenchmark();
+		}
+		catch ( common::Exception & )
+		{
+			doCleanup();
+			throw;
+		}
+	}
+
+	RenderPanel::~RenderPanel()noexcept
+	{
+		doCleanup();
+	}
+
+	void RenderPanel::doCleanup()noexcept
+	{
+		if ( m_device )
+		{
+			m_device->getDevice().waitIdle();
+			m_commandPool.reset();
+			m_device.reset();
+		}
+	}
+
+	ashes::SurfacePtr RenderPanel::doCreateSurface( utils::Instance const & instance )
+	{
+		auto handle = common::makeWindowHandle( *this );
+		auto const & gpu = instance.getPhysicalDevice( 0u );
+		return instance.getInstance().createSurface( gpu
+			, std::move( handle ) );
+	}
+
+	void RenderPanel::doCreateDevice( utils::Instance const & instance
+		, ashes::Surface const & surface )
+	{
+		m_device = std::make_unique< utils::Device >( instance.getInstance()
+			, surface );
+		m_commandPool = m_device->getDevice().createCommandPool( m_device->getGraphicsQueueFamily()
+			, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT );
+	}
+
+	void RenderPanel::doBenchmark()
+	{
+		auto & device = m_device->getDevice();
+		auto commandBuffer = m_commandPool->createCommandBuffer();
+		auto fence = device.createFence();
+		VkCommandBuffer commandBufferHandle = *commandBuffer;
+		VkDevice deviceHandle = device;
+		VkFence fenceHandle = *fence;
+		// The device functions are resolved through vkGetDeviceProcAddr, they are the renderer's ones.
+		auto directSetLineWidth = device.vkCmdSetLineWidth;
+		auto directGetFenceStatus = device.vkGetFenceStatus;
+
+		auto recordLoader = common::benchmark( "vkCmdSetLineWidth, loader"
+			, Rounds
+			, [&commandBuffer, commandBufferHandle]( uint32_t )
+			{
+				commandBuffer->reset();
+				commandBuffer->begin();
+
+				for ( uint32_t i = 0u; i < CallsPerRound; ++i )
+				{
+					vkCmdSetLineWidth( commandBufferHandle, 1.0f );
+				}
+
+				commandBuffer->end();
+			} );
+		auto recordDirect = common::benchmark( "vkCmdSetLineWidth, direct"
+			, Rounds
+			, [&commandBuffer, commandBufferHandle, directSetLineWidth]( uint32_t )
+			{
+				commandBuffer->reset();
+				commandBuffer->begin();
+
+				for ( uint32_t i = 0u; i < CallsPerRound; ++i )
+				{
+					directSetLineWidth( commandBufferHandle, 1.0f );
+				}
+
+				commandBuffer->end();
+			} );
+		printOverhead( "vkCmdSetLineWidth", recordLoader, recordDirect );
+
+		// The results are accumulated, so the calls can't be dropped.
+		uint64_t results{};
+		auto statusLoader = common::benchmark( "vkGetFenceStatus, loader"
+			, Rounds
+			, [deviceHandle, fenceHandle, &results]( uint32_t )
+			{
+				for ( uint32_t i = 0u; i < CallsPerRound; ++i )
+				{
+					results += uint64_t( vkGetFenceStatus( deviceHandle, fenceHandle ) );
+				}
+			} );
+		auto statusDirect = common::benchmark( "vkGetFenceStatus, direct"
+			, Rounds
+			, [deviceHandle, fenceHandle, directGetFenceStatus, &results]( uint32_t )
+			{
+				for ( uint32_t i = 0u; i < CallsPerRound; ++i )
+				{
+					results += uint64_t( directGetFenceStatus( deviceHandle, fenceHandle ) );
+				}
+			} );
+		printOverhead( "vkGetFenceStatus", statusLoader, statusDirect );
+		common::printMeasure( "vkGetFenceStatus results sum"
+			, std::to_string( results ) );
+	}
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Prerequisites.hpp"
+
+#include <ashespp/Command/CommandPool.hpp>
+#include <ashespp/Core/Device.hpp>
+#include <ashespp/Sync/Fence.hpp>
+
+#include <wx/panel.h>
+
+namespace vkapp
+{
+	/**
+	*\brief
+	*	Measures the cost of the loader's exported entry points, against calls to the renderer's own functions.
+	*\remarks
+	*	Meant to be run with the Test renderer, whose functions do almost nothing.
+	*/
+	class RenderPanel
+		: public wxPanel
+	{
+	public:
+		RenderPanel( wxWindow * parent
+			, wxSize const & size
+			, utils::Instance const & instance );
+		~RenderPanel()noexcept override;
+
+	private:
+		void doCleanup()noexcept;
+		ashes::SurfacePtr doCreateSurface( utils::Instance const & instance );
+		void doCreateDevice( utils::Instance const & instance
+			, ashes::Surface const & surface );
+		void doBenchmark();
+
+	private:
+		utils::DevicePtr m_device;
+		ashes::CommandPoolPtr m_commandPool;
+	};
+}
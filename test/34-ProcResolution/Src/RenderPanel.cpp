@@ -0,0 +1,144 @@
+#include "RenderPanel.hpp"
+
+#include "Application.hpp"
+#include "MainFrame.hpp"
+
+#include <ashespp/Core/Surface.hpp>
+
+#include <Benchmark.hpp>
+
+#include <iomanip>
+#include <sstream>
+
+// The loader's exported entry point, VK_NO_PROTOTYPES hides its declaration.
+extern "C"
+{
+	Ashes_API PFN_vkVoidFunction VKAPI_CALL vkGetInstanceProcAddr( VkInstance instance
+		, const char * pName );
+}
+
+namespace vkapp
+{
+	namespace
+	{
+		uint32_t const Rounds = 1000u;
+
+		std::vector< char const * > const InstanceFunctions
+		{
+#define VK_LIB_INSTANCE_FUNCTION( v, x ) "vk"#x,
+#define VK_LIB_PHYSDEVICE_FUNCTION( v, x ) "vk"#x,
+#include <ashes/ashes_functions_list.hpp>
+		};
+
+		std::vector< char const * > const DeviceFunctions
+		{
+#define VK_LIB_DEVICE_FUNCTION( v, x ) "vk"#x,
+#include <ashes/ashes_functions_list.hpp>
+		};
+		/**
+		*\brief
+		*	Resolves every name of \p names through \p resolve, \p Rounds times.
+		*\return
+		*	The count of names resolved to a function.
+		*/
+		template< typename ResolveFuncT >
+		size_t resolveAll( std::string const & name
+			, std::vector< char const * > const & names
+			, ResolveFuncT resolve )
+		{
+			size_t resolved{};
+			auto round = common::benchmark( name + ", " + std::to_string( names.size() ) + " functions"
+				, Rounds
+				, [&names, &resolve, &resolved]( uint32_t )
+				{
+					resolved = 0u;
+
+					for ( auto functionName : names )
+					{
+						resolved += resolve( functionName ) ? 1u : 0u;
+					}
+				} );
+			std::stringstream stream;
+			stream.imbue( std::locale{ "C" } );
+			stream << std::fixed << std::setprecision( 3 )
+				<< ( round / double( names.size() ) ) << " ns";
+			common::printMeasure( name + ", per lookup"
+				, stream.str() );
+			return resolved;
+		}
+	}
+
+	RenderPanel::RenderPanel( wxWindow * parent
+		, wxSize const & size
+		, utils::Instance const & instance )
+		: wxPanel{ parent, wxID_ANY, wxDefaultPosition, size }
+	{
+		try
+		{
+			auto surface = doCreateSurface( instance );
+			std::cout << "Surface created." << std::endl;
+			doCreateDevice( instance, *surface );
+			std::cout << "Logical device created." << std::endl;
+			doBenchmark( instance );
+		}
+		catch ( common::Exception & )
+		{
+			doCleanup();
+			throw;
+		}
+	}
+
+	RenderPanel::~RenderPanel()noexcept
+	{
+		doCleanup();
+	}
+
+	void RenderPanel::doCleanup()noexcept
+	{
+		if ( m_device )
+		{
+			m_device->getDevice().waitIdle();
+			m_device.reset();
+		}
+	}
+
+	ashes::SurfacePtr RenderPanel::doCreateSurface( utils::Instance const & instance )
+	{
+		auto handle = common::makeWindowHandle( *this );
+		auto const & gpu = instance.getPhysicalDevice( 0u );
+		return instance.getInstance().createSurface( gpu
+			, std::move( handle ) );
+	}
+
+	void RenderPanel::doCreateDevice( utils::Instance const & instance
+		, ashes::Surface const & surface )
+	{
+		m_device = std::make_unique< utils::Device >( instance.getInstance()
+			, surface );
+	}
+
+	void RenderPanel::doBenchmark( utils::Instance const & instance )
+	{
+		VkInstance instanceHandle = instance.getInstance();
+		auto & device = m_device->getDevice();
+		VkDevice deviceHandle = device;
+		auto getDeviceProcAddr = device.vkGetDeviceProcAddr;
+
+		auto instanceResolved = resolveAll( "vkGetInstanceProcAddr"
+			, InstanceFunctions
+			, [instanceHandle]( char const * name )
+			{
+				return vkGetInstanceProcAddr( instanceHandle, name );
+			} );
+		common::printMeasure( "vkGetInstanceProcAddr, resolved"
+			, std::to_string( instanceResolved ) + "/" + std::to_string( InstanceFunctions.size() ) );
+		auto deviceResolved = resolveAll( "vkGetDeviceProcAddr"
+			, DeviceFunctions
+			, [deviceHandle, getDeviceProcAddr]( char const * name )
+			{
+				return getDeviceProcAddr( deviceHandle, name );
+			} );
+		common::printMeasure( "vkGetDeviceProcAddr, resolved"
+			, std::to_string( deviceResolved ) + "/" + std::to_string( DeviceFunctions.size() ) );
+	}
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "Prerequisites.hpp"
+
+#include <ashespp/Core/Device.hpp>
+
+#include <wx/panel.h>
+
+namespace vkapp
+{
+	/**
+	*\brief
+	*	Measures the resolution of the whole functions list, through vkGetInstanceProcAddr and vkGetDeviceProcAddr.
+	*/
+	class RenderPanel
+		: public wxPanel
+	{
+	public:
+		RenderPanel( wxWindow * parent
+			, wxSize const & size
+			, utils::Instance const & instance );
+		~RenderPanel()noexcept override;
+
+	private:
+		void doCleanup()noexcept;
+		ashes::SurfacePtr doCreateSurface( utils::Instance const & instance );
+		void doCreateDevice( utils::Instance const & instance
+			, ashes::Surface const & surface );
+		void doBenchmark( utils::Instance const & instance );
+
+	private:
+		utils::DevicePtr m_device;
+	};
+}
@@ -0,0 +1,139 @@
+#include "RenderPanel.hpp"
+
+#include "Application.hpp"
+#include "MainFrame.hpp"
+
+#include <ashespp/Buffer/Buffer.hpp>
+#include <ashespp/Core/Surface.hpp>
+#include <ashespp/Sync/Fence.hpp>
+#include <ashespp/Sync/Semaphore.hpp>
+
+#include <Benchmark.hpp>
+
+#include <array>
+#include <exception>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+namespace vkapp
+{
+	namespace
+	{
+		std::array< uint32_t, 4u > const ThreadCounts{ 1u, 2u, 4u, 8u };
+		uint32_t const ChurnsPerThread = 10000u;
+		uint32_t const Rounds = 3u;
+	}
+
+	RenderPanel::RenderPanel( wxWindow * parent
+		, wxSize const & size
+		, utils::Instance const & instance )
+		: wxPanel{ parent, wxID_ANY, wxDefaultPosition, size }
+	{
+		try
+		{
+			auto surface = doCreateSurface( instance );
+			std::cout << "Surface created." << std::endl;
+			doCreateDevice( instance, *surface );
+			std::cout << "Logical device created." << std::endl;
+			doBenchmark();
+		}
+		catch ( common::Exception & )
+		{
+			doCleanup();
+			throw;
+		}
+	}
+
+	RenderPanel::~RenderPanel()noexcept
+	{
+		doCleanup();
+	}
+
+	void RenderPanel::doCleanup()noexcept
+	{
+		if ( m_device )
+		{
+			m_device->getDevice().waitIdle();
+			m_device.reset();
+		}
+	}
+
+	ashes::SurfacePtr RenderPanel::doCreateSurface( utils::Instance const & instance )
+	{
+		auto handle = common::makeWindowHandle( *this );
+		auto const & gpu = instance.getPhysicalDevice( 0u );
+		return instance.getInstance().createSurface( gpu
+			, std::move( handle ) );
+	}
+
+	void RenderPanel::doCreateDevice( utils::Instance const & instance
+		, ashes::Surface const & surface )
+	{
+		m_device = std::make_unique< utils::Device >( instance.getInstance()
+			, surface );
+	}
+
+	void RenderPanel::doChurn()const
+	{
+		auto & device = m_device->getDevice();
+
+		for ( uint32_t i = 0u; i < ChurnsPerThread; ++i )
+		{
+			auto fence = device.createFence();
+			auto semaphore = device.createSemaphore();
+			auto buffer = device.createBuffer( 256u
+				, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT );
+		}
+	}
+
+	void RenderPanel::doBenchmark()
+	{
+		for ( auto threadCount : ThreadCounts )
+		{
+			auto name = std::to_string( threadCount ) + " thread(s)";
+			auto round = common::benchmark( name + ", " + std::to_string( ChurnsPerThread ) + " churns each"
+				, Rounds
+				, [this, threadCount]( uint32_t )
+				{
+					std::vector< std::exception_ptr > errors( threadCount );
+					std::vector< std::thread > threads;
+
+					for ( uint32_t index = 0u; index < threadCount; ++index )
+					{
+						threads.emplace_back( [this, &errors, index]()
+							{
+								try
+								{
+									doChurn();
+								}
+								catch ( ... )
+								{
+									errors[index] = std::current_exception();
+								}
+							} );
+					}
+
+					for ( auto & thread : threads )
+					{
+						thread.join();
+					}
+
+					for ( auto & error : errors )
+					{
+						if ( error )
+						{
+							std::rethrow_exception( error );
+						}
+					}
+				} );
+			// One churn creates and destroys three objects.
+			std::stringstream stream;
+			stream.imbue( std::locale{ "C" } );
+			stream << std::fixed << std::setprecision( 3 )
+				<< ( round / ( double( threadCount ) * ChurnsPerThread * 3u ) ) << " ns";
+			common::printMeasure( name + ", wall time per object create/destroy"
+				, stream.str() );
+		}
+	}
+}
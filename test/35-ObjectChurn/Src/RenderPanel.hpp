@@ -0,0 +1,36 @@
+#pragma once
+
+#include "Prerequisites.hpp"
+
+#include <ashespp/Core/Device.hpp>
+
+#include <wx/panel.h>
+
+namespace vkapp
+{
+	/**
+	*\brief
+	*	Measures the creation and destruction of transient objects (fences, semaphores, buffers),
+	*	from an increasing count of threads.
+	*/
+	class RenderPanel
+		: public wxPanel
+	{
+	public:
+		RenderPanel( wxWindow * parent
+			, wxSize const & size
+			, utils::Instance const & instance );
+		~RenderPanel()noexcept override;
+
+	private:
+		void doCleanup()noexcept;
+		ashes::SurfacePtr doCreateSurface( utils::Instance const & instance );
+		void doCreateDevice( utils::Instance const & instance
+			, ashes::Surface const & surface );
+		void doChurn()const;
+		void doBenchmark();
+
+	private:
+		utils::DevicePtr m_device;
+	};
+}